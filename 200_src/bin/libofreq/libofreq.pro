@@ -0,0 +1,52 @@
+#-------------------------------------------------
+#
+# Linkable library of the ofreq solver.
+# Programs that embed the solver link against this library and use the OfreqEngine class.
+#
+#-------------------------------------------------
+
+QT       += core
+
+QT       -= gui
+
+TARGET = ofreq
+CONFIG   += staticlib
+
+TEMPLATE = lib
+
+# Force C++11 build.  Required by the ofreq sources.
+QMAKE_CXXFLAGS += -std=c++11
+
+# Solver sources shared with the other programs.  Includes the OfreqEngine interface.
+include(../ofreq/ofreq.pri)
+
+# Include header files path for libraries
+INCLUDEPATH += \
+    $$_PRO_FILE_PWD_/../../lib \
+    $$_PRO_FILE_PWD_/../../var \
+    $$_PRO_FILE_PWD_/../../lib/alglib \
+
+# force rebuild if the headers change
+DEPENDPATH += $${INCLUDEPATH} \
+    $$_PRO_FILE_PWD_/../../lib/alglib
+
+
+# Platform Specific files go in these scope brackets
+# ========================================================
+win32 {
+    # Any files specific to windows go in these brackets.
+    CONFIG(debug) {
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/libofreq/debug
+    }
+
+    CONFIG(release) {
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/libofreq/release
+    }
+
+}
+
+unix {
+    # Any files specific to linux go in these brackets.
+    # Programs linking the library also link armadillo, lapack, blas and alglib.
+    DESTDIR = $$PWD/../../../300_build/320_build_linux/lib/libofreq
+}
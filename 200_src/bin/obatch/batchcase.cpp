@@ -0,0 +1,267 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "batchcase.h"
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/motion_solver/dragsolver.h"
+#include "../ofreq/global_objects/solution.h"
+#include "../ofreq/global_objects/solutionset.h"
+#include "../ofreq/file_reader/filereader.h"
+#include "../ofreq/file_reader/dictcontrol.h"
+#include "../ofreq/file_reader/dictforces.h"
+#include "../ofreq/file_reader/dictbodies.h"
+#include "../ofreq/file_reader/dictseaenv.h"
+#include "../ofreq/file_reader/dictdata.h"
+#include "../ofreq/file_reader/dictoutputs.h"
+#include <QDir>
+#include <stdexcept>
+
+using namespace std;
+using namespace osea::ofreq;
+using namespace osea::obatch;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BatchCase::BatchCase()
+{
+    pCasePath = "";
+    pOutputPath = "";
+    pHeaderPath = "";
+    pCost = 1.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BatchCase::~BatchCase()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchCase::setCasePath(string pathIn)
+{
+    pCasePath = pathIn;
+
+    if (pOutputPath.empty())
+        pOutputPath = pathIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string BatchCase::getCasePath()
+{
+    return pCasePath;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchCase::setOutputPath(string pathIn)
+{
+    pOutputPath = pathIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string BatchCase::getOutputPath()
+{
+    return pOutputPath;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchCase::setHeaderPath(string pathIn)
+{
+    pHeaderPath = pathIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchCase::addFactor(string forceIn, double factorIn)
+{
+    plistForceName.push_back(forceIn);
+    plistFactor.push_back(factorIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchCase::estimateCost()
+{
+    try
+    {
+        //Read only the control file.  It defines the wave directions and wave frequencies.
+        System sysCase;
+        FileReader fileIn;
+        dictControl dictCont;
+
+        fileIn.setSystem(&sysCase);
+        dictCont.setSystem(&sysCase);
+        fileIn.setPath(pCasePath);
+        fileIn.setDictionary(dictCont);
+        fileIn.readControl();
+
+        //One solution for each wave direction and wave frequency.
+        int nDir = sysCase.listWaveDirections().size();
+        int nFreq = sysCase.listWaveFrequencies().size();
+
+        pCost = static_cast<double>(nDir > 1 ? nDir : 1) * static_cast<double>(nFreq > 1 ? nFreq : 1);
+    }
+    catch(const std::exception &err)
+    {
+        //Unknown cost.  Schedule the case with the default cost.
+        pCost = 1.0;
+        logErr.Write(ID + std::string(err.what()), 1);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double BatchCase::getCost()
+{
+    return pCost;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool BatchCase::run(HydroCache &cacheIn)
+{
+    try
+    {
+        //Each case has its own System object.  Nothing in it is shared with other cases.
+        System sysCase;
+        sysCase.setPath(pCasePath);
+
+        //Read input files and interpret data.
+        //---------------------------------------------------------------------------
+        FileReader fileIn;                  //Create file reading objects
+        dictBodies dictBod;                 //Create dictionary object for bodies.in
+        dictForces dictForce;               //Create dictionary object for forces.in
+        dictControl dictCont;               //Create dictionary object for control.in
+        dictSeaEnv dictSea;                 //Create dictionary object for seaenv.in
+        dictData dictDat(&fileIn);          //Create dictionary object for data.in
+        dictOutputs dictOut;                //Create dictionary object for outputs.in
+
+        fileIn.setSystem(&sysCase);
+        dictBod.setSystem(&sysCase);
+        dictForce.setSystem(&sysCase);
+        dictCont.setSystem(&sysCase);
+        dictSea.setSystem(&sysCase);
+        dictDat.setSystem(&sysCase);
+        dictOut.setSystem(&sysCase);
+
+        fileIn.setPath(pCasePath);
+
+        //Sequence of file reading is important.  Same as ofreq.
+        fileIn.setDictionary(dictCont);
+        fileIn.readControl();
+        fileIn.setDictionary(dictSea);
+        fileIn.readSeaEnv();
+        fileIn.setDictionary(dictForce);
+        fileIn.readForces();
+        fileIn.setDictionary(dictBod);
+        fileIn.readBodies();
+        fileIn.setDictionary(dictDat);
+        fileIn.readData();
+        fileIn.setDictionary(dictOut);
+        fileIn.readOutputs();
+
+        sysCase.SearchActiveSeaModel();
+
+        //Hydrodynamic data comes from the shared cache.
+        for (unsigned int i = 0; i < fileIn.listDataFiles().size(); i++)
+            cacheIn.load(&sysCase, fileIn.listDataFiles(i));
+
+        sysCase.setActiveSeaModel();
+        sysCase.resolveIndex();
+        sysCase.resampleHydro();
+        sysCase.applyFarField();
+
+        //Apply the factors for a parameter table row.
+        //---------------------------------------------------------------------------
+        for (unsigned int i = 0; i < plistForceName.size(); i++)
+        {
+            bool found = false;
+
+            for (unsigned int k = 0; k < sysCase.listForceReact_user().size(); k++)
+            {
+                if (sysCase.listForceReact_user(k).getForceName() == plistForceName.at(i))
+                {
+                    sysCase.listForceReact_user(k).scaleCoefficient(plistFactor.at(i));
+                    found = true;
+                }
+            }
+
+            for (unsigned int k = 0; k < sysCase.listForceCross_user().size(); k++)
+            {
+                if (sysCase.listForceCross_user(k).getForceName() == plistForceName.at(i))
+                {
+                    sysCase.listForceCross_user(k).scaleCoefficient(plistFactor.at(i));
+                    found = true;
+                }
+            }
+
+            if (!found)
+                throw std::runtime_error("Parameter table force does not match any user reactive force or user "
+                                         "cross-body force.  Offending force:  " + plistForceName.at(i));
+        }
+
+        //Reports go to the output directory.
+        QDir().mkpath(QString::fromStdString(pOutputPath));
+        sysCase.setPath(pOutputPath);
+        sysCase.refReportManager().clearFiles();
+
+        //Resize the solution object.
+        for (unsigned int i = 0; i < sysCase.listBody().size(); i++)
+        {
+            sysCase.listSolutionSet().push_back(SolutionSet(sysCase.listWaveDirections().size(),
+                                                sysCase.listWaveFrequencies().size()));
+        }
+
+        //Linearize the quadratic drag forces.
+        //---------------------------------------------------------------------------
+        DragSolver drag;
+        drag.setSystem(&sysCase);
+        drag.solve();
+
+        //Iterate through each wave direction and wave frequency to solve
+        //---------------------------------------------------------------------------
+        sysCase.solveSweep(true);
+
+        //Write outputs
+        //---------------------------------------------------------------------------
+        sysCase.refReportManager().setHeader(pHeaderPath);
+        sysCase.refReportManager().writeReport();
+
+        return true;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + string("Case:  ") + pOutputPath + string("\n") + std::string(err.what()), 1);
+        return false;
+    }
+}
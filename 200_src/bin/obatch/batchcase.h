@@ -0,0 +1,189 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef BATCHCASE_H
+#define BATCHCASE_H
+#include <string>
+#include <vector>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "hydrocache.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with obatch.
+ */
+namespace obatch
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The BatchCase is a single ofreq run inside a batch.  It reads the input files of one case directory, solves the
+ * equations of motion for every wave direction and wave frequency, and writes the reports.  It uses the same System,
+ * MotionSolver and ReportManager objects as ofreq.  Each run creates its own System object, so several cases can run
+ * at the same time on separate threads.  The hydrodynamic databases come from a HydroCache shared by all cases.
+ *
+ * A case may also be one row of a parameter table.  Then the named user forces are scaled by the factors in that row
+ * before solving, and the reports are written to a separate output directory.
+ */
+class BatchCase : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    BatchCase();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~BatchCase();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the directory with the input files of the case.  Also sets the output directory, if none was set.
+     * @param pathIn String.  The case directory.  Variable passed by value.
+     */
+    void setCasePath(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the directory with the input files of the case.
+     * @return String.  The case directory.  Returned variable passed by value.
+     */
+    std::string getCasePath();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the directory the reports are written to.
+     * @param pathIn String.  The output directory.  Created if it does not exist.  Variable passed by value.
+     */
+    void setOutputPath(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the directory the reports are written to.
+     * @return String.  The output directory.  Returned variable passed by value.
+     */
+    std::string getOutputPath();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the directory with the header file for output reports.
+     * @param pathIn String.  The directory of the header file.  Variable passed by value.
+     */
+    void setHeaderPath(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a scale factor for one user force.  Used for cases from a parameter table.
+     * @param forceIn String.  The name of a user reactive force or user cross-body force.  Variable passed by value.
+     * @param factorIn Double.  The factor to scale all coefficients of the force by.  Variable passed by value.
+     */
+    void addFactor(std::string forceIn, double factorIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Estimates the cost of the case, for scheduling.  Only reads the control file.  The estimate is the
+     * number of wave directions times the number of wave frequencies.  Each of these points needs one solution of the
+     * equations of motion.
+     */
+    void estimateCost();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the estimated cost of the case.  Call estimateCost() first.
+     * @return Double.  The estimated cost.  Returned variable passed by value.
+     */
+    double getCost();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Runs the case.  Any error is written to the error log and stops this case only.
+     * @param cacheIn The shared hydrodynamic data.  Variable passed by reference.
+     * @return Boolean.  True if the case completed.  Returned variable passed by value.
+     */
+    bool run(HydroCache &cacheIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pCasePath; /**< Directory with the input files. */
+    std::string pOutputPath; /**< Directory the reports are written to. */
+    std::string pHeaderPath; /**< Directory with the header file for output reports. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<std::string> plistForceName; /**< Names of the scaled user forces. */
+    std::vector<double> plistFactor; /**< Scale factor for each entry in plistForceName. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pCost; /**< Estimated cost of the case. */
+};
+
+}   //Namespace obatch
+}   //Namespace osea
+
+#endif // BATCHCASE_H
@@ -0,0 +1,151 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "batchscheduler.h"
+#include <algorithm>
+#include <thread>
+
+using namespace std;
+using namespace osea::obatch;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BatchScheduler::BatchScheduler()
+{
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+
+    pNext = 0;
+    pDone = 0;
+    pFailed = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BatchScheduler::~BatchScheduler()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchScheduler::addCase(BatchCase caseIn)
+{
+    plistCase.push_back(caseIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<BatchCase> &BatchScheduler::listCase()
+{
+    return plistCase;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchScheduler::setThreads(int threadsIn)
+{
+    pThreads = (threadsIn < 1) ? 1 : threadsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BatchScheduler::getThreads()
+{
+    return pThreads;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BatchScheduler::run()
+{
+    //Estimate the cost of each case and start the longest cases first.
+    plistOrder.clear();
+    for (unsigned int i = 0; i < plistCase.size(); i++)
+    {
+        plistCase.at(i).estimateCost();
+        plistOrder.push_back(i);
+    }
+
+    std::stable_sort(plistOrder.begin(), plistOrder.end(),
+                     [this](int a, int b) {return plistCase.at(a).getCost() > plistCase.at(b).getCost();});
+
+    pNext = 0;
+    pDone = 0;
+    pFailed = 0;
+
+    //No point in more threads than cases.
+    int nThreads = pThreads;
+    if (nThreads > static_cast<int>(plistCase.size()))
+        nThreads = plistCase.size();
+
+    logStd.Write("Running " + itoa(plistCase.size()) + " cases on " + itoa(nThreads) + " threads", 3);
+
+    //Each database read gets its share of the processor cores, so the readers do not oversubscribe the pool.
+    int nCores = static_cast<int>(std::thread::hardware_concurrency());
+    pCache.setThreads(max(1, nCores / max(1, nThreads)));
+
+    vector<std::thread> listThread;
+    for (int i = 0; i < nThreads; i++)
+        listThread.push_back(std::thread(&BatchScheduler::runWorker, this));
+
+    for (unsigned int i = 0; i < listThread.size(); i++)
+        listThread.at(i).join();
+
+    logStd.Write("Hydrodynamic databases read:  " + itoa(pCache.getNumLoaded()), 3);
+
+    return pFailed;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BatchScheduler::runWorker()
+{
+    while (true)
+    {
+        int pos = pNext++;
+        if (pos >= static_cast<int>(plistOrder.size()))
+            break;
+
+        BatchCase &curCase = plistCase.at(plistOrder.at(pos));
+
+        bool success = curCase.run(pCache);
+        if (!success)
+            pFailed++;
+
+        int done = ++pDone;
+        logMon.Write(itoa(done) + "       \t" + itoa(plistCase.size()) + "        \t"
+                     + (success ? string("done    ") : string("failed  ")) + "\t" + curCase.getOutputPath(), 3);
+    }
+}
@@ -0,0 +1,166 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef BATCHSCHEDULER_H
+#define BATCHSCHEDULER_H
+#include <vector>
+#include <atomic>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "batchcase.h"
+#include "hydrocache.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with obatch.
+ */
+namespace obatch
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The BatchScheduler runs a list of batch cases on a pool of threads.  All cases share one HydroCache, so each
+ * hydrodynamic database is only read once.
+ *
+ * Cases are started in order of decreasing estimated cost.  Each thread takes the next case from the list as soon as
+ * it finishes the previous one.  Starting the longest cases first keeps one long case from running alone at the end
+ * of the batch.
+ */
+class BatchScheduler : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.  The number of threads defaults to the number of hardware threads.
+     */
+    BatchScheduler();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~BatchScheduler();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a case to the batch.
+     * @param caseIn The case to add.  Variable passed by value.
+     */
+    void addCase(BatchCase caseIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of cases in the batch.
+     * @return Reference to the list of cases.  Returned variable passed by reference.
+     */
+    std::vector<BatchCase> &listCase();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads used to run cases.
+     * @param threadsIn Integer.  The number of threads.  Values less than one use a single thread.  Variable passed
+     * by value.
+     */
+    void setThreads(int threadsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of threads used to run cases.
+     * @return Integer.  The number of threads.  Returned variable passed by value.
+     */
+    int getThreads();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Runs all cases in the batch.  Returns when every case has finished.
+     * @return Integer.  The number of cases that failed.  Returned variable passed by value.
+     */
+    int run();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The work loop of each thread.  Takes cases from the ordered list until none remain.
+     */
+    void runWorker();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<BatchCase> plistCase; /**< The list of cases in the batch. */
+    std::vector<int> plistOrder; /**< Indices of cases in the order they are started. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pThreads; /**< Number of threads used to run cases. */
+    std::atomic<int> pNext; /**< Position in plistOrder of the next case to start. */
+    std::atomic<int> pDone; /**< Number of cases finished. */
+    std::atomic<int> pFailed; /**< Number of cases that failed. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    HydroCache pCache; /**< Hydrodynamic data shared by all cases. */
+};
+
+}   //Namespace obatch
+}   //Namespace osea
+
+#endif // BATCHSCHEDULER_H
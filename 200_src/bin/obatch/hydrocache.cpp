@@ -0,0 +1,144 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "hydrocache.h"
+#include "../ofreq/hydro_reader/hydroreader.h"
+#include <QFileInfo>
+#include <QDir>
+#include <thread>
+
+using namespace std;
+using namespace osea::ofreq;
+using namespace osea::obatch;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HydroCache::HydroCache()
+{
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HydroCache::~HydroCache()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroCache::load(System *ptSystem, string pathIn)
+{
+    //Identify the database by its absolute path and by the System settings used while reading it.
+    pair<string, double> key(QDir::cleanPath(
+                                 QFileInfo(QString::fromStdString(pathIn)).absoluteFilePath()
+                                 ).toStdString(),
+                             ptSystem->getRecipTolerance());
+
+    {
+        std::unique_lock<std::mutex> lock(pMutex);
+
+        //Wait for any other case reading the same database.
+        while (plistLoading.count(key) > 0)
+            pReady.wait(lock);
+
+        //Copy the cached objects if the database was already read.
+        if (plistHydro.count(key) > 0)
+        {
+            for (unsigned int i = 0; i < plistHydro.at(key).size(); i++)
+                ptSystem->addHydroManager(plistHydro.at(key).at(i));
+
+            return;
+        }
+
+        //Mark the database as being read by this case.
+        plistLoading.insert(key);
+    }
+
+    //Read the database outside the lock, so other databases can be read at the same time.  The database is read
+    //into a separate System that only carries the settings in the key.  The whole database is read, so the bodies,
+    //wave directions, and wave frequencies of the case do not change the result.
+    vector<HydroManager> listNew;
+    bool valid = false;
+
+    try
+    {
+        System sysRead;
+        sysRead.setRecipTolerance(ptSystem->getRecipTolerance());
+
+        HydroReader hydroIn;
+        hydroIn.setSystem(&sysRead);
+        hydroIn.setThreads(pThreads);
+        hydroIn.setSelective(false);
+        hydroIn.setPath(pathIn);
+        valid = (hydroIn.readHydroSys() == 0);
+
+        listNew = sysRead.listHydroManager();
+    }
+    catch(const std::exception &err)
+    {
+        valid = false;
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+    }
+
+    //Store the result and release any waiting cases.  A failed read is not stored, so the next case tries again
+    //and reports its own error.
+    {
+        std::lock_guard<std::mutex> lock(pMutex);
+        if (valid)
+            plistHydro[key] = listNew;
+        plistLoading.erase(key);
+    }
+    pReady.notify_all();
+
+    for (unsigned int i = 0; valid && (i < listNew.size()); i++)
+        ptSystem->addHydroManager(listNew.at(i));
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroCache::getNumLoaded()
+{
+    std::lock_guard<std::mutex> lock(pMutex);
+    return plistHydro.size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroCache::setThreads(int threadsIn)
+{
+    pThreads = (threadsIn < 1) ? 1 : threadsIn;
+}
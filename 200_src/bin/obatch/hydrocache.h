@@ -0,0 +1,164 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef HYDROCACHE_H
+#define HYDROCACHE_H
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/hydro_data/hydromanager.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with obatch.
+ */
+namespace obatch
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The HydroCache holds the hydrodynamic databases read by all cases in a batch.  Each distinct database is read and
+ * parsed once, by the first case that needs it.  Every later case gets copies of the parsed HydroManager objects
+ * instead of reading the files again.  The cached objects are never changed after they are stored, so the cache is
+ * shared by all worker threads.  Each case works on its own copies, because the HydroManager keeps the results of
+ * the latest interpolation.
+ *
+ * If a second case asks for a database while the first case is still reading it, the second case waits until the
+ * read is finished.  Databases are identified by their absolute path and the reciprocity tolerance, the only System
+ * setting the HydroReader uses when it reads a whole database.  Each database is read into a separate System, so
+ * the other settings of the first case do not leak into the copies given to later cases.  A database that fails to
+ * read is not stored.
+ */
+class HydroCache : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    HydroCache();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~HydroCache();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the hydrodynamic data from one database to the System object.  Reads the database if it is not in
+     * the cache yet.  Otherwise copies the cached HydroManager objects.  Safe to call from several threads.
+     * @param ptSystem Pointer to the System object to add the data to.  Variable passed by value.
+     * @param pathIn The path of the hydrodynamic database, as listed in the data input file.  Variable passed by
+     * value.
+     */
+    void load(ofreq::System *ptSystem, std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of distinct databases read so far.
+     * @return Integer.  The number of databases in the cache.  Returned variable passed by value.
+     */
+    int getNumLoaded();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads each read of a database may use.  The cases already run on a pool of
+     * threads, so each read should only use its share of the processor cores.  Set before any case starts.
+     * @param threadsIn The number of threads for each database read.  Values below one are treated as one.
+     * Variable passed by value.
+     */
+    void setThreads(int threadsIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The parsed HydroManager objects for each database.  Keyed by the absolute path of the database and
+     * the reciprocity tolerance used to read it.
+     */
+    std::map< std::pair<std::string, double>, std::vector<ofreq::HydroManager> > plistHydro;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::set< std::pair<std::string, double> > plistLoading; /**< Databases currently being read by a case. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pThreads; /**< Number of threads each database read may use. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::mutex pMutex; /**< Protects the lists of databases. */
+    std::condition_variable pReady; /**< Signals when a database finished reading. */
+};
+
+}   //Namespace obatch
+}   //Namespace osea
+
+#endif // HYDROCACHE_H
@@ -0,0 +1,404 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Include Statements ########################################################
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "batchcase.h"
+#include "batchscheduler.h"
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <stdexcept>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    //----------- Windows Inclusions ------------
+    #include <windows.h>
+#elif defined Q_OS_LINUX
+    //----------- Linux Inclusions ------------
+    #include <unistd.h>
+#endif
+
+//########################################## Global Variables #########################################################
+//Namespaces
+using namespace osea;
+using namespace osea::ofreq;
+using namespace osea::obatch;
+using namespace std;
+
+//########################################## Global Variables #########################################################
+
+//System object.  Only used to set up the log files.  Each case has its own System object.
+System sysobatch;
+
+//Name of executable file itself
+const std::string EXECNAME = "obatch";
+
+//Name of executable folder.  Specific to the obatch executable.
+const std::string EXECFOLDER = "obatch";
+
+//Name of var folder.
+const std::string VARFOLDER = "var";
+
+//Name of lib folder
+const std::string LIBFOLDER = "lib";
+
+//Name of etc folder
+const std::string ETCFOLDER = "etc";
+
+//Name of binaries folder
+const std::string BINFOLDER = "bin";
+
+//Command line option to set the number of threads.
+const std::string ARG_THREADS = "--threads";
+
+//Name of the directory, under each case directory, for reports of each row of a parameter table.
+const std::string BATCHFOLDER = "batch";
+
+//Character that starts a comment in the list file and the parameter table.
+const char COMMENT = '#';
+
+//######################################### Function Prototypes #######################################################
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * Finds the path of one of four possible folders that are critical to the oSea program.  Includes platform
+ * dependant code so that this function should work both under Windows or Linux.
+ * @param typePath String that specifies which path to get.  Options are:
+ * "exec":      Path to the directory of the executable file.  NOT the directory the program was called from.
+ * "lib":       Path to the lib directory that is common to all oSea programs.
+ * "var":       Path to the var directory that is common to all oSea programs.
+ * "etc":       Path to the etc directory that is common to all oSea programs.
+ * "bin":       Path to the binaries directory.  Binaries for individual programs are included in sub folders.
+ * @return Returns std::string that is the full absolute path to the specified .  Returned variable passed by
+ * value.
+ */
+std::string getPath(std::string typePath = "exec");
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Splits a line of the list file or parameter table into words.  Blank lines and comments give no words.
+ * @param lineIn String.  The line to split.  Variable passed by value.
+ * @return Vector of strings.  The words of the line.  Returned variable passed by value.
+ */
+vector<string> splitLine(string lineIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Resolves a path from the list file.  Relative paths are relative to the directory of the list file.
+ * @param pathIn String.  The path from the list file.  Variable passed by value.
+ * @param baseIn String.  The directory of the list file.  Variable passed by value.
+ * @return String.  The absolute path.  Returned variable passed by value.
+ */
+string resolvePath(string pathIn, string baseIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Reads the list file and adds a batch case to the scheduler for each case.
+ *
+ * Each line of the list file names one case directory.  A second word on the line names a parameter table.  Then
+ * one case is added for each row of the table.  The first line of the table holds the word "name", followed by the
+ * names of the user forces to scale.  Each following line holds the name of the row, followed by one factor for each
+ * force.  The reports of each row are written to the directory batch/<name> under the case directory.
+ * @param fileIn String.  The path of the list file.  Variable passed by value.
+ * @param schedIn The scheduler to add cases to.  Variable passed by reference.
+ */
+void readList(string fileIn, BatchScheduler &schedIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Reads a parameter table and adds a batch case to the scheduler for each row of the table.
+ * @param fileIn String.  The path of the parameter table.  Variable passed by value.
+ * @param caseIn String.  The case directory.  Variable passed by value.
+ * @param schedIn The scheduler to add cases to.  Variable passed by reference.
+ */
+void readTable(string fileIn, string caseIn, BatchScheduler &schedIn);
+
+//########################################### Main Function ###########################################################
+/**
+ * @brief The main function that runs obatch program.
+ *
+ * obatch runs many ofreq cases inside a single process.  The usage is:
+ * obatch <list file> [--threads N]
+ * 1.  Read the list file and any parameter tables.  Build one batch case for each ofreq run.
+ * 2.  Estimate the cost of each case from its control file.
+ * 3.  Run the cases on a pool of threads, longest cases first.  Each hydrodynamic database is read only once and
+ *     shared by all cases that use it.
+ * 4.  Each case writes its own reports.  Errors in one case do not stop the other cases.
+ *
+ * The log files are written in the directory of the list file.
+ */
+int main(int argc, char *argv[])
+{
+    //Main Input Section
+    //=================================================================================================================
+    string listPath = "";
+    int nThreads = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (string(argv[i]) == ARG_THREADS && i + 1 < argc)
+            nThreads = atoi(argv[++i]);
+        else
+            listPath = argv[i];
+    }
+
+    if (listPath.empty())
+    {
+        cerr << "Usage:  " << EXECNAME << " <list file> [" << ARG_THREADS << " N]" << endl;
+        return 1;
+    }
+
+    listPath = QFileInfo(QString::fromStdString(listPath)).absoluteFilePath().toStdString();
+
+    //Setup the output log files
+    //---------------------------------------------------------------------------
+    sysobatch.setLogFiles(QFileInfo(QString::fromStdString(listPath)).absolutePath().toStdString());
+    sysobatch.logStd.cls();
+
+    BatchScheduler scheduler;
+    int nFailed = 0;
+
+    try
+    {
+        //Read the list of cases
+        //---------------------------------------------------------------------------
+        sysobatch.logStd.Write("Reading case list", 3);
+        readList(listPath, scheduler);
+
+        if (nThreads > 0)
+            scheduler.setThreads(nThreads);
+
+        //Run all cases
+        //---------------------------------------------------------------------------
+        nFailed = scheduler.run();
+
+        if (nFailed > 0)
+            sysobatch.logStd.Write(sysobatch.itoa(nFailed) + " cases failed.  Please check the error log.", 3);
+
+        sysobatch.logStd.Write("obatch complete", 3);
+    }
+    catch(const std::exception &err)
+    {
+        sysobatch.logStd.Notify();
+        sysobatch.logErr.Write(ID + std::string(err.what()));
+        return 1;
+    }
+
+    return (nFailed > 0) ? 1 : 0;
+}
+
+//######################################## getPath Function ###########################################################
+std::string getPath(string typePath)
+{
+    std::string output;     //Output of full path
+    char buff[1024];        //Buffer for reading path
+
+    //First get executable path.  Includes dependancy code for both windows and linux.
+    #ifdef Q_OS_WIN
+    //----------------------------------- Windows Code ----------------------------------------------------------------
+    ssize_t len = GetModuleFileNameA(NULL, buff, sizeof(buff) - 1);
+    std::string SLASH = "\\";
+    #elif defined Q_OS_LINUX
+    //------------------------------------ Linux Code -----------------------------------------------------------------
+    ssize_t len = readlink("/proc/self/exe", buff, sizeof(buff) - 1);
+    std::string SLASH = "/";
+    #endif
+
+    //--------------------------- Platform Independent Code -----------------------------------------------------------
+    if (len != -1)
+    {
+        buff[len] = '\0';
+        output.assign(buff);
+    }
+    else
+    {
+        sysobatch.logErr.Write(string("Function:  obatch \n Error Message:  Could not find filepath for executable."));
+        sysobatch.logStd.Write("Errors found.  Please check the error log.",3);
+    }
+
+    //Strip off name of executable itself.
+    std::string strip = SLASH + EXECNAME;
+    output.erase(output.size() - strip.size(), strip.size());
+
+    //Strip back the name of the executable directory.
+    strip = BINFOLDER + SLASH + EXECFOLDER;
+    output.erase(output.size() - strip.size(), strip.size());
+
+    //Change output depending on which path was requested
+    if (typePath == "exec")
+    {
+        //Add on the executable path
+        output.append(BINFOLDER);
+        output.append(SLASH);
+        output.append(EXECFOLDER);
+    }
+    else if (typePath == "bin")
+    {
+        //Add on the binary folder
+        output.append(BINFOLDER);
+    }
+    else if (typePath == "lib")
+    {
+        //Add on library path
+        output.append(LIBFOLDER);
+    }
+    else if (typePath == "var")
+    {
+        //Add on variable folder
+        output.append(VARFOLDER);
+    }
+    else if (typePath == "etc")
+    {
+        //Add on etc folder
+        output.append(ETCFOLDER);
+    }
+
+    //Write output
+    return output;
+}
+
+//######################################## splitLine Function #########################################################
+vector<string> splitLine(string lineIn)
+{
+    vector<string> output;
+
+    //Strip comments
+    size_t pos = lineIn.find(COMMENT);
+    if (pos != string::npos)
+        lineIn.erase(pos);
+
+    istringstream words(lineIn);
+    string word;
+    while (words >> word)
+        output.push_back(word);
+
+    return output;
+}
+
+//######################################## resolvePath Function #######################################################
+string resolvePath(string pathIn, string baseIn)
+{
+    QDir base(QString::fromStdString(baseIn));
+    return QDir::cleanPath(base.absoluteFilePath(QString::fromStdString(pathIn))).toStdString();
+}
+
+//######################################## readList Function ##########################################################
+void readList(string fileIn, BatchScheduler &schedIn)
+{
+    ifstream listInput(fileIn.c_str(), std::ios::in);
+    if (!listInput)
+        throw std::ios_base::failure("List file does not exist:  " + fileIn);
+
+    string base = QFileInfo(QString::fromStdString(fileIn)).absolutePath().toStdString();
+    string header = getPath("var");
+    string line;
+
+    while (getline(listInput, line))
+    {
+        vector<string> words = splitLine(line);
+        if (words.empty())
+            continue;
+
+        string casePath = resolvePath(words.at(0), base);
+
+        if (words.size() == 1)
+        {
+            BatchCase newCase;
+            newCase.setCasePath(casePath);
+            newCase.setHeaderPath(header);
+            schedIn.addCase(newCase);
+        }
+        else
+        {
+            readTable(resolvePath(words.at(1), base), casePath, schedIn);
+        }
+    }
+
+    if (schedIn.listCase().empty())
+        throw std::runtime_error("List file does not name any cases:  " + fileIn);
+}
+
+//######################################## readTable Function #########################################################
+void readTable(string fileIn, string caseIn, BatchScheduler &schedIn)
+{
+    ifstream tableInput(fileIn.c_str(), std::ios::in);
+    if (!tableInput)
+        throw std::ios_base::failure("Parameter table does not exist:  " + fileIn);
+
+    QDir caseDir(QString::fromStdString(caseIn));
+    string header = getPath("var");
+    vector<string> listForce;
+    string line;
+
+    while (getline(tableInput, line))
+    {
+        vector<string> words = splitLine(line);
+        if (words.empty())
+            continue;
+
+        //First line names the forces.
+        if (listForce.empty())
+        {
+            if (words.size() < 2)
+                throw std::runtime_error("Parameter table header must list at least one force:  " + fileIn);
+
+            listForce.assign(words.begin() + 1, words.end());
+            continue;
+        }
+
+        if (words.size() != listForce.size() + 1)
+            throw std::runtime_error("Parameter table row does not have one factor for each force.  Offending row:  "
+                                     + words.at(0) + "  in file:  " + fileIn);
+
+        BatchCase newCase;
+        newCase.setCasePath(caseIn);
+        newCase.setOutputPath(
+                    QDir::cleanPath(caseDir.absoluteFilePath(
+                                        QString::fromStdString(BATCHFOLDER + "/" + words.at(0)))).toStdString());
+        newCase.setHeaderPath(header);
+
+        for (unsigned int i = 0; i < listForce.size(); i++)
+            newCase.addFactor(listForce.at(i), atof(words.at(i + 1).c_str()));
+
+        schedIn.addCase(newCase);
+    }
+}
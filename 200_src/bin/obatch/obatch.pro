@@ -0,0 +1,75 @@
+#-------------------------------------------------
+#
+# Project created by QtCreator 2013-07-22T19:56:40
+#
+#-------------------------------------------------
+
+QT       += core
+
+QT       -= gui
+
+TARGET = obatch
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+# Force C++11 build.  Required by the ofreq sources and by std::thread.
+QMAKE_CXXFLAGS += -std=c++11
+
+SOURCES += obatch.cpp \
+    batchcase.cpp \
+    hydrocache.cpp \
+    batchscheduler.cpp
+
+HEADERS += \
+    batchcase.h \
+    hydrocache.h \
+    batchscheduler.h
+
+# Solver sources shared with the other programs.
+include(../ofreq/ofreq.pri)
+
+# Include header files path for libraries
+INCLUDEPATH += \
+    $$_PRO_FILE_PWD_/../../lib \
+    $$_PRO_FILE_PWD_/../../var \
+    $$_PRO_FILE_PWD_/../../lib/alglib \
+
+# force rebuild if the headers change
+DEPENDPATH += $${INCLUDEPATH} \
+    $$_PRO_FILE_PWD_/../../lib/alglib
+
+
+# Platform Specific files go in these scope brackets
+# ========================================================
+win32 {
+    # Any files specific to windows go in these brackets.
+    LIBS += \
+        $$_PRO_FILE_PWD_/../../lib/armadillo.h \        #Add armadillo and associated support
+        $$_PRO_FILE_PWD_/../../lib/blas_win32_MT.lib \
+        $$_PRO_FILE_PWD_/../../lib/lapack_win32_MT.lib
+    #LIBS += boost_system boost_filesystem   # Add boost and boost filesystem
+    CONFIG(debug) {
+        LIBS += -L$$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/alglib/debug/ -lalglib
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/bin/obatch
+    }
+
+    CONFIG(release) {
+        LIBS += -L$$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/alglib/release/ -lalglib
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/bin/obatch
+    }
+
+}
+
+unix {
+    # Any files specific to linux go in these brackets.
+    LIBS += -larmadillo -llapack -lblas #Add armadillo and associated support
+    #LIBS += -lboost_system -lboost_filesystem   # Add boost and boost filesystem
+    LIBS += -L$$PWD/../../../300_build/320_build_linux/lib/alglib/ -lalglib #AGLIB library for interpolation.
+    QMAKE_CXXFLAGS += -pthread
+    LIBS += -pthread                 #Thread pool for running cases.
+}
+
+OTHER_FILES += \
+    ../../var/openseaheader.txt
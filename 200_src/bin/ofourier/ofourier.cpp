@@ -0,0 +1,352 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Include Statements ########################################################
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "timeseriesreader.h"
+#include "welchspectrum.h"
+#include "repspectrum.h"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+#include <iostream>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    //----------- Windows Inclusions ------------
+    #include <windows.h>
+#elif defined Q_OS_LINUX
+    //----------- Linux Inclusions ------------
+    #include <unistd.h>
+#endif
+
+//########################################## Global Variables #########################################################
+//Namespaces
+using namespace osea;
+using namespace osea::ofreq;
+using namespace osea::ofourier;
+using namespace std;
+
+//########################################## Global Variables #########################################################
+
+//System object.  Holds the spectral frequencies and the reports, so the ofreq ReportManager can write them.
+System sysofourier;
+
+//Name of executable file itself
+const std::string EXECNAME = "ofourier";
+
+//Name of executable folder.  Specific to the ofourier executable.
+const std::string EXECFOLDER = "ofourier";
+
+//Name of var folder.
+const std::string VARFOLDER = "var";
+
+//Name of lib folder
+const std::string LIBFOLDER = "lib";
+
+//Name of etc folder
+const std::string ETCFOLDER = "etc";
+
+//Name of binaries folder
+const std::string BINFOLDER = "bin";
+
+//Suffix of the default output directory.
+const std::string OUTSUFFIX = "_fourier";
+
+//Command line options.
+const std::string ARG_SEGMENT = "--nfft";       //Number of samples in each segment.
+const std::string ARG_OVERLAP = "--overlap";    //Fraction of overlap between segments.
+const std::string ARG_WINDOW = "--window";      //Window applied to each segment.
+const std::string ARG_THREADS = "--threads";    //Number of threads.
+const std::string ARG_REF = "--ref";            //Reference channel for transfer functions.
+const std::string ARG_BLOCK = "--block";        //Number of rows read at a time.
+const std::string ARG_OUT = "--out";            //Output directory.
+
+//######################################### Function Prototypes #######################################################
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * Finds the path of one of four possible folders that are critical to the oSea program.  Includes platform
+ * dependant code so that this function should work both under Windows or Linux.
+ * @param typePath String that specifies which path to get.  Options are:
+ * "exec":      Path to the directory of the executable file.  NOT the directory the program was called from.
+ * "lib":       Path to the lib directory that is common to all oSea programs.
+ * "var":       Path to the var directory that is common to all oSea programs.
+ * "etc":       Path to the etc directory that is common to all oSea programs.
+ * "bin":       Path to the binaries directory.  Binaries for individual programs are included in sub folders.
+ * @return Returns std::string that is the full absolute path to the specified .  Returned variable passed by
+ * value.
+ */
+std::string getPath(std::string typePath = "exec");
+
+//########################################### Main Function ###########################################################
+/**
+ * @brief The main function that runs ofourier program.
+ *
+ * ofourier calculates spectra of long time histories.  The usage is:
+ * ofourier <time history file> [--nfft N] [--overlap F] [--window hann|rect] [--threads N] [--ref channel]
+ *          [--block rows] [--out directory]
+ * 1.  Open the time history file.  Binary files are memory mapped.  Text files are streamed.
+ * 2.  Read the file in blocks.  Each block is split into overlapping segments, which are transformed on several
+ *     threads and averaged.  Only one block and one segment of samples are held in memory.
+ * 3.  Write the spectrum of each channel with the ofreq ReportManager, as directory d1/body1/spectrum.out under the
+ *     output directory.  The spectral frequencies are written to frequencies.out.
+ * 4.  If a reference channel is given, by label or by number, the transfer function from the reference channel to
+ *     each channel is written as the RAO data of each report.
+ *
+ * The default output directory is the name of the time history file, with _fourier appended.
+ */
+int main(int argc, char *argv[])
+{
+    //Main Input Section
+    //=================================================================================================================
+    string filePath = "";
+    string outPath = "";
+    string refName = "";
+    string windowName = "hann";
+    int nSegment = 1024;
+    double overlap = 0.5;
+    int nThreads = 0;
+    int nBlock = 65536;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg(argv[i]);
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == ARG_SEGMENT && hasValue)
+            nSegment = atoi(argv[++i]);
+        else if (arg == ARG_OVERLAP && hasValue)
+            overlap = atof(argv[++i]);
+        else if (arg == ARG_WINDOW && hasValue)
+            windowName = argv[++i];
+        else if (arg == ARG_THREADS && hasValue)
+            nThreads = atoi(argv[++i]);
+        else if (arg == ARG_REF && hasValue)
+            refName = argv[++i];
+        else if (arg == ARG_BLOCK && hasValue)
+            nBlock = atoi(argv[++i]);
+        else if (arg == ARG_OUT && hasValue)
+            outPath = argv[++i];
+        else
+            filePath = arg;
+    }
+
+    if (filePath.empty())
+    {
+        cerr << "Usage:  " << EXECNAME << " <time history file> [" << ARG_SEGMENT << " N] [" << ARG_OVERLAP
+             << " F] [" << ARG_WINDOW << " hann|rect] [" << ARG_THREADS << " N] [" << ARG_REF << " channel] ["
+             << ARG_BLOCK << " rows] [" << ARG_OUT << " directory]" << endl;
+        return 1;
+    }
+
+    QFileInfo fileInfo(QString::fromStdString(filePath));
+    if (outPath.empty())
+        outPath = (fileInfo.absolutePath() + "/" + fileInfo.completeBaseName()).toStdString() + OUTSUFFIX;
+
+    //Setup the output directory and log files
+    //---------------------------------------------------------------------------
+    QDir().mkpath(QString::fromStdString(outPath));
+    sysofourier.setPath(outPath);
+    sysofourier.setLogFiles(sysofourier.getPath());
+    sysofourier.logStd.cls();
+
+    try
+    {
+        //Open the time history.
+        //---------------------------------------------------------------------------
+        sysofourier.logStd.Write("Reading time history:  " + filePath, 3);
+        TimeSeriesReader reader;
+        reader.open(filePath);
+
+        WelchSpectrum welch;
+        welch.setSegment(nSegment);
+        welch.setOverlap(overlap);
+        welch.setWindow(windowName);
+        if (nThreads > 0)
+            welch.setThreads(nThreads);
+
+        //Reference channel, by label or by number starting from 1.
+        if (!refName.empty())
+        {
+            int ref = -1;
+            for (int c = 0; c < reader.getNumChannel(); c++)
+            {
+                if (reader.listLabel().at(c) == refName)
+                    ref = c;
+            }
+            if ((ref < 0) && (atoi(refName.c_str()) > 0))
+                ref = atoi(refName.c_str()) - 1;
+            if ((ref < 0) || (ref >= reader.getNumChannel()))
+                throw std::invalid_argument("Reference channel not found:  " + refName);
+
+            welch.setReference(ref);
+        }
+
+        //Stream the time history through the spectral estimate.
+        //---------------------------------------------------------------------------
+        arma::mat block;
+        long nRow = 0;
+        bool started = false;
+
+        while (reader.readBlock(nBlock, block) > 0)
+        {
+            if (!started)
+            {
+                if (block.n_rows < 2)
+                    throw std::runtime_error("Time history needs at least two rows.");
+                welch.start(reader.getNumChannel(), reader.getTimeStep());
+                started = true;
+            }
+
+            welch.addBlock(block);
+            nRow += block.n_rows;
+        }
+
+        if (!started)
+            throw std::runtime_error("Time history is empty:  " + filePath);
+
+        welch.finish();
+
+        sysofourier.logStd.Write("Samples:  " + sysofourier.itoa(nRow)
+                                 + "    Segments:  " + sysofourier.itoa(welch.getNumSegment()), 3);
+
+        //Write the spectra in the ofreq report format.
+        //---------------------------------------------------------------------------
+        sysofourier.listWaveFrequencies() = welch.listFreq();
+        sysofourier.listWaveDirections().push_back(0.0);
+
+        sysofourier.addBody();
+        sysofourier.listBody(0).setBodyName(fileInfo.completeBaseName().toStdString());
+
+        for (int c = 0; c < reader.getNumChannel(); c++)
+        {
+            repSpectrum *ptRep = new repSpectrum(&sysofourier.refReportManager());
+            ptRep->setBody(&sysofourier.listBody(0));
+            ptRep->setName(reader.listLabel().at(c));
+            ptRep->setSpectrum(welch.listSpectrum(c));
+            ptRep->setTransfer(welch.listTransfer(c));
+            sysofourier.refReportManager().addReport(ptRep);
+        }
+
+        sysofourier.refReportManager().clearFiles();
+        sysofourier.refReportManager().setHeader(getPath("var"));
+        sysofourier.refReportManager().writeReport();
+
+        sysofourier.logStd.Write("ofourier complete", 3);
+    }
+    catch(const std::exception &err)
+    {
+        sysofourier.logStd.Notify();
+        sysofourier.logErr.Write(ID + std::string(err.what()));
+        return 1;
+    }
+
+    return 0;
+}
+
+//######################################## getPath Function ###########################################################
+std::string getPath(string typePath)
+{
+    std::string output;     //Output of full path
+    char buff[1024];        //Buffer for reading path
+
+    //First get executable path.  Includes dependancy code for both windows and linux.
+    #ifdef Q_OS_WIN
+    //----------------------------------- Windows Code ----------------------------------------------------------------
+    ssize_t len = GetModuleFileNameA(NULL, buff, sizeof(buff) - 1);
+    std::string SLASH = "\\";
+    #elif defined Q_OS_LINUX
+    //------------------------------------ Linux Code -----------------------------------------------------------------
+    ssize_t len = readlink("/proc/self/exe", buff, sizeof(buff) - 1);
+    std::string SLASH = "/";
+    #endif
+
+    //--------------------------- Platform Independent Code -----------------------------------------------------------
+    if (len != -1)
+    {
+        buff[len] = '\0';
+        output.assign(buff);
+    }
+    else
+    {
+        sysofourier.logErr.Write(string("Function:  ofourier \n Error Message:  Could not find filepath for executable."));
+        sysofourier.logStd.Write("Errors found.  Please check the error log.",3);
+    }
+
+    //Strip off name of executable itself.
+    std::string strip = SLASH + EXECNAME;
+    output.erase(output.size() - strip.size(), strip.size());
+
+    //Strip back the name of the executable directory.
+    strip = BINFOLDER + SLASH + EXECFOLDER;
+    output.erase(output.size() - strip.size(), strip.size());
+
+    //Change output depending on which path was requested
+    if (typePath == "exec")
+    {
+        //Add on the executable path
+        output.append(BINFOLDER);
+        output.append(SLASH);
+        output.append(EXECFOLDER);
+    }
+    else if (typePath == "bin")
+    {
+        //Add on the binary folder
+        output.append(BINFOLDER);
+    }
+    else if (typePath == "lib")
+    {
+        //Add on library path
+        output.append(LIBFOLDER);
+    }
+    else if (typePath == "var")
+    {
+        //Add on variable folder
+        output.append(VARFOLDER);
+    }
+    else if (typePath == "etc")
+    {
+        //Add on etc folder
+        output.append(ETCFOLDER);
+    }
+
+    //Write output
+    return output;
+}
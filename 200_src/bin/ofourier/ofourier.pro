@@ -0,0 +1,76 @@
+#-------------------------------------------------
+#
+# Project created by QtCreator 2013-07-22T19:56:40
+#
+#-------------------------------------------------
+
+QT       += core
+
+QT       -= gui
+
+TARGET = ofourier
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+# Force C++11 build.  This is required by equantionofmotion.h and derived classes
+# These derived classes may implement lambda functions.
+QMAKE_CXXFLAGS += -std=c++11
+
+SOURCES += ofourier.cpp \
+    timeseriesreader.cpp \
+    welchspectrum.cpp \
+    repspectrum.cpp
+
+HEADERS += \
+    timeseriesreader.h \
+    welchspectrum.h \
+    repspectrum.h
+
+# Solver sources shared with the other programs.
+include(../ofreq/ofreq.pri)
+
+# Include header files path for libraries
+INCLUDEPATH += \
+    $$_PRO_FILE_PWD_/../../lib \
+    $$_PRO_FILE_PWD_/../../var \
+    $$_PRO_FILE_PWD_/../../lib/alglib \
+
+# force rebuild if the headers change
+DEPENDPATH += $${INCLUDEPATH} \
+    $$_PRO_FILE_PWD_/../../lib/alglib
+
+
+# Platform Specific files go in these scope brackets
+# ========================================================
+win32 {
+    # Any files specific to windows go in these brackets.
+    LIBS += \
+        $$_PRO_FILE_PWD_/../../lib/armadillo.h \        #Add armadillo and associated support
+        $$_PRO_FILE_PWD_/../../lib/blas_win32_MT.lib \
+        $$_PRO_FILE_PWD_/../../lib/lapack_win32_MT.lib
+    #LIBS += boost_system boost_filesystem   # Add boost and boost filesystem
+    CONFIG(debug) {
+        LIBS += -L$$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/alglib/debug/ -lalglib
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/bin/ofourier
+    }
+
+    CONFIG(release) {
+        LIBS += -L$$_PRO_FILE_PWD_/../../../300_build/310_build_windows/lib/alglib/release/ -lalglib
+        DESTDIR = $$_PRO_FILE_PWD_/../../../300_build/310_build_windows/bin/ofourier
+    }
+
+}
+
+unix {
+    # Any files specific to linux go in these brackets.
+    LIBS += -larmadillo -llapack -lblas #Add armadillo and associated support
+    #LIBS += -lboost_system -lboost_filesystem   # Add boost and boost filesystem
+    LIBS += -L$$PWD/../../../300_build/320_build_linux/lib/alglib/ -lalglib #AGLIB library for interpolation.
+    QMAKE_CXXFLAGS += -pthread
+    LIBS += -pthread                 #Threads for segment transforms.
+}
+
+OTHER_FILES += \
+    ../../var/openseaheader.txt
@@ -0,0 +1,121 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "repspectrum.h"
+
+using namespace std;
+using namespace osea::ofreq;
+using namespace osea::ofourier;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repSpectrum::repSpectrum()
+{
+    //Set the name for this report.
+    this->setName("Spectrum");
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repSpectrum::repSpectrum(ofreq::ReportManager *ptIn) : repSpectrum::repSpectrum()
+{
+    this->setManager(ptIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repSpectrum::~repSpectrum()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repSpectrum::setSpectrum(vector<double> specIn)
+{
+    plistSpectrum = specIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repSpectrum::setTransfer(vector< complex<double> > transIn)
+{
+    plistTransfer = transIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repSpectrum::calcReport(int freqInd)
+{
+    try
+    {
+        plistData.push_back(Data(freqInd));
+        plistData.back().addValue(plistSpectrum.at(freqInd));
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repSpectrum::calcRAO(int freqInd)
+{
+    if (plistTransfer.size() == 0)
+        return;
+
+    try
+    {
+        plistRAO.push_back(Data(freqInd));
+        plistRAO.back().addValue(plistTransfer.at(freqInd));
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string repSpectrum::getClass()
+{
+    return "repSpectrum";
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::string repSpectrum::getFileName()
+{
+    return "spectrum.out";
+}
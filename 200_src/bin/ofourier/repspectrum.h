@@ -0,0 +1,174 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+//Include statements and headers
+#ifndef REPSPECTRUM_H
+#define REPSPECTRUM_H
+#include <vector>
+#include <complex>
+#include "../ofreq/reports/report.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofourier.
+ */
+namespace ofourier
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * @brief Report of the spectrum of one channel of a time history.
+ *
+ * Written by ofourier in the same format as the reports of ofreq.  The data of each wave frequency holds the one sided
+ * spectrum, in units of the channel squared per rad/s.  If a reference channel was set, the RAO data holds the
+ * estimated transfer function from the reference channel.  This compares directly with the RAOs of ofreq.
+ */
+class repSpectrum : public ofreq::Report
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    repSpectrum();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.  Sets a pointer to the system object.
+     * @param ptIn Pointer to ReportManager object that owns this Report object, pointer passed by value.
+     */
+    repSpectrum(ofreq::ReportManager *ptIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~repSpectrum();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the spectrum of the channel.
+     * @param specIn Vector of doubles.  The spectrum at each wave frequency of the System.  Variable passed by
+     * value.
+     */
+    void setSpectrum(std::vector<double> specIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the transfer function of the channel.
+     * @param transIn Vector of complex doubles.  The transfer function at each wave frequency of the System.  Empty
+     * if there is no reference channel.  Variable passed by value.
+     */
+    void setTransfer(std::vector< std::complex<double> > transIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Generates the Report Data.
+     *
+     * Writes the spectrum at the wave frequency to the vector of Data values.
+     * @param freqInd Integer, variable passed by value.  The wave frequency index to use for calculating the Report
+     * object's data.
+     */
+    virtual void calcReport(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the RAO report data.
+     *
+     * Writes the transfer function at the wave frequency to the vector of RAO Data values.  Does nothing if there is
+     * no reference channel.
+     * @param freqInd Integer, variable passed by value.  The wave frequency index to use for calculating the Report
+     * object's data.
+     */
+    virtual void calcRAO(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the class associated with this Report object.
+     * @return Returns the name of the Report class.  Returned variable is a string, variable passed by value.
+     */
+    virtual std::string getClass();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides the filename associated with this Report object.
+     * @return Returns a string object, passed by value.  String is the filename associated with this Report.
+     */
+    virtual std::string getFileName();
+
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<double> plistSpectrum; /**< Spectrum at each wave frequency. */
+    std::vector< std::complex<double> > plistTransfer; /**< Transfer function at each wave frequency. */
+};
+
+}   //Namespace ofourier
+
+}   //Namespace osea
+
+#endif // REPSPECTRUM_H
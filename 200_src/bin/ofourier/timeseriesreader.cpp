@@ -0,0 +1,308 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "timeseriesreader.h"
+#include <sstream>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofourier;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string TimeSeriesReader::MAGIC = "OSEATS01"; /**< Identifier at the start of every binary file. */
+double TimeSeriesReader::TOL = 1.0e-3; /**< Relative tolerance on a uniform time step. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSeriesReader::TimeSeriesReader()
+{
+    pBinary = false;
+    pNumCol = 0;
+    ptData = NULL;
+    pNumRow = 0;
+    pRow = 0;
+    pTimeStep = 0.0;
+    pTimeLast = 0.0;
+    pNumRead = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSeriesReader::~TimeSeriesReader()
+{
+    close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSeriesReader::open(string pathIn)
+{
+    close();
+
+    //Check for the binary identifier.
+    char magic[8];
+    ifstream test(pathIn.c_str(), std::ios::in | std::ios::binary);
+    if (!test)
+        throw std::ios_base::failure("Time history file does not exist:  " + pathIn);
+    test.read(magic, 8);
+    pBinary = (test.gcount() == 8) && (string(magic, 8) == MAGIC);
+    test.close();
+
+    if (pBinary)
+    {
+        //Memory map the whole file.  The operating system pages it in as needed.
+        pFile.setFileName(QString::fromStdString(pathIn));
+        if (!pFile.open(QIODevice::ReadOnly))
+            throw std::ios_base::failure("Could not open time history file:  " + pathIn);
+
+        qint64 size = pFile.size();
+        const uchar *ptMap = pFile.map(0, size);
+        if (ptMap == NULL)
+            throw std::ios_base::failure("Could not memory map time history file:  " + pathIn);
+
+        qint64 pos = 8;
+        if (size < pos + static_cast<qint64>(sizeof(qint32)))
+            throw std::runtime_error("Time history file ends inside the header:  " + pathIn);
+
+        qint32 nCol;
+        memcpy(&nCol, ptMap + pos, sizeof(qint32));
+        pos += sizeof(qint32);
+        pNumCol = nCol;
+
+        //Checked here, before the number of rows divides by it.
+        if (pNumCol < 2)
+            throw std::runtime_error("Time history file needs a time column and at least one channel:  " + pathIn);
+
+        for (int i = 0; i < pNumCol; i++)
+        {
+            if (size < pos + static_cast<qint64>(sizeof(qint32)))
+                throw std::runtime_error("Time history file ends inside the header:  " + pathIn);
+
+            qint32 len;
+            memcpy(&len, ptMap + pos, sizeof(qint32));
+            pos += sizeof(qint32);
+            if ((len < 0) || (pos + len > size))
+                throw std::runtime_error("Invalid column label in time history file:  " + pathIn);
+
+            if (i > 0)
+                plistLabel.push_back(string(reinterpret_cast<const char *>(ptMap + pos), len));
+            pos += len;
+        }
+
+        //Rows of doubles.  The header may leave the rows unaligned, so copy values out with memcpy.
+        ptData = reinterpret_cast<const double *>(ptMap + pos);
+        pNumRow = (size - pos) / (sizeof(double) * pNumCol);
+    }
+    else
+    {
+        pText.open(pathIn.c_str(), std::ios::in);
+        if (!pText)
+            throw std::ios_base::failure("Could not open time history file:  " + pathIn);
+
+        //Column labels from the first comment line.  Number of columns from the first data line.
+        string line;
+        streampos start = pText.tellg();
+        while (getline(pText, line))
+        {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == string::npos)
+            {
+                start = pText.tellg();
+                continue;
+            }
+
+            istringstream words(line.substr(first));
+            string word;
+
+            if (line.at(first) == '#')
+            {
+                if (plistLabel.empty())
+                {
+                    words.ignore(1);
+                    words >> word;      //Time label.
+                    while (words >> word)
+                        plistLabel.push_back(word);
+                }
+                start = pText.tellg();
+                continue;
+            }
+
+            double val;
+            pNumCol = 0;
+            while (words >> val)
+                pNumCol++;
+            break;
+        }
+
+        //Return to the first data line.
+        pText.clear();
+        pText.seekg(start);
+    }
+
+    if (pNumCol < 2)
+        throw std::runtime_error("Time history file needs a time column and at least one channel:  " + pathIn);
+
+    //Default labels.
+    plistLabel.resize(pNumCol - 1);
+    for (int i = 0; i < pNumCol - 1; i++)
+    {
+        if (plistLabel.at(i).empty())
+            plistLabel.at(i) = "ch" + itoa(i + 1);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSeriesReader::close()
+{
+    if (pText.is_open())
+        pText.close();
+    if (pFile.isOpen())
+        pFile.close();      //Also removes the memory map.
+
+    ptData = NULL;
+    pNumRow = 0;
+    pRow = 0;
+    pNumCol = 0;
+    plistLabel.clear();
+    pTimeStep = 0.0;
+    pTimeLast = 0.0;
+    pNumRead = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int TimeSeriesReader::getNumChannel()
+{
+    return pNumCol - 1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> &TimeSeriesReader::listLabel()
+{
+    return plistLabel;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double TimeSeriesReader::getTimeStep()
+{
+    return pTimeStep;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int TimeSeriesReader::readBlock(int rowsIn, mat &dataOut)
+{
+    int nChan = pNumCol - 1;
+    dataOut.set_size(rowsIn, nChan);
+    int nRead = 0;
+
+    if (pBinary)
+    {
+        while ((nRead < rowsIn) && (pRow < pNumRow))
+        {
+            const double *ptRow = ptData + pRow * pNumCol;
+            double val;
+
+            memcpy(&val, ptRow, sizeof(double));
+            checkTime(val);
+
+            for (int j = 0; j < nChan; j++)
+            {
+                memcpy(&val, ptRow + j + 1, sizeof(double));
+                dataOut(nRead, j) = val;
+            }
+
+            pRow++;
+            nRead++;
+        }
+    }
+    else
+    {
+        string line;
+        while ((nRead < rowsIn) && getline(pText, line))
+        {
+            size_t first = line.find_first_not_of(" \t\r");
+            if ((first == string::npos) || (line.at(first) == '#'))
+                continue;
+
+            istringstream words(line);
+            double val;
+            if (!(words >> val))
+                throw std::runtime_error("Invalid row in time history file:  " + line);
+            checkTime(val);
+
+            for (int j = 0; j < nChan; j++)
+            {
+                if (!(words >> val))
+                    throw std::runtime_error("Missing channel value in time history file:  " + line);
+                dataOut(nRead, j) = val;
+            }
+
+            nRead++;
+        }
+    }
+
+    if (nRead < rowsIn)
+        dataOut.resize(nRead, nChan);
+
+    return nRead;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSeriesReader::checkTime(double timeIn)
+{
+    if (pNumRead == 1)
+    {
+        pTimeStep = timeIn - pTimeLast;
+        if (pTimeStep <= 0.0)
+            throw std::runtime_error("Time must increase in the time history file.");
+    }
+    else if (pNumRead > 1)
+    {
+        if (fabs(timeIn - pTimeLast - pTimeStep) > TOL * pTimeStep)
+            throw std::runtime_error("Time step is not uniform at time " + ftoa(timeIn));
+    }
+
+    pTimeLast = timeIn;
+    pNumRead++;
+}
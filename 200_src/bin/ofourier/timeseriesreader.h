@@ -0,0 +1,191 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef TIMESERIESREADER_H
+#define TIMESERIESREADER_H
+#include <string>
+#include <vector>
+#include <fstream>
+#include <armadillo>
+#include <QFile>
+#include "../ofreq/system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofourier.
+ */
+namespace ofourier
+{
+
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The TimeSeriesReader reads a time history file in blocks, so the whole record never needs to be held in memory.
+ * The first column of the file is time.  Each remaining column is one channel.  Two file formats are recognized.
+ *
+ * Text files are read line by line.  Blank lines are skipped.  The first line starting with # holds the labels of the
+ * columns.  This is the format otime writes.
+ *
+ * Binary files are memory mapped.  They start with the 8 characters OSEATS01, then a 32 bit integer with the number
+ * of columns.  Each column label follows, as a 32 bit integer length and then the characters.  The remainder of the
+ * file is rows of 64 bit floating point values, in native byte order.
+ *
+ * The time step must be uniform.  An error is thrown if it is not.
+ */
+class TimeSeriesReader : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    TimeSeriesReader();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Closes the file.
+     */
+    ~TimeSeriesReader();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Opens a time history file and reads the column labels.  Throws an error if the file can not be read.
+     * @param pathIn String.  The path of the file.  Variable passed by value.
+     */
+    void open(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Closes the file.
+     */
+    void close();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of channels.  Does not include the time column.
+     * @return Integer.  The number of channels.  Returned variable passed by value.
+     */
+    int getNumChannel();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The label of each channel.  Does not include the time column.
+     * @return Vector of strings.  Returned variable passed by reference.
+     */
+    std::vector<std::string> &listLabel();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the time step.  Only valid after the first two rows are read.
+     * @return Double.  The time step, in seconds.  Returned variable passed by value.
+     */
+    double getTimeStep();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads the next block of rows.
+     * @param rowsIn Integer.  The maximum number of rows to read.  Variable passed by value.
+     * @param dataOut Matrix of doubles.  One row for each time sample and one column for each channel.  Resized to
+     * the number of rows read.  Variable passed by reference.
+     * @return Integer.  The number of rows read.  Zero at the end of the file.  Returned variable passed by value.
+     */
+    int readBlock(int rowsIn, arma::mat &dataOut);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Checks the time of each row for a uniform time step.
+     * @param timeIn Double.  The time of the row.  Variable passed by value.
+     */
+    void checkTime(double timeIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pBinary; /**< True for binary files. */
+    int pNumCol; /**< Number of columns, including time. */
+    std::vector<std::string> plistLabel; /**< Label of each channel. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::ifstream pText; /**< Text file stream. */
+    QFile pFile; /**< Binary file. */
+    const double *ptData; /**< Start of the memory mapped rows of a binary file. */
+    qint64 pNumRow; /**< Number of rows in a binary file. */
+    qint64 pRow; /**< Index of the next row to read. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pTimeStep; /**< The time step. */
+    double pTimeLast; /**< Time of the last row read. */
+    qint64 pNumRead; /**< Number of rows read. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static std::string MAGIC; /**< Identifier at the start of every binary file. */
+    static double TOL; /**< Relative tolerance on a uniform time step. */
+};
+
+}   //Namespace ofourier
+}   //Namespace osea
+
+#endif // TIMESERIESREADER_H
@@ -0,0 +1,334 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "welchspectrum.h"
+#include <cmath>
+#include <thread>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofourier;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+WelchSpectrum::WelchSpectrum()
+{
+    pSegment = 1024;
+    pOverlap = 0.5;
+    pWindowName = "hann";
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+    pRef = -1;
+    pNumChan = 0;
+    pTimeStep = 0.0;
+    pBufferRows = 0;
+    pNumSegment = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+WelchSpectrum::~WelchSpectrum()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::setSegment(int sizeIn)
+{
+    pSegment = sizeIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::setOverlap(double overIn)
+{
+    pOverlap = overIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::setWindow(string nameIn)
+{
+    pWindowName = nameIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::setThreads(int threadsIn)
+{
+    pThreads = (threadsIn < 1) ? 1 : threadsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::setReference(int chanIn)
+{
+    pRef = chanIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int WelchSpectrum::getReference()
+{
+    return pRef;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::start(int chanIn, double stepIn)
+{
+    if (pSegment < 4)
+        throw std::invalid_argument("Segment length must be at least 4 samples.");
+    if ((pOverlap < 0.0) || (pOverlap >= 1.0))
+        throw std::invalid_argument("Segment overlap must be from 0 to less than 1.");
+    if (pRef >= chanIn)
+        throw std::invalid_argument("Reference channel does not exist.");
+
+    pNumChan = chanIn;
+    pTimeStep = stepIn;
+
+    //Window values.
+    pWindow.set_size(pSegment);
+    for (int n = 0; n < pSegment; n++)
+    {
+        if (pWindowName == "hann")
+            pWindow(n) = 0.5 * (1.0 - cos(2.0 * datum::pi * n / pSegment));
+        else if (pWindowName == "rect")
+            pWindow(n) = 1.0;
+        else
+            throw std::invalid_argument("Unknown window:  " + pWindowName);
+    }
+
+    pBuffer.set_size(pSegment, pNumChan);
+    pBufferRows = 0;
+    plistBatch.clear();
+    pNumSegment = 0;
+
+    //One set of sums for each thread.  Lines from zero frequency to the Nyquist frequency.
+    int nLine = pSegment / 2 + 1;
+    plistSumAuto.assign(pThreads, zeros<mat>(nLine, pNumChan));
+    plistSumCross.assign(pThreads, zeros<cx_mat>(nLine, pNumChan));
+
+    plistFreq.clear();
+    plistSpectrum.clear();
+    plistTransfer.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::addBlock(const mat &blockIn)
+{
+    int hop = pSegment - static_cast<int>(floor(pOverlap * pSegment + 0.5));
+    if (hop < 1)
+        hop = 1;
+    int keep = pSegment - hop;
+
+    for (unsigned int r = 0; r < blockIn.n_rows; r++)
+    {
+        pBuffer.row(pBufferRows) = blockIn.row(r);
+        pBufferRows++;
+
+        if (pBufferRows == pSegment)
+        {
+            //Segment complete.  Keep the overlap for the next segment.
+            plistBatch.push_back(pBuffer);
+            if (keep > 0)
+                pBuffer.rows(0, keep - 1) = plistBatch.back().rows(hop, pSegment - 1);
+            pBufferRows = keep;
+
+            //Enough segments to keep every thread busy.
+            if (static_cast<int>(plistBatch.size()) >= 4 * pThreads)
+                runBatch();
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::finish()
+{
+    runBatch();
+
+    if (pNumSegment == 0)
+        throw std::runtime_error("Time history is shorter than one segment of " + itoa(pSegment) + " samples.");
+
+    //Combine the sums of each thread.
+    mat sumAuto = plistSumAuto.at(0);
+    cx_mat sumCross = plistSumCross.at(0);
+    for (int t = 1; t < pThreads; t++)
+    {
+        sumAuto += plistSumAuto.at(t);
+        sumCross += plistSumCross.at(t);
+    }
+
+    //One sided spectrum, per rad/s.
+    double winPow = accu(square(pWindow));
+    double scale = 2.0 * pTimeStep / (2.0 * datum::pi * winPow * pNumSegment);
+    int nLine = pSegment / 2 + 1;
+
+    plistSpectrum.assign(pNumChan, vector<double>());
+    plistTransfer.assign(pNumChan, vector< complex<double> >());
+
+    for (int k = 1; k < nLine; k++)
+    {
+        plistFreq.push_back(2.0 * datum::pi * k / (pSegment * pTimeStep));
+
+        //The Nyquist line of an even segment is not folded.
+        double factor = ((pSegment % 2 == 0) && (k == nLine - 1)) ? 0.5 : 1.0;
+
+        for (int c = 0; c < pNumChan; c++)
+        {
+            plistSpectrum.at(c).push_back(factor * scale * sumAuto(k, c));
+
+            if (pRef >= 0)
+            {
+                double refAuto = sumAuto(k, pRef);
+                plistTransfer.at(c).push_back(
+                            (refAuto > 0.0) ? sumCross(k, c) / refAuto : complex<double>(0.0, 0.0));
+            }
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int WelchSpectrum::getNumSegment()
+{
+    return pNumSegment;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &WelchSpectrum::listFreq()
+{
+    return plistFreq;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &WelchSpectrum::listSpectrum(int chanIn)
+{
+    return plistSpectrum.at(chanIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector< complex<double> > &WelchSpectrum::listTransfer(int chanIn)
+{
+    return plistTransfer.at(chanIn);
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::runBatch()
+{
+    int nSeg = plistBatch.size();
+    if (nSeg == 0)
+        return;
+
+    int nThreads = (pThreads < nSeg) ? pThreads : nSeg;
+
+    if (nThreads == 1)
+    {
+        runSegments(0, nSeg, 0);
+    }
+    else
+    {
+        //Split the batch into one range for each thread.
+        vector<std::thread> listThread;
+        for (int t = 0; t < nThreads; t++)
+        {
+            int first = (nSeg * t) / nThreads;
+            int last = (nSeg * (t + 1)) / nThreads;
+            listThread.push_back(std::thread(&WelchSpectrum::runSegments, this, first, last, t));
+        }
+
+        for (unsigned int t = 0; t < listThread.size(); t++)
+            listThread.at(t).join();
+    }
+
+    pNumSegment += nSeg;
+    plistBatch.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::runSegments(int startIn, int endIn, int sumIn)
+{
+    int nLine = pSegment / 2 + 1;
+    mat &sumAuto = plistSumAuto.at(sumIn);
+    cx_mat &sumCross = plistSumCross.at(sumIn);
+
+    alglib::real_1d_array input;
+    alglib::complex_1d_array output;
+    input.setlength(pSegment);
+    cx_vec refLine(nLine);
+
+    for (int s = startIn; s < endIn; s++)
+    {
+        mat &seg = plistBatch.at(s);
+
+        //Transform the reference channel first.  Its lines are kept for the cross spectra.
+        if (pRef >= 0)
+        {
+            transform(seg, pRef, input, output);
+            for (int k = 0; k < nLine; k++)
+                refLine(k) = complex<double>(output[k].x, output[k].y);
+        }
+
+        for (int c = 0; c < pNumChan; c++)
+        {
+            if (c != pRef)
+                transform(seg, c, input, output);
+
+            for (int k = 0; k < nLine; k++)
+            {
+                complex<double> X = (c == pRef) ? refLine(k) : complex<double>(output[k].x, output[k].y);
+
+                sumAuto(k, c) += norm(X);
+                if (pRef >= 0)
+                    sumCross(k, c) += conj(refLine(k)) * X;
+            }
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WelchSpectrum::transform(const mat &segIn, int chanIn, alglib::real_1d_array &inputIn,
+                              alglib::complex_1d_array &outputIn)
+{
+    //Remove mean and apply window.
+    double mean = 0.0;
+    for (int n = 0; n < pSegment; n++)
+        mean += segIn(n, chanIn);
+    mean /= pSegment;
+
+    for (int n = 0; n < pSegment; n++)
+        inputIn[n] = (segIn(n, chanIn) - mean) * pWindow(n);
+
+    alglib::fftr1d(inputIn, pSegment, outputIn);
+}
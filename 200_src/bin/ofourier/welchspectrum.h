@@ -0,0 +1,268 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef WELCHSPECTRUM_H
+#define WELCHSPECTRUM_H
+#include <string>
+#include <vector>
+#include <complex>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "fasttransforms.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofourier.
+ */
+namespace ofourier
+{
+
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The WelchSpectrum estimates spectra of long time histories with Welch's method.  The record is split into
+ * overlapping segments.  Each segment has its mean removed, is windowed, and is transformed with the ALGLIB real FFT.
+ * The squared magnitudes are averaged over all segments.
+ *
+ * Samples are added in blocks of any size.  Only the samples needed for the next segment are kept, so the memory
+ * use does not depend on the length of the record.  Complete segments are collected into a batch, and each batch is
+ * transformed on several threads.  Each thread keeps its own sums, which are combined at the end.
+ *
+ * Spectra are one sided, with frequency in rad/s, so they compare directly with ofreq.  If a reference channel is
+ * set, the transfer function from the reference channel to each channel is also estimated, as the cross spectrum
+ * divided by the spectrum of the reference channel.  With wave elevation as the reference channel, the transfer
+ * function uses the same sign convention as the RAOs of ofreq.
+ */
+class WelchSpectrum : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    WelchSpectrum();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~WelchSpectrum();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of samples in each segment.  This is the FFT length.
+     * @param sizeIn Integer.  The segment length.  Variable passed by value.
+     */
+    void setSegment(int sizeIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the overlap between segments.
+     * @param overIn Double.  Fraction of each segment shared with the next segment.  From 0 to less than 1.
+     * Variable passed by value.
+     */
+    void setOverlap(double overIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the window applied to each segment.
+     * @param nameIn String.  Either "hann" or "rect".  Variable passed by value.
+     */
+    void setWindow(std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads used to transform segments.
+     * @param threadsIn Integer.  The number of threads.  Variable passed by value.
+     */
+    void setThreads(int threadsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the reference channel for transfer functions.
+     * @param chanIn Integer.  Index of the reference channel.  Use -1 for no transfer functions.  Variable passed by
+     * value.
+     */
+    void setReference(int chanIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the reference channel for transfer functions.
+     * @return Integer.  Index of the reference channel.  -1 for none.  Returned variable passed by value.
+     */
+    int getReference();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of channels and the time step.  Clears any previous samples and sums.
+     * @param chanIn Integer.  The number of channels.  Variable passed by value.
+     * @param stepIn Double.  The time step, in seconds.  Variable passed by value.
+     */
+    void start(int chanIn, double stepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a block of samples.
+     * @param blockIn Matrix of doubles.  One row for each time sample and one column for each channel.  Variable
+     * passed by reference.
+     */
+    void addBlock(const arma::mat &blockIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Transforms any remaining segments and calculates the spectra.  Throws an error if the record was
+     * shorter than one segment.
+     */
+    void finish();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of segments averaged.
+     * @return Integer.  The number of segments.  Returned variable passed by value.
+     */
+    int getNumSegment();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The frequency of each spectral line, in rad/s.  Does not include zero frequency.
+     * @return Vector of doubles.  Returned variable passed by reference.
+     */
+    std::vector<double> &listFreq();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The spectrum of one channel, at each frequency in listFreq().
+     * @param chanIn Integer.  Index of the channel.  Variable passed by value.
+     * @return Vector of doubles.  Units of the channel squared per rad/s.  Returned variable passed by reference.
+     */
+    std::vector<double> &listSpectrum(int chanIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The transfer function from the reference channel to one channel, at each frequency in listFreq().
+     * Empty if no reference channel is set.
+     * @param chanIn Integer.  Index of the channel.  Variable passed by value.
+     * @return Vector of complex doubles.  Returned variable passed by reference.
+     */
+    std::vector< std::complex<double> > &listTransfer(int chanIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Transforms all segments in the current batch, on several threads.
+     */
+    void runBatch();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Transforms a range of segments in the current batch and adds them to one set of sums.
+     * @param startIn Integer.  First segment of the range.  Variable passed by value.
+     * @param endIn Integer.  One past the last segment of the range.  Variable passed by value.
+     * @param sumIn Integer.  Index of the set of sums.  Variable passed by value.
+     */
+    void runSegments(int startIn, int endIn, int sumIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Removes the mean of one channel of a segment, applies the window, and transforms it.
+     * @param segIn The segment.  Variable passed by reference.
+     * @param chanIn Integer.  Index of the channel.  Variable passed by value.
+     * @param inputIn Work array for the windowed samples.  Variable passed by reference.
+     * @param outputIn The transform.  Variable passed by reference.
+     */
+    void transform(const arma::mat &segIn, int chanIn, alglib::real_1d_array &inputIn,
+                   alglib::complex_1d_array &outputIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pSegment; /**< Number of samples in each segment. */
+    double pOverlap; /**< Fraction of overlap between segments. */
+    std::string pWindowName; /**< Name of the window. */
+    int pThreads; /**< Number of threads. */
+    int pRef; /**< Index of the reference channel.  -1 for none. */
+    int pNumChan; /**< Number of channels. */
+    double pTimeStep; /**< The time step. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::vec pWindow; /**< Window values. */
+    arma::mat pBuffer; /**< Samples kept for the next segment. */
+    int pBufferRows; /**< Number of valid rows in pBuffer. */
+    std::vector<arma::mat> plistBatch; /**< Complete segments waiting to be transformed. */
+    int pNumSegment; /**< Number of segments transformed. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<arma::mat> plistSumAuto; /**< Sums of squared magnitude.  One per thread.  Line by channel. */
+    std::vector<arma::cx_mat> plistSumCross; /**< Sums of cross spectrum with the reference.  One per thread. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<double> plistFreq; /**< Frequency of each spectral line. */
+    std::vector< std::vector<double> > plistSpectrum; /**< Spectrum of each channel. */
+    std::vector< std::vector< std::complex<double> > > plistTransfer; /**< Transfer function of each channel. */
+};
+
+}   //Namespace ofourier
+}   //Namespace osea
+
+#endif // WELCHSPECTRUM_H
@@ -35,6 +35,8 @@ using namespace osea::ofreq;
 //------------------------------------------Function Separator ----------------------------------------------------
 //Class Names
 string dictControl::KEY_SYSTEM = "system"; /**< Keyword for system object.*/
+string dictControl::KEY_SCAN = "scan"; /**< Keyword for parametric scan object.*/
+string dictControl::KEY_ENSEMBLE = "ensemble"; /**< Keyword for ensemble parameter object.*/
 
 //------------------------------------------Function Separator ----------------------------------------------------
 //Keyword Value Pairs
@@ -42,6 +44,25 @@ string dictControl::KEY_ANALYSIS = "analysis"; /**< Keyword for analysis specifi
 string dictControl::KEY_FREQUENCY = "frequency"; /**< Keyword for frequency specification */
 string dictControl::KEY_DIRECTION = "direction"; /**< Keyword for direction list specification. */
 string dictControl::KEY_WAVEMODEL = "seamodel"; /**< Keyword for wave model specification. */
+string dictControl::KEY_SCANFORCE = "force"; /**< Keyword for the name of the user force to scan. */
+string dictControl::KEY_SCANFACTOR = "factor"; /**< Keyword for the list of factors to scale the scanned force by. */
+string dictControl::KEY_SOLVER = "solver"; /**< Keyword for the precision of the motion solver. */
+string dictControl::VAL_DOUBLE = "double"; /**< Value for a double precision motion solver. */
+string dictControl::VAL_MIXED = "mixed"; /**< Value for a mixed precision motion solver. */
+string dictControl::KEY_FARFIELD = "farfield"; /**< Keyword for the far-field distance, in wavelengths. */
+string dictControl::KEY_SYMTOL = "symtol"; /**< Keyword for the tolerance of the symmetry check in the motion solver. */
+string dictControl::KEY_RECIPTOL = "reciptol"; /**< Keyword for the tolerance to average reciprocal crossbody blocks. */
+string dictControl::KEY_SAMPLES = "samples"; /**< Keyword for the number of samples in an ensemble study. */
+string dictControl::KEY_SEED = "seed"; /**< Keyword for the random number seed of an ensemble study. */
+string dictControl::KEY_ENSBODY = "body"; /**< Keyword for the name of the body that an ensemble parameter varies. */
+string dictControl::KEY_PROPERTY = "property"; /**< Keyword for the mass property that an ensemble parameter varies. */
+string dictControl::KEY_DISTRIBUTION = "distribution"; /**< Keyword for the distribution of an ensemble parameter. */
+string dictControl::KEY_VALUE = "value"; /**< Keyword for the values that define the distribution. */
+string dictControl::VAL_NORMAL = "normal"; /**< Value for a normal distribution. */
+string dictControl::VAL_UNIFORM = "uniform"; /**< Value for a uniform distribution. */
+string dictControl::VAL_TABLE = "table"; /**< Value for a table of sample values. */
+vector<string> dictControl::LIST_PROPERTY = {"mass", "ixx", "iyy", "izz", "ixy", "ixz", "iyz",
+                                             "cogx", "cogy", "cogz"}; /**< Values for the mass properties of a body. */
 
 //==========================================Section Separator =========================================================
 //Public Functions
@@ -121,6 +142,173 @@ int dictControl::defineKey(string keyIn, vector<string> valIn)
         return 0;
     }
 
+    else if ((keyIn == KEY_SCANFORCE) && (pClass == KEY_ENSEMBLE))
+    {
+        //Set the name of the user force for the latest ensemble parameter.
+        if (ptSystem->listEnsemble().size() == 0)
+            return 2;
+
+        ptSystem->listEnsemble().back().setForceName(valIn.at(0));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SCANFORCE)
+    {
+        //Set the name of the force for the latest scan object.
+        if (ptSystem->listScanForce().size() == 0)
+            return 2;
+
+        ptSystem->listScanForce().back().setForceName(valIn.at(0));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SCANFACTOR)
+    {
+        //Set the list of factors for the latest scan object.
+        if (ptSystem->listScanForce().size() == 0)
+            return 2;
+
+        for (unsigned int i = 0; i < valIn.size(); i++)
+        {
+            //Convert the value and add it to the list.
+            ptSystem->listScanForce().back().listFactor().push_back(atof(valIn.at(i).c_str()));
+        }
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SOLVER)
+    {
+        //Set the precision of the motion solver.
+        if (valIn.at(0) == VAL_MIXED)
+            ptSystem->setMixedPrecision(true);
+        else if (valIn.at(0) == VAL_DOUBLE)
+            ptSystem->setMixedPrecision(false);
+        else
+            return 1;
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_FARFIELD)
+    {
+        //Set the distance, in wavelengths, beyond which bodies use the far-field approximation.
+        ptSystem->setFarField(atof(valIn.at(0).c_str()));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SYMTOL)
+    {
+        //Set the relative tolerance used to detect a complex symmetric system matrix.
+        ptSystem->setSymTolerance(atof(valIn.at(0).c_str()));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_RECIPTOL)
+    {
+        //Set the relative tolerance to average reciprocal crossbody blocks.
+        ptSystem->setRecipTolerance(atof(valIn.at(0).c_str()));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SAMPLES)
+    {
+        //Set the number of samples in the ensemble study.
+        ptSystem->setEnsembleSize(atoi(valIn.at(0).c_str()));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_SEED)
+    {
+        //Set the random number seed of the ensemble study.
+        ptSystem->setEnsembleSeed(static_cast<unsigned int>(atol(valIn.at(0).c_str())));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_ENSBODY)
+    {
+        //Set the name of the body for the latest ensemble parameter.
+        if (ptSystem->listEnsemble().size() == 0)
+            return 2;
+
+        ptSystem->listEnsemble().back().setBodyName(valIn.at(0));
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_PROPERTY)
+    {
+        //Set the mass property for the latest ensemble parameter.
+        if (ptSystem->listEnsemble().size() == 0)
+            return 2;
+
+        for (unsigned int i = 0; i < LIST_PROPERTY.size(); i++)
+        {
+            if (valIn.at(0) == LIST_PROPERTY.at(i))
+            {
+                ptSystem->listEnsemble().back().setProperty(i);
+
+                //return success
+                return 0;
+            }
+        }
+
+        //Property not found.
+        return 1;
+    }
+
+    else if (keyIn == KEY_DISTRIBUTION)
+    {
+        //Set the distribution for the latest ensemble parameter.
+        if (ptSystem->listEnsemble().size() == 0)
+            return 2;
+
+        if (valIn.at(0) == VAL_NORMAL)
+            ptSystem->listEnsemble().back().setDistribution(0);
+        else if (valIn.at(0) == VAL_UNIFORM)
+            ptSystem->listEnsemble().back().setDistribution(1);
+        else if (valIn.at(0) == VAL_TABLE)
+            ptSystem->listEnsemble().back().setDistribution(2);
+        else
+            return 1;
+
+        //return success
+        return 0;
+    }
+
+    else if (keyIn == KEY_VALUE)
+    {
+        //Set the values of the distribution for the latest ensemble parameter.
+        if (ptSystem->listEnsemble().size() == 0)
+            return 2;
+
+        for (unsigned int i = 0; i < valIn.size(); i++)
+        {
+            //Convert the value and add it to the list.
+            ptSystem->listEnsemble().back().listValue().push_back(atof(valIn.at(i).c_str()));
+        }
+
+        //return success
+        return 0;
+    }
+
     else
     {
         //Word not found.  Return error code.
@@ -131,6 +319,9 @@ int dictControl::defineKey(string keyIn, vector<string> valIn)
 //------------------------------------------Function Separator --------------------------------------------------------
 int dictControl::defineClass(string nameIn)
 {
+    //Remember the current object.  Some keywords depend on it.
+    pClass = nameIn;
+
     if (nameIn == KEY_SYSTEM)
     {
         //Don't need to do anything for the system object.
@@ -138,6 +329,22 @@ int dictControl::defineClass(string nameIn)
         return 0;
     }
 
+    else if (nameIn == KEY_SCAN)
+    {
+        //Create a new parameter for the parametric scan.
+        ptSystem->addScanForce();
+
+        return 0;
+    }
+
+    else if (nameIn == KEY_ENSEMBLE)
+    {
+        //Create a new parameter for the ensemble study.
+        ptSystem->addEnsemble();
+
+        return 0;
+    }
+
     else
     {
         //Word not found.  Return error code.
@@ -138,6 +138,8 @@ private:
     //------------------------------------------Function Separator ----------------------------------------------------
     //Class Names
     static std::string KEY_SYSTEM; /**< Keyword for system object.*/
+    static std::string KEY_SCAN; /**< Keyword for parametric scan object.*/
+    static std::string KEY_ENSEMBLE; /**< Keyword for ensemble parameter object.*/
 
     //------------------------------------------Function Separator ----------------------------------------------------
     //Keyword Value Pairs
@@ -145,6 +147,36 @@ private:
     static std::string KEY_FREQUENCY; /**< Keyword for frequency specification */
     static std::string KEY_DIRECTION; /**< Keyword for direction list specification. */
     static std::string KEY_WAVEMODEL; /**< Keyword for wave model specification. */
+    static std::string KEY_SCANFORCE; /**< Keyword for the name of the user force to scan. */
+    static std::string KEY_SCANFACTOR; /**< Keyword for the list of factors to scale the scanned force by. */
+    static std::string KEY_SOLVER; /**< Keyword for the precision of the motion solver. */
+    static std::string VAL_DOUBLE; /**< Value for a double precision motion solver. */
+    static std::string VAL_MIXED; /**< Value for a mixed precision motion solver. */
+    static std::string KEY_FARFIELD; /**< Keyword for the far-field distance, in wavelengths. */
+    static std::string KEY_SYMTOL; /**< Keyword for the tolerance of the symmetry check in the motion solver. */
+    static std::string KEY_RECIPTOL; /**< Keyword for the tolerance to average reciprocal crossbody blocks. */
+    static std::string KEY_SAMPLES; /**< Keyword for the number of samples in an ensemble study. */
+    static std::string KEY_SEED; /**< Keyword for the random number seed of an ensemble study. */
+    static std::string KEY_ENSBODY; /**< Keyword for the name of the body that an ensemble parameter varies. */
+    static std::string KEY_PROPERTY; /**< Keyword for the mass property that an ensemble parameter varies. */
+    static std::string KEY_DISTRIBUTION; /**< Keyword for the distribution of an ensemble parameter. */
+    static std::string KEY_VALUE; /**< Keyword for the values that define the distribution. */
+    static std::string VAL_NORMAL; /**< Value for a normal distribution. */
+    static std::string VAL_UNIFORM; /**< Value for a uniform distribution. */
+    static std::string VAL_TABLE; /**< Value for a table of sample values. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Values for the mass properties of a body.  Same names as the bodies input file.  Listed in the order of
+     * the integer used by EnsembleParam::setProperty().
+     */
+    static std::vector<std::string> LIST_PROPERTY;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The name of the current object.  Some keywords mean different things in different objects.
+     */
+    std::string pClass;
 };
 
 }   //Namespace ofreq
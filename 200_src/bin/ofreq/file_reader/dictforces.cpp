@@ -40,6 +40,7 @@ string dictForces::OBJECT_FORCE_CROSS = "force_crossbody"; /**< Keyword for forc
 string dictForces::OBJECT_DERIVATIVE = "derivative"; /**< Keyword for derivative class definition. */
 string dictForces::OBJECT_EQUATION = "equation"; /**< Keyword for equation designation.*/
 string dictForces::OBJECT_FORCE = "force"; /**< Keyword for force designation as part of force_active definition. */
+string dictForces::OBJECT_FORCE_DRAG = "force_drag"; /**< Keyword for force_drag class definition. */
 
 //------------------------------------------Function Separator --------------------------------------------------------
 //Keyword Names
@@ -49,6 +50,7 @@ string dictForces::KEY_NUMBER = "number"; /**< Keyword for equation number desig
 string dictForces::KEY_ORDER = "order"; /**< Keyword for order of derivative designation. */
 string dictForces::KEY_FORCE = "force"; /**< Keyword for force coefficients designation.*/
 string dictForces::KEY_EQUATION = "equation"; /**< Keyword for equation designation.*/
+string dictForces::KEY_DRAG = "drag"; /**< Keyword for quadratic drag coefficients designation. */
 
 //==========================================Section Separator =========================================================
 //Public Functions
@@ -56,6 +58,7 @@ string dictForces::KEY_EQUATION = "equation"; /**< Keyword for equation designat
 //------------------------------------------Function Separator --------------------------------------------------------
 dictForces::dictForces()
 {
+    pDragIndex = -1;
 }
 
 //==========================================Section Separator =========================================================
@@ -79,9 +82,9 @@ int dictForces::defineKey(string keyIn, vector<string> valIn)
             //Active force type.
             ptSystem->listForceActive_user(pForceIndex).setForceName(valIn.at(0));
         }
-        else if (pForceType == 2)
+        else if ((pForceType == 2) || (pForceType == 4))
         {
-            //Reactive force type
+            //Reactive force type.  Drag forces are named through their reactive force.
             ptSystem->listForceReact_user(pForceIndex).setForceName(valIn.at(0));
         }
         else if (pForceType == 3)
@@ -192,6 +195,26 @@ int dictForces::defineKey(string keyIn, vector<string> valIn)
         }
     }
 
+    else if (keyIn == KEY_DRAG)
+    {
+        //Only applicable to drag forces.
+        if (pForceType != 4)
+            return 2;
+
+        //Set the quadratic drag coefficient for each equation.
+        ptSystem->listForceDrag(pDragIndex).listCoeff().clear();
+        for (unsigned int i = 0; i < valIn.size(); i++)
+        {
+            ptSystem->listForceDrag(pDragIndex).listCoeff().push_back(atof(valIn.at(i).c_str()));
+        }
+
+        //Start the reactive force with zero linear damping.
+        ptSystem->listForceDrag(pDragIndex).applyLinear(ptSystem->listForceReact_user(pForceIndex));
+
+        //Report success
+        return 0;
+    }
+
     else
     {
         //Key not found.  Report error
@@ -241,6 +264,23 @@ int dictForces::defineClass(string nameIn)
         return 0;
     }
 
+    else if (nameIn == OBJECT_FORCE_DRAG)
+    {
+        //Drag force key.
+        //Set variable for force type.
+        pForceType = 4;
+
+        //Set index of new force.  The drag force keeps its linear damping in a new user reactive force.
+        setForceIndex();
+        ptSystem->listForceReact_user(pForceIndex);
+
+        pDragIndex = ptSystem->listForceDrag().size();
+        ptSystem->listForceDrag(pDragIndex).setReactIndex(pForceIndex);
+
+        //Report back success
+        return 0;
+    }
+
     else if (nameIn == OBJECT_FORCE)
     {
         //Force designation for entry in active force object.
@@ -307,9 +347,9 @@ int dictForces::defineClass(string nameIn)
              //Active forces
              pForceIndex = ptSystem->listForceActive_user().size();
          }
-         else if (pForceType == 2)
+         else if ((pForceType == 2) || (pForceType == 4))
          {
-             //Reactive Forces
+             //Reactive Forces.  Also used for drag forces.
              pForceIndex = ptSystem->listForceReact_user().size();
 
          }
@@ -344,7 +384,7 @@ void dictForces::setEquation(int eqIn)
         else if (pForceType == 3)
         {
             //Cross-body force type.
-            pEqn = ptSystem->listForceReact_user(pForceIndex).listDerivative(pOrd).listDataEquation().size();
+            pEqn = ptSystem->listForceCross_user(pForceIndex).listDerivative(pOrd).listDataEquation().size();
         }
     }
     else
@@ -145,15 +145,22 @@ protected:
 private:  
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
-     * @brief Integer variable.  Can take on an integer from 1 to 3.  This is how the dictionary remembers which type
+     * @brief Integer variable.  Can take on an integer from 1 to 4.  This is how the dictionary remembers which type
      * of force object was created.  Valid values are:
      * 0:  Variable not set
      * 1:  forceActive_user
      * 2:  forceReact_user
      * 3:  forceCross_user
+     * 4:  forceDrag, with its equivalent linear damping held in a forceReact_user
      */
     int pForceType;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Index of the last drag force currently being used.  Only used when pForceType is 4.
+     */
+    int pDragIndex;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Index of last force currently being used.
@@ -209,6 +216,7 @@ private:
     static std::string OBJECT_DERIVATIVE; /**< Keyword for derivative class definition. */
     static std::string OBJECT_EQUATION; /**< Keyword for equation designation.*/
     static std::string OBJECT_FORCE; /**< Keyword for force designation as part of force_active definition. */
+    static std::string OBJECT_FORCE_DRAG; /**< Keyword for force_drag class definition. */
 
     //------------------------------------------Function Separator ----------------------------------------------------
     //Keyword Names
@@ -218,6 +226,7 @@ private:
     static std::string KEY_ORDER; /**< Keyword for order of derivative designation. */
     static std::string KEY_FORCE; /**< Keyword for force coefficients designation.*/
     static std::string KEY_EQUATION; /**< Keyword for equation designation.*/
+    static std::string KEY_DRAG; /**< Keyword for quadratic drag coefficients designation. */
 };
 
 }   //Namespace ofreq
@@ -52,6 +52,8 @@ string dictOutputs::OBJECT_REPBODYACCELERATION = "repBodyAcceleration";
 string dictOutputs::OBJECT_REPBODYVELOCITY = "repBodyVelocity";
 string dictOutputs::OBJECT_REPBODYMOTION = "repBodyMotion";
 string dictOutputs::OBJECT_REPBODYSOLUTION = "repBodSolution";
+string dictOutputs::OBJECT_REPPOWERGRADIENT = "repPowerGradient";
+string dictOutputs::OBJECT_REPTIMEHISTORY = "repTimeHistory";
 
 //------------------------------------------Function Separator ----------------------------------------------------
 //Keyword name static constants
@@ -117,6 +119,19 @@ int dictOutputs::defineKey(std::string keyIn, std::vector<std::string> valIn)
         return 0;
     }
 
+    else if (keyIn == KEY_RAO)
+    {
+        //Set whether to calculate RAO values.  RAO values are calculated unless turned off.
+        ptRep->calcRAO(
+                    !((valIn.at(0) == "false")
+                      || (valIn.at(0) == "no")
+                      || (valIn.at(0) == "0"))
+                    );
+
+        //Report success
+        return 0;
+    }
+
     else
     {
         //Simply add key to list of constants.      
@@ -409,6 +424,33 @@ int dictOutputs::defineClass(std::string nameIn)
         return 0;
     }
 
+    else if (nameIn == OBJECT_REPPOWERGRADIENT)
+    {
+        //Create new Report object and add it to the Reports manager.
+        ptRep = new repPowerGradient(
+                    &(ptSystem->refReportManager()));
+
+        //Add report to Report manager
+        ptSystem->refReportManager().addReport(ptRep);
+
+        //The report solves the adjoint system, so keep the factors from the motion solver.
+        ptSystem->setKeepFactor(true);
+
+        return 0;
+    }
+
+    else if (nameIn == OBJECT_REPTIMEHISTORY)
+    {
+        //Create new Report object and add it to the Reports manager.
+        ptRep = new repTimeHistory(
+                    &(ptSystem->refReportManager()));
+
+        //Add report to Report manager
+        ptSystem->refReportManager().addReport(ptRep);
+
+        return 0;
+    }
+
     else
     {
         //Return error
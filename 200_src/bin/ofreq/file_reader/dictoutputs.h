@@ -62,6 +62,8 @@
 #include "../reports/repbodmotion.h"
 #include "../reports/repbodvelocity.h"
 #include "../reports/repbodsolution.h"
+#include "../reports/reppowergradient.h"
+#include "../reports/reptimehistory.h"
 
 //######################################### Class Separator ###########################################################
 //Namespace declarations
@@ -186,6 +188,8 @@ private:
     static std::string OBJECT_REPBODYVELOCITY;  /**< Key to declare body velocity object. */
     static std::string OBJECT_REPBODYMOTION;    /**< Key to declare body motion object. */
     static std::string OBJECT_REPBODYSOLUTION;  /**< Key to declare body solution object. */
+    static std::string OBJECT_REPPOWERGRADIENT; /**< Key to declare report of power gradients. */
+    static std::string OBJECT_REPTIMEHISTORY;   /**< Key to declare report of synthesized time histories. */
 
     //------------------------------------------Function Separator ----------------------------------------------------
     //Keyword name constants
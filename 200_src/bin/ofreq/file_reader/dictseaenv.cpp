@@ -51,6 +51,9 @@ string dictSeaEnv::KEY_1D = "single_direction"; /**< Class designation for a sin
 string dictSeaEnv::KEY_2D = "dual_direction"; /**< Class designation for a dual direction sea model. */
 string dictSeaEnv::KEY_LONG = "long_crested"; /**< Class designation for a long crested wave sea model. */
 string dictSeaEnv::KEY_UNIFORM = "uniform"; /**< Class designatino for a uniform wave sea model. */
+string dictSeaEnv::KEY_SPREADING = "spreading"; /**< Class designation for a directional spreading sea model. */
+string dictSeaEnv::KEY_COS2S = "cos2s"; /**< Designation for the cos-2s spreading function. */
+string dictSeaEnv::KEY_WRAPNORMAL = "wrapped_normal"; /**< Designation for the wrapped normal spreading function. */
 
 string dictSeaEnv::KEY_CLASS = "class";   /**< Keyword to specify class type for sea model or wave spectrum. */
 string dictSeaEnv::KEY_NAME = "name";    /**< Keyword to specify the user name designation for sea model or wave spectrum. */
@@ -66,6 +69,10 @@ string dictSeaEnv::KEY_WIND = "wind";    /**< Keyword to specify the wind speed
 string dictSeaEnv::KEY_DIRECTION = "direction"; /**< Keyword to specify the wave direction for a sea model component. */
 string dictSeaEnv::KEY_SPECTRUM = "spectrum";  /**< Keyword to specify the wave spectrum for a sea model component. */
 string dictSeaEnv::KEY_SCALE = "scale";   /**< Keyword to specify the scale factor for a sea model component. */
+string dictSeaEnv::KEY_SPREADTYPE = "spread_type"; /**< Keyword to specify the spreading function of a spreading sea model. */
+string dictSeaEnv::KEY_SPREAD = "spread";  /**< Keyword to specify the spreading parameter of a spreading sea model. */
+string dictSeaEnv::KEY_TOLERANCE = "tolerance"; /**< Keyword to specify the quadrature tolerance of a spreading sea model. */
+string dictSeaEnv::KEY_MAXDIR = "max_directions";  /**< Keyword to specify the most quadrature directions of a spreading sea model. */
 
 
 //==========================================Section Separator =========================================================
@@ -600,6 +607,49 @@ int dictSeaEnv::defineKey(string keyIn, vector<string> valIn)
                 }
             }
 
+            //------------------------------------------
+            else if ((keyIn == KEY_SPREADTYPE) || (keyIn == KEY_SPREAD) ||
+                     (keyIn == KEY_TOLERANCE) || (keyIn == KEY_MAXDIR))
+            {
+                //Set the properties of the directional spreading sea model.
+                if ((pClassType == OBJECT_SEA_MODEL) && (pSubClassType == KEY_SPREADING))
+                {
+                    //Get the object.
+                    osea::SeaModel_Spreading* Model = dynamic_cast<osea::SeaModel_Spreading*>
+                                                      (&(ptSystem->listSeaModel(pObjIndex)));
+
+                    if (keyIn == KEY_SPREADTYPE)
+                    {
+                        if (valIn.at(0) == KEY_COS2S)
+                            Model->setSpreadType(0);
+                        else if (valIn.at(0) == KEY_WRAPNORMAL)
+                            Model->setSpreadType(1);
+                        else
+                        {
+                            logStd.Notify();
+                            logErr.Write(string("Spreading function not recognized:  ") + valIn.at(0));
+                            return 2;
+                        }
+                    }
+                    else if (keyIn == KEY_SPREAD)
+                        Model->setSpread(atof(valIn.at(0).c_str()));
+                    else if (keyIn == KEY_TOLERANCE)
+                        Model->setTolerance(atof(valIn.at(0).c_str()));
+                    else
+                        Model->setMaxDirections(atoi(valIn.at(0).c_str()));
+
+                    return 0;
+                }
+                else
+                {
+                    //Throw an error.
+                    logStd.Notify();
+                    logErr.Write(keyIn + string(" parameter does not apply to the specified object type:  ")
+                                 + pClassType + string(":") + pSubClassType);
+                    return 2;
+                }
+            }
+
             //------------------------------------------
             else
             {
@@ -825,4 +875,20 @@ int dictSeaEnv::buildClass(std::string nameIn)
         pClassSet = true;
         return 0;
     }
+
+    else if (nameIn == KEY_SPREADING)
+    {
+        //Specification of a directional spreading sea model.
+        ptSystem->addSeaModel(osea::SeaModel_Spreading());
+
+        //Set the specific class type
+        pSubClassType = nameIn;
+
+        //Get the index
+        pObjIndex = ptSystem->listSeaModel().size() - 1;
+
+        //Notify the properly set class.
+        pClassSet = true;
+        return 0;
+    }
 }
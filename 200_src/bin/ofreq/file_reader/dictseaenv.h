@@ -218,6 +218,9 @@ private:
     static std::string KEY_2D; /**< Class designation for a dual direction sea model. */
     static std::string KEY_LONG; /**< Class designation for a long crested wave sea model. */
     static std::string KEY_UNIFORM; /**< Class designatino for a uniform wave sea model. */
+    static std::string KEY_SPREADING; /**< Class designation for a directional spreading sea model. */
+    static std::string KEY_COS2S; /**< Designation for the cos-2s spreading function. */
+    static std::string KEY_WRAPNORMAL; /**< Designation for the wrapped normal spreading function. */
 
     static std::string KEY_CLASS;   /**< Keyword to specify class type for sea model or wave spectrum. */
     static std::string KEY_NAME;    /**< Keyword to specify the user name designation for sea model or wave spectrum. */
@@ -233,6 +236,10 @@ private:
     static std::string KEY_DIRECTION; /**< Keyword to specify the wave direction for a sea model component. */
     static std::string KEY_SPECTRUM;  /**< Keyword to specify the wave spectrum for a sea model component. */
     static std::string KEY_SCALE;   /**< Keyword to specify the scale factor for a sea model component. */
+    static std::string KEY_SPREADTYPE; /**< Keyword to specify the spreading function of a spreading sea model. */
+    static std::string KEY_SPREAD;  /**< Keyword to specify the spreading parameter of a spreading sea model. */
+    static std::string KEY_TOLERANCE; /**< Keyword to specify the quadrature tolerance of a spreading sea model. */
+    static std::string KEY_MAXDIR;  /**< Keyword to specify the most quadrature directions of a spreading sea model. */
 
 
 };
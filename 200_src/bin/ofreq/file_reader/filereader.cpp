@@ -144,6 +144,16 @@ void FileReader::setPath(string input)
     pPath = input;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+string FileReader::getPath()
+{
+    if (pPath.empty())
+        return pPath;
+
+    //Resolve any relative reference against the current directory.
+    return QFileInfo(QString::fromStdString(pPath)).absoluteFilePath().toStdString();
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 int FileReader::readControl()
 {
@@ -263,7 +273,7 @@ int FileReader::readBodies()
     //Read file
     int out = readFile(filename);
 
-    for (unsigned int i; i < ptSystem->listBody().size(); i++)
+    for (unsigned int i = 0; i < ptSystem->listBody().size(); i++)
     {
         //Link bodies for cross-body forces
         ptSystem->linkBodies(i);
@@ -919,6 +929,12 @@ void FileReader::setDictionary(osea::Dictionary &dictIn)
     ptDict = &dictIn;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void FileReader::setMemoryFiles(const std::map<std::string, std::string> *ptInput)
+{
+    ptMemory = ptInput;
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 vector<string> &FileReader::listDataFiles()
 {
@@ -931,6 +947,27 @@ string &FileReader::listDataFiles(int index)
     return plistDataFiles.at(index);
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> FileReader::listInputFiles()
+{
+    vector<string> output;
+
+    //Same sequence as the files are read.
+    output.push_back(pPath + SLASH + SYS + SLASH + CONTROL);
+    output.push_back(pPath + SLASH + CONST + SLASH + SEAENV);
+    output.push_back(pPath + SLASH + CONST + SLASH + FORCES);
+    output.push_back(pPath + SLASH + CONST + SLASH + BODIES);
+    output.push_back(pPath + SLASH + CONST + SLASH + DATA);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> &FileReader::listReadFiles()
+{
+    return plistReadFiles;
+}
+
 
 //==========================================Section Separator =========================================================
 //Signals
@@ -958,18 +995,30 @@ int FileReader::readFile(string path)
 {
     //Read input file
 
-    //Create input file
-    ifstream InputFile(path.c_str());
+    //Create input file.  Files supplied in memory take priority over the file system.
+    ifstream InputFile;
+    istringstream MemoryFile;
+    istream *ptInput = &InputFile;
+
+    if (ptMemory && (ptMemory->find(path) != ptMemory->end()))
+    {
+        MemoryFile.str(ptMemory->find(path)->second);
+        ptInput = &MemoryFile;
+    }
+    else
+        InputFile.open(path.c_str());
 
     try
     {
         //Test if file exists
-        if(!InputFile)
+        if(!*ptInput)
             throw std::ios_base::failure("Could not open file:  " + path);
 
+        plistReadFiles.push_back(path);
+
         //Parse file
         Parser myParse;
-        myParse.Parse(InputFile);
+        myParse.Parse(*ptInput);
 
         //variables to record seafile parameters.
         string version;     //version of the sea file.
@@ -1062,6 +1111,7 @@ int FileReader::readFile(string path)
 //------------------------------------------Function Separator --------------------------------------------------------
 void FileReader::initClass()
 {
+    ptMemory = NULL;
 }
 
 //==========================================Section Separator =========================================================
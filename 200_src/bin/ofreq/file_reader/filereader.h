@@ -44,10 +44,13 @@
 #ifndef FILEREADER_H
 #define FILEREADER_H
 #include <QObject>
+#include <QFileInfo>
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <vector>
+#include <map>
 #include "parser.h"
 #include "objectgroup.h"
 #include "../system_objects/system.h"
@@ -135,6 +138,14 @@ public:
      */
     void setPath(std::string input);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the path to the working directory.
+     * @return Returns the path set with setPath() as an absolute path.  A relative path is resolved against the
+     * current directory, so the same directory always gives the same string.  Variable passed by value.
+     */
+    std::string getPath();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Reads in the control file and parses its inputs.
@@ -191,6 +202,19 @@ public:
      */
     void setDictionary(osea::Dictionary &dictIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets a list of input files held in memory.
+     *
+     * Each entry maps the full path of an input file to the text of that file.  When reading a file, the FileReader
+     * first checks the list for the path.  If found, the text in memory is parsed instead of the file on disk.  If
+     * not found, the file is read from disk as normal.  Lets a program supply the input files without any access to
+     * the file system.  The paths must match the paths the FileReader builds from the path set with setPath().
+     * @param ptInput Pointer to the map of input files.  Variable passed by value.  The map is not copied and must
+     * stay valid while the FileReader reads files.  Set to NULL to read only from disk.
+     */
+    void setMemoryFiles(const std::map<std::string, std::string> *ptInput);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief lists the data files for the HydroReader to process.
@@ -216,6 +240,26 @@ public:
      */
     std::string &listDataFiles(int index);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Lists the full paths of the input files that define the solution of the equations of motion.
+     *
+     * Includes the control, sea environment, forces, bodies, and data files.  The outputs file is deliberately
+     * excluded.  It only controls the reports calculated from the solution and does not change the solution itself.
+     * The paths are built from the path set for the FileReader.  The files are not checked for existence.
+     * @return Vector of strings, variable passed by value.  The list of full paths to the input files.
+     */
+    std::vector<std::string> listInputFiles();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Lists the full paths of the files opened and parsed by readFile(), in the order they were read.
+     *
+     * Files that could not be opened are not listed.  The list is only added to.  Clear it to start a new record.
+     * @return Vector of strings, variable passed by reference.  The list of full paths to the files read.
+     */
+    std::vector<std::string> &listReadFiles();
+
 //==========================================Section Separator =========================================================
 public slots:
         //------------------------------------------Function Separator ----------------------------------------------------
@@ -327,6 +371,19 @@ protected:
      */
     ofreq::System* ptSystem = NULL;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Pointer to the list of input files held in memory.  Keyed by the full path of each file.  NULL when
+     * all files come from disk.
+     */
+    const std::map<std::string, std::string>* ptMemory = NULL;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of files opened and parsed by readFile().  Full paths, in the order they were read.
+     */
+    std::vector<std::string> plistReadFiles;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief private function to initialize variables and perform other functions common to all constructors.
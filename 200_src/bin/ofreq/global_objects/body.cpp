@@ -47,6 +47,7 @@ Body::Body()
 //    initMassMat();
     pCentroid.zeros(3,1);
     pPosn.zeros(3,1);
+    pHydroIndex = -1;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -728,6 +729,18 @@ double Body::getPosnZ()
     return pPosn(Tz,0);
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+double Body::getLocationX()
+{
+    return getPosnX() + getCenX();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double Body::getLocationY()
+{
+    return getPosnY() + getCenY();
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 Mat<double> Body::getPosn()
 {
@@ -1008,15 +1021,58 @@ vector<string> &Body::listNamedLink_user()
 //------------------------------------------Function Separator --------------------------------------------------------
 string &Body::listNamedLink_user(unsigned int varIn)
 {
-    //Check if need to resize the vector
-    if ((varIn > plistLinkedBody_usr.size() - 1) || (plistLinkedBody_usr.size() == 0))
+    //Check if need to resize the vectors.  The linked body list keeps one entry for each name.
+    if ((varIn > plistNamedLink_usr.size() - 1) || (plistNamedLink_usr.size() == 0))
     {
+        plistNamedLink_usr.resize(varIn + 1);
         plistLinkedBody_usr.resize(varIn + 1);
     }
 
     return plistNamedLink_usr.at(varIn);
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<int> &Body::listCrossIndex_user()
+{
+    return plistLinkedIndex_usr;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Body::getCrossIndex_user(int index)
+{
+    if ((index < 0) || (index >= static_cast<int>(plistLinkedIndex_usr.size())))
+        return -1;
+
+    return plistLinkedIndex_usr.at(index);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<int> &Body::listCrossIndex_hydro()
+{
+    return plistLinkedIndex_hydro;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Body::getCrossIndex_hydro(int index)
+{
+    if ((index < 0) || (index >= static_cast<int>(plistLinkedIndex_hydro.size())))
+        return -1;
+
+    return plistLinkedIndex_hydro.at(index);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Body::setHydroIndex(int indexIn)
+{
+    pHydroIndex = indexIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Body::getHydroIndex()
+{
+    return pHydroIndex;
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void Body::setMotionModel(ofreq::MotionModel &modelIn)
 {
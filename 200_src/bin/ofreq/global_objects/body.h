@@ -411,6 +411,26 @@ public:
      */
     double getPosnZ();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the location of the body in the X-axis, in the world coordinate system.
+     *
+     * The input files give the centroid in world coordinates, so the location is the body position plus the
+     * centroid.  Used to find the distance and bearing between bodies.  Units are in meters.
+     * @return Double precision floating number specifying the location on the X-axis, units of meters.
+     */
+    double getLocationX();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the location of the body in the Y-axis, in the world coordinate system.
+     *
+     * The input files give the centroid in world coordinates, so the location is the body position plus the
+     * centroid.  Used to find the distance and bearing between bodies.  Units are in meters.
+     * @return Double precision floating number specifying the location on the Y-axis, units of meters.
+     */
+    double getLocationY();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Returns the entire matrix for position of the body.
@@ -706,6 +726,63 @@ public:
      */
     std::string &listNamedLink_user(unsigned int varIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of linked body indices for user cross-body forces.
+     *
+     * The same links as listCrossBody_user(), but stored as the index of the linked body in the system list of
+     * bodies.  The indices are resolved once by System::resolveIndex(), so that later steps do not need to search
+     * through the list of bodies.  The indices of this list match the indices of listForceCross_user.
+     * @return Returns the list of linked body indices.  Variable passed by reference.
+     * @sa System::resolveIndex()
+     */
+    std::vector<int> &listCrossIndex_user();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the index of a single linked body for the user cross-body force.
+     * @param index Integer.  The index of the cross-body force.
+     * @return Returns the index of the linked body in the system list of bodies.  Returns -1 if the index was not
+     * resolved.  Variable passed by value.
+     */
+    int getCrossIndex_user(int index);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of linked body indices for hydrodynamic cross-body forces.
+     *
+     * The same links as listCrossBody_hydro(), but stored as the index of the linked body in the system list of
+     * bodies.  The indices of this list match the indices of listForceCross_hydro.
+     * @return Returns the list of linked body indices.  Variable passed by reference.
+     */
+    std::vector<int> &listCrossIndex_hydro();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the index of a single linked body for the hydro cross-body force.
+     * @param index Integer.  The index of the cross-body force.
+     * @return Returns the index of the linked body in the system list of bodies.  Returns -1 if the index was not
+     * resolved.  Variable passed by value.
+     */
+    int getCrossIndex_hydro(int index);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the index of the HydroManager object that holds the hydrodynamic data for this body.
+     * @param indexIn Integer, variable passed by value.  The index of the HydroManager in the system.  Use -1 if the
+     * body has no hydrodynamic data.
+     * @sa System::resolveIndex()
+     */
+    void setHydroIndex(int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the index of the HydroManager object that holds the hydrodynamic data for this body.
+     * @return Returns integer, variable passed by value.  The index of the HydroManager in the system.  Returns -1
+     * if the body has no hydrodynamic data, or if the index was not resolved.
+     */
+    int getHydroIndex();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Sets the motion model for lookup later.
@@ -868,6 +945,24 @@ private:
      */
     std::vector<std::string> plistNamedLink_usr;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of linked body indices for user cross-body forces.  Matches plistLinkedBody_usr.
+     */
+    std::vector<int> plistLinkedIndex_usr;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of linked body indices for hydrodynamic cross-body forces.  Matches plistLinkedBody_hydro.
+     */
+    std::vector<int> plistLinkedIndex_hydro;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The index of the HydroManager object that holds the hydrodynamic data for this body.
+     */
+    int pHydroIndex;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Private variable for the mass matrix.
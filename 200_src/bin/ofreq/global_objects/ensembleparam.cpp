@@ -0,0 +1,228 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "ensembleparam.h"
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleParam::EnsembleParam()
+{
+    pBodyName = "";
+    pForceName = "";
+    pProperty = -1;
+    pDistribution = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleParam::~EnsembleParam()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleParam::setBodyName(string nameIn)
+{
+    pBodyName = nameIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string EnsembleParam::getBodyName()
+{
+    return pBodyName;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleParam::setForceName(string nameIn)
+{
+    pForceName = nameIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string EnsembleParam::getForceName()
+{
+    return pForceName;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleParam::setProperty(int propIn)
+{
+    pProperty = propIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int EnsembleParam::getProperty()
+{
+    return pProperty;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleParam::setDistribution(int distIn)
+{
+    pDistribution = distIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int EnsembleParam::getDistribution()
+{
+    return pDistribution;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &EnsembleParam::listValue()
+{
+    return plistValue;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> EnsembleParam::drawSamples(int nIn, mt19937 &genIn)
+{
+    vector<double> output;
+    string name = pBodyName.empty() ? pForceName : pBodyName;
+
+    if (pDistribution == 2)
+    {
+        //Sample table.  Values are used in order.
+        if (static_cast<int>(plistValue.size()) != nIn)
+            throw std::runtime_error("Ensemble sample table does not match the number of samples.  Parameter:  " +
+                                     name + ".  Table size:  " + itoa(plistValue.size()) + ".  Samples:  " +
+                                     itoa(nIn));
+        return plistValue;
+    }
+
+    if (plistValue.size() != 2)
+        throw std::runtime_error("Ensemble distribution requires two values.  Parameter:  " + name);
+
+    if (pDistribution == 0)
+    {
+        //Normal distribution.  Mean and standard deviation.
+        normal_distribution<double> dist(plistValue.at(0), plistValue.at(1));
+        for (int i = 0; i < nIn; i++)
+            output.push_back(dist(genIn));
+    }
+    else
+    {
+        //Uniform distribution.  Lower and upper bounds.
+        uniform_real_distribution<double> dist(plistValue.at(0), plistValue.at(1));
+        for (int i = 0; i < nIn; i++)
+            output.push_back(dist(genIn));
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double EnsembleParam::getBodyValue(Body &bodIn)
+{
+    switch (pProperty)
+    {
+    case 0:
+        return bodIn.getMass();
+    case 1:
+        return bodIn.getMomIxx();
+    case 2:
+        return bodIn.getMomIyy();
+    case 3:
+        return bodIn.getMomIzz();
+    case 4:
+        return bodIn.getMomIxy();
+    case 5:
+        return bodIn.getMomIxz();
+    case 6:
+        return bodIn.getMomIyz();
+    case 7:
+        return bodIn.getCenX();
+    case 8:
+        return bodIn.getCenY();
+    case 9:
+        return bodIn.getCenZ();
+    default:
+        throw std::runtime_error("Unknown mass property for ensemble parameter.  Body:  " + pBodyName);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleParam::setBodyValue(Body &bodIn, double valIn)
+{
+    switch (pProperty)
+    {
+    case 0:
+        bodIn.setMass(valIn);
+        break;
+    case 1:
+        bodIn.setMomIxx(valIn);
+        break;
+    case 2:
+        bodIn.setMomIyy(valIn);
+        break;
+    case 3:
+        bodIn.setMomIzz(valIn);
+        break;
+    case 4:
+        bodIn.setMomIxy(valIn);
+        break;
+    case 5:
+        bodIn.setMomIxz(valIn);
+        break;
+    case 6:
+        bodIn.setMomIyz(valIn);
+        break;
+    case 7:
+        bodIn.setCenX(valIn);
+        break;
+    case 8:
+        bodIn.setCenY(valIn);
+        break;
+    case 9:
+        bodIn.setCenZ(valIn);
+        break;
+    default:
+        throw std::runtime_error("Unknown mass property for ensemble parameter.  Body:  " + pBodyName);
+    }
+
+    //Mass couples with the centre of gravity.  Refresh the coupling terms.
+    if (pProperty == 0)
+        bodIn.setCenX(bodIn.getCenX());
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
@@ -0,0 +1,224 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#ifndef ENSEMBLEPARAM_H
+#define ENSEMBLEPARAM_H
+#include <string>
+#include <vector>
+#include <random>
+#include "../system_objects/ofreqcore.h"
+#include "body.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The EnsembleParam class defines one uncertain parameter of an ensemble study.  A parameter is either a mass
+ * property of a body, or a factor that scales all coefficients of a user reactive force or user cross-body force.
+ * The System object holds a list of EnsembleParam objects.  Each sample of the ensemble draws one value for every
+ * parameter.
+ *
+ * The values of a parameter come from one of three distributions:
+ * 0 = Normal distribution.  The list of values holds the mean and the standard deviation.
+ * 1 = Uniform distribution.  The list of values holds the lower bound and the upper bound.
+ * 2 = Sample table.  The list of values holds one value for each sample, in order.
+ *
+ * Body mass properties use the same names as the bodies input file.  The property is stored as an integer:
+ * 0 = mass, 1 = ixx, 2 = iyy, 3 = izz, 4 = ixy, 5 = ixz, 6 = iyz, 7 = cogx, 8 = cogy, 9 = cogz.
+ * Values for a body are the property itself, not a change in the property.
+ */
+class EnsembleParam : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    EnsembleParam();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~EnsembleParam();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the name of the body to vary.  Leave blank if the parameter is a user force.
+     * @param nameIn String.  The name of the body.  Variable passed by value.
+     */
+    void setBodyName(std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the body to vary.
+     * @return String.  The name of the body.  Blank if the parameter is a user force.  Returned variable passed by
+     * value.
+     */
+    std::string getBodyName();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the name of the user force to scale.  Leave blank if the parameter is a body mass property.
+     * @param nameIn String.  The name of the user reactive force or user cross-body force.  Variable passed by
+     * value.
+     */
+    void setForceName(std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the user force to scale.
+     * @return String.  The name of the user force.  Blank if the parameter is a body mass property.  Returned
+     * variable passed by value.
+     */
+    std::string getForceName();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the mass property of the body to vary.
+     * @param propIn Integer.  The mass property, as listed in the class description.  Variable passed by value.
+     */
+    void setProperty(int propIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the mass property of the body to vary.
+     * @return Integer.  The mass property, as listed in the class description.  -1 if not set.  Returned variable
+     * passed by value.
+     */
+    int getProperty();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the distribution of the parameter values.
+     * @param distIn Integer.  0 = normal, 1 = uniform, 2 = sample table.  Variable passed by value.
+     */
+    void setDistribution(int distIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the distribution of the parameter values.
+     * @return Integer.  0 = normal, 1 = uniform, 2 = sample table.  Returned variable passed by value.
+     */
+    int getDistribution();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of values that define the distribution.  Meaning depends on the distribution, as listed in the
+     * class description.
+     * @return Vector of doubles.  The list of values.  Returned variable passed by reference.
+     */
+    std::vector<double> &listValue();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Draws the parameter value for each sample.
+     * @param nIn Integer.  The number of samples.  A sample table must have exactly this many values.  Variable
+     * passed by value.
+     * @param genIn The random number generator.  Shared by all parameters so the samples only depend on the seed.
+     * Variable passed by reference.
+     * @return Vector of doubles.  One value for each sample.  Returned variable passed by value.
+     */
+    std::vector<double> drawSamples(int nIn, std::mt19937 &genIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the current value of the mass property from a body.
+     * @param bodIn The body to read.  Variable passed by reference.
+     * @return Double.  The value of the mass property.  Returned variable passed by value.
+     */
+    double getBodyValue(ofreq::Body &bodIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the mass property on a body.  The body updates the coupling terms of its mass matrix.
+     * @param bodIn The body to change.  Variable passed by reference.
+     * @param valIn Double.  The new value of the mass property.  Variable passed by value.
+     */
+    void setBodyValue(ofreq::Body &bodIn, double valIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pBodyName; /**< The name of the body to vary. */
+    std::string pForceName; /**< The name of the user force to scale. */
+    int pProperty; /**< The mass property of the body to vary. */
+    int pDistribution; /**< The distribution of the parameter values. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of values that define the distribution.
+     */
+    std::vector<double> plistValue;
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // ENSEMBLEPARAM_H
@@ -0,0 +1,109 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "forcedrag.h"
+#include <cmath>
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+double ForceDrag::LINEAR_FACTOR = sqrt(8.0 / M_PI); /**< The factor sqrt(8 / pi) from stochastic linearization. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ForceDrag::ForceDrag()
+{
+    pReactIndex = -1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ForceDrag::~ForceDrag()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ForceDrag::setReactIndex(int indexIn)
+{
+    pReactIndex = indexIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int ForceDrag::getReactIndex()
+{
+    return pReactIndex;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &ForceDrag::listCoeff()
+{
+    return plistCoeff;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &ForceDrag::listLinear()
+{
+    return plistLinear;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double ForceDrag::calcLinear(int eqnIn, double rmsIn)
+{
+    return LINEAR_FACTOR * plistCoeff.at(eqnIn) * rmsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ForceDrag::applyLinear(ForceReact &forceIn)
+{
+    //One linear damping entry for each equation.
+    plistLinear.resize(plistCoeff.size(), 0.0);
+
+    //Equation i has damping on variable i.
+    Derivative deriv;
+    for (unsigned int i = 0; i < plistLinear.size(); i++)
+    {
+        vector<double> coeff(i + 1, 0.0);
+        coeff.at(i) = plistLinear.at(i);
+        deriv.addModelEquation(coeff, i);
+    }
+
+    //Damping is the first derivative.
+    forceIn.addDerivative(deriv, 1);
+}
@@ -0,0 +1,171 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef FORCEDRAG_H
+#define FORCEDRAG_H
+#include <vector>
+#include "forcereact.h"
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The ForceDrag class defines a viscous quadratic drag force, F = -C * |v| * v, for each equation of motion of a
+ * body.  Equation i has drag on variable i, with the quadratic coefficient C for that equation.
+ *
+ * ofreq only solves linear equations, so the drag force is replaced by an equivalent linear damping from stochastic
+ * linearization.  For a velocity response with a Gaussian distribution and standard deviation (RMS) s, the damping
+ * that gives the same expected energy dissipation is:
+ * B = sqrt(8 / pi) * C * s
+ * The RMS velocity depends on the damping, so the DragSolver iterates the frequency sweep until the damping and the
+ * response agree.
+ *
+ * The equivalent linear damping is stored as the first derivative of a user reactive force, held in the list of
+ * user reactive forces in the System object.  Bodies link to the drag force by name, the same as any other user
+ * reactive force.  The ForceDrag object records which reactive force it controls.
+ */
+class ForceDrag : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    ForceDrag();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~ForceDrag();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the index of the user reactive force that holds the equivalent linear damping.
+     * @param indexIn Integer.  Index in the list of user reactive forces in the System object.  Variable passed by
+     * value.
+     */
+    void setReactIndex(int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the index of the user reactive force that holds the equivalent linear damping.
+     * @return Integer.  Index in the list of user reactive forces in the System object.  Returned variable passed by
+     * value.
+     */
+    int getReactIndex();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of quadratic drag coefficients.  One entry for each equation of motion.
+     * @return Vector of doubles.  The quadratic drag coefficients.  Returned variable passed by reference.
+     */
+    std::vector<double> &listCoeff();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of equivalent linear damping coefficients.  One entry for each equation of motion.  Starts
+     * at zero and keeps the result of the last linearization, so that a new linearization starts from the last one.
+     * @return Vector of doubles.  The linear damping coefficients.  Returned variable passed by reference.
+     */
+    std::vector<double> &listLinear();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the equivalent linear damping for one equation from the RMS velocity.
+     * @param eqnIn Integer.  The index of the equation.  Variable passed by value.
+     * @param rmsIn Double.  The RMS velocity of the variable for that equation.  Variable passed by value.
+     * @return Double.  The equivalent linear damping coefficient.  Returned variable passed by value.
+     */
+    double calcLinear(int eqnIn, double rmsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the equivalent linear damping into the reactive force.  Replaces the first derivative of the
+     * force with one equation for each entry in the list of linear damping coefficients.
+     * @param forceIn The user reactive force that holds the linear damping.  Variable passed by reference.
+     */
+    void applyLinear(ForceReact &forceIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pReactIndex; /**< Index of the user reactive force that holds the linear damping. */
+    std::vector<double> plistCoeff; /**< Quadratic drag coefficients, one for each equation. */
+    std::vector<double> plistLinear; /**< Equivalent linear damping coefficients, one for each equation. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    static double LINEAR_FACTOR; /**< The factor sqrt(8 / pi) from stochastic linearization. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // FORCEDRAG_H
@@ -116,3 +116,19 @@ int ForceReact::getMaxOrd()
 {
     return pDerivative.size() - 1;
 }
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ForceReact::scaleCoefficient(double factorIn)
+{
+    //Iterate through each derivative, equation, and coefficient.
+    for (unsigned int i = 0; i < pDerivative.size(); i++)
+    {
+        for (unsigned int j = 0; j < pDerivative.at(i).listEquation().size(); j++)
+        {
+            for (unsigned int k = 0; k < pDerivative.at(i).listEquation(j).listCoefficient().size(); k++)
+            {
+                pDerivative.at(i).listEquation(j).listCoefficient(k) *= factorIn;
+            }
+        }
+    }
+}
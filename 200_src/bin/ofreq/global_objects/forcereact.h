@@ -159,6 +159,16 @@ public:
      */
     int getMaxOrd();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Multiplies every coefficient of every derivative in the force object by the specified factor.
+     *
+     * Used for parameter scans.  The force is linear in its coefficients, so scaling the coefficients scales the
+     * force matrix by the same factor.
+     * @param factorIn Double.  The factor to multiply all coefficients by.  Variable passed by value.
+     */
+    void scaleCoefficient(double factorIn);
+
 //==========================================Section Separator =========================================================
 protected:
     //------------------------------------------Function Separator ----------------------------------------------------
@@ -124,6 +124,7 @@ double mathInterp::checkAngle(double angIn)
         logStd.Notify();
         logErr.Write(ID + std::string(err.what()));  
     }
+    return angIn;
 }
 
 
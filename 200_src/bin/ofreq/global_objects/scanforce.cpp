@@ -0,0 +1,84 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "scanforce.h"
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ScanForce::ScanForce()
+{
+    pForceName = "";
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ScanForce::~ScanForce()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ScanForce::setForceName(string nameIn)
+{
+    pForceName = nameIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string ScanForce::getForceName()
+{
+    return pForceName;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &ScanForce::listFactor()
+{
+    return plistFactor;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double &ScanForce::listFactor(int index)
+{
+    return plistFactor.at(index);
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
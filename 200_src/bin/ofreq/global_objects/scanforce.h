@@ -0,0 +1,150 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+
+//######################################### Class Separator ###########################################################
+#ifndef SCANFORCE_H
+#define SCANFORCE_H
+#include <string>
+#include <vector>
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The ScanForce class defines one parameter of a parametric scan.  A parameter is a user reactive force or user
+ * cross-body force, identified by name, and a list of factors to scale all coefficients of that force by.  The
+ * System object holds a list of ScanForce objects.  The parameter sets of the scan are every combination of the
+ * factors across all ScanForce objects.
+ */
+class ScanForce : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    ScanForce();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~ScanForce();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the name of the user force to scan.
+     * @param nameIn String.  The name of the user reactive force or user cross-body force.  Variable passed by
+     * value.
+     */
+    void setForceName(std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the user force to scan.
+     * @return String.  The name of the user force.  Returned variable passed by value.
+     */
+    std::string getForceName();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of factors to scale the force coefficients by.  A factor of 1.0 is the force as defined in
+     * the forces input file.
+     * @return Vector of doubles.  The list of factors.  Returned variable passed by reference.
+     */
+    std::vector<double> &listFactor();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of factors to scale the force coefficients by.
+     * @param index Integer.  The index of the factor to return.  Variable passed by value.
+     * @return Double.  The factor at the specified index.  Returned variable passed by reference.
+     */
+    double &listFactor(int index);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The name of the user force to scan.
+     */
+    std::string pForceName;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of factors to scale the force coefficients by.
+     */
+    std::vector<double> plistFactor;
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // SCANFORCE_H
@@ -0,0 +1,180 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "farfield.h"
+
+using namespace std;
+using namespace arma;
+using namespace osea;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+double FarField::GRAVITY = 9.80665;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+FarField::FarField()
+{
+
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+FarField::~FarField()
+{
+
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat FarField::calcCoupling(HydroManager &hydroBod, HydroManager &hydroLink, double dxIn, double dyIn,
+                              double freqIn)
+{
+    double dist = sqrt(dxIn * dxIn + dyIn * dyIn);
+    if ((dist <= 0) || (freqIn <= 0) || (hydroBod.listHydroData().size() == 0) ||
+            (hydroBod.listHydroData().at(0).size() == 0))
+        return cx_mat();
+
+    //Deep water wave number and group velocity.
+    double grav = getGravity(hydroBod);
+    double rho = hydroBod.listHydroData(0, 0).getDensity();
+    double k = freqIn * freqIn / grav;
+    double cg = grav / (2 * freqIn);
+
+    //Direction of travel from the linked body to the body.
+    double dir = atan2(dyIn, dxIn);
+    if (dir < 0)
+        dir += 2 * M_PI;
+
+    cx_vec forceBod = hydroBod.getExcitation(dir, freqIn);
+    cx_vec forceLink = hydroLink.getExcitation(fmod(dir + M_PI, 2 * M_PI), freqIn);
+    if ((forceBod.n_elem == 0) || (forceLink.n_elem == 0))
+        return cx_mat();
+
+    //Radiated wave amplitude at the body, for unit motion of each mode of the linked body.
+    complex<double> scale = complex<double>(0, freqIn) * sqrt(k / (8 * M_PI * dist)) / (rho * grav * cg) *
+            polar(1.0, k * dist - M_PI / 4);
+
+    return forceBod * strans(forceLink * scale);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ForceCross FarField::makeForce(cx_mat couplingIn, double freqIn, string nameIn)
+{
+    ForceCross output;
+
+    for (int k = 0; k <= 2; k++)
+    {
+        Derivative tempDeriv;
+
+        for (unsigned int i = 0; i < couplingIn.n_rows; i++)
+        {
+            vector<double> listCoeff;
+
+            for (unsigned int j = 0; j < couplingIn.n_cols; j++)
+            {
+                if (k == 1)
+                    listCoeff.push_back(-imag(couplingIn(i,j)) / freqIn);
+                else if (k == 2)
+                    listCoeff.push_back(real(couplingIn(i,j)) / (freqIn * freqIn));
+                else
+                    listCoeff.push_back(0.0);
+            }
+
+            tempDeriv.addModelEquation(listCoeff, i);
+        }
+
+        output.addDerivative(tempDeriv, k);
+    }
+
+    output.setForceName(nameIn);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void FarField::addError(HydroManager &hydroBod, HydroManager &hydroLink, string nameIn, double dxIn, double dyIn,
+                        double &sumDiff, double &sumFull)
+{
+    if ((hydroBod.listHydroData().size() == 0) || (hydroBod.listHydroData().at(0).size() == 0))
+        return;
+
+    hydroData &data = hydroBod.listHydroData(0, 0);
+
+    for (unsigned int f = 0; f < data.listWaveFreq().size(); f++)
+    {
+        double freq = data.listWaveFreq(f);
+        if (freq <= 0)
+            continue;
+
+        cx_mat approx = calcCoupling(hydroBod, hydroLink, dxIn, dyIn, freq);
+        matForceCross cross = data.getDataCross(freq, nameIn);
+        if ((approx.n_elem == 0) || (cross.getMaxOrder() < 2))
+            continue;
+
+        //Full coupling from added mass and damping.  H = w^2 A - iw B
+        mat damp = real(cross.getDerivative(1));
+        mat mass = real(cross.getDerivative(2));
+        if ((mass.n_rows != approx.n_rows) || (mass.n_cols != approx.n_cols))
+            continue;
+
+        cx_mat full(freq * freq * mass, -freq * damp);
+
+        sumDiff += pow(norm(approx - full, "fro"), 2);
+        sumFull += pow(norm(full, "fro"), 2);
+    }
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double FarField::getGravity(HydroManager &hydroIn)
+{
+    vector<double> grav = hydroIn.getGravity();
+    double output = 0;
+
+    for (unsigned int i = 0; i < grav.size(); i++)
+        output += grav.at(i) * grav.at(i);
+
+    return (output > 0) ? sqrt(output) : GRAVITY;
+}
@@ -0,0 +1,181 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef FARFIELD_H
+#define FARFIELD_H
+#include <vector>
+#include <string>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "../system_objects/ofreqcore.h"
+#include "../global_objects/forcecross.h"
+#include "hydromanager.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The FarField class approximates the hydrodynamic interaction between two distant bodies, without any crossbody
+ * data.
+ *
+ * Motion of the linked body radiates a wave.  Far from the body, the radiated wave is a cylindrical wave, and its
+ * amplitude in each direction follows from the excitation force of the linked body by the Haskind relation.  The
+ * radiated wave arrives at the other body as a plane wave, and causes a force given by the excitation force of the
+ * other body for that wave direction.  For unit motion in mode j of the linked body, the force in mode i of the
+ * body is:
+ * H(i,j) = X_bod,i(t) * iw * X_link,j(t + pi) * sqrt(k / (8 pi R)) / (rho g cg) * exp(i(kR - pi/4))
+ * where t is the direction from the linked body to the body, R is the distance between them, k is the wave number,
+ * and cg is the group velocity.  Deep water is assumed for k and cg.  Wave directions are measured from the x-axis
+ * toward the y-axis of the world coordinate system, the same as the hydrodynamic data.
+ *
+ * The approximation ignores the evanescent near field and multiple scattering.  It improves as the distance grows
+ * compared to the wave length.  The coupling is returned as added mass and damping, the same form as crossbody data:
+ * A = real(H) / w^2, B = -imag(H) / w.
+ */
+class FarField : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    FarField();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~FarField();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the far-field coupling between two bodies.
+     * @param hydroBod HydroManager, passed by reference.  The hydrodynamic data of the body that receives the force.
+     * @param hydroLink HydroManager, passed by reference.  The hydrodynamic data of the linked body that moves.
+     * @param dxIn Double, variable passed by value.  Position of the body minus position of the linked body, along
+     * the x-axis.  Units of meters.
+     * @param dyIn Double, variable passed by value.  Position of the body minus position of the linked body, along
+     * the y-axis.  Units of meters.
+     * @param freqIn Double, variable passed by value.  The wave frequency, in units of rad/s.
+     * @return Returns arma::cx_mat, variable passed by value.  Force on each equation of the body for unit motion of
+     * each equation of the linked body.  Empty if either body has no excitation data.
+     */
+    arma::cx_mat calcCoupling(HydroManager &hydroBod, HydroManager &hydroLink, double dxIn, double dyIn,
+                              double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts a far-field coupling into a crossbody force, with added mass and damping.
+     * @param couplingIn arma::cx_mat, passed by value.  The coupling from calcCoupling().  Must be square.
+     * @param freqIn Double, variable passed by value.  The wave frequency, in units of rad/s.
+     * @param nameIn String, variable passed by value.  The name of the linked hydrobody.
+     * @return Returns ForceCross, variable passed by value.  Derivative orders 0, 1, and 2.  The stiffness is zero.
+     */
+    ForceCross makeForce(arma::cx_mat couplingIn, double freqIn, std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Compares the far-field coupling with the full crossbody data, over all wave frequencies of the data.
+     *
+     * Adds the squared Frobenius norms of the difference and of the full coupling to the running sums.  The relative
+     * error is sqrt(sumDiff / sumFull).
+     * @param hydroBod HydroManager, passed by reference.  The hydrodynamic data of the body that receives the force.
+     * Must still contain the crossbody data for the linked body.
+     * @param hydroLink HydroManager, passed by reference.  The hydrodynamic data of the linked body.
+     * @param nameIn String, variable passed by value.  The name of the linked hydrobody.
+     * @param dxIn Double, variable passed by value.  Position of the body minus position of the linked body, x-axis.
+     * @param dyIn Double, variable passed by value.  Position of the body minus position of the linked body, y-axis.
+     * @param sumDiff Double, passed by reference.  Running sum of the squared difference.
+     * @param sumFull Double, passed by reference.  Running sum of the squared full coupling.
+     */
+    void addError(HydroManager &hydroBod, HydroManager &hydroLink, std::string nameIn, double dxIn, double dyIn,
+                  double &sumDiff, double &sumFull);
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the magnitude of gravity for the hydrodynamic data.  Default of 9.80665 m/s^2 if not set.
+     * @param hydroIn HydroManager, passed by reference.  The hydrodynamic data.
+     * @return Returns double, variable passed by value.  Magnitude of gravity, in units of m/s^2.
+     */
+    double getGravity(HydroManager &hydroIn);
+
+    static double GRAVITY; /**< Default magnitude of gravity. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // FARFIELD_H
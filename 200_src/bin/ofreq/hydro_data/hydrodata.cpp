@@ -28,9 +28,11 @@
 
 using namespace osea::ofreq;
 using namespace std;
+using namespace arma;
 
 //==========================================Section Separator =========================================================
 //Static initialization
+double hydroData::RECIPTOL = 1.0e-12; /**< Relative tolerance for crossbody blocks to be equal within round off. */
 
 //==========================================Section Separator =========================================================
 //Public Functions
@@ -38,6 +40,10 @@ using namespace std;
 //------------------------------------------Function Separator --------------------------------------------------------
 hydroData::hydroData()
 {
+    pReactCompact = false;
+    pCrossCompact = false;
+    pReactSize = 0;
+    pReactOrd = 0;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -206,6 +212,21 @@ void hydroData::addWaveFreq(std::vector<double> freqIn)
 //------------------------------------------Function Separator --------------------------------------------------------
 matForceReact hydroData::getDataReact(double freqIn)
 {
+    //Read the resampled grid directly.
+    int grid = findGrid(freqIn);
+    if ((grid >= 0) && (pGridReact.n_cols > 0))
+    {
+        matForceReact output;
+        int nBlock = pReactSize * pReactSize;
+        for (int o = 0; o < pReactOrd; o++)
+        {
+            mat coeff(pGridReact.colptr(grid) + o * nBlock, pReactSize, pReactSize);
+            output.setDerivative(o, cx_mat(coeff, zeros<mat>(pReactSize, pReactSize)));
+        }
+
+        return output;
+    }
+
     //Find the closest distance indices
     vector<int> index = FindMatch(freqIn, plistWaveFreq);
 
@@ -222,14 +243,23 @@ matForceReact hydroData::getDataReact(double freqIn)
     return iPolate(freqIn,
             plistWaveFreq.at(index.at(0)),
             plistWaveFreq.at(index.at(1)),
-            plistDataReact.at(index.at(0)),
-            plistDataReact.at(index.at(1))
+            getReactAt(index.at(0)),
+            getReactAt(index.at(1))
             );
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 matForceActive hydroData::getDataActive(double freqIn)
 {
+    //Read the resampled grid directly.
+    int grid = findGrid(freqIn);
+    if ((grid >= 0) && (pGridActive.n_cols > 0))
+    {
+        matForceActive output;
+        output.listCoefficient() = pGridActive.col(grid);
+        return output;
+    }
+
     //Find the closest distance indices
     vector<int> index = FindMatch(freqIn, plistWaveFreq);
 
@@ -262,6 +292,27 @@ matForceActive hydroData::getDataActive(double freqIn)
 //------------------------------------------Function Separator --------------------------------------------------------
 matForceCross hydroData::getDataCross(double freqIn, int hydroInd)
 {
+    //Read the resampled grid directly.
+    int grid = findGrid(freqIn);
+    if ((grid >= 0) && (hydroInd >= 0) && (hydroInd < static_cast<int>(plistGridCross.size())))
+    {
+        matForceCross output;
+        output.setLinkedName(plistCrossName.at(hydroInd));
+
+        int nRow = plistCrossRows.at(hydroInd);
+        int nCol = plistCrossCols.at(hydroInd);
+        for (int o = 0; o < plistCrossOrd.at(hydroInd); o++)
+        {
+            mat coeff(plistGridCross.at(hydroInd).colptr(grid) + o * nRow * nCol, nRow, nCol);
+            if (plistCrossTrans.at(hydroInd))
+                coeff = strans(coeff);
+
+            output.setDerivative(o, cx_mat(coeff, zeros<mat>(coeff.n_rows, coeff.n_cols)));
+        }
+
+        return output;
+    }
+
     double dist[2];         //The distance between the search term and terms considered.
     vector<int> output(2);      //The vector of output terms.
 
@@ -278,7 +329,7 @@ matForceCross hydroData::getDataCross(double freqIn, int hydroInd)
         //Check if distance is smaller
         //And make sure that vector is large enough for specified index.
         if ((dist[0] < dist[1]) &&
-                (plistDataCross.at(i).size() >= hydroInd + 1))
+                (getCrossCount(i) >= hydroInd + 1))
         {
             dist[1] = dist[0];
             output.at(0) = i;
@@ -299,7 +350,7 @@ matForceCross hydroData::getDataCross(double freqIn, int hydroInd)
         //Also be sure that vector is large enough for the specified index.
         if ((dist[0] < dist[1]) &&
                 (i != output.at(0)) &&
-                (plistDataCross.at(i).size() >= hydroInd + 1))
+                (getCrossCount(i) >= hydroInd + 1))
         {
             dist[1] = dist[0];
             output.at(1) = i;
@@ -310,8 +361,8 @@ matForceCross hydroData::getDataCross(double freqIn, int hydroInd)
     matForceCross test = iPolate(freqIn,
             plistWaveFreq.at(output.at(0)),
             plistWaveFreq.at(output.at(1)),
-            plistDataCross.at(output.at(0)).at(hydroInd),
-            plistDataCross.at(output.at(1)).at(hydroInd));
+            getCrossAt(output.at(0), hydroInd),
+            getCrossAt(output.at(1), hydroInd));
 
     return test;
 }
@@ -330,7 +381,7 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
     //Include requirement that searched terms must match hydroName.
     for (int i = 0; i < plistWaveFreq.size(); i++)
     {
-        for (int j = 0; j < plistDataCross.at(i).size(); j++)
+        for (int j = 0; j < getCrossCount(i); j++)
         {
             //Calculate distance
             dist[0] = fabs(freqIn - plistWaveFreq.at(i));
@@ -338,7 +389,7 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
             //Check if distance is smaller
             //And require that frequency contains a hydrobody with the matching name.
             if ((dist[0] < dist[1]) &&
-                    (plistDataCross.at(i).at(j).getLinkedName().compare(hydroName) == 0))
+                    (getCrossName(i, j).compare(hydroName) == 0))
             {
                 dist[1] = dist[0];
                 output.at(0) = i;
@@ -353,7 +404,7 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
     //Iterate through and find the 2nd closest match
     for (int i = 0; i < plistWaveFreq.size(); i++)
     {
-        for (int j = 0; j < plistDataCross.at(i).size(); j++)
+        for (int j = 0; j < getCrossCount(i); j++)
         {
             //Calculate distance
             dist[0] = fabs(freqIn - plistWaveFreq.at(i));
@@ -362,7 +413,7 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
             //And require that frequency contains a hydrobody with the matching name.
             if ((dist[0] < dist[1]) &&
                     (i != output.at(0)) &&
-                    (plistDataCross.at(i).at(j).getLinkedName().compare(hydroName) == 0))
+                    (getCrossName(i, j).compare(hydroName) == 0))
             {
                 dist[1] = dist[0];
                 output.at(1) = i;
@@ -374,9 +425,9 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
     int hydroInd[2];              //Index of hydrobody names
     for (int i = 0; i < 2; i++)
     {
-        for (int j = 0; j < plistDataCross.at(i).size(); j++)
+        for (int j = 0; j < getCrossCount(output.at(i)); j++)
         {
-            if (plistDataCross.at(i).at(j).getLinkedName().compare(hydroName) == 0)
+            if (getCrossName(output.at(i), j).compare(hydroName) == 0)
             {
                 hydroInd[i] = j;
                 break;
@@ -388,8 +439,8 @@ matForceCross hydroData::getDataCross(double freqIn, std::string hydroName)
     return iPolate(freqIn,
             plistWaveFreq.at(output.at(0)),
             plistWaveFreq.at(output.at(1)),
-                   plistDataCross.at(output.at(0)).at(hydroInd[0]),
-            plistDataCross.at(output.at(1)).at(hydroInd[1])
+            getCrossAt(output.at(0), hydroInd[0]),
+            getCrossAt(output.at(1), hydroInd[1])
             );
 }
 
@@ -420,7 +471,7 @@ hydroData hydroData::interpHydroData(double freqIn)
                     this->getDataReact(freqIn));
 
         //Iterate through each item in the data cross.  Interpolate and add to the list.
-        for (int i = 0; i < plistDataCross.at(0).size(); i++)
+        for (int i = 0; i < getCrossCount(0); i++)
         {
             output.addDataCross(
                         this->getDataCross(freqIn, i)
@@ -473,6 +524,464 @@ double hydroData::getDensity()
     return pDensity;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void hydroData::compact()
+{
+    unsigned int nFreq = plistWaveFreq.size();
+
+    //Reactive forces.
+    if (!pReactCompact && (nFreq > 0) && (plistDataReact.size() == nFreq))
+    {
+        bool test = true;           //Test if all frequencies can be stored compact.
+        unsigned int nOrd = plistDataReact.at(0).listDerivative().size();
+        unsigned int n = 0;
+        if (nOrd > 0)
+            n = plistDataReact.at(0).listDerivative().at(0).n_rows;
+
+        vector<double> listVal;
+        listVal.reserve(nFreq * nOrd * n * n);
+
+        for (unsigned int k = 0; (k < nFreq) && test; k++)
+        {
+            vector<cx_mat> &deriv = plistDataReact.at(k).listDerivative();
+            if (deriv.size() != nOrd)
+                test = false;
+
+            for (unsigned int o = 0; (o < deriv.size()) && test; o++)
+            {
+                if ((deriv.at(o).n_rows != n) ||
+                        (deriv.at(o).n_cols != n) ||
+                        !addBlock(listVal, deriv.at(o)))
+                    test = false;
+            }
+        }
+
+        if (test)
+        {
+            pReactSize = n;
+            pReactOrd = nOrd;
+            plistReactVal.swap(listVal);
+            vector<matForceReact>().swap(plistDataReact);
+            pReactCompact = true;
+        }
+    }
+
+    //Crossbody forces.
+    if (!pCrossCompact && (nFreq > 0) && (plistDataCross.size() == nFreq))
+    {
+        bool test = true;           //Test if all frequencies can be stored compact.
+        unsigned int nCross = plistDataCross.at(0).size();
+
+        vector<string> listName;
+        vector<int> listOrd;
+        vector<int> listRow;
+        vector<int> listCol;
+        vector< shared_ptr< vector<double> > > listVal;
+
+        //The first frequency sets the layout for all others.
+        for (unsigned int c = 0; c < nCross; c++)
+        {
+            matForceCross &force = plistDataCross.at(0).at(c);
+            listName.push_back(force.getLinkedName());
+            listOrd.push_back(force.listDerivative().size());
+            if (force.listDerivative().size() > 0)
+            {
+                listRow.push_back(force.listDerivative().at(0).n_rows);
+                listCol.push_back(force.listDerivative().at(0).n_cols);
+            }
+            else
+            {
+                listRow.push_back(0);
+                listCol.push_back(0);
+            }
+            listVal.push_back(make_shared< vector<double> >());
+            listVal.back()->reserve(nFreq * listOrd.back() * listRow.back() * listCol.back());
+        }
+
+        for (unsigned int k = 0; (k < nFreq) && test; k++)
+        {
+            if (plistDataCross.at(k).size() != nCross)
+                test = false;
+
+            for (unsigned int c = 0; (c < nCross) && test; c++)
+            {
+                matForceCross &force = plistDataCross.at(k).at(c);
+                vector<cx_mat> &deriv = force.listDerivative();
+                if ((force.getLinkedName() != listName.at(c)) ||
+                        (static_cast<int>(deriv.size()) != listOrd.at(c)))
+                    test = false;
+
+                for (unsigned int o = 0; (o < deriv.size()) && test; o++)
+                {
+                    if ((static_cast<int>(deriv.at(o).n_rows) != listRow.at(c)) ||
+                            (static_cast<int>(deriv.at(o).n_cols) != listCol.at(c)) ||
+                            !addBlock(*listVal.at(c), deriv.at(o)))
+                        test = false;
+                }
+            }
+        }
+
+        if (test)
+        {
+            plistCrossName.swap(listName);
+            plistCrossOrd.swap(listOrd);
+            plistCrossRows.swap(listRow);
+            plistCrossCols.swap(listCol);
+            plistCrossVal.swap(listVal);
+            plistCrossTrans.assign(nCross, false);
+            plistCrossOwner.assign(nCross, true);
+            vector< vector<matForceCross> >().swap(plistDataCross);
+            pCrossCompact = true;
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int hydroData::shareCross(int crossIn, hydroData &other, int otherCross, double avgTolIn)
+{
+    //Both blocks must be compact, and not already shared.
+    if (!pCrossCompact || !other.pCrossCompact)
+        return 0;
+    if (!plistCrossOwner.at(crossIn) || !other.plistCrossOwner.at(otherCross) ||
+            plistCrossTrans.at(crossIn) || other.plistCrossTrans.at(otherCross))
+        return 0;
+
+    //Blocks must have transposed sizes, and the same frequencies.
+    int nRow = plistCrossRows.at(crossIn);
+    int nCol = plistCrossCols.at(crossIn);
+    if ((other.plistCrossRows.at(otherCross) != nCol) ||
+            (other.plistCrossCols.at(otherCross) != nRow) ||
+            (other.plistCrossOrd.at(otherCross) != plistCrossOrd.at(crossIn)) ||
+            (other.plistWaveFreq != plistWaveFreq))
+        return 0;
+
+    vector<double> &valA = *plistCrossVal.at(crossIn);
+    vector<double> &valB = *other.plistCrossVal.at(otherCross);
+    int nBlock = nRow * nCol;
+    if ((nBlock == 0) || (valA.size() != valB.size()))
+        return 0;
+
+    //Check reciprocity for each frequency and derivative order.
+    double tol = max(RECIPTOL, avgTolIn);
+    bool exact = true;
+    int nSet = valA.size() / nBlock;
+    for (int s = 0; s < nSet; s++)
+    {
+        double maxVal = 0.0;
+        double maxDiff = 0.0;
+
+        for (int j = 0; j < nCol; j++)
+        {
+            for (int i = 0; i < nRow; i++)
+            {
+                double a = valA.at(s * nBlock + j * nRow + i);
+                double b = valB.at(s * nBlock + i * nCol + j);
+
+                maxVal = max(maxVal, max(fabs(a), fabs(b)));
+                maxDiff = max(maxDiff, fabs(a - b));
+            }
+        }
+
+        if (maxDiff > tol * maxVal)
+            return 0;
+        if (maxDiff > RECIPTOL * maxVal)
+            exact = false;
+    }
+
+    //Blocks equal within round off keep the values of this data set.  Others store the average once.
+    if (!exact)
+    {
+        for (int s = 0; s < nSet; s++)
+        {
+            for (int j = 0; j < nCol; j++)
+            {
+                for (int i = 0; i < nRow; i++)
+                {
+                    double &a = valA.at(s * nBlock + j * nRow + i);
+                    a = 0.5 * (a + valB.at(s * nBlock + i * nCol + j));
+                }
+            }
+        }
+    }
+
+    other.plistCrossVal.at(otherCross) = plistCrossVal.at(crossIn);
+    other.plistCrossRows.at(otherCross) = nRow;
+    other.plistCrossCols.at(otherCross) = nCol;
+    other.plistCrossTrans.at(otherCross) = true;
+    other.plistCrossOwner.at(otherCross) = false;
+
+    if (exact)
+        return 1;
+    else
+        return 2;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+unsigned long hydroData::getStorage()
+{
+    unsigned long output = 0;
+
+    //Reactive forces.
+    if (pReactCompact)
+        output += plistReactVal.size() * sizeof(double);
+    else
+    {
+        for (unsigned int k = 0; k < plistDataReact.size(); k++)
+        {
+            for (unsigned int o = 0; o < plistDataReact.at(k).listDerivative().size(); o++)
+                output += plistDataReact.at(k).listDerivative().at(o).n_elem * sizeof(complex<double>);
+        }
+    }
+
+    //Crossbody forces.  Shared blocks only count for the owner.
+    if (pCrossCompact)
+    {
+        for (unsigned int c = 0; c < plistCrossVal.size(); c++)
+        {
+            if (plistCrossOwner.at(c))
+                output += plistCrossVal.at(c)->size() * sizeof(double);
+        }
+    }
+    else
+    {
+        for (unsigned int k = 0; k < plistDataCross.size(); k++)
+        {
+            for (unsigned int c = 0; c < plistDataCross.at(k).size(); c++)
+            {
+                for (unsigned int o = 0; o < plistDataCross.at(k).at(c).listDerivative().size(); o++)
+                    output += plistDataCross.at(k).at(c).listDerivative().at(o).n_elem * sizeof(complex<double>);
+            }
+        }
+    }
+
+    //Resampled grid.
+    output += pGridReact.n_elem * sizeof(double);
+    output += pGridActive.n_elem * sizeof(complex<double>);
+    for (unsigned int c = 0; c < plistGridCross.size(); c++)
+        output += plistGridCross.at(c).n_elem * sizeof(double);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool hydroData::isCompact()
+{
+    return pReactCompact;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int hydroData::getCrossCount(int freqInd)
+{
+    if (pCrossCompact)
+        return plistCrossName.size();
+
+    if ((freqInd < 0) || (freqInd >= static_cast<int>(plistDataCross.size())))
+        return 0;
+
+    return plistDataCross.at(freqInd).size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string hydroData::getCrossName(int freqInd, int crossInd)
+{
+    if (pCrossCompact)
+        return plistCrossName.at(crossInd);
+
+    return plistDataCross.at(freqInd).at(crossInd).getLinkedName();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+matForceReact hydroData::getReactAt(int freqInd)
+{
+    if (!pReactCompact)
+        return plistDataReact.at(freqInd);
+
+    //Rebuild the complex matrices.
+    matForceReact output;
+    for (int o = 0; o < pReactOrd; o++)
+    {
+        mat coeff = getReactReal(freqInd, o);
+        output.setDerivative(o, cx_mat(coeff, zeros<mat>(coeff.n_rows, coeff.n_cols)));
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+matForceCross hydroData::getCrossAt(int freqInd, int crossInd)
+{
+    if (!pCrossCompact)
+        return plistDataCross.at(freqInd).at(crossInd);
+
+    //Rebuild the complex matrices.
+    matForceCross output;
+    output.setLinkedName(plistCrossName.at(crossInd));
+    for (int o = 0; o < plistCrossOrd.at(crossInd); o++)
+    {
+        mat coeff = getCrossReal(freqInd, crossInd, o);
+        output.setDerivative(o, cx_mat(coeff, zeros<mat>(coeff.n_rows, coeff.n_cols)));
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat hydroData::getReactReal(int freqInd, int ordIn)
+{
+    if (!pReactCompact)
+    {
+        matForceReact &force = plistDataReact.at(freqInd);
+        if ((ordIn < 0) || (ordIn >= static_cast<int>(force.listDerivative().size())))
+            return mat();
+
+        return real(force.listDerivative().at(ordIn));
+    }
+
+    if ((freqInd < 0) || (freqInd >= static_cast<int>(plistWaveFreq.size())))
+        throw std::out_of_range("Wave frequency index exceeds the list of reactive forces.");
+    if ((ordIn < 0) || (ordIn >= pReactOrd))
+        return mat();
+
+    int nBlock = pReactSize * pReactSize;
+    return getBlock(plistReactVal, (freqInd * pReactOrd + ordIn) * nBlock, pReactSize, pReactSize);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat hydroData::getCrossReal(int freqInd, int crossInd, int ordIn)
+{
+    if (!pCrossCompact)
+    {
+        matForceCross &force = plistDataCross.at(freqInd).at(crossInd);
+        if ((ordIn < 0) || (ordIn >= static_cast<int>(force.listDerivative().size())))
+            return mat();
+
+        return real(force.listDerivative().at(ordIn));
+    }
+
+    if ((freqInd < 0) || (freqInd >= static_cast<int>(plistWaveFreq.size())))
+        throw std::out_of_range("Wave frequency index exceeds the list of crossbody forces.");
+    int nOrd = plistCrossOrd.at(crossInd);
+    if ((ordIn < 0) || (ordIn >= nOrd))
+        return mat();
+
+    int nRow = plistCrossRows.at(crossInd);
+    int nCol = plistCrossCols.at(crossInd);
+    mat output = getBlock(*plistCrossVal.at(crossInd), (freqInd * nOrd + ordIn) * nRow * nCol, nRow, nCol);
+
+    //Reciprocal block owned by the linked body.
+    if (plistCrossTrans.at(crossInd))
+        return strans(output);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void hydroData::resample(std::vector<double> freqIn)
+{
+    plistGridFreq.clear();
+    pGridReact.reset();
+    pGridActive.reset();
+    plistGridCross.clear();
+
+    //Interpolation needs at least two wave frequencies.
+    int nFreq = plistWaveFreq.size();
+    if ((freqIn.size() == 0) || (nFreq < 2))
+        return;
+
+    //Interpolation weights.  Same rules as getDataReact().
+    mat weightT = strans(getWeight(freqIn, true));
+
+    //Reactive forces.  Rows are coefficients, columns are wave frequencies.
+    if (pReactCompact && (plistReactVal.size() > 0))
+    {
+        int nCoeff = pReactOrd * pReactSize * pReactSize;
+        pGridReact = mat(&plistReactVal.at(0), nCoeff, nFreq, false) * weightT;
+    }
+
+    //Active forces.  Only if every wave frequency has the same size of column.
+    if (static_cast<int>(plistDataActive.size()) == nFreq)
+    {
+        unsigned int nCoeff = plistDataActive.at(0).listCoefficient().n_rows;
+        bool test = (nCoeff > 0);
+        for (int k = 0; (k < nFreq) && test; k++)
+        {
+            test = (plistDataActive.at(k).listCoefficient().n_rows == nCoeff) &&
+                    (plistDataActive.at(k).listCoefficient().n_cols == 1);
+        }
+
+        if (test)
+        {
+            cx_mat coeff(nCoeff, nFreq);
+            for (int k = 0; k < nFreq; k++)
+                coeff.col(k) = plistDataActive.at(k).listCoefficient();
+
+            pGridActive = coeff * cx_mat(weightT, zeros<mat>(weightT.n_rows, weightT.n_cols));
+        }
+    }
+
+    //Crossbody forces.  Same rules as getDataCross(), which keeps the closest wave frequency first.
+    if (pCrossCompact)
+    {
+        weightT = strans(getWeight(freqIn, false));
+
+        for (unsigned int c = 0; c < plistCrossVal.size(); c++)
+        {
+            vector<double> &val = *plistCrossVal.at(c);
+            int nCoeff = plistCrossOrd.at(c) * plistCrossRows.at(c) * plistCrossCols.at(c);
+
+            if (nCoeff == 0)
+                plistGridCross.push_back(zeros<mat>(0, freqIn.size()));
+            else
+                plistGridCross.push_back(mat(&val.at(0), nCoeff, nFreq, false) * weightT);
+        }
+    }
+
+    plistGridFreq = freqIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int hydroData::removeCross(string hydroName)
+{
+    int output = 0;
+
+    if (pCrossCompact)
+    {
+        for (int c = plistCrossName.size() - 1; c >= 0; c--)
+        {
+            if (plistCrossName.at(c) != hydroName)
+                continue;
+
+            plistCrossName.erase(plistCrossName.begin() + c);
+            plistCrossOrd.erase(plistCrossOrd.begin() + c);
+            plistCrossRows.erase(plistCrossRows.begin() + c);
+            plistCrossCols.erase(plistCrossCols.begin() + c);
+            plistCrossVal.erase(plistCrossVal.begin() + c);
+            plistCrossTrans.erase(plistCrossTrans.begin() + c);
+            plistCrossOwner.erase(plistCrossOwner.begin() + c);
+            if (c < static_cast<int>(plistGridCross.size()))
+                plistGridCross.erase(plistGridCross.begin() + c);
+            output++;
+        }
+
+        return output;
+    }
+
+    for (unsigned int k = 0; k < plistDataCross.size(); k++)
+    {
+        vector<matForceCross> &listCross = plistDataCross.at(k);
+        for (int c = listCross.size() - 1; c >= 0; c--)
+        {
+            if (listCross.at(c).getLinkedName() == hydroName)
+            {
+                listCross.erase(listCross.begin() + c);
+                output++;
+            }
+        }
+    }
+
+    return output;
+}
+
 //==========================================Section Separator =========================================================
 //Protected Functions
 
@@ -480,3 +989,72 @@ double hydroData::getDensity()
 
 //==========================================Section Separator =========================================================
 //Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat hydroData::getWeight(vector<double> &freqIn, bool sortIn)
+{
+    mat output = zeros<mat>(freqIn.size(), plistWaveFreq.size());
+
+    for (unsigned int k = 0; k < freqIn.size(); k++)
+    {
+        vector<int> index = FindMatch(freqIn.at(k), plistWaveFreq);
+
+        //Make sure the two frequencies are in the correct order.
+        if (sortIn && (plistWaveFreq.at(index.at(1)) < plistWaveFreq.at(index.at(0))))
+        {
+            int swap = index.at(0);
+            index.at(0) = index.at(1);
+            index.at(1) = swap;
+        }
+
+        //Weight of the second frequency.
+        double p = iPolate(freqIn.at(k),
+                           plistWaveFreq.at(index.at(0)),
+                           plistWaveFreq.at(index.at(1)),
+                           0.0,
+                           1.0);
+
+        output(k, index.at(0)) += 1.0 - p;
+        output(k, index.at(1)) += p;
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int hydroData::findGrid(double freqIn)
+{
+    for (unsigned int k = 0; k < plistGridFreq.size(); k++)
+    {
+        if (plistGridFreq.at(k) == freqIn)
+            return k;
+    }
+
+    return -1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat hydroData::getBlock(vector<double> &valIn, int startIn, int rowIn, int colIn)
+{
+    if ((rowIn == 0) || (colIn == 0))
+        return mat(rowIn, colIn);
+
+    return mat(&valIn.at(startIn), rowIn, colIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool hydroData::addBlock(vector<double> &valIn, cx_mat &matIn)
+{
+    for (unsigned int j = 0; j < matIn.n_cols; j++)
+    {
+        for (unsigned int i = 0; i < matIn.n_rows; i++)
+        {
+            if (imag(matIn.at(i, j)) != 0.0)
+                return false;
+
+            valIn.push_back(real(matIn.at(i, j)));
+        }
+    }
+
+    return true;
+}
@@ -39,6 +39,7 @@
 #ifndef HYDRODATA_H
 #define HYDRODATA_H
 #include <math.h>
+#include <memory>
 #include "../global_objects/mathinterp.h"
 #include "../motion_solver/matforceactive.h"
 #include "../motion_solver/matforcecross.h"
@@ -454,6 +455,162 @@ public:
      */
     double getDensity();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts the reactive and crossbody force data into compact storage.
+     *
+     * Added mass, damping, and stiffness coefficients are read as complex matrices, even though the imaginary part
+     * is always zero.  If every imaginary part in the data set is exactly zero, and all wave frequencies use the same
+     * matrix sizes (and the same list of linked bodies for crossbody data), the coefficients are moved into flat
+     * lists of real values.  The original lists of matForceReact and matForceCross objects are then released.  So
+     * after compaction, listDataReact() and listDataCross() return empty lists.  Use getReactAt(), getCrossAt(),
+     * getReactReal(), and getCrossReal() instead.  These work for both compact and normal storage.
+     *
+     * If the data set fails any of those checks, it is left unchanged.  Active forces are never compacted.  They
+     * are truly complex.
+     */
+    void compact();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Stores a pair of reciprocal crossbody blocks only once.
+     *
+     * Radiation reciprocity means the crossbody coefficients of body i, linked to body j, equal the transpose of
+     * the crossbody coefficients of body j, linked to body i.  This function compares the two blocks at every wave
+     * frequency and derivative order.  If they are equal within round off (RECIPTOL, relative to the largest
+     * coefficient in the block), the block of this data set is stored once and shared between both data sets.  The
+     * other data set then reads its block as the transpose of the shared values.  The input values are unchanged.
+     *
+     * Blocks that only agree within a larger tolerance are averaged, but only if the caller asks for it with
+     * avgTolIn.  Averaging changes the input coefficients, so the caller should report it.
+     *
+     * Both data sets must already be compacted with compact().
+     * @param crossIn Integer, variable passed by value.  The index of the crossbody block in this data set.
+     * @param other hydroData object, passed by reference.  The data set of the linked body.
+     * @param otherCross Integer, variable passed by value.  The index of the crossbody block in the other data set
+     * that links back to this body.
+     * @param avgTolIn Double, variable passed by value.  Relative tolerance for blocks to be averaged and shared.
+     * Negative turns off averaging.  Default is off.
+     * @return Returns integer, variable passed by value.  The result of the comparison:
+     * 0:   Nothing changed.
+     * 1:   The blocks were equal within round off and are now shared.
+     * 2:   The blocks were averaged and are now shared.
+     */
+    int shareCross(int crossIn, hydroData &other, int otherCross, double avgTolIn = -1.0);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports the memory used by the reactive and crossbody coefficients in this data set.
+     *
+     * Shared crossbody blocks are only counted by the data set that owns them.  Active forces are not included,
+     * except for any resampled grid.  See resample().
+     * @return Returns unsigned long, variable passed by value.  The size of the coefficients, in bytes.
+     */
+    unsigned long getStorage();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the reactive and crossbody coefficients are in compact storage.
+     * @return Returns boolean, variable passed by value.  True if compact() converted the reactive coefficients.
+     */
+    bool isCompact();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the number of crossbody blocks defined at a wave frequency.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @return Returns integer, variable passed by value.  The number of crossbody blocks.  Returns zero if no
+     * crossbody data exists for that wave frequency.
+     */
+    int getCrossCount(int freqInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the name of the linked body for a crossbody block.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @param crossInd Integer, variable passed by value.  The index of the crossbody block.
+     * @return Returns string, variable passed by value.  The name of the linked hydrobody.
+     */
+    std::string getCrossName(int freqInd, int crossInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the reactive forces at a wave frequency.
+     *
+     * For compact storage, a complex matForceReact object is rebuilt from the stored real values.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @return Returns matForceReact object, passed by value.  The reactive forces at that wave frequency.
+     */
+    ofreq::matForceReact getReactAt(int freqInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the crossbody forces at a wave frequency.
+     *
+     * For compact storage, a complex matForceCross object is rebuilt from the stored real values.  Shared
+     * reciprocal blocks are transposed as needed.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @param crossInd Integer, variable passed by value.  The index of the crossbody block.
+     * @return Returns matForceCross object, passed by value.  The crossbody forces at that wave frequency.
+     */
+    ofreq::matForceCross getCrossAt(int freqInd, int crossInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the real part of one derivative order of the reactive forces, at a wave frequency.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @param ordIn Integer, variable passed by value.  The derivative order.  (0 = stiffness, 1 = damping,
+     * 2 = mass.)
+     * @return Returns mat, passed by value.  The coefficients.  Returns an empty matrix if the derivative order is
+     * not defined.
+     */
+    arma::mat getReactReal(int freqInd, int ordIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the real part of one derivative order of a crossbody block, at a wave frequency.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @param crossInd Integer, variable passed by value.  The index of the crossbody block.
+     * @param ordIn Integer, variable passed by value.  The derivative order.  (0 = stiffness, 1 = damping,
+     * 2 = mass.)
+     * @return Returns mat, passed by value.  The coefficients.  Returns an empty matrix if the derivative order is
+     * not defined.
+     */
+    arma::mat getCrossReal(int freqInd, int crossInd, int ordIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Resamples the data set onto a fixed list of wave frequencies.
+     *
+     * The solution only ever asks for data at the wave frequencies in the control file.  This function does the
+     * frequency interpolation for all of those frequencies at once, when the data is loaded.  The interpolation
+     * weights are the same as getDataReact() uses, so the results do not change.  Each coefficient is a row of a
+     * coefficient by frequency matrix.  The resampled grid is a single matrix product of that with the weights.
+     * Columns of the grid are stored one wave frequency after another.  So getDataReact(), getDataActive(), and
+     * getDataCross() read one contiguous column when asked for a frequency on the grid.  Any other frequency
+     * still uses interpolation.
+     *
+     * Only compact reactive and crossbody data is resampled.  Active forces are resampled if all wave frequencies
+     * use the same size of matrix.  The original data is kept, so the list of wave frequencies can change later.
+     * Call this function again after any change.
+     * @param freqIn Vector of doubles, passed by value.  The wave frequencies for the grid.  Wave frequencies are
+     * measured in units of radians per second (rad/s).  An empty list removes the grid.
+     */
+    void resample(std::vector<double> freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Removes every crossbody block linked to the named hydrobody.
+     *
+     * Used for far-field interaction, where distant bodies use an approximation instead of stored crossbody data.
+     * Works on both compact and expanded data, and on the resampled grid.  Blocks shared with other hydrodata sets
+     * stay with those sets.
+     * @param hydroName String, passed by value.  The name of the linked hydrobody.
+     * @return Returns integer, variable passed by value.  The number of crossbody blocks removed, counted once per
+     * wave frequency for expanded data.
+     */
+    int removeCross(std::string hydroName);
+
 
 //==========================================Section Separator =========================================================
 protected:
@@ -536,6 +693,162 @@ private:
      * depending on the water density.  Hence why it was recorded.
      */
     double pDensity;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the real coefficients of a single block from a flat list of compact values.
+     * @param valIn Vector of doubles, passed by reference.  The flat list of values.
+     * @param startIn Integer, variable passed by value.  The index of the first value in the block.
+     * @param rowIn Integer, variable passed by value.  The number of rows in the block.
+     * @param colIn Integer, variable passed by value.  The number of columns in the block.
+     * @return Returns mat, passed by value.  The block, stored column by column.
+     */
+    arma::mat getBlock(std::vector<double> &valIn, int startIn, int rowIn, int colIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the real part of a complex matrix to a flat list of values.  Stored column by column.
+     * @param valIn Vector of doubles, passed by reference.  The list of values to add to.
+     * @param matIn cx_mat, passed by reference.  The matrix to add.
+     * @return Returns boolean, variable passed by value.  False if any imaginary part was not zero.
+     */
+    bool addBlock(std::vector<double> &valIn, arma::cx_mat &matIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief True if the reactive coefficients are in compact storage.
+     */
+    bool pReactCompact;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief True if the crossbody coefficients are in compact storage.
+     */
+    bool pCrossCompact;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The size of the reactive matrices in compact storage.  The matrices are square.
+     */
+    int pReactSize;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The number of derivative orders of reactive matrices in compact storage.
+     */
+    int pReactOrd;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The compact list of reactive coefficients.
+     *
+     * Ordered by wave frequency, then derivative order.  Each matrix is stored column by column.
+     */
+    std::vector<double> plistReactVal;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The names of the linked bodies for crossbody blocks in compact storage.  One entry per block.
+     */
+    std::vector<std::string> plistCrossName;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The number of derivative orders for each crossbody block in compact storage.
+     */
+    std::vector<int> plistCrossOrd;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The number of rows of the stored values for each crossbody block in compact storage.
+     */
+    std::vector<int> plistCrossRows;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The number of columns of the stored values for each crossbody block in compact storage.
+     */
+    std::vector<int> plistCrossCols;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The compact lists of crossbody coefficients.  One list for each crossbody block.
+     *
+     * Each list is ordered by wave frequency, then derivative order.  Each matrix is stored column by column.  A
+     * list may be shared with the data set of the linked body.  See shareCross().
+     */
+    std::vector< std::shared_ptr< std::vector<double> > > plistCrossVal;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief True if the crossbody block is read as the transpose of the stored values.
+     */
+    std::vector<bool> plistCrossTrans;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief True if this data set owns the stored values of the crossbody block.  Used to count storage.
+     */
+    std::vector<bool> plistCrossOwner;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the linear interpolation weights from the list of wave frequencies to a new list.
+     *
+     * Uses the two closest wave frequencies, and the same limits as mathInterp::iPolate().
+     * @param freqIn Vector of doubles, passed by reference.  The new list of wave frequencies, measured in rad/s.
+     * @param sortIn Boolean, variable passed by value.  True if the two closest wave frequencies are put in
+     * increasing order before interpolation.  False to keep the closest wave frequency first.
+     * @return Returns mat, passed by value.  One row for each new wave frequency.  One column for each wave
+     * frequency in the data set.
+     */
+    arma::mat getWeight(std::vector<double> &freqIn, bool sortIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds a wave frequency in the resampled grid.
+     * @param freqIn Double, variable passed by value.  The wave frequency to search for.  Measured in rad/s.
+     * @return Returns integer, variable passed by value.  The index of the matching column in the grid.  Returns
+     * -1 if the frequency is not on the grid.
+     */
+    int findGrid(double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of wave frequencies for the resampled grid.  Each entry is in units of rad/s.
+     */
+    std::vector<double> plistGridFreq;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The resampled reactive coefficients.  One column for each wave frequency in the grid.
+     *
+     * Each column uses the same layout as one wave frequency of plistReactVal.  Empty if the reactive data was not
+     * resampled.
+     */
+    arma::mat pGridReact;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The resampled active force coefficients.  One column for each wave frequency in the grid.
+     *
+     * Empty if the active data was not resampled.
+     */
+    arma::cx_mat pGridActive;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The resampled crossbody coefficients.  One matrix for each crossbody block, with one column for each
+     * wave frequency in the grid.
+     *
+     * Each column uses the same layout as one wave frequency of the matching entry in plistCrossVal.  Blocks read
+     * as a transpose are still transposed when read.  Empty if the crossbody data was not resampled.
+     */
+    std::vector<arma::mat> plistGridCross;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static double RECIPTOL; /**< Relative tolerance for crossbody blocks to be equal within round off. */
 };
 
 }   //Namespace ofreq
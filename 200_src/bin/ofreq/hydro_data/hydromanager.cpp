@@ -269,6 +269,77 @@ void HydroManager::calcHydroData(double waveAmp, double waveFreq)
     }
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroManager::resample(std::vector<double> freqIn)
+{
+    for (unsigned int i = 0; i < plistHydroData.size(); i++)
+    {
+        for (unsigned int j = 0; j < plistHydroData.at(i).size(); j++)
+            plistHydroData.at(i).at(j).resample(freqIn);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroManager::removeCross(string hydroName)
+{
+    int output = 0;
+
+    for (unsigned int i = 0; i < plistHydroData.size(); i++)
+    {
+        for (unsigned int j = 0; j < plistHydroData.at(i).size(); j++)
+            output += plistHydroData.at(i).at(j).removeCross(hydroName);
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_vec HydroManager::getExcitation(double dirIn, double freqIn)
+{
+    if ((plistHydroData.size() == 0) || (plistHydroData.at(0).size() == 0))
+        return cx_vec();
+
+    vector<hydroData> &listDir = plistHydroData.at(0);
+
+    //Closest wave direction on either side, going around the circle.
+    int indLow = 0;
+    int indHigh = 0;
+    double distLow = 4 * M_PI;
+    double distHigh = 4 * M_PI;
+
+    for (unsigned int i = 0; i < listDir.size(); i++)
+    {
+        double dist = fmod(listDir.at(i).getWaveDir() - dirIn, 2 * M_PI);
+        if (dist < 0)
+            dist += 2 * M_PI;
+
+        if (dist < distHigh)
+        {
+            distHigh = dist;
+            indHigh = i;
+        }
+
+        dist = (dist == 0) ? 0 : 2 * M_PI - dist;
+        if (dist < distLow)
+        {
+            distLow = dist;
+            indLow = i;
+        }
+    }
+
+    //Unit wave amplitude.
+    double ampLow = listDir.at(indLow).getWaveAmp();
+    double ampHigh = listDir.at(indHigh).getWaveAmp();
+    cx_vec forceLow = listDir.at(indLow).getDataActive(freqIn).listCoefficient().col(0) / (ampLow > 0 ? ampLow : 1.0);
+    cx_vec forceHigh = listDir.at(indHigh).getDataActive(freqIn).listCoefficient().col(0) /
+            (ampHigh > 0 ? ampHigh : 1.0);
+
+    if ((indLow == indHigh) || (distLow + distHigh <= 0))
+        return forceLow;
+
+    return forceLow + (forceHigh - forceLow) * (distLow / (distLow + distHigh));
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 ForceActive *HydroManager::getForceActive()
 {
@@ -334,46 +405,51 @@ ForceReact *HydroManager::getForceReact()
 ForceCross *HydroManager::getForceCross(std::string linkedBodName)
 {
     //Test if the specified body name exists.
-    bool test = false;      //Tests if a matching body name was found.
-    for (int i = 0; i < pHydroFinal.listDataCross().at(0).size(); i++)
+    int crossInd = -1;      //Index of the matching body name.
+    for (int i = 0; i < getCrossCount(); i++)
     {
-        if (pHydroFinal.listDataCross(0,i).getLinkedName() == linkedBodName)
+        if (getCrossName(i) == linkedBodName)
         {
-            test = true;
+            crossInd = i;
             break;
         }
     }
 
     //if no match was found, throw an error.
-    if (!test)
+    if (crossInd < 0)
         throw std::invalid_argument("Bodyname not found.");
 
     //If body name was found, proceed to locating and returning it.
+    return getForceCross(crossInd);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ForceCross *HydroManager::getForceCross(int crossInd)
+{
+    //Get the crossbody block once.
+    matForceCross dataCross = pHydroFinal.getCrossAt(0, crossInd);
 
     //Create ptForceCross
     ptForceCross = new ForceCross();
 
     //Iterate through each order of derivative.
-    for (int k = 0; k <= pHydroFinal.listDataCross(0, linkedBodName).getMaxOrder(); k++)
+    for (int k = 0; k <= dataCross.getMaxOrder(); k++)
     {
         //Create new derivative object.
         Derivative tempDeriv;
+        cx_mat coeff = dataCross.getDerivative(k);
 
         //Iterate through each equation.
-        for (int i = 0; i < pHydroFinal.listDataCross(0, linkedBodName).getMatSize(); i++)
+        for (int i = 0; i < dataCross.getMatSize(); i++)
         {
             //Create new vector of variables.
             vector<double> listCoeff;
 
             //Iterate through each coefficient in the equation.
-            for (int j = 0; j < pHydroFinal.listDataCross(0,linkedBodName).getMatSize(); j++)
+            for (int j = 0; j < dataCross.getMatSize(); j++)
             {
                 //Fill the vector with variables.
-                listCoeff.push_back(
-                            real(pHydroFinal.listDataCross(0,linkedBodName)
-                                 .getDerivative(k)(i,j)
-                                )
-                            );
+                listCoeff.push_back(real(coeff(i,j)));
             }
 
             //Add the vector to the list.
@@ -385,12 +461,24 @@ ForceCross *HydroManager::getForceCross(std::string linkedBodName)
     }
 
     //Set the name for the linked body.
-    ptForceCross->setForceName(linkedBodName);
+    ptForceCross->setForceName(dataCross.getLinkedName());
 
     //Write ptForceCross.
     return ptForceCross;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroManager::getCrossCount()
+{
+    return pHydroFinal.getCrossCount(0);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string HydroManager::getCrossName(int crossInd)
+{
+    return pHydroFinal.getCrossName(0, crossInd);
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void HydroManager::setWaveDir(double dirIn)
 {
@@ -995,7 +1083,8 @@ hydroData HydroManager::interpWaveDir(ofreq::hydroData &Data1, ofreq::hydroData
                          )
                     );
 
-        for (int i = 0; i < Data1.listDataCross().at(0).size(); i++)
+        //The far-field approximation may have removed all of the crossbody data.
+        for (int i = 0; (Data1.listDataCross().size() > 0) && (i < Data1.listDataCross().at(0).size()); i++)
         {
             //Get hydrobody name from first data set.
             std::string Name = Data1.listDataCross().at(0).at(i).getLinkedName();
@@ -1070,8 +1159,8 @@ hydroData HydroManager::ScaleHydroData(double ampIn, ofreq::hydroData &Data1)
                         )
                     );
 
-        //Scale the crossbody force objects.
-        for (int i = 0; i < Data1.listDataCross().at(0).size(); i++)
+        //Scale the crossbody force objects.  The far-field approximation may have removed all of them.
+        for (int i = 0; (Data1.listDataCross().size() > 0) && (i < Data1.listDataCross().at(0).size()); i++)
         {
             //Linear scaling
             output.addDataCross(
@@ -1142,8 +1231,8 @@ hydroData HydroManager::ScaleHydroData(double ampIn, ofreq::hydroData &Data1, of
                         )
                     );
 
-        //Scale the crossbody force objects.
-        for (int i = 0; i < Data1.listDataCross().at(0).size(); i++)
+        //Scale the crossbody force objects.  The far-field approximation may have removed all of them.
+        for (int i = 0; (Data1.listDataCross().size() > 0) && (i < Data1.listDataCross().at(0).size()); i++)
         {
             //Nonlinear wave scaling
             output.addDataCross(
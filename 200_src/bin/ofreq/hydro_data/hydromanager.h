@@ -192,6 +192,38 @@ public:
      */
     void calcHydroData(double waveAmp, double waveFreq);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Resamples every hydrodata set onto a fixed list of wave frequencies.
+     *
+     * After this, calcHydroData() reads the frequency data directly for any wave frequency in the list.
+     * @param freqIn Vector of doubles, passed by value.  The wave frequencies, measured in rad/s.
+     * @sa hydroData::resample()
+     */
+    void resample(std::vector<double> freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Removes the crossbody blocks linked to the named hydrobody from every hydrodata set.
+     * @param hydroName String, passed by value.  The name of the linked hydrobody.
+     * @return Returns integer, variable passed by value.  The number of crossbody blocks removed.
+     * @sa hydroData::removeCross()
+     */
+    int removeCross(std::string hydroName);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the excitation force for a unit wave amplitude, at any wave direction and wave frequency.
+     *
+     * Independent of the current wave direction and the output of calcHydroData().  Uses the first set of wave
+     * amplitudes.  Interpolates linearly between the two closest wave directions, going around the circle.
+     * @param dirIn Double, variable passed by value.  The wave direction, in units of radians.
+     * @param freqIn Double, variable passed by value.  The wave frequency, in units of rad/s.
+     * @return Returns arma::cx_vec, variable passed by value.  One row for each equation of motion.  Empty if there
+     * is no hydrodynamic data.
+     */
+    arma::cx_vec getExcitation(double dirIn, double freqIn);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Gets the forceActive object associated the requested environmental data.
@@ -236,6 +268,35 @@ public:
      */
     ofreq::ForceCross *getForceCross(std::string linkedBodName);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the forceCross object for a crossbody block, selected by index.
+     *
+     * Same as getForceCross(std::string), but without any search for the linked body name.  Use getCrossCount() and
+     * getCrossName() to iterate through the crossbody blocks.
+     * @param crossInd Integer, passed by value.  The index of the crossbody block.
+     * @return Returns a pointer to the forceCross object, specific to the environmental conditions you specified.
+     * Pointer returned by value.
+     * @sa HydroManager::calcHydroData()
+     */
+    ofreq::ForceCross *getForceCross(int crossInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the number of crossbody blocks in the final set of hydrodata.
+     * @return Returns integer, variable passed by value.  The number of crossbody blocks.  Zero if calcHydroData()
+     * has not been called, or if there is no crossbody data.
+     */
+    int getCrossCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the name of the linked body for a crossbody block in the final set of hydrodata.
+     * @param crossInd Integer, passed by value.  The index of the crossbody block.
+     * @return Returns string, variable passed by value.  The name of the linked hydrobody.
+     */
+    std::string getCrossName(int crossInd);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Sets the wave direction for the current set of analysis.
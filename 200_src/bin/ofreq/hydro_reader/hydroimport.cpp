@@ -0,0 +1,852 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+#include "hydroimport.h"
+#include <QFileInfo>
+#include <math.h>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+int HydroImport::NDOF = 6; /**< The number of degrees of freedom for each body. */
+string HydroImport::BODY = "body"; /**< The prefix for body names.  Followed by the body number, starting at 1. */
+string HydroImport::NEMOH_CAL = "Nemoh.cal"; /**< The name of the NEMOH input file. */
+string HydroImport::NEMOH_RADIATION = "results/RadiationCoefficients.tec"; /**< NEMOH radiation coefficients. */
+string HydroImport::NEMOH_EXCITE = "results/ExcitationForce.tec"; /**< NEMOH excitation forces. */
+string HydroImport::NEMOH_STIFF = "Mesh/KH"; /**< NEMOH hydrostatic stiffness, without extension. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HydroImport::HydroImport()
+{
+    pFormat = 0;
+    ptMemory = NULL;
+    pDensity = 1025.0;
+    pDepth = 0.0;
+    pGravity = 9.80665;
+    pDofTot = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HydroImport::~HydroImport()
+{
+
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::setMemoryFiles(const std::map<string, string> *ptInput)
+{
+    ptMemory = ptInput;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroImport::findFormat(string pathIn)
+{
+    //NEMOH calculation directory.
+    if (hasFile(pathIn + SLASH + NEMOH_CAL))
+        return 3;
+
+    //WAMIT added mass and damping file.
+    if ((pathIn.size() > 2) && (pathIn.substr(pathIn.size() - 2) == ".1") && hasFile(pathIn))
+        return 2;
+
+    //Any other single file is an AQWA database.  Directories are an ohydro file tree.
+    if (ptMemory && (ptMemory->find(pathIn) != ptMemory->end()))
+        return 1;
+
+    QFileInfo info(QString::fromStdString(pathIn));
+    if (info.exists() && !info.isDir())
+        return 1;
+
+    return 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::read(string pathIn)
+{
+    //Clear any previous data.
+    plistWaveFreq.clear();
+    plistWaveDir.clear();
+    plistReadFiles.clear();
+    plistMass.clear();
+    plistDamp.clear();
+    pStiff.reset();
+    plistExcite.clear();
+    plistExciteSet.clear();
+    pDofTot = 0;
+
+    pFormat = findFormat(pathIn);
+
+    if (pFormat == 1)
+        readAqwa(pathIn);
+    else if (pFormat == 2)
+        readWamit(pathIn);
+    else if (pFormat == 3)
+        readNemoh(pathIn);
+    else
+        throw std::runtime_error("No hydrodynamic data to import at path:  " + pathIn);
+
+    //Check that the data is complete.
+    if ((plistWaveFreq.size() == 0) || (plistWaveDir.size() == 0) || (pDofTot == 0))
+        throw std::runtime_error("No hydrodynamic data found in file:  " + pathIn);
+
+    if (pDofTot % NDOF != 0)
+        throw std::runtime_error("Hydrodynamic data does not have six degrees of freedom for each body:  " + pathIn);
+
+    for (unsigned int d = 0; d < plistExciteSet.size(); d++)
+    {
+        for (unsigned int k = 0; k < plistExciteSet.at(d).size(); k++)
+        {
+            if (!plistExciteSet.at(d).at(k))
+                throw std::runtime_error("Excitation forces missing for wave direction " + itoa(d + 1)
+                                         + " and wave frequency " + itoa(k + 1) + ".  File:  " + pathIn);
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string HydroImport::getFormatName()
+{
+    if (pFormat == 1)
+        return "AQWA";
+    else if (pFormat == 2)
+        return "WAMIT";
+    else if (pFormat == 3)
+        return "NEMOH";
+    else
+        return "";
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &HydroImport::listWaveFreq()
+{
+    return plistWaveFreq;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &HydroImport::listWaveDir()
+{
+    return plistWaveDir;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> &HydroImport::listReadFiles()
+{
+    return plistReadFiles;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double HydroImport::getDensity()
+{
+    return pDensity;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double HydroImport::getDepth()
+{
+    return pDepth;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> HydroImport::getGravity()
+{
+    vector<double> output(3, 0.0);
+    output.at(2) = -pGravity;
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroImport::getBodyCount()
+{
+    return pDofTot / NDOF;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<hydroData> HydroImport::getHydroData(int dirInd)
+{
+    vector<hydroData> output;
+    int nBody = getBodyCount();
+
+    for (int b = 0; b < nBody; b++)
+    {
+        hydroData data;
+        data.setWaveAmp(1.0);
+        data.setWaveDir(plistWaveDir.at(dirInd));
+        data.setHydroBodyName(BODY + itoa(b + 1));
+        data.setDepth(pDepth);
+        data.setDensity(pDensity);
+        data.addWaveFreq(plistWaveFreq);
+
+        span rowB(b * NDOF, (b + 1) * NDOF - 1);
+
+        for (unsigned int k = 0; k < plistWaveFreq.size(); k++)
+        {
+            //Reactive forces.
+            matForceReact react;
+            mat stiff = pStiff(rowB, rowB);
+            mat damp = plistDamp.at(k)(rowB, rowB);
+            mat mass = plistMass.at(k)(rowB, rowB);
+            react.setDerivative(0, cx_mat(stiff, zeros<mat>(NDOF, NDOF)));
+            react.setDerivative(1, cx_mat(damp, zeros<mat>(NDOF, NDOF)));
+            react.setDerivative(2, cx_mat(mass, zeros<mat>(NDOF, NDOF)));
+            data.addDataReact(react);
+
+            //Active forces.
+            matForceActive active;
+            active.setCoefficient(cx_mat(plistExcite.at(dirInd).at(k).rows(b * NDOF, (b + 1) * NDOF - 1)));
+            data.addDataActive(active);
+
+            //Crossbody forces.  One for each other body.
+            bool first = true;
+            for (int c = 0; c < nBody; c++)
+            {
+                if (c == b)
+                    continue;
+
+                span colC(c * NDOF, (c + 1) * NDOF - 1);
+                matForceCross cross;
+                cross.setLinkedName(BODY + itoa(c + 1));
+                mat crossStiff = pStiff(rowB, colC);
+                mat crossDamp = plistDamp.at(k)(rowB, colC);
+                mat crossMass = plistMass.at(k)(rowB, colC);
+                cross.setDerivative(0, cx_mat(crossStiff, zeros<mat>(NDOF, NDOF)));
+                cross.setDerivative(1, cx_mat(crossDamp, zeros<mat>(NDOF, NDOF)));
+                cross.setDerivative(2, cx_mat(crossMass, zeros<mat>(NDOF, NDOF)));
+
+                //The first block adds the entry for the wave frequency.
+                if (first)
+                    data.addDataCross(cross);
+                else
+                    data.addDataCross(cross, k);
+                first = false;
+            }
+        }
+
+        output.push_back(data);
+    }
+
+    return output;
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::readAqwa(string pathIn)
+{
+    ifstream fileIn;
+    istringstream memIn;
+    istream *ptInput = openFile(pathIn, fileIn, memIn);
+
+    string line;
+    string section = "";        //The current section of the file.
+    vector<double> listHead;    //Wave directions and wave frequencies from the header.
+    int nDir = -1;
+    int nFreq = -1;
+    bool headDone = false;
+
+    vector<double> listVal;     //Values of the current record.
+    int index[3] = {0, 0, 0};   //Indices of the current record.
+    bool recordOn = false;
+    unsigned int nNeed = 0;
+
+    while (getline(*ptInput, line))
+    {
+        //Remove carriage returns from files written on Windows.
+        if (!line.empty() && (line.at(line.size() - 1) == '\r'))
+            line.erase(line.size() - 1);
+
+        vector<string> word = splitLine(line);
+        if ((word.size() == 0) || (line.at(0) == '*'))
+            continue;
+
+        //Header.  Structure count, direction count, and frequency count, in fixed columns.  Then the lists.
+        if (!headDone)
+        {
+            if (nDir < 0)
+            {
+                if (line.size() < 7)
+                    throw std::runtime_error("AQWA file header not recognized:  " + pathIn);
+
+                nDir = atoi(line.substr(2, 2).c_str());
+                nFreq = atoi(line.substr(4, 3).c_str());
+                word = splitLine(line.substr(7));
+            }
+
+            for (unsigned int i = 0; i < word.size(); i++)
+                listHead.push_back(atof(word.at(i).c_str()));
+
+            if (static_cast<int>(listHead.size()) >= nDir + nFreq)
+            {
+                for (int i = 0; i < nDir; i++)
+                    plistWaveDir.push_back(getAngle(listHead.at(i)));
+                for (int i = 0; i < nFreq; i++)
+                    plistWaveFreq.push_back(listHead.at(nDir + i));
+
+                resizeData(nFreq, nDir, 0);
+                headDone = true;
+            }
+            continue;
+        }
+
+        //Section keywords.
+        if (isalpha(line.at(0)))
+        {
+            section = word.at(0);
+            recordOn = false;
+            continue;
+        }
+
+        if (section == "GENERAL")
+        {
+            if (word.size() >= 3)
+            {
+                pDepth = atof(word.at(0).c_str());
+                pDensity = atof(word.at(1).c_str());
+                pGravity = atof(word.at(2).c_str());
+            }
+            continue;
+        }
+
+        if ((section != "HYDSTIFFNESS") && (section != "ADDEDMASS") &&
+                (section != "DAMPING") && (section != "FORCERAO"))
+            continue;
+
+        //Start of a record.  Indices in fixed columns, then values.
+        if (!recordOn)
+        {
+            if (line.size() < 7)
+                throw std::runtime_error("AQWA record not recognized:  " + line);
+
+            index[0] = atoi(line.substr(0, 2).c_str());
+            index[1] = atoi(line.substr(2, 2).c_str());
+            index[2] = atoi(line.substr(4, 3).c_str());
+            word = splitLine(line.substr(7));
+            listVal.clear();
+            nNeed = (section == "FORCERAO") ? 2 * NDOF : NDOF * NDOF;
+            recordOn = true;
+        }
+
+        for (unsigned int i = 0; i < word.size(); i++)
+            listVal.push_back(atof(word.at(i).c_str()));
+
+        if (listVal.size() < nNeed)
+            continue;
+
+        //Record complete.  Store the values.
+        recordOn = false;
+        int bodA = index[0] - 1;
+        if (bodA < 0)
+            throw std::runtime_error("AQWA structure number out of range:  " + line);
+
+        if (section == "HYDSTIFFNESS")
+        {
+            resizeData(0, 0, (bodA + 1) * NDOF);
+            for (int i = 0; i < NDOF; i++)
+            {
+                for (int j = 0; j < NDOF; j++)
+                    pStiff(bodA * NDOF + i, bodA * NDOF + j) = listVal.at(i * NDOF + j);
+            }
+        }
+        else if (section == "FORCERAO")
+        {
+            int dir = index[1] - 1;
+            int freq = index[2] - 1;
+            if ((dir < 0) || (dir >= nDir) || (freq < 0) || (freq >= nFreq))
+                throw std::runtime_error("AQWA wave direction or frequency number out of range:  " + line);
+
+            resizeData(0, 0, (bodA + 1) * NDOF);
+            for (int i = 0; i < NDOF; i++)
+            {
+                plistExcite.at(dir).at(freq)(bodA * NDOF + i) =
+                        polar(listVal.at(i), listVal.at(NDOF + i) * M_PI / 180.0);
+            }
+            plistExciteSet.at(dir).at(freq) = true;
+        }
+        else
+        {
+            int bodB = index[1] - 1;
+            int freq = index[2] - 1;
+            if ((bodB < 0) || (freq < 0) || (freq >= nFreq))
+                throw std::runtime_error("AQWA structure or wave frequency number out of range:  " + line);
+
+            resizeData(0, 0, (max(bodA, bodB) + 1) * NDOF);
+            mat &coeff = (section == "ADDEDMASS") ? plistMass.at(freq) : plistDamp.at(freq);
+            for (int i = 0; i < NDOF; i++)
+            {
+                for (int j = 0; j < NDOF; j++)
+                    coeff(bodA * NDOF + i, bodB * NDOF + j) = listVal.at(i * NDOF + j);
+            }
+        }
+    }
+
+    if (!headDone)
+        throw std::runtime_error("AQWA file header not found:  " + pathIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::readWamit(string pathIn)
+{
+    string base = pathIn.substr(0, pathIn.size() - 2);
+    double length = 1.0;
+    string line;
+
+    //Gravity, length scale, and water depth from the log file.  Defaults if there is no log file.
+    if (hasFile(base + ".out"))
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(base + ".out", fileIn, memIn);
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            for (unsigned int i = 0; i + 1 < word.size(); i++)
+            {
+                if (word.at(i) == "Gravity:")
+                    pGravity = atof(word.at(i + 1).c_str());
+                else if ((word.at(i) == "scale:") && (i > 0) && (word.at(i - 1) == "Length"))
+                    length = atof(word.at(i + 1).c_str());
+                else if ((word.at(i) == "depth:") && (i > 0) && (word.at(i - 1) == "Water"))
+                    pDepth = atof(word.at(i + 1).c_str());
+            }
+        }
+    }
+
+    vector<double> listPeriod;      //Wave periods in the order found.  One for each wave frequency.
+    vector<double> listBeta;        //Wave headings in the order found, in degrees.
+
+    //Added mass and damping:  PER I J A B
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathIn, fileIn, memIn);
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() < 5)
+                continue;
+
+            //Zero and infinite wave periods only have added mass.  Skip them.
+            double per = atof(word.at(0).c_str());
+            if (per <= 0.0)
+                continue;
+
+            int modeA = atoi(word.at(1).c_str());
+            int modeB = atoi(word.at(2).c_str());
+            if ((modeA < 1) || (modeB < 1))
+                throw std::runtime_error("WAMIT mode number out of range:  " + line);
+
+            int freq = findIndex(listPeriod, per);
+            double omega = 2.0 * M_PI / per;
+            resizeData(listPeriod.size(), 0, (max(modeA, modeB) + NDOF - 1) / NDOF * NDOF);
+
+            double scale = pDensity * pow(length, getPower(modeA, modeB, 3));
+            plistMass.at(freq)(modeA - 1, modeB - 1) = atof(word.at(3).c_str()) * scale;
+            plistDamp.at(freq)(modeA - 1, modeB - 1) = atof(word.at(4).c_str()) * scale * omega;
+        }
+    }
+
+    for (unsigned int k = 0; k < listPeriod.size(); k++)
+        plistWaveFreq.push_back(2.0 * M_PI / listPeriod.at(k));
+
+    //Excitation:  PER BETA I MOD PHA RE IM.  Diffraction (.3) if available, otherwise Haskind (.2).
+    {
+        string pathExcite = hasFile(base + ".3") ? base + ".3" : base + ".2";
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathExcite, fileIn, memIn);
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() < 7)
+                continue;
+
+            double per = atof(word.at(0).c_str());
+            if (per <= 0.0)
+                continue;
+
+            int freq = findIndex(listPeriod, per);
+            if (freq >= static_cast<int>(plistWaveFreq.size()))
+                throw std::runtime_error("WAMIT wave period not found in the added mass file:  " + line);
+
+            int dir = findIndex(listBeta, atof(word.at(1).c_str()));
+            int mode = atoi(word.at(2).c_str());
+            if (mode < 1)
+                throw std::runtime_error("WAMIT mode number out of range:  " + line);
+
+            resizeData(0, listBeta.size(), (mode + NDOF - 1) / NDOF * NDOF);
+
+            double scale = pDensity * pGravity * pow(length, getPower(mode, 0, 2));
+            plistExcite.at(dir).at(freq)(mode - 1) =
+                    complex<double>(atof(word.at(5).c_str()), atof(word.at(6).c_str())) * scale;
+            plistExciteSet.at(dir).at(freq) = true;
+        }
+    }
+
+    for (unsigned int d = 0; d < listBeta.size(); d++)
+        plistWaveDir.push_back(getAngle(listBeta.at(d)));
+
+    //Hydrostatics:  I J C.  Optional.
+    if (hasFile(base + ".hst"))
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(base + ".hst", fileIn, memIn);
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() < 3)
+                continue;
+
+            int modeA = atoi(word.at(0).c_str());
+            int modeB = atoi(word.at(1).c_str());
+            if ((modeA < 1) || (modeB < 1))
+                continue;
+
+            resizeData(0, 0, (max(modeA, modeB) + NDOF - 1) / NDOF * NDOF);
+            pStiff(modeA - 1, modeB - 1) = atof(word.at(2).c_str()) *
+                    pDensity * pGravity * pow(length, getPower(modeA, modeB, 2));
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::readNemoh(string pathIn)
+{
+    string line;
+
+    //Environment.  Density, gravity, and water depth are the first values of lines 2 to 4.
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathIn + SLASH + NEMOH_CAL, fileIn, memIn);
+
+        for (int i = 0; (i < 4) && getline(*ptInput, line); i++)
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() == 0)
+                continue;
+
+            if (i == 1)
+                pDensity = atof(word.at(0).c_str());
+            else if (i == 2)
+                pGravity = atof(word.at(0).c_str());
+            else if (i == 3)
+                pDepth = atof(word.at(0).c_str());
+        }
+    }
+
+    //Radiation coefficients.  One zone for each body and degree of freedom that moves.  Each line has the wave
+    //frequency, then added mass and damping for each force.
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathIn + SLASH + NEMOH_RADIATION, fileIn, memIn);
+        int motion = -1;
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() == 0)
+                continue;
+
+            //Zone title:  Motion of body <n> in DoF <m>
+            if (line.find("Zone") != string::npos)
+            {
+                int bod = -1;
+                int dof = -1;
+                for (unsigned int i = 0; i + 1 < word.size(); i++)
+                {
+                    if (word.at(i) == "body")
+                        bod = atoi(word.at(i + 1).c_str());
+                    else if (word.at(i) == "DoF")
+                        dof = atoi(word.at(i + 1).c_str());
+                }
+
+                if ((bod < 1) || (dof < 1) || (dof > NDOF))
+                    throw std::runtime_error("NEMOH zone title not recognized:  " + line);
+
+                motion = (bod - 1) * NDOF + dof - 1;
+                continue;
+            }
+
+            if (!isdigit(word.at(0).at(0)) && (word.at(0).at(0) != '.'))
+                continue;
+            if (motion < 0)
+                throw std::runtime_error("NEMOH radiation data found before a zone title:  " + line);
+
+            int freq = findIndex(plistWaveFreq, atof(word.at(0).c_str()));
+            int nForce = (word.size() - 1) / 2;
+            resizeData(plistWaveFreq.size(), 0, max(nForce, (motion / NDOF + 1) * NDOF));
+
+            for (int i = 0; i < nForce; i++)
+            {
+                plistMass.at(freq)(i, motion) = atof(word.at(1 + 2 * i).c_str());
+                plistDamp.at(freq)(i, motion) = atof(word.at(2 + 2 * i).c_str());
+            }
+        }
+    }
+
+    //Excitation forces.  One zone for each wave direction.  Each line has the wave frequency, then amplitude and
+    //phase for each force.
+    {
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathIn + SLASH + NEMOH_EXCITE, fileIn, memIn);
+        vector<double> listBeta;
+        int dir = -1;
+
+        while (getline(*ptInput, line))
+        {
+            vector<string> word = splitLine(line);
+            if (word.size() == 0)
+                continue;
+
+            //Zone title:  Diffraction force - beta = <angle> deg
+            if (line.find("Zone") != string::npos)
+            {
+                size_t pos = line.find("beta");
+                if ((pos == string::npos) || (line.find('=', pos) == string::npos))
+                    throw std::runtime_error("NEMOH zone title not recognized:  " + line);
+
+                dir = findIndex(listBeta, atof(line.substr(line.find('=', pos) + 1).c_str()));
+                resizeData(0, listBeta.size(), 0);
+                continue;
+            }
+
+            if (!isdigit(word.at(0).at(0)) && (word.at(0).at(0) != '.'))
+                continue;
+            if (dir < 0)
+                throw std::runtime_error("NEMOH excitation data found before a zone title:  " + line);
+
+            int freq = findIndex(plistWaveFreq, atof(word.at(0).c_str()));
+            int nForce = (word.size() - 1) / 2;
+            resizeData(plistWaveFreq.size(), 0, nForce);
+
+            for (int i = 0; i < nForce; i++)
+            {
+                plistExcite.at(dir).at(freq)(i) =
+                        polar(atof(word.at(1 + 2 * i).c_str()), atof(word.at(2 + 2 * i).c_str()));
+            }
+            plistExciteSet.at(dir).at(freq) = true;
+        }
+
+        for (unsigned int d = 0; d < listBeta.size(); d++)
+            plistWaveDir.push_back(getAngle(listBeta.at(d)));
+    }
+
+    //Hydrostatic stiffness.  Optional.  One file for a single body, or one file for each body.
+    int nBody = pDofTot / NDOF;
+    for (int b = 0; b < nBody; b++)
+    {
+        string pathStiff = pathIn + SLASH + NEMOH_STIFF + ".dat";
+        if (nBody > 1)
+            pathStiff = pathIn + SLASH + NEMOH_STIFF + "_" + itoa(b) + ".dat";
+
+        if (!hasFile(pathStiff))
+            continue;
+
+        ifstream fileIn;
+        istringstream memIn;
+        istream *ptInput = openFile(pathStiff, fileIn, memIn);
+
+        for (int i = 0; (i < NDOF) && getline(*ptInput, line); i++)
+        {
+            vector<string> word = splitLine(line);
+            for (int j = 0; (j < NDOF) && (j < static_cast<int>(word.size())); j++)
+                pStiff(b * NDOF + i, b * NDOF + j) = atof(word.at(j).c_str());
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool HydroImport::hasFile(string pathIn)
+{
+    if (ptMemory && (ptMemory->find(pathIn) != ptMemory->end()))
+        return true;
+
+    ifstream fileIn(pathIn.c_str());
+    return fileIn.good();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+istream *HydroImport::openFile(string pathIn, ifstream &fileIn, istringstream &memIn)
+{
+    plistReadFiles.push_back(pathIn);
+
+    //Files supplied in memory take priority over the file system.
+    if (ptMemory && (ptMemory->find(pathIn) != ptMemory->end()))
+    {
+        memIn.str(ptMemory->find(pathIn)->second);
+        return &memIn;
+    }
+
+    fileIn.open(pathIn.c_str());
+    if (!fileIn)
+        throw std::runtime_error("Could not open file:  " + pathIn);
+
+    return &fileIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> HydroImport::splitLine(string lineIn)
+{
+    vector<string> output;
+    istringstream stream(lineIn);
+    string word;
+
+    while (stream >> word)
+        output.push_back(word);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroImport::findIndex(vector<double> &listIn, double valIn)
+{
+    for (unsigned int i = 0; i < listIn.size(); i++)
+    {
+        if (listIn.at(i) == valIn)
+            return i;
+    }
+
+    listIn.push_back(valIn);
+    return listIn.size() - 1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroImport::resizeData(int nFreq, int nDir, int nDof)
+{
+    //Degrees of freedom.  Grow every matrix.
+    if (nDof > pDofTot)
+    {
+        mat temp = zeros<mat>(nDof, nDof);
+        if (pDofTot > 0)
+            temp.submat(0, 0, pDofTot - 1, pDofTot - 1) = pStiff;
+        pStiff = temp;
+
+        for (unsigned int k = 0; k < plistMass.size(); k++)
+        {
+            temp = zeros<mat>(nDof, nDof);
+            if (pDofTot > 0)
+                temp.submat(0, 0, pDofTot - 1, pDofTot - 1) = plistMass.at(k);
+            plistMass.at(k) = temp;
+
+            temp = zeros<mat>(nDof, nDof);
+            if (pDofTot > 0)
+                temp.submat(0, 0, pDofTot - 1, pDofTot - 1) = plistDamp.at(k);
+            plistDamp.at(k) = temp;
+        }
+
+        for (unsigned int d = 0; d < plistExcite.size(); d++)
+        {
+            for (unsigned int k = 0; k < plistExcite.at(d).size(); k++)
+            {
+                cx_vec tempVec = zeros<cx_vec>(nDof);
+                if (pDofTot > 0)
+                    tempVec.rows(0, pDofTot - 1) = plistExcite.at(d).at(k);
+                plistExcite.at(d).at(k) = tempVec;
+            }
+        }
+
+        pDofTot = nDof;
+    }
+
+    //Wave frequencies.
+    while (static_cast<int>(plistMass.size()) < nFreq)
+    {
+        plistMass.push_back(zeros<mat>(pDofTot, pDofTot));
+        plistDamp.push_back(zeros<mat>(pDofTot, pDofTot));
+    }
+
+    //Wave directions.
+    while (static_cast<int>(plistExcite.size()) < nDir)
+    {
+        plistExcite.push_back(vector<cx_vec>());
+        plistExciteSet.push_back(vector<bool>());
+    }
+
+    //Every wave direction has an entry for every wave frequency.
+    for (unsigned int d = 0; d < plistExcite.size(); d++)
+    {
+        while (plistExcite.at(d).size() < plistMass.size())
+        {
+            plistExcite.at(d).push_back(zeros<cx_vec>(pDofTot));
+            plistExciteSet.at(d).push_back(false);
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double HydroImport::getAngle(double degIn)
+{
+    double output = fmod(degIn, 360.0);
+
+    if (output < 0.0)
+        output += 360.0;
+
+    return output * M_PI / 180.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroImport::getPower(int dofA, int dofB, int baseIn)
+{
+    int output = baseIn;
+
+    //Modes 4 to 6 of each body are rotations.
+    if ((dofA > 0) && ((dofA - 1) % NDOF >= 3))
+        output++;
+    if ((dofB > 0) && ((dofB - 1) % NDOF >= 3))
+        output++;
+
+    return output;
+}
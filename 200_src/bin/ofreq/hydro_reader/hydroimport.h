@@ -0,0 +1,338 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+//Put header file includes and constant variables in here.
+#ifndef HYDROIMPORT_H
+#define HYDROIMPORT_H
+#include <map>
+#include <fstream>
+#include <sstream>
+#include "../global_objects/ioword.h"
+#include "../hydro_data/hydrodata.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * @brief Imports hydrodynamic data directly from the output files of other radiation-diffraction programs.
+ *
+ * The normal path for hydrodynamic data is the ohydro file tree (environment.out, directions.out, frequencies.out,
+ * and one directory of files for each wave direction).  Data from other programs had to be converted into that file
+ * tree first, then parsed again by HydroReader.  This class reads the output files of those programs in a single
+ * pass, straight into matrices.  It then builds the same hydroData objects that HydroReader builds from the ohydro
+ * file tree.
+ *
+ * Supported formats:
+ * 1.)  AQWA:   The ASCII hydrodynamic database (.AH1 file).  The path is the file.  Coefficients are dimensional.
+ *              Phases are in degrees.
+ * 2.)  WAMIT:  The added mass and damping file (.1), with the excitation file (.3, or .2 if no .3 exists).  The
+ *              path is the .1 file.  The hydrostatic file (.hst) is optional.  Coefficients are non-dimensional.
+ *              The gravity, length scale, and water depth are taken from the log file (.out), if it exists.
+ *              Periods must be in seconds (IPERIN = 1).  Zero and infinite periods are skipped.
+ * 3.)  NEMOH:  The path is the calculation directory, with the file Nemoh.cal.  Results are read from
+ *              results/RadiationCoefficients.tec and results/ExcitationForce.tec.  Hydrostatic stiffness is read
+ *              from Mesh/KH.dat (or Mesh/KH_0.dat, Mesh/KH_1.dat for several bodies), if it exists.
+ *
+ * Every body has six degrees of freedom.  Bodies are named body1, body2, and so on, in the order of the source
+ * program.  Use those names as the hydrobody names in the bodies.in file.  All data is per unit wave amplitude.
+ * Reactive data does not depend on wave direction, so it is copied to each wave direction.
+ *
+ * To use this class:
+ * 1.)  Call findFormat() with the path from data.in.  If it returns zero, the path is an ohydro file tree.
+ * 2.)  Call read() with the same path.
+ * 3.)  Call getHydroData() for each wave direction.
+ */
+class HydroImport : public osea::ofreq::ioword
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    HydroImport();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~HydroImport();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the list of files supplied in memory.  Same as FileReader::setMemoryFiles().
+     * @param ptInput Pointer to map of strings.  The key is the file path and the value is the file content.  Files
+     * in the map take priority over the file system.  Use NULL to read only from the file system.
+     */
+    void setMemoryFiles(const std::map<std::string, std::string> *ptInput);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds the format of the hydrodynamic data at a path.
+     * @param pathIn String, variable passed by value.  The path listed in the data.in file.
+     * @return Returns integer, variable passed by value.  Returns 0 for an ohydro file tree (no import).  1 for
+     * AQWA.  2 for WAMIT.  3 for NEMOH.
+     */
+    int findFormat(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads the hydrodynamic data at a path.
+     *
+     * The format is found with findFormat().  Any previous data is cleared first.  Throws std::runtime_error if
+     * the files can not be read, or the data is incomplete.
+     * @param pathIn String, variable passed by value.  The path listed in the data.in file.
+     */
+    void read(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the name of the format last read.
+     * @return Returns string, variable passed by value.  AQWA, WAMIT, or NEMOH.  Empty if nothing was read.
+     */
+    std::string getFormatName();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of wave frequencies.  Measured in rad/s.  In the order of the source files.
+     * @return Returns a vector of doubles, passed by reference.
+     */
+    std::vector<double> &listWaveFreq();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of wave directions.  Measured in rad, in the body coordinate system.  In the order of the
+     * source files.
+     * @return Returns a vector of doubles, passed by reference.
+     */
+    std::vector<double> &listWaveDir();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of files opened by the last read, in the order they were opened.
+     * @return Returns a vector of strings, passed by reference.  The full path of each file.
+     */
+    std::vector<std::string> &listReadFiles();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the water density used for the hydrodynamic data.
+     * @return Returns double, variable passed by value.  The water density, measured in kg/m^3.
+     */
+    double getDensity();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the water depth used for the hydrodynamic data.
+     * @return Returns double, variable passed by value.  The water depth, measured in m.  Zero for infinite depth.
+     */
+    double getDepth();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the gravity vector used for the hydrodynamic data.  Same form as the environment.out file.
+     * @return Returns a vector of doubles, passed by value.  Three entries for the X, Y, and Z components of
+     * gravity.  Measured in m/s^2.
+     */
+    std::vector<double> getGravity();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of bodies in the hydrodynamic data.
+     * @return Returns integer, variable passed by value.
+     */
+    int getBodyCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds the hydroData objects for one wave direction.  One object for each body.
+     *
+     * Same content as HydroReader builds from the ohydro file tree:  reactive forces for derivative orders 0 to 2,
+     * active forces, and one crossbody force for every other body.
+     * @param dirInd Integer, variable passed by value.  The index of the wave direction.
+     * @return Returns a vector of hydroData objects, passed by value.
+     */
+    std::vector<ofreq::hydroData> getHydroData(int dirInd);
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads an AQWA ASCII hydrodynamic database.
+     * @param pathIn String, variable passed by value.  The path of the .AH1 file.
+     */
+    void readAqwa(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads the WAMIT output files.
+     * @param pathIn String, variable passed by value.  The path of the .1 file.
+     */
+    void readWamit(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads the NEMOH output files.
+     * @param pathIn String, variable passed by value.  The path of the NEMOH calculation directory.
+     */
+    void readNemoh(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Tests if a file can be read, either from memory or from the file system.
+     * @param pathIn String, variable passed by value.  The path of the file.
+     * @return Returns boolean, variable passed by value.  True if the file exists.
+     */
+    bool hasFile(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Opens a file for reading, either from memory or from the file system.  Throws std::runtime_error if
+     * the file can not be opened.
+     * @param pathIn String, variable passed by value.  The path of the file.
+     * @param fileIn ifstream, passed by reference.  Used if the file is on the file system.
+     * @param memIn istringstream, passed by reference.  Used if the file is in memory.
+     * @return Returns pointer to istream.  Points to either fileIn or memIn.
+     */
+    std::istream *openFile(std::string pathIn, std::ifstream &fileIn, std::istringstream &memIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Splits a line of text into words, separated by white space.
+     * @param lineIn String, variable passed by value.  The line of text.
+     * @return Returns a vector of strings, passed by value.
+     */
+    std::vector<std::string> splitLine(std::string lineIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds a value in a list, and adds it to the end of the list if not found.
+     * @param listIn Vector of doubles, passed by reference.  The list to search.
+     * @param valIn Double, variable passed by value.  The value to find.
+     * @return Returns integer, variable passed by value.  The index of the value in the list.
+     */
+    int findIndex(std::vector<double> &listIn, double valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Grows the stored matrices to fit the given number of frequencies, directions, and degrees of freedom.
+     *
+     * Matrices never shrink.  New entries are zero.
+     * @param nFreq Integer, variable passed by value.  The number of wave frequencies.
+     * @param nDir Integer, variable passed by value.  The number of wave directions.
+     * @param nDof Integer, variable passed by value.  The total number of degrees of freedom, for all bodies.
+     */
+    void resizeData(int nFreq, int nDir, int nDof);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts a wave direction from degrees to radians, in the range from 0 to 2*pi.
+     * @param degIn Double, variable passed by value.  The wave direction in degrees.  Other programs often use
+     * negative wave directions.
+     * @return Returns double, variable passed by value.  The wave direction in radians.
+     */
+    double getAngle(double degIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the power of the length scale for WAMIT non-dimensional coefficients.
+     * @param dofA Integer, variable passed by value.  The first mode, starting at 1.
+     * @param dofB Integer, variable passed by value.  The second mode, starting at 1.  Zero if only one mode is
+     * involved.
+     * @param baseIn Integer, variable passed by value.  The power for translation modes only.
+     * @return Returns integer, variable passed by value.  baseIn, plus one for each rotation mode.
+     */
+    int getPower(int dofA, int dofB, int baseIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pFormat; /**< The format last read.  Same values as findFormat(). */
+    const std::map<std::string, std::string> *ptMemory; /**< Files supplied in memory.  NULL if none. */
+    std::vector<double> plistWaveFreq; /**< The list of wave frequencies, in rad/s. */
+    std::vector<double> plistWaveDir; /**< The list of wave directions, in rad. */
+    std::vector<std::string> plistReadFiles; /**< The files opened by the last read. */
+    double pDensity; /**< The water density, in kg/m^3. */
+    double pDepth; /**< The water depth, in m.  Zero for infinite depth. */
+    double pGravity; /**< The magnitude of gravity, in m/s^2. */
+    int pDofTot; /**< The total number of degrees of freedom, for all bodies. */
+    std::vector<arma::mat> plistMass; /**< Added mass for all bodies.  One matrix for each wave frequency. */
+    std::vector<arma::mat> plistDamp; /**< Damping for all bodies.  One matrix for each wave frequency. */
+    arma::mat pStiff; /**< Hydrostatic stiffness for all bodies.  Same for every wave frequency. */
+    std::vector< std::vector<arma::cx_vec> > plistExcite; /**< Excitation for all bodies.  By direction, then frequency. */
+    std::vector< std::vector<bool> > plistExciteSet; /**< True if the excitation was read.  By direction, then frequency. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static int NDOF; /**< The number of degrees of freedom for each body. */
+    static std::string BODY; /**< The prefix for body names.  Followed by the body number, starting at 1. */
+    static std::string NEMOH_CAL; /**< The name of the NEMOH input file. */
+    static std::string NEMOH_RADIATION; /**< The path of the NEMOH radiation coefficients, in the calculation directory. */
+    static std::string NEMOH_EXCITE; /**< The path of the NEMOH excitation forces, in the calculation directory. */
+    static std::string NEMOH_STIFF; /**< The path of the NEMOH hydrostatic stiffness, without extension. */
+};
+
+}   //Namespace osea
+
+#endif // HYDROIMPORT_H
@@ -25,6 +25,10 @@
 \*-------------------------------------------------------------------------------------------------------------------*/
 
 #include "hydroreader.h"
+#include "hydroimport.h"
+#include <thread>
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 using namespace osea;
@@ -72,6 +76,23 @@ std::string HydroReader::OBJ_CROSSSTIFFNESS = "crossstiff"; /**< The designation
 //------------------------------------------Function Separator --------------------------------------------------------
 HydroReader::HydroReader()
 {
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+    pNext = 0;
+    pSelective = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroReader::setThreads(int threadsIn)
+{
+    pThreads = (threadsIn < 1) ? 1 : threadsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroReader::setSelective(bool selIn)
+{
+    pSelective = selIn;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -82,44 +103,129 @@ int HydroReader::readHydroSys()
     plistTempHydro.clear();
     plistWaveDir.clear();
     plistWaveFreq.clear();
+    plistNeedDir.clear();
+    plistNeedFreq.clear();
+    plistNeedBody.clear();
+    plistDirFiles.clear();
+    plistReadFiles.clear();
 
     try {
         //Write output to user.
         logStd.Write(string("    ") + pPath + string(". . . "),3);
 
-        //First read the top level files
-        //Read environment file
-        readEnvironment();
+        //Track memory of the hydro coefficients.
+        unsigned long sizeFull = 0;
+        unsigned long sizeCompact = 0;
+        int nShare = 0;
+        int nAverage = 0;
 
-        //Read directions file
-        readDirections();
+        //Output files from other programs are imported directly.  No conversion to the ohydro format.
+        HydroImport import;
+        if (import.findFormat(pPath) != 0)
+        {
+            import.read(pPath);
+            plistReadFiles = import.listReadFiles();
+
+            pWaveAmp = 1.0;
+            pDepth = import.getDepth();
+            pDensity = import.getDensity();
+            pGravity = import.getGravity();
+            plistWaveFreq = import.listWaveFreq();
+            plistWaveDir = import.listWaveDir();
+
+            logStd.Write(string("    Imported ") + import.getFormatName() + string(" data:  ")
+                         + itoa(import.getBodyCount()) + string(" bodies, ")
+                         + itoa(plistWaveDir.size()) + string(" wave directions, ")
+                         + itoa(plistWaveFreq.size()) + string(" wave frequencies"), 3);
+
+            if (pSelective)
+                findNeeded();
+
+            int nDir = plistWaveDir.size();
+            plistDirHydro.assign(nDir, vector<ofreq::hydroData>());
+            plistDirFull.assign(nDir, 0);
+            plistDirCompact.assign(nDir, 0);
+            plistDirShare.assign(nDir, 0);
+            plistDirAvg.assign(nDir, 0);
+            plistDirErr.assign(nDir, string(""));
+            plistDirDrop.assign(nDir, 0);
+
+            for (int dir = 0; dir < nDir; dir++)
+            {
+                if ((plistNeedDir.size() > 0) && !plistNeedDir.at(dir))
+                    continue;
+
+                plistTempHydro = import.getHydroData(dir);
+                plistDirDrop.at(dir) = trimHydro();
+                plistDirShare.at(dir) = compactHydro(plistDirFull.at(dir), plistDirCompact.at(dir),
+                                                     plistDirAvg.at(dir));
+                plistTempHydro.swap(plistDirHydro.at(dir));
+                plistTempHydro.clear();
+            }
+        }
+        else
+        {
+            //First read the top level files
+            //Read environment file
+            readEnvironment();
+
+            //Read directions file
+            readDirections();
+
+            //Read frequencies file
+            readFrequencies();
+
+            //Work out which data the run needs before reading the wave direction files.
+            if (pSelective)
+                findNeeded();
+
+            //Next read the files of each wave direction.  The directions are independent, so each worker thread
+            //reads whole directions into its own list of hydrodata objects.
+            int nDir = plistWaveDir.size();
+            plistDirHydro.assign(nDir, vector<ofreq::hydroData>());
+            plistDirFull.assign(nDir, 0);
+            plistDirCompact.assign(nDir, 0);
+            plistDirShare.assign(nDir, 0);
+            plistDirAvg.assign(nDir, 0);
+            plistDirErr.assign(nDir, string(""));
+            plistDirDrop.assign(nDir, 0);
+            plistDirFiles.assign(nDir, vector<string>());
+
+            pNext = 0;
+            int nThread = (pThreads < nDir) ? pThreads : nDir;
+
+            if (nThread <= 1)
+                runWorker();
+            else
+            {
+                vector<std::thread> listThread;
+                for (int t = 0; t < nThread; t++)
+                    listThread.push_back(std::thread(&HydroReader::runWorker, this));
 
-        //Read frequencies file
-        readFrequencies();
+                for (unsigned int t = 0; t < listThread.size(); t++)
+                    listThread.at(t).join();
+            }
+        }
 
-        //Next Iterate through each of the wave directions and read those files.
+        //Merge in order of wave direction.  Same sequence as reading one direction at a time.
+        int nDrop = 0;
         for (WaveInd = 0; WaveInd < plistWaveDir.size(); WaveInd++)
         {
-            //Read the hydro mass file
-            readHydroMass(WaveInd);
-
-            //Read the hydro damping file
-            readHydroDamp(WaveInd);
-
-            //Read the hydro stiffness file
-            readHydroStiff(WaveInd);
+            if (!plistDirErr.at(WaveInd).empty())
+                throw std::runtime_error(plistDirErr.at(WaveInd));
 
-            //Read the cross mass file
-            readCrossMass(WaveInd);
+            sizeFull += plistDirFull.at(WaveInd);
+            sizeCompact += plistDirCompact.at(WaveInd);
+            nShare += plistDirShare.at(WaveInd);
+            nAverage += plistDirAvg.at(WaveInd);
+            nDrop = max(nDrop, plistDirDrop.at(WaveInd));
 
-            //Read the cross damping file
-            readCrossDamp(WaveInd);
+            //Files read for this direction.  Imported data has none.
+            if (WaveInd < plistDirFiles.size())
+                plistReadFiles.insert(plistReadFiles.end(), plistDirFiles.at(WaveInd).begin(),
+                                      plistDirFiles.at(WaveInd).end());
 
-            //Read the cross stiffness file
-            readCrossStiff(WaveInd);
-
-            //Read the active forces file
-            readForceExcite(WaveInd);
+            plistTempHydro.swap(plistDirHydro.at(WaveInd));
 
             //Done reading in data.  Transfer the data from temporary holding to final values.
             //Each hydrodata object is its own hydrobody.
@@ -163,15 +269,54 @@ int HydroReader::readHydroSys()
 
             //Clear the list of hydrodata
             plistTempHydro.clear();
+            plistDirHydro.at(WaveInd).clear();
+        }
+
+        //Report data skipped by selective loading.
+        if (pSelective)
+        {
+            int nDirLoad = plistWaveDir.size();
+            if (plistNeedDir.size() > 0)
+                nDirLoad = count(plistNeedDir.begin(), plistNeedDir.end(), true);
+
+            int nFreqLoad = plistWaveFreq.size();
+            if (plistNeedFreq.size() > 0)
+                nFreqLoad = plistNeedFreq.size();
+
+            logStd.Write(string("    Selective loading:  ") + itoa(nDirLoad) + string(" of ")
+                         + itoa(plistWaveDir.size()) + string(" wave directions, ")
+                         + itoa(nFreqLoad) + string(" of ") + itoa(plistWaveFreq.size())
+                         + string(" wave frequencies, ") + itoa(nDrop)
+                         + string(" unreferenced hydro bodies skipped"), 3);
+        }
+
+        //Report memory savings.
+        if (sizeFull > 0)
+        {
+            logStd.Write(string("    Hydro storage:  ") + itoa(sizeCompact / 1024) + string(" kB, compacted from ")
+                         + itoa(sizeFull / 1024) + string(" kB (")
+                         + itoa(static_cast<int>(100.0 * (sizeFull - sizeCompact) / sizeFull)) + string("% saved), ")
+                         + itoa(nShare) + string(" reciprocal blocks shared"), 3);
+        }
+
+        //Averaging changes the input coefficients.  Always report it.
+        if (nAverage > 0)
+        {
+            logStd.Write(string("    Reciprocal averaging:  ") + itoa(nAverage)
+                         + string(" crossbody blocks were not equal within round off, and were replaced by the "
+                                  "average of the pair (reciptol ") + ftoa(ptSystem->getRecipTolerance()) + ")", 2);
         }
 
         //Write output to user.
         logStd.Write("    . . . done.",3);
+
+        return 0;
     }
     catch(const std::exception &err)
     {
         logStd.Notify();
         logErr.Write(ID + std::string(err.what()));   
+        return 1;
     }
 }
 
@@ -683,3 +828,314 @@ int HydroReader::findHydroDataTemp(std::string BodyName)
 
 
 
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroReader::runWorker()
+{
+    //Each worker has its own reader, so the parsed objects and temporary hydrodata are never shared.
+    HydroReader reader;
+    reader.ptSystem = ptSystem;
+    reader.ptMemory = ptMemory;
+    reader.pPath = pPath;
+    reader.pGravity = pGravity;
+    reader.plistWaveFreq = plistWaveFreq;
+    reader.plistWaveDir = plistWaveDir;
+    reader.pWaveAmp = pWaveAmp;
+    reader.pDepth = pDepth;
+    reader.pDensity = pDensity;
+    reader.plistNeedFreq = plistNeedFreq;
+    reader.plistNeedBody = plistNeedBody;
+
+    int nDir = plistWaveDir.size();
+
+    while (true)
+    {
+        int dir = pNext++;
+        if (dir >= nDir)
+            break;
+
+        //Directions the run does not use are never read.
+        if ((plistNeedDir.size() > 0) && !plistNeedDir.at(dir))
+            continue;
+
+        try
+        {
+            reader.plistTempHydro.clear();
+            reader.plistReadFiles.clear();
+            reader.WaveInd = dir;
+
+            //Read the files in the same sequence as a single reader.
+            reader.readHydroMass(dir);
+            reader.readHydroDamp(dir);
+            reader.readHydroStiff(dir);
+            reader.readCrossMass(dir);
+            reader.readCrossDamp(dir);
+            reader.readCrossStiff(dir);
+            reader.readForceExcite(dir);
+
+            //Drop the hydro bodies and wave frequencies the run does not use.
+            plistDirDrop.at(dir) = reader.trimHydro();
+
+            //Store the data compact before it gets merged into the system.
+            plistDirShare.at(dir) = reader.compactHydro(plistDirFull.at(dir), plistDirCompact.at(dir),
+                                                        plistDirAvg.at(dir));
+
+            reader.plistTempHydro.swap(plistDirHydro.at(dir));
+            reader.plistReadFiles.swap(plistDirFiles.at(dir));
+        }
+        catch(const std::exception &err)
+        {
+            plistDirErr.at(dir) = std::string(err.what());
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroReader::compactHydro(unsigned long &sizeFull, unsigned long &sizeCompact, int &nAverage)
+{
+    int output = 0;
+
+    //Real valued storage for each body.
+    for (unsigned int j = 0; j < plistTempHydro.size(); j++)
+    {
+        sizeFull += plistTempHydro.at(j).getStorage();
+        plistTempHydro.at(j).compact();
+    }
+
+    //Reciprocal crossbody blocks between each pair of bodies.
+    for (unsigned int j = 0; j < plistTempHydro.size(); j++)
+    {
+        ofreq::hydroData &dataJ = plistTempHydro.at(j);
+
+        for (int c = 0; c < dataJ.getCrossCount(0); c++)
+        {
+            for (unsigned int k = j + 1; k < plistTempHydro.size(); k++)
+            {
+                ofreq::hydroData &dataK = plistTempHydro.at(k);
+                if (dataJ.getCrossName(0, c) != dataK.getHydroBodyName())
+                    continue;
+
+                //Find the block linking back to body j.
+                for (int c2 = 0; c2 < dataK.getCrossCount(0); c2++)
+                {
+                    if (dataK.getCrossName(0, c2) != dataJ.getHydroBodyName())
+                        continue;
+
+                    int share = dataJ.shareCross(c, dataK, c2, ptSystem->getRecipTolerance());
+                    if (share > 0)
+                        output++;
+                    if (share == 2)
+                        nAverage++;
+                }
+            }
+        }
+    }
+
+    for (unsigned int j = 0; j < plistTempHydro.size(); j++)
+        sizeCompact += plistTempHydro.at(j).getStorage();
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroReader::findNeeded()
+{
+    plistNeedDir.clear();
+    plistNeedFreq.clear();
+    plistNeedBody.clear();
+
+    //Directional spreading replaces the wave directions after loading.  Keep all directions.
+    bool spread = false;
+    for (unsigned int i = 0; i < ptSystem->listSeaModel().size(); i++)
+    {
+        if (dynamic_cast<osea::SeaModel_Spreading*>(ptSystem->listSeaModelPt(i)) != NULL)
+            spread = true;
+    }
+
+    //Wave directions.  Nothing to save with two or fewer.
+    int nDir = plistWaveDir.size();
+    if (!spread && (nDir > 2) && (ptSystem->listWaveDirections().size() > 0))
+    {
+        plistNeedDir.assign(nDir, false);
+
+        //Angles the hydro data is sampled at.
+        vector<double> listAngle = ptSystem->listWaveDirections();
+
+        //The far-field approximation samples the excitation of each body along the bearing to every other body,
+        //and of the other body along the reverse bearing.  Which pairs are far apart is only known after loading,
+        //so keep the bearings of all pairs.
+        if (ptSystem->getFarField() > 0)
+        {
+            for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+            {
+                for (unsigned int c = b + 1; c < ptSystem->listBody().size(); c++)
+                {
+                    double bearing = atan2(ptSystem->listBody(b).getLocationY() - ptSystem->listBody(c).getLocationY(),
+                                           ptSystem->listBody(b).getLocationX() - ptSystem->listBody(c).getLocationX());
+                    listAngle.push_back(bearing);
+                    listAngle.push_back(bearing + M_PI);
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < listAngle.size(); i++)
+        {
+            //Same range of angles as HydroManager::setWaveDir().
+            double dirIn = listAngle.at(i);
+            if (dirIn < 0)
+                dirIn += 2 * M_PI;
+            if (dirIn > 2 * M_PI)
+                dirIn -= 2 * M_PI;
+
+            //Pair used for interpolation.
+            vector<int> index = findClosest(dirIn, plistWaveDir);
+            plistNeedDir.at(index.at(0)) = true;
+            plistNeedDir.at(index.at(1)) = true;
+
+            //Closest direction on either side, going around the circle.  Used for far-field excitation.
+            if (ptSystem->getFarField() > 0)
+            {
+                int indLow = 0;
+                int indHigh = 0;
+                double distLow = 4 * M_PI;
+                double distHigh = 4 * M_PI;
+
+                for (int j = 0; j < nDir; j++)
+                {
+                    double dist = fmod(plistWaveDir.at(j) - dirIn, 2 * M_PI);
+                    if (dist < 0)
+                        dist += 2 * M_PI;
+
+                    if (dist < distHigh)
+                    {
+                        distHigh = dist;
+                        indHigh = j;
+                    }
+
+                    dist = (dist == 0) ? 0 : 2 * M_PI - dist;
+                    if (dist < distLow)
+                    {
+                        distLow = dist;
+                        indLow = j;
+                    }
+                }
+
+                plistNeedDir.at(indLow) = true;
+                plistNeedDir.at(indHigh) = true;
+            }
+        }
+    }
+
+    //Wave frequencies.  Nothing to save with two or fewer.
+    int nFreq = plistWaveFreq.size();
+    if ((nFreq > 2) && (ptSystem->listWaveFrequencies().size() > 0))
+    {
+        vector<bool> listNeed(nFreq, false);
+
+        for (unsigned int i = 0; i < ptSystem->listWaveFrequencies().size(); i++)
+        {
+            vector<int> index = findClosest(ptSystem->listWaveFrequencies().at(i), plistWaveFreq);
+            listNeed.at(index.at(0)) = true;
+            listNeed.at(index.at(1)) = true;
+        }
+
+        for (int k = 0; k < nFreq; k++)
+        {
+            if (listNeed.at(k))
+                plistNeedFreq.push_back(k);
+        }
+    }
+
+    //Hydro bodies named by a body.
+    for (unsigned int i = 0; i < ptSystem->listBody().size(); i++)
+    {
+        string name = ptSystem->listBody(i).getHydroBodName();
+        if (find(plistNeedBody.begin(), plistNeedBody.end(), name) == plistNeedBody.end())
+            plistNeedBody.push_back(name);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HydroReader::trimHydro()
+{
+    int output = 0;
+
+    //Hydro bodies that no body uses.
+    if (plistNeedBody.size() > 0)
+    {
+        for (int j = plistTempHydro.size() - 1; j >= 0; j--)
+        {
+            if (find(plistNeedBody.begin(), plistNeedBody.end(), plistTempHydro.at(j).getHydroBodyName())
+                    == plistNeedBody.end())
+            {
+                plistTempHydro.erase(plistTempHydro.begin() + j);
+                output++;
+            }
+        }
+    }
+
+    //Wave frequencies that are not used for interpolation.  The lists stay aligned by frequency index.
+    if (plistNeedFreq.size() > 0)
+    {
+        for (unsigned int j = 0; j < plistTempHydro.size(); j++)
+        {
+            ofreq::hydroData &data = plistTempHydro.at(j);
+
+            vector<double> listFreq;
+            vector<ofreq::matForceReact> listReact;
+            vector<ofreq::matForceActive> listActive;
+            vector< vector<ofreq::matForceCross> > listCross;
+
+            for (unsigned int i = 0; i < plistNeedFreq.size(); i++)
+            {
+                unsigned int k = plistNeedFreq.at(i);
+
+                if (k < data.listWaveFreq().size())
+                    listFreq.push_back(data.listWaveFreq().at(k));
+                if (k < data.listDataReact().size())
+                    listReact.push_back(data.listDataReact().at(k));
+                if (k < data.listDataActive().size())
+                    listActive.push_back(data.listDataActive().at(k));
+                if (k < data.listDataCross().size())
+                    listCross.push_back(data.listDataCross().at(k));
+            }
+
+            data.listWaveFreq().swap(listFreq);
+            data.listDataReact().swap(listReact);
+            data.listDataActive().swap(listActive);
+            data.listDataCross().swap(listCross);
+        }
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<int> HydroReader::findClosest(double valIn, vector<double> &listIn)
+{
+    vector<int> output(2, 0);
+    double dist1 = 1E9;
+    double dist2 = 1E9;
+
+    //Closest match.
+    for (unsigned int i = 0; i < listIn.size(); i++)
+    {
+        if (fabs(valIn - listIn.at(i)) < dist1)
+        {
+            dist1 = fabs(valIn - listIn.at(i));
+            output.at(0) = i;
+        }
+    }
+
+    //Second closest match.
+    for (unsigned int i = 0; i < listIn.size(); i++)
+    {
+        if ((fabs(valIn - listIn.at(i)) < dist2) && (static_cast<int>(i) != output.at(0)))
+        {
+            dist2 = fabs(valIn - listIn.at(i));
+            output.at(1) = i;
+        }
+    }
+
+    return output;
+}
@@ -37,6 +37,7 @@
 //Put header files
 #ifndef HYDROREADER_H
 #define HYDROREADER_H
+#include <atomic>
 #include "../file_reader/filereader.h"
 #include "../hydro_data/hydrodata.h"
 #include "dictcrossdamp.h"
@@ -128,10 +129,41 @@ public:
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Tells the HydroReader to progress through reading each of the files in the hydrosystem.
+     *
+     * Afterwards, listReadFiles() holds every file of the hydrosystem that was actually read, in the same order for
+     * every run.  Wave direction files skipped by selective loading are not listed.
      * @return Returns an integer.  Returns 0 for success.  All others are error codes.
      */
     int readHydroSys();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads used to read the wave direction files.  Default is the number of hardware
+     * threads.
+     * @param threadsIn Integer.  The number of threads.  Variable passed by value.
+     */
+    void setThreads(int threadsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether readHydroSys() only loads the hydrodynamic data needed for the current run.
+     *
+     * Before reading the wave direction files, the reader works out which data the run can use.  It needs the wave
+     * directions and wave frequencies from the control file, and the bodies from the bodies file, so those must be
+     * read first.
+     * 1.)  Wave directions:  the two closest hydro wave directions to each control wave direction, the same pair
+     *      HydroManager interpolates between.  If far-field interaction is on, also the closest direction on either
+     *      side, used for the far-field excitation.  Directories for any other direction are never read.
+     * 2.)  Wave frequencies:  the two closest hydro wave frequencies to each control wave frequency, the same pair
+     *      used for interpolation.  Other frequencies are dropped after each direction is read.
+     * 3.)  Hydro bodies:  only hydro bodies named by a body.  Others are dropped after each direction is read.
+     * The interpolated results are identical to loading everything.  All directions are kept if a directional
+     * spreading sea model is defined, because it replaces the wave directions after the data is loaded.  Only use
+     * this when the wave directions and wave frequencies do not change after loading.  Default is false.
+     * @param selIn Boolean.  True to load only the data needed.  Variable passed by value.
+     */
+    void setSelective(bool selIn);
+
 //==========================================Section Separator =========================================================
 public slots:
 
@@ -268,6 +300,61 @@ private:
      */
     int findHydroDataTemp(std::string BodyName);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts the temporary hydrodata objects into compact storage.
+     *
+     * Each hydrodata object stores its reactive and crossbody coefficients as real values.  Then reciprocal crossbody
+     * blocks between each pair of bodies are stored only once.  See hydroData::compact() and
+     * hydroData::shareCross().  Called once per wave direction, before the data is transferred to the system.
+     * @param sizeFull Unsigned long, passed by reference.  The size of the coefficients before compaction, in bytes.
+     * The function adds to the existing value.
+     * @param sizeCompact Unsigned long, passed by reference.  The size of the coefficients after compaction, in
+     * bytes.  The function adds to the existing value.
+     * @param nAverage Integer, passed by reference.  The number of shared blocks that were averaged, because they
+     * were not equal within round off.  The function adds to the existing value.
+     * @return Returns integer, variable passed by value.  The number of reciprocal crossbody blocks shared.
+     * @sa System::setRecipTolerance()
+     */
+    int compactHydro(unsigned long &sizeFull, unsigned long &sizeCompact, int &nAverage);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Worker function for one thread.  Takes wave directions from the shared counter until none remain.
+     *
+     * Each wave direction is read by a separate HydroReader into its own list of hydrodata objects, then compacted.
+     * The results go into the per direction lists, and readHydroSys() merges them into the system in order of wave
+     * direction.
+     */
+    void runWorker();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Works out which wave directions, wave frequencies, and hydro bodies the run needs.  Called after the top
+     * level files are read, when selective loading is on.  See setSelective().  With the far-field approximation on,
+     * the bearings between every pair of bodies are kept as well.
+     */
+    void findNeeded();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Drops the hydro bodies and wave frequencies that are not needed from the temporary hydrodata objects.
+     * Called once per wave direction, before compaction.  Does nothing if the lists of needed items are empty.
+     * @return Returns integer, variable passed by value.  The number of hydro bodies dropped.
+     */
+    int trimHydro();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds the closest and second closest entries in a list.  Same rule as mathInterp::FindMatch(), so the
+     * selection matches the entries later used for interpolation.
+     * @param valIn Double.  The value to search for.  Variable passed by value.
+     * @param listIn Vector of doubles.  The list to search.  Variable passed by reference.
+     * @return Returns vector of two integers.  The index of the closest match, then the second closest match.
+     * Returned variable passed by value.
+     */
+    std::vector<int> findClosest(double valIn, std::vector<double> &listIn);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief The index of the wave direction currently reading data from.
@@ -328,6 +415,26 @@ private:
      */
     std::vector<ofreq::hydroData> plistTempHydro;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Per wave direction results from the worker threads.
+    std::vector< std::vector<ofreq::hydroData> > plistDirHydro; /**< Compacted hydrodata for each wave direction. */
+    std::vector<unsigned long> plistDirFull; /**< Size of the coefficients before compaction, in bytes. */
+    std::vector<unsigned long> plistDirCompact; /**< Size of the coefficients after compaction, in bytes. */
+    std::vector<int> plistDirShare; /**< Number of reciprocal crossbody blocks shared. */
+    std::vector<int> plistDirAvg; /**< Number of shared crossbody blocks that were averaged. */
+    std::vector<std::string> plistDirErr; /**< Error message for each wave direction.  Empty if none. */
+    std::vector< std::vector<std::string> > plistDirFiles; /**< Files read for each wave direction. */
+    int pThreads; /**< The number of threads used to read the wave direction files. */
+    std::atomic<int> pNext; /**< The next wave direction to read.  Shared between worker threads. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Selective loading.  See setSelective().
+    bool pSelective; /**< Boolean to record if only the needed data is loaded. */
+    std::vector<bool> plistNeedDir; /**< True for each wave direction needed.  Empty if all are needed. */
+    std::vector<int> plistNeedFreq; /**< Indices of the wave frequencies needed, in order.  Empty if all. */
+    std::vector<std::string> plistNeedBody; /**< Names of the hydro bodies needed.  Empty if all are needed. */
+    std::vector<int> plistDirDrop; /**< Number of hydro bodies dropped for each wave direction. */
+
     //------------------------------------------Function Separator ----------------------------------------------------
     // Directory Names
     static std::string DIR;  /**< The letter prefix for directory names of wave direction directories. */
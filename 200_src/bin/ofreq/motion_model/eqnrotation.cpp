@@ -133,28 +133,44 @@ std::complex<double> EqnRotation::setVarGlobtoBod()
 std::complex<double> EqnRotation::Func1()
 {
     //ForceMass
-    return ForceMass(var()) * Func20();
+    std::complex<double> coeff = ForceMass(var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == std::complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnRotation::Func2()
 {
     //ForceReact_hydro
-    return ForceReact_hydro(ord(),var()) * Func20();
+    std::complex<double> coeff = ForceReact_hydro(ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == std::complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnRotation::Func3()
 {
     //ForceReact_user
-    return ForceReact_user(ord(),var()) * Func20();
+    std::complex<double> coeff = ForceReact_user(ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == std::complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnRotation::Func4()
 {
     //ForceCross_hydro
-    return ForceCross_hydro(body(),ord(),var()) * Func20();
+    std::complex<double> coeff = ForceCross_hydro(body(),ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == std::complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -168,15 +184,22 @@ std::complex<double> EqnRotation::Func5()
 std::complex<double> EqnRotation::Func6()
 {
     //ForceCross_hydro
-    return Kronecker(curbody(),body(),true) *
-            Sum("Func5()", "ord");
+    std::complex<double> delta = Kronecker(curbody(),body(),true);
+    //Skip the summation for the current body.
+    if (delta == std::complex<double>(0,0))
+        return delta;
+    return delta * Sum("Func5()", "ord");
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnRotation::Func7()
 {
     //ForceCross-user
-    return ForceCross_user(body(),ord(),var()) * Func20();
+    std::complex<double> coeff = ForceCross_user(body(),ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == std::complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -190,8 +213,11 @@ std::complex<double> EqnRotation::Func8()
 std::complex<double> EqnRotation::Func9()
 {
     //ForceCross-user
-    return Kronecker(curbody(),body(),true) *
-            Sum("Func8()", "ord");
+    std::complex<double> delta = Kronecker(curbody(),body(),true);
+    //Skip the summation for the current body.
+    if (delta == std::complex<double>(0,0))
+        return delta;
+    return delta * Sum("Func8()", "ord");
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -257,7 +283,7 @@ std::complex<double> EqnRotation::Func19()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func20()
+std::complex<double> EqnRotation::Func20()
 {
     //Returning derivative of motion variables, in body coordinate system.
 
@@ -266,30 +292,38 @@ std::complex<double> EqnTranslation::Func20()
     switch(var())
     {
     case 1:
-        out = Ddt("Func21()", ord(), bod());
+        out = Ddt("Func21()", ord(), body());
+        break;
     case 2:
-        out = Ddt("Func22()", ord(), bod());
+        out = Ddt("Func22()", ord(), body());
+        break;
     case 3:
-        out = Ddt("Func23()", ord(), bod());
+        out = Ddt("Func23()", ord(), body());
+        break;
     case 4:
-        out = Ddt("Func24()", ord(), bod());
+        out = Ddt("Func24()", ord(), body());
+        break;
     case 5:
-        out = Ddt("Func25()", ord(), bod());
+        out = Ddt("Func25()", ord(), body());
+        break;
     case 6:
-        out = Ddt("Func26()", ord(), bod());
+        out = Ddt("Func26()", ord(), body());
+        break;
     }
+
+    return out;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func21()
+std::complex<double> EqnRotation::Func21()
 {
     //Translation X in body coordinates
     //X_1a * cos(R_z) + X_2a * sin(R_z)
-    Func27() * cos(R_z()) + Func28() * sin(R_z());
+    return Func27() * cos(R_z()) + Func28() * sin(R_z());
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func22()
+std::complex<double> EqnRotation::Func22()
 {
     //Translation Y in body coordinates
     //-X_1a * sin(R_z) + X_2a * cos(R_z)
@@ -297,31 +331,31 @@ std::complex<double> EqnTranslation::Func22()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func23()
+std::complex<double> EqnRotation::Func23()
 {
     return T_x() * Ddt(6,0) - T_y() * Ddt(4,0) + Ddt(3,0);
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func24()
+std::complex<double> EqnRotation::Func24()
 {
     return Func29() * cos(R_z()) + Func30() * sin(R_z());
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func25()
+std::complex<double> EqnRotation::Func25()
 {
     return -Func29() * sin(R_z()) + Func30() * cos(R_z());
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func26()
+std::complex<double> EqnRotation::Func26()
 {
     return T_x() * Ddt(3,0) - T_y() * Ddt(2,0) + Ddt(5,0);
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func27()
+std::complex<double> EqnRotation::Func27()
 {
     //Partial conversion of body coordinates.
     //X1a;
@@ -329,7 +363,7 @@ std::complex<double> EqnTranslation::Func27()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func28()
+std::complex<double> EqnRotation::Func28()
 {
     //Partial conversion of body coordinates.
     //X2a;
@@ -337,7 +371,7 @@ std::complex<double> EqnTranslation::Func28()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func29()
+std::complex<double> EqnRotation::Func29()
 {
     //Partial conversion of body coordinates.
     //X4a;
@@ -345,7 +379,7 @@ std::complex<double> EqnTranslation::Func29()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-std::complex<double> EqnTranslation::Func30()
+std::complex<double> EqnRotation::Func30()
 {
     //Partial conversion of body coordinates.
     //X5a;
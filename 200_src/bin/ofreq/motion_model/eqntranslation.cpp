@@ -161,7 +161,11 @@ std::complex<double> EqnTranslation::setVarGlobtoBod()
 std::complex<double> EqnTranslation::Func1()
 {
     //ForceReact_hydro
-    return ForceReact_hydro(ord(),var()) * Func20();
+    complex<double> coeff = ForceReact_hydro(ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -175,7 +179,11 @@ std::complex<double> EqnTranslation::Func2()
 std::complex<double> EqnTranslation::Func3()
 {
     //ForceReact_user
-    return ForceReact_user(ord(),var()) * Func20();
+    complex<double> coeff = ForceReact_user(ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -189,30 +197,44 @@ std::complex<double> EqnTranslation::Func4()
 std::complex<double> EqnTranslation::Func5()
 {
     //ForceCross_hydro
-    return ForceCross_hydro(body(),ord(),var()) * Func20();
+    complex<double> coeff = ForceCross_hydro(body(),ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnTranslation::Func6()
 {
     //ForceCross_hydro
-    return Kronecker(curbody(),body(),true) *
-            Sum("Func9()", "ord", 0, 2);
+    complex<double> delta = Kronecker(curbody(),body(),true);
+    //Skip the summation for the current body.
+    if (delta == complex<double>(0,0))
+        return delta;
+    return delta * Sum("Func9()", "ord", 0, 2);
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnTranslation::Func7()
 {
     //ForceCross_user
-    return ForceCross_user(body(),ord(),var()) * Func20();
+    complex<double> coeff = ForceCross_user(body(),ord(),var());
+    //Skip the motion derivative when the coefficient is zero.
+    if (coeff == complex<double>(0,0))
+        return coeff;
+    return coeff * Func20();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 std::complex<double> EqnTranslation::Func8()
 {
     //ForceCross_user
-    return Kronecker(curbody(),body(),true) *
-            Sum("Func10()", "ord");
+    complex<double> delta = Kronecker(curbody(),body(),true);
+    //Skip the summation for the current body.
+    if (delta == complex<double>(0,0))
+        return delta;
+    return delta * Sum("Func10()", "ord");
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -293,18 +315,26 @@ std::complex<double> EqnTranslation::Func20()
     switch(var())
     {
     case 1:
-        out = Ddt("Func21()", ord(), bod());
+        out = Ddt("Func21()", ord(), body());
+        break;
     case 2:
-        out = Ddt("Func22()", ord(), bod());
+        out = Ddt("Func22()", ord(), body());
+        break;
     case 3:
-        out = Ddt("Func23()", ord(), bod());
+        out = Ddt("Func23()", ord(), body());
+        break;
     case 4:
-        out = Ddt("Func24()", ord(), bod());
+        out = Ddt("Func24()", ord(), body());
+        break;
     case 5:
-        out = Ddt("Func25()", ord(), bod());
+        out = Ddt("Func25()", ord(), body());
+        break;
     case 6:
-        out = Ddt("Func26()", ord(), bod());
+        out = Ddt("Func26()", ord(), body());
+        break;
     }
+
+    return out;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -312,7 +342,7 @@ std::complex<double> EqnTranslation::Func21()
 {
     //Translation X in body coordinates
     //X_1a * cos(R_z) + X_2a * sin(R_z)
-    Func27() * cos(R_z()) + Func28() * sin(R_z());
+    return Func27() * cos(R_z()) + Func28() * sin(R_z());
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -272,8 +272,10 @@ complex<double> EquationofMotion::Ddt(int var, int ord, int bodIn)
         //get wave frequency.
         freq = pParentModel->getFreq();
 
-        //Calculate Derivative
-        out = out * pow(freq,ord) * pow(imagI, ord);
+        //Calculate Derivative.  Coefficients are kept separate for each order of derivative, and the motion solver
+        //applies the frequency, so the factor is only applied to actual values.
+        if (!(pParentModel->CoefficientOnly()))
+            out = out * pow(freq,ord) * pow(imagI, ord);
     }
     catch(const std::exception &err)
     {
@@ -316,8 +318,9 @@ std::complex<double> EquationofMotion::Ddt(std::string funcName, int ord, int bo
         //get wave frequency.
         freq = pParentModel->getFreq();
 
-        //Calculate Derivative
-        out = out * pow(freq,ord) * pow(imagI, ord);
+        //Calculate Derivative.  Only applied to actual values, as above.
+        if (!(pParentModel->CoefficientOnly()))
+            out = out * pow(freq,ord) * pow(imagI, ord);
     }
     catch(const std::exception &err)
     {
@@ -360,7 +360,9 @@ protected:
      * determined by the summation function that you include Ddt() into.
      * @param bodIn The body to retrieve variable data for.
      * @return Returns a complex value that is the time differential, transposed into a frequency domain.  If absolute
-     * values of response were desired, the function will include the effects of response amplitude.
+     * values of response were desired, the function will include the effects of response amplitude.  When only
+     * coefficients are calculated, the frequency and imaginary number are left out.  The motion solver applies them
+     * for each order of derivative.
      */
     std::complex<double> Ddt(int var, int ord, int bodIn=-1);
 
@@ -376,7 +378,9 @@ protected:
      * determined by the summation function that you include Ddt() into.
      * @param bodIn The body to retrieve variable data for.
      * @return Returns a complex value that is the time differential, transposed into a frequency domain.  If absolute
-     * values of response were desired, the function will include the effects of response amplitude.
+     * values of response were desired, the function will include the effects of response amplitude.  When only
+     * coefficients are calculated, the frequency and imaginary number are left out.  The motion solver applies them
+     * for each order of derivative.
      */
     std::complex<double> Ddt(std::string funcName, int ord, int bodIn=-1);
 
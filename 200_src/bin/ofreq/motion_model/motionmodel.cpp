@@ -171,47 +171,7 @@ void MotionModel::Reset()
      */
 
     //memory cleanup of all variables in the data list
-
-    for (unsigned int i = 0; i < plistData.size(); i++)
-    {
-        //memory cleanup of Active-user forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceActive_user().size(); j++)
-        {
-            delete plistData.at(i).listForceActive_user(j);
-        }
-
-        //memory cleanup of Active-hydro forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceActive_hydro().size(); j++)
-        {
-            delete plistData.at(i).listForceActive_hydro(j);
-        }
-
-        //memory cleanup of React-user forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceReact_user().size(); j++)
-        {
-            delete plistData.at(i).listForceReact_user(j);
-        }
-
-        //memory cleanup of React-hydro forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceReact_hydro().size(); j++)
-        {
-            delete plistData.at(i).listForceReact_hydro(j);
-        }
-
-        //memory cleanup of Cross-body user forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceCross_user().size(); j++)
-        {
-            delete plistData.at(i).listForceCross_user(j);
-        }
-
-        //memory cleanup of Cross-body hydro forces
-        for (unsigned int j = 0; j < plistData.at(i).listForceCross_hydro().size(); j++)
-        {
-            delete plistData.at(i).listForceCross_hydro(j);
-        }
-    }
-
-    plistData.clear();
+    clearData();
 
     //Initialize Active force variable.
     pActiveOnly = true;
@@ -647,6 +607,9 @@ void MotionModel::useForceReact_user(unsigned int force, unsigned int ord)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceReact_user().size() < force + 1)
         {
@@ -695,6 +658,9 @@ void MotionModel::useForceReact_user(unsigned int force)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceReact_user().size() < force + 1)
         {
@@ -900,6 +866,9 @@ void MotionModel::useForceReact_hydro(unsigned int force, unsigned int ord)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceReact_hydro().size() < force + 1)
         {
@@ -945,6 +914,9 @@ void MotionModel::useForceReact_hydro(unsigned int force)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceReact_hydro().size() < force + 1)
         {
@@ -1075,17 +1047,16 @@ void MotionModel::useForceCross_user(unsigned int force, unsigned int ord, unsig
                     plistBody->at(curBody).listForceCross_user(force)->listDerivative(ord).
                     listDataEquation(eqn).getDataIndex();
 
-        //Copy over the linked body reference.
-        for (unsigned int i = 0; i < plistBody->size(); i++)
+        //Copy over the linked body reference.  Use the index resolved by the System object when available.
+        int link = plistBody->at(curBody).getCrossIndex_user(force);
+        for (unsigned int i = 0; (link < 0) && (i < plistBody->size()); i++)
         {
             //Check if the cross body force matches.
-            if (plistBody->at(i) == (plistBody->at(curBody).listCrossBody_user(force)))
-            {
-                //True.  Copy integer and stop.
-                pCompCrossBod_user.at(force) = i;
-                break;
-            }
+            if (plistBody->at(i) == plistBody->at(curBody).listCrossBody_user(force))
+                link = i;
         }
+        if (link >= 0)
+            pCompCrossBod_user.at(force) = link;
     }
     catch(const std::exception &err)
     {
@@ -1100,6 +1071,9 @@ void MotionModel::useForceCross_user(unsigned int force, unsigned int ord, unsig
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_user().size() < force + 1)
         {
@@ -1149,6 +1123,9 @@ void MotionModel::useForceCross_user(unsigned int force, unsigned int ord)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_user().size() < force + 1)
         {
@@ -1197,6 +1174,9 @@ void MotionModel::useForceCross_user(unsigned int force)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_user().size() < force + 1)
         {
@@ -1327,17 +1307,16 @@ void MotionModel::useForceCross_hydro(unsigned int force, unsigned int ord, unsi
                     plistBody->at(curBody).listForceCross_hydro(force)->listDerivative(ord).
                     listDataEquation(eqn).getDataIndex();
 
-        //Copy over the linked body reference.
-        for (unsigned int i = 0; i < plistBody->size(); i++)
+        //Copy over the linked body reference.  Use the index resolved by the System object when available.
+        int link = plistBody->at(curBody).getCrossIndex_hydro(force);
+        for (unsigned int i = 0; (link < 0) && (i < plistBody->size()); i++)
         {
             //Check if the cross body force matches.
             if (plistBody->at(i) == plistBody->at(curBody).listCrossBody_hydro(force))
-            {
-                //True.  Copy integer and stop.
-                pCompCrossBod_hydro.at(force) = i;
-                break;
-            }
+                link = i;
         }
+        if (link >= 0)
+            pCompCrossBod_hydro.at(force) = link;
     }
     catch(const std::exception &err)
     {
@@ -1352,6 +1331,9 @@ void MotionModel::useForceCross_hydro(unsigned int force, unsigned int ord, unsi
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_hydro().size() < force + 1)
         {
@@ -1398,6 +1380,9 @@ void MotionModel::useForceCross_hydro(unsigned int force, unsigned int ord)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_hydro().size() < force + 1)
         {
@@ -1443,6 +1428,9 @@ void MotionModel::useForceCross_hydro(unsigned int force)
 {
     try
     {
+        //Check if there are enough bodies for the current called functions.
+        fillBodies();
+
         //Check if the designated body has enough forces for the current specified number.
         if (plistData.at(curBody).listForceCross_hydro().size() < force + 1)
         {
@@ -1852,7 +1840,6 @@ cx_mat MotionModel::getMatForceCross_hydro(int force, int ord)
             useForceCross_hydro(force, ord, eqnIndex, varIndex);
 
             //Evaluate the equation of motion and store in matrix.
-            complex<double> test = Evaluate(eqnIndex);
             outputmat(i,j) = Evaluate(eqnIndex);
         }
     }
@@ -2103,25 +2090,109 @@ void MotionModel::fillBodies()
     if (plistBody->size() != plistData.size())
     {
         //Not equal sized lists.  Create the list.
+        clearData();
+        plistData.clear();
         plistData.resize(plistBody->size());
+        plistDataUsed.assign(plistBody->size(), false);
         for (unsigned int i = 0; i < plistBody->size(); i++)
         {
-            //Assign some critical information that should always be carried through.
-            plistData.at(i).setBodyName(
-                        plistBody->at(i).getBodyName());
-            plistData.at(i).setHydroBodName(
-                        plistBody->at(i).getHydroBodName());
-            plistData.at(i).setHeading(
-                        plistBody->at(i).getHeading());
-            plistData.at(i).refPosn() = plistBody->at(i).getPosn();
-            plistData.at(i).setMotionModel(
-                        plistBody->at(i).getMotionModel()
-                        );
+            fillInfo(i);
 
             //Initialize mass matrix of new body
             plistData.at(i).initMassMat();
         }
     }
+
+    if ((curBody >= 0) && (curBody < static_cast<int>(plistData.size())))
+    {
+        //The list is kept between resets, so the bodies may have changed since it was created.
+        fillInfo(curBody);
+
+        //Record the current body, so the next reset only clears the bodies that hold data.
+        if (!plistDataUsed.at(curBody))
+        {
+            plistDataUsed.at(curBody) = true;
+            plistUsed.push_back(curBody);
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MotionModel::fillInfo(int bodIn)
+{
+    //Assign some critical information that should always be carried through.
+    plistData.at(bodIn).setBodyName(
+                plistBody->at(bodIn).getBodyName());
+    plistData.at(bodIn).setHydroBodName(
+                plistBody->at(bodIn).getHydroBodName());
+    plistData.at(bodIn).setHeading(
+                plistBody->at(bodIn).getHeading());
+    plistData.at(bodIn).refPosn() = plistBody->at(bodIn).getPosn();
+    plistData.at(bodIn).setMotionModel(
+                plistBody->at(bodIn).getMotionModel()
+                );
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MotionModel::clearData()
+{
+    //Only the bodies recorded by fillBodies hold any data.  The list of bodies itself is kept, so it does not
+    //need to be rebuilt for every body.
+    for (unsigned int k = 0; k < plistUsed.size(); k++)
+    {
+        int i = plistUsed.at(k);
+
+        //memory cleanup of Active-user forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceActive_user().size(); j++)
+        {
+            delete plistData.at(i).listForceActive_user(j);
+        }
+        plistData.at(i).listForceActive_user().clear();
+
+        //memory cleanup of Active-hydro forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceActive_hydro().size(); j++)
+        {
+            delete plistData.at(i).listForceActive_hydro(j);
+        }
+        plistData.at(i).listForceActive_hydro().clear();
+
+        //memory cleanup of React-user forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceReact_user().size(); j++)
+        {
+            delete plistData.at(i).listForceReact_user(j);
+        }
+        plistData.at(i).listForceReact_user().clear();
+
+        //memory cleanup of React-hydro forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceReact_hydro().size(); j++)
+        {
+            delete plistData.at(i).listForceReact_hydro(j);
+        }
+        plistData.at(i).listForceReact_hydro().clear();
+
+        //memory cleanup of Cross-body user forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceCross_user().size(); j++)
+        {
+            delete plistData.at(i).listForceCross_user(j);
+        }
+        plistData.at(i).listForceCross_user().clear();
+        plistData.at(i).listCrossBody_user().clear();
+
+        //memory cleanup of Cross-body hydro forces
+        for (unsigned int j = 0; j < plistData.at(i).listForceCross_hydro().size(); j++)
+        {
+            delete plistData.at(i).listForceCross_hydro(j);
+        }
+        plistData.at(i).listForceCross_hydro().clear();
+        plistData.at(i).listCrossBody_hydro().clear();
+
+        //Reset the mass matrix to zeros.
+        plistData.at(i).MassMatrix().zeros();
+
+        plistDataUsed.at(i) = false;
+    }
+
+    plistUsed.clear();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -1201,6 +1201,18 @@ private:
      */
     std::vector<ofreq::Body> plistData;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Flag for each entry in plistData.  True if the entry holds data since the last reset.
+     */
+    std::vector<bool> plistDataUsed;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of indices of entries in plistData that hold data since the last reset.
+     */
+    std::vector<int> plistUsed;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Current wave frequency.  Used for calculating derivatives.
@@ -1255,10 +1267,29 @@ private:
      * @brief Checks to make sure the number of bodies matches the input data.  If not, fills out the body data.
      *
      * Checks to make sure the number of bodies matches the input data.  If not, fills out the body data.  Operates
-     * on listData vector.  Adds items to the vector and assigns basic properties to those items.
+     * on listData vector.  Adds items to the vector and assigns basic properties to those items.  The basic
+     * properties of the current body are copied again on every call, since the list is kept between resets.
      */
     void fillBodies();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Copies the basic properties of a body into its entry in listData:  the body name, hydro body name,
+     * heading, position, and motion model.
+     * @param bodIn Integer.  The index of the body.  Variable passed by value.
+     */
+    void fillInfo(int bodIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Deletes the data of all bodies recorded as used since the last reset.
+     *
+     * Each body build resets the motion model.  With many bodies, clearing and rebuilding the entire listData
+     * vector for every body scales with the square of the number of bodies.  Instead, fillBodies() records which
+     * bodies receive data, and this function only clears those entries.  The entries themselves are kept.
+     */
+    void clearData();
+
     //------------------------------------------Function Separator --------------------------------------------------------
     /**
      * @brief Records the index of the body object referenced by the cross body.
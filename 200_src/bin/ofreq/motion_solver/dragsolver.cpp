@@ -0,0 +1,407 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "dragsolver.h"
+#include "motionsolver.h"
+#include "../system_objects/system.h"
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+using namespace arma;
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+DragSolver::DragSolver()
+{
+    ptSystem = NULL;
+    pTol = 1e-4;
+    pMaxIter = 50;
+    pDepth = 5;
+    pIter = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+DragSolver::~DragSolver()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::setSystem(ofreq::System *ptInput)
+{
+    ptSystem = ptInput;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::setTolerance(double tolIn)
+{
+    pTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::setMaxIter(int iterIn)
+{
+    pMaxIter = iterIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::setDepth(int depthIn)
+{
+    pDepth = depthIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool DragSolver::solve()
+{
+    pIter = 0;
+
+    try
+    {
+        if (!ptSystem)
+            throw std::runtime_error("Pointer to system object not set.");
+
+        if (ptSystem->listForceDrag().size() == 0)
+            return true;
+
+        findBodies();
+
+        //Only entries with a drag coefficient take part in the iteration.  All others stay at zero.
+        vector<unsigned int> listActive;
+        vec damp = getDamping();
+        vec coeff = getCoeff();
+        for (unsigned int i = 0; i < coeff.n_elem; i++)
+        {
+            if (coeff(i) > 0.0)
+                listActive.push_back(i);
+            else
+                damp(i) = 0.0;
+        }
+
+        //Start from the damping left by the last linearization.  If there is none, take one plain step first.
+        bool haveStart = true;
+        for (unsigned int i = 0; i < listActive.size(); i++)
+        {
+            if (damp(listActive.at(i)) <= 0.0)
+                haveStart = false;
+        }
+
+        if (!haveStart)
+        {
+            pIter = 1;
+            vec dampNew = evalDamping(damp);
+            writeLog(damp, dampNew);
+            damp = dampNew;
+        }
+
+        //Iterate on the logarithm of the damping.  The RMS velocity falls roughly in inverse proportion to the
+        //damping, so the fixed point problem is close to linear in the logarithm.
+        int depth = min(pDepth, static_cast<int>(listActive.size()));
+        vec logLast, residLast;
+        mat histResid, histLog;            //Differences of the residuals and of log(G(x)) between iterates.
+
+        for (pIter = pIter + 1; pIter <= pMaxIter; pIter++)
+        {
+            vec dampNew = evalDamping(damp);
+            writeLog(damp, dampNew);
+
+            //Converged when the change is small relative to the damping.
+            double scale = std::max(arma::max(arma::abs(dampNew)), std::numeric_limits<double>::min());
+            if (arma::max(arma::abs(dampNew - damp)) <= pTol * scale)
+            {
+                setDamping(dampNew);
+                ptSystem->logStd.Write("Drag linearization converged after " + itoa(pIter) + " sweeps.",3);
+                return true;
+            }
+
+            //Residual in the logarithm of the damping.
+            vec logDamp(listActive.size());
+            vec logNew(listActive.size());
+            for (unsigned int i = 0; i < listActive.size(); i++)
+            {
+                logDamp(i) = log(std::max(damp(listActive.at(i)), std::numeric_limits<double>::min()));
+                logNew(i) = log(std::max(dampNew(listActive.at(i)), std::numeric_limits<double>::min()));
+            }
+            vec resid = logNew - logDamp;
+
+            //Keep the differences for Anderson acceleration.
+            if ((residLast.n_elem > 0) && (depth > 0))
+            {
+                histResid.insert_cols(histResid.n_cols, resid - residLast);
+                histLog.insert_cols(histLog.n_cols, logNew - logLast);
+
+                if (static_cast<int>(histResid.n_cols) > depth)
+                {
+                    histResid.shed_col(0);
+                    histLog.shed_col(0);
+                }
+            }
+            residLast = resid;
+            logLast = logNew;
+
+            //Next iterate.  Fall back to the plain fixed point step if the least squares problem fails.
+            vec logNext = logNew;
+            if (histResid.n_cols > 0)
+            {
+                vec gamma;
+                if (arma::solve(gamma, histResid, resid) && gamma.is_finite())
+                {
+                    logNext = logNew - histLog * gamma;
+                }
+                else
+                {
+                    histResid.reset();
+                    histLog.reset();
+                }
+            }
+
+            for (unsigned int i = 0; i < listActive.size(); i++)
+                damp(listActive.at(i)) = exp(logNext(i));
+        }
+
+        //Keep the last iterate.
+        pIter = pMaxIter;
+        setDamping(damp);
+        ptSystem->logStd.Write("Drag linearization did not converge after " + itoa(pMaxIter) +
+                               " sweeps.  Using the last iterate.",3);
+        return false;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+        return false;
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int DragSolver::getIterations()
+{
+    return pIter;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::findBodies()
+{
+    plistDragBody.assign(ptSystem->listForceDrag().size(), -1);
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        ForceReact *ptReact = &ptSystem->listForceReact_user(ptSystem->listForceDrag(d).getReactIndex());
+
+        for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+        {
+            for (unsigned int k = 0; k < ptSystem->listBody(b).listForceReact_user().size(); k++)
+            {
+                if (ptSystem->listBody(b).listForceReact_user(k) != ptReact)
+                    continue;
+
+                if ((plistDragBody.at(d) >= 0) && (plistDragBody.at(d) != static_cast<int>(b)))
+                    throw std::runtime_error("Drag force used by more than one body.  Each drag force may only be "
+                                             "used by one body.  Offending force:  " + ptReact->getForceName());
+
+                plistDragBody.at(d) = b;
+            }
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vec DragSolver::getDamping()
+{
+    //Count the entries.
+    unsigned int n = 0;
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+        n += ptSystem->listForceDrag(d).listCoeff().size();
+
+    vec out(n);
+    unsigned int pos = 0;
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        ForceDrag &drag = ptSystem->listForceDrag(d);
+        drag.listLinear().resize(drag.listCoeff().size(), 0.0);
+
+        for (unsigned int i = 0; i < drag.listLinear().size(); i++)
+            out(pos++) = drag.listLinear().at(i);
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vec DragSolver::getCoeff()
+{
+    vec out(getDamping().n_elem);
+    unsigned int pos = 0;
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        for (unsigned int i = 0; i < ptSystem->listForceDrag(d).listCoeff().size(); i++)
+            out(pos++) = ptSystem->listForceDrag(d).listCoeff().at(i);
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::setDamping(const vec &dampIn)
+{
+    unsigned int pos = 0;
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        ForceDrag &drag = ptSystem->listForceDrag(d);
+        drag.listLinear().resize(drag.listCoeff().size(), 0.0);
+
+        for (unsigned int i = 0; i < drag.listLinear().size(); i++)
+            drag.listLinear().at(i) = dampIn(pos++);
+
+        drag.applyLinear(ptSystem->listForceReact_user(drag.getReactIndex()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vec DragSolver::evalDamping(const vec &dampIn)
+{
+    setDamping(dampIn);
+
+    //Velocity variance of each variable of each body.
+    plistRMS.assign(ptSystem->listBody().size(), vector<double>());
+
+    //No solutions or factors are kept, so mixed precision is always allowed.
+    ptSystem->solveSweep(false, false, [&](int, int j, MotionSolver &solver)
+    {
+        //Add the velocity of each component.  Variance of a component is half the square of its amplitude.
+        //Solutions are for unit wave amplitude, so scale by the wave amplitude of the active sea model.
+        double freq = ptSystem->getCurFreq();
+        double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), j);
+        for (unsigned int k = 0; k < ptSystem->listBody().size(); k++)
+        {
+            cx_mat &soln = solver.listSolution(k);
+            if (plistRMS.at(k).size() < soln.n_rows)
+                plistRMS.at(k).resize(soln.n_rows, 0.0);
+
+            for (unsigned int v = 0; v < soln.n_rows; v++)
+                plistRMS.at(k).at(v) += 0.5 * std::norm(freq * amp * soln(v,0));
+        }
+    });
+
+    //Variance to RMS.
+    for (unsigned int k = 0; k < plistRMS.size(); k++)
+    {
+        for (unsigned int v = 0; v < plistRMS.at(k).size(); v++)
+            plistRMS.at(k).at(v) = sqrt(plistRMS.at(k).at(v));
+    }
+
+    //Linear damping from the RMS velocity.
+    vec out(dampIn.n_elem);
+    unsigned int pos = 0;
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        ForceDrag &drag = ptSystem->listForceDrag(d);
+        int bod = plistDragBody.at(d);
+
+        for (unsigned int i = 0; i < drag.listCoeff().size(); i++)
+        {
+            double rms = 0.0;
+            if ((bod >= 0) && (i < plistRMS.at(bod).size()))
+                rms = plistRMS.at(bod).at(i);
+
+            out(pos++) = drag.calcLinear(i, rms);
+        }
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void DragSolver::writeLog(const vec &dampIn, const vec &dampOut)
+{
+    //Largest relative change in damping for each body.
+    vector<double> listChange(ptSystem->listBody().size(), 0.0);
+    unsigned int pos = 0;
+
+    for (unsigned int d = 0; d < ptSystem->listForceDrag().size(); d++)
+    {
+        int bod = plistDragBody.at(d);
+
+        for (unsigned int i = 0; i < ptSystem->listForceDrag(d).listCoeff().size(); i++)
+        {
+            double change = fabs(dampOut(pos) - dampIn(pos));
+            if (fabs(dampOut(pos)) > 0.0)
+                change /= fabs(dampOut(pos));
+
+            if ((bod >= 0) && (change > listChange.at(bod)))
+                listChange.at(bod) = change;
+            pos++;
+        }
+    }
+
+    //Only bodies with drag forces.
+    for (unsigned int d = 0; d < plistDragBody.size(); d++)
+    {
+        int bod = plistDragBody.at(d);
+        if (bod < 0)
+            continue;
+
+        //Write each body once.
+        bool written = false;
+        for (unsigned int d2 = 0; d2 < d; d2++)
+        {
+            if (plistDragBody.at(d2) == bod)
+                written = true;
+        }
+        if (written)
+            continue;
+
+        ostringstream msg;
+        msg << "Drag sweep " << pIter << "\tBody:  " << ptSystem->listBody(bod).getBodyName()
+            << "\tChange:  " << listChange.at(bod) << "\tRMS velocity:";
+        for (unsigned int v = 0; v < plistRMS.at(bod).size(); v++)
+            msg << "  " << plistRMS.at(bod).at(v);
+
+        ptSystem->logStd.Write(msg.str(),3);
+    }
+}
@@ -0,0 +1,231 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef DRAGSOLVER_H
+#define DRAGSOLVER_H
+#include <vector>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations.
+class System;
+
+//######################################### Class Separator ###########################################################
+/**
+ * The DragSolver class finds the equivalent linear damping of each quadratic drag force by stochastic
+ * linearization.
+ *
+ * The linear damping of a drag force depends on the RMS velocity of the body, and the RMS velocity depends on the
+ * linear damping.  The solver treats this as a fixed point problem, x = G(x), where x is the list of linear damping
+ * coefficients for all drag forces.  G(x) applies the damping x, runs the full sweep of wave directions and wave
+ * frequencies, and calculates the damping from the resulting RMS velocities.  The RMS velocity is taken over the
+ * response to all wave directions and wave frequencies, under the amplitudes of the active sea model:
+ * s^2 = sum( 0.5 * |w * X|^2 )
+ *
+ * Plain repetition of the sweep oscillates, and often fails to converge, when the drag dominates the damping.  The
+ * solver uses Anderson acceleration instead.  Each new damping is a combination of the last few evaluations of G(x),
+ * chosen to minimize the residual in a least squares sense.  The iteration works on the logarithm of the damping,
+ * where the problem is close to linear.  Each sweep starts from the damping of the previous iterate, and the first
+ * sweep starts from the damping left by the last linearization.  Without a previous linearization, one plain step
+ * from zero damping gives the starting point.  The change in damping and the RMS
+ * velocity for each body are logged at each iteration.
+ *
+ * Each drag force may only be used by one body.  The damping must describe the motion of a single body.
+ */
+class DragSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    DragSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~DragSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the system object that holds the bodies, forces, and sea model.
+     * @param ptInput Pointer to the System object.  Variable passed by value.
+     */
+    void setSystem(ofreq::System *ptInput);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the relative tolerance on the change in linear damping.  Default is 1e-4.
+     * @param tolIn Double.  The relative tolerance.  Variable passed by value.
+     */
+    void setTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the maximum number of sweeps.  Default is 50.
+     * @param iterIn Integer.  The maximum number of sweeps.  Variable passed by value.
+     */
+    void setMaxIter(int iterIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of previous iterates used by Anderson acceleration.  Zero gives plain fixed point
+     * iteration.  Default is 5.
+     * @param depthIn Integer.  The number of previous iterates.  Variable passed by value.
+     */
+    void setDepth(int depthIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Iterates the sweep until the linear damping of all drag forces is self consistent.  The final damping
+     * is written to the user reactive force of each drag force.  Does nothing if there are no drag forces.
+     * @return Returns true if the damping converged.  Returns false if it did not converge within the maximum
+     * number of sweeps, or if an error occurred.  Returned variable passed by value.
+     */
+    bool solve();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of sweeps used by the last call to solve().
+     * @return Integer.  The number of sweeps.  Returned variable passed by value.
+     */
+    int getIterations();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds the body that uses each drag force.  Throws an error if a drag force is used by more than one
+     * body.
+     */
+    void findBodies();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the linear damping of all drag forces as a single vector.
+     * @return Returns the linear damping.  Returned variable passed by value.
+     */
+    arma::vec getDamping();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the quadratic drag coefficients of all drag forces as a single vector.
+     * @return Returns the drag coefficients, in the same order as getDamping().  Returned variable passed by value.
+     */
+    arma::vec getCoeff();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the linear damping of all drag forces to their user reactive forces.
+     * @param dampIn The linear damping, in the same order as getDamping().  Variable passed by reference.
+     */
+    void setDamping(const arma::vec &dampIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Evaluates G(x).  Applies the damping, runs the sweep, and calculates the linear damping from the RMS
+     * velocities.  The RMS velocities are kept in plistRMS.
+     * @param dampIn The linear damping x.  Variable passed by reference.
+     * @return Returns the new linear damping G(x).  Returned variable passed by value.
+     */
+    arma::vec evalDamping(const arma::vec &dampIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the convergence of each body to the standard log.
+     * @param dampIn The linear damping x of the iterate.  Variable passed by reference.
+     * @param dampOut The new linear damping G(x).  Variable passed by reference.
+     */
+    void writeLog(const arma::vec &dampIn, const arma::vec &dampOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    ofreq::System *ptSystem; /**< Pointer to the System object. */
+    double pTol; /**< Relative tolerance on the change in linear damping. */
+    int pMaxIter; /**< Maximum number of sweeps. */
+    int pDepth; /**< Number of previous iterates used by Anderson acceleration. */
+    int pIter; /**< Number of sweeps used by the last call to solve(). */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<int> plistDragBody; /**< Index of the body that uses each drag force.  -1 if not used. */
+    std::vector< std::vector<double> > plistRMS; /**< RMS velocity of each variable of each body, from the last sweep. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // DRAGSOLVER_H
@@ -0,0 +1,385 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "ensemblesolver.h"
+
+using namespace arma;
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+const int EnsembleSolver::BATCH = 64;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleSolver::EnsembleSolver()
+{
+    pFreq = 0;
+    pSize = 0;
+    pCount = 0;
+    pFail = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleSolver::~EnsembleSolver()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleSolver::setBaseline(cx_mat reactIn, cx_mat activeIn, double freqIn)
+{
+    pReact = reactIn;
+    pActive = activeIn;
+    pFreq = freqIn;
+    pSize = reactIn.n_rows;
+    pCount = 0;
+    pFail = 0;
+    plistForce.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleSolver::addForce(cx_mat forceIn)
+{
+    plistForce.push_back(forceIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleSolver::solve(const mat &factorIn, const vector<mat> &massIn, int firstIn, int countIn)
+{
+    try
+    {
+        if (factorIn.n_rows != plistForce.size())
+            throw std::runtime_error("Number of ensemble factors does not match the number of varied forces.");
+
+        if ((firstIn < 0) || (countIn < 0) || (firstIn + countIn > static_cast<int>(factorIn.n_cols)))
+            throw std::runtime_error("Ensemble batch is outside the list of samples.");
+
+        int n = pSize;
+        int w = countIn;
+        pCount = countIn;
+
+        //Baseline system, copied to every sample in the batch.
+        pARe.resize(n * n * w);
+        pAIm.resize(n * n * w);
+        pBRe.resize(n * w);
+        pBIm.resize(n * w);
+        plistSingular.assign(w, 0);
+
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c < n; c++)
+            {
+                double re = pReact(r, c).real();
+                double im = pReact(r, c).imag();
+                double *aRe = &pARe[(r * n + c) * w];
+                double *aIm = &pAIm[(r * n + c) * w];
+
+                for (int s = 0; s < w; s++)
+                {
+                    aRe[s] = re;
+                    aIm[s] = im;
+                }
+            }
+
+            double re = pActive(r, 0).real();
+            double im = pActive(r, 0).imag();
+            for (int s = 0; s < w; s++)
+            {
+                pBRe[r * w + s] = re;
+                pBIm[r * w + s] = im;
+            }
+        }
+
+        //Scaled user forces.  Only the entries each force touches.
+        vector<double> scale(w);
+        for (unsigned int f = 0; f < plistForce.size(); f++)
+        {
+            for (int s = 0; s < w; s++)
+                scale[s] = factorIn(f, firstIn + s) - 1.0;
+
+            for (int r = 0; r < n; r++)
+            {
+                for (int c = 0; c < n; c++)
+                {
+                    double re = plistForce.at(f)(r, c).real();
+                    double im = plistForce.at(f)(r, c).imag();
+                    if ((re == 0.0) && (im == 0.0))
+                        continue;
+
+                    double *aRe = &pARe[(r * n + c) * w];
+                    double *aIm = &pAIm[(r * n + c) * w];
+
+                    for (int s = 0; s < w; s++)
+                    {
+                        aRe[s] += scale[s] * re;
+                        aIm[s] += scale[s] * im;
+                    }
+                }
+            }
+        }
+
+        //Changes in mass.  The mass enters the global matrix as (i*w)^2 * M.
+        if (massIn.size() > 0)
+        {
+            double freq2 = pFreq * pFreq;
+
+            for (int s = 0; s < w; s++)
+            {
+                const mat &mass = massIn.at(firstIn + s);
+
+                for (unsigned int r = 0; r < mass.n_rows; r++)
+                {
+                    for (unsigned int c = 0; c < mass.n_cols; c++)
+                    {
+                        if (mass(r, c) != 0.0)
+                            pARe[(r * n + c) * w + s] -= freq2 * mass(r, c);
+                    }
+                }
+            }
+        }
+
+        //Factor and solve the whole batch.
+        eliminate();
+
+        for (int s = 0; s < w; s++)
+            pFail += plistSingular.at(s);
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+
+        //Nothing solved.  Every sample in the batch is treated as singular.
+        pCount = countIn;
+        plistSingular.assign(countIn, 1);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat EnsembleSolver::getSolution(int sampleIn)
+{
+    cx_mat output;
+    output.set_size(pSize, 1);
+
+    if ((sampleIn < 0) || (sampleIn >= pCount) || (plistSingular.at(sampleIn) != 0) ||
+            (pBRe.size() < static_cast<unsigned int>(pSize * pCount)))
+    {
+        output.fill(complex<double>(datum::nan, datum::nan));
+        return output;
+    }
+
+    for (int r = 0; r < pSize; r++)
+        output(r, 0) = complex<double>(pBRe[r * pCount + sampleIn], pBIm[r * pCount + sampleIn]);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int EnsembleSolver::getFailCount()
+{
+    return pFail;
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleSolver::eliminate()
+{
+    int n = pSize;
+    int w = pCount;
+
+    double *aRe = pARe.data();
+    double *aIm = pAIm.data();
+    double *bRe = pBRe.data();
+    double *bIm = pBIm.data();
+
+    vector<int> piv(w);             //Pivot row of each sample.
+    vector<double> best(w);         //Squared magnitude of the pivot of each sample.
+    vector<double> invRe(w);        //Inverse of the pivot, real part.
+    vector<double> invIm(w);        //Inverse of the pivot, imaginary part.
+    vector<double> lRe(w);          //Multiplier for the current row, real part.
+    vector<double> lIm(w);          //Multiplier for the current row, imaginary part.
+
+    for (int k = 0; k < n; k++)
+    {
+        //Find the pivot of each sample.
+        for (int s = 0; s < w; s++)
+        {
+            double re = aRe[(k * n + k) * w + s];
+            double im = aIm[(k * n + k) * w + s];
+            best[s] = re * re + im * im;
+            piv[s] = k;
+        }
+
+        for (int r = k + 1; r < n; r++)
+        {
+            const double *colRe = &aRe[(r * n + k) * w];
+            const double *colIm = &aIm[(r * n + k) * w];
+
+            for (int s = 0; s < w; s++)
+            {
+                double mag = colRe[s] * colRe[s] + colIm[s] * colIm[s];
+                bool larger = mag > best[s];
+                best[s] = larger ? mag : best[s];
+                piv[s] = larger ? r : piv[s];
+            }
+        }
+
+        //Swap the pivot row into row k.  A select across the batch, so every sample runs the same instructions.
+        for (int r = k + 1; r < n; r++)
+        {
+            for (int c = k; c < n; c++)
+            {
+                double *kRe = &aRe[(k * n + c) * w];
+                double *kIm = &aIm[(k * n + c) * w];
+                double *rRe = &aRe[(r * n + c) * w];
+                double *rIm = &aIm[(r * n + c) * w];
+
+                for (int s = 0; s < w; s++)
+                {
+                    bool swap = (piv[s] == r);
+                    double tRe = kRe[s];
+                    double tIm = kIm[s];
+                    kRe[s] = swap ? rRe[s] : tRe;
+                    kIm[s] = swap ? rIm[s] : tIm;
+                    rRe[s] = swap ? tRe : rRe[s];
+                    rIm[s] = swap ? tIm : rIm[s];
+                }
+            }
+
+            for (int s = 0; s < w; s++)
+            {
+                bool swap = (piv[s] == r);
+                double tRe = bRe[k * w + s];
+                double tIm = bIm[k * w + s];
+                bRe[k * w + s] = swap ? bRe[r * w + s] : tRe;
+                bIm[k * w + s] = swap ? bIm[r * w + s] : tIm;
+                bRe[r * w + s] = swap ? tRe : bRe[r * w + s];
+                bIm[r * w + s] = swap ? tIm : bIm[r * w + s];
+            }
+        }
+
+        //Inverse of the pivot.  A zero pivot marks the sample as singular, and continues with a unit pivot so the
+        //rest of the batch is not disturbed.
+        const double *pRe = &aRe[(k * n + k) * w];
+        const double *pIm = &aIm[(k * n + k) * w];
+        for (int s = 0; s < w; s++)
+        {
+            bool zero = !(best[s] > 0.0) || !std::isfinite(best[s]);
+            plistSingular[s] |= zero ? 1 : 0;
+            double mag = zero ? 1.0 : best[s];
+            invRe[s] = zero ? 1.0 : pRe[s] / mag;
+            invIm[s] = zero ? 0.0 : -pIm[s] / mag;
+        }
+
+        //Eliminate column k from the rows below.
+        for (int r = k + 1; r < n; r++)
+        {
+            const double *colRe = &aRe[(r * n + k) * w];
+            const double *colIm = &aIm[(r * n + k) * w];
+
+            for (int s = 0; s < w; s++)
+            {
+                lRe[s] = colRe[s] * invRe[s] - colIm[s] * invIm[s];
+                lIm[s] = colRe[s] * invIm[s] + colIm[s] * invRe[s];
+            }
+
+            for (int c = k + 1; c < n; c++)
+            {
+                const double *kRe = &aRe[(k * n + c) * w];
+                const double *kIm = &aIm[(k * n + c) * w];
+                double *rRe = &aRe[(r * n + c) * w];
+                double *rIm = &aIm[(r * n + c) * w];
+
+                for (int s = 0; s < w; s++)
+                {
+                    rRe[s] -= lRe[s] * kRe[s] - lIm[s] * kIm[s];
+                    rIm[s] -= lRe[s] * kIm[s] + lIm[s] * kRe[s];
+                }
+            }
+
+            for (int s = 0; s < w; s++)
+            {
+                double tRe = bRe[k * w + s];
+                double tIm = bIm[k * w + s];
+                bRe[r * w + s] -= lRe[s] * tRe - lIm[s] * tIm;
+                bIm[r * w + s] -= lRe[s] * tIm + lIm[s] * tRe;
+            }
+        }
+    }
+
+    //Back substitution.  The solution replaces the right hand side.
+    for (int k = n - 1; k >= 0; k--)
+    {
+        double *xRe = &bRe[k * w];
+        double *xIm = &bIm[k * w];
+
+        for (int c = k + 1; c < n; c++)
+        {
+            const double *kRe = &aRe[(k * n + c) * w];
+            const double *kIm = &aIm[(k * n + c) * w];
+            const double *yRe = &bRe[c * w];
+            const double *yIm = &bIm[c * w];
+
+            for (int s = 0; s < w; s++)
+            {
+                xRe[s] -= kRe[s] * yRe[s] - kIm[s] * yIm[s];
+                xIm[s] -= kRe[s] * yIm[s] + kIm[s] * yRe[s];
+            }
+        }
+
+        const double *pRe = &aRe[(k * n + k) * w];
+        const double *pIm = &aIm[(k * n + k) * w];
+        for (int s = 0; s < w; s++)
+        {
+            double mag = pRe[s] * pRe[s] + pIm[s] * pIm[s];
+            mag = (mag > 0.0) ? mag : 1.0;
+            double re = (xRe[s] * pRe[s] + xIm[s] * pIm[s]) / mag;
+            double im = (xIm[s] * pRe[s] - xRe[s] * pIm[s]) / mag;
+            xRe[s] = re;
+            xIm[s] = im;
+        }
+    }
+}
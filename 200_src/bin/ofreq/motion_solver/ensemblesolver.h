@@ -0,0 +1,222 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#ifndef ENSEMBLESOLVER_H
+#define ENSEMBLESOLVER_H
+#include <complex>
+#include <vector>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The EnsembleSolver solves the equations of motion for a batch of sample systems at once.  It applies to a single
+ * wave frequency and single wave direction.  Each sample changes the mass properties of some bodies and scales some
+ * user forces.  The global reactive matrix for sample s is:
+ * [A_s] = [A] + sum( (x_fs - 1) * [K_f] ) - w^2 * [dM_s]
+ * where [A] is the baseline global reactive matrix, [K_f] is the contribution of user force f, x_fs is the factor on
+ * force f for sample s, and [dM_s] is the change in the global mass matrix for sample s.  The active force matrix
+ * does not change between samples.
+ *
+ * Ensemble systems are small (6 or 12 equations) and there are thousands of them.  Calling a general LU solver for
+ * each one spends most of its time in call overhead.  Instead, the solver stores a batch of systems as a structure
+ * of arrays:  the same matrix entry for every sample in the batch sits next to each other in memory, with the real
+ * and imaginary parts in separate arrays.  Gaussian elimination then works on one matrix entry at a time, with the
+ * innermost loop running across the batch.  That loop has no dependencies between samples, so the compiler
+ * vectorizes it.
+ *
+ * Each sample uses its own partial pivoting.  The row swaps are done with a select across the batch instead of a
+ * branch, so every sample follows the same sequence of instructions.  A sample with a zero pivot is marked as
+ * singular, and its solution is all NaN.
+ */
+class EnsembleSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    EnsembleSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~EnsembleSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the baseline system.  Clears any forces previously added.
+     * @param reactIn The baseline global reactive force matrix (the A matrix).  Variable passed by value.
+     * @param activeIn The global active force matrix (the F matrix).  Variable passed by value.
+     * @param freqIn Double.  The wave frequency, in rad/s.  Used for the mass terms.  Variable passed by value.
+     */
+    void setBaseline(arma::cx_mat reactIn, arma::cx_mat activeIn, double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the contribution of one varied user force to the global reactive force matrix.  Forces must be
+     * added in the same sequence as the rows of the factors supplied to solve().
+     * @param forceIn The contribution of the force to the global reactive force matrix, at a factor of 1.0.  Must
+     * be the same size as the global reactive force matrix.  Variable passed by value.
+     */
+    void addForce(arma::cx_mat forceIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Assembles and solves a batch of samples.  Replaces the solutions of any previous batch.
+     * @param factorIn Matrix of doubles.  One row for each force added, one column for each sample in the ensemble.
+     * The factor on each force for each sample.  Variable passed by reference.
+     * @param massIn Vector of matrices.  One entry for each sample in the ensemble.  The change in the global mass
+     * matrix for that sample.  Leave empty if no mass properties vary.  Variable passed by reference.
+     * @param firstIn Integer.  The index of the first sample in the batch.  Variable passed by value.
+     * @param countIn Integer.  The number of samples in the batch.  Variable passed by value.
+     */
+    void solve(const arma::mat &factorIn, const std::vector<arma::mat> &massIn, int firstIn, int countIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the global solution for one sample of the last batch solved.
+     * @param sampleIn Integer.  The index of the sample within the batch.  Start numbering from 0.  Variable passed
+     * by value.
+     * @return Returns a column matrix of complex doubles.  The global solution for all bodies.  If the sample system
+     * is singular, all values are NaN.  Returned variable passed by value.
+     */
+    arma::cx_mat getSolution(int sampleIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of singular sample systems found since the baseline was set.
+     * @return Integer.  The number of singular sample systems.  Returned variable passed by value.
+     */
+    int getFailCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The number of samples solved together in one batch.  Chosen so the batch of 12 x 12 systems stays in
+     * the level 2 cache.
+     */
+    static const int BATCH;
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Factors the batch with Gaussian elimination and solves for the right hand side by back substitution.
+     * Works in place on the batch arrays.
+     */
+    void eliminate();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_mat pReact; /**< Baseline global reactive force matrix. */
+    arma::cx_mat pActive; /**< Global active force matrix. */
+    double pFreq; /**< Wave frequency, in rad/s. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Contribution of each varied user force to the global reactive force matrix.
+     */
+    std::vector<arma::cx_mat> plistForce;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pSize; /**< Number of equations in the global matrix. */
+    int pCount; /**< Number of samples in the current batch. */
+    int pFail; /**< Number of singular sample systems found. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Real and imaginary parts of the batch of reactive matrices.  Entry (r, c) of sample s is at index
+     * (r * pSize + c) * pCount + s.  Holds the LU factors after elimination.
+     */
+    std::vector<double> pARe;
+    std::vector<double> pAIm;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Real and imaginary parts of the batch of right hand sides.  Entry r of sample s is at index
+     * r * pCount + s.  Holds the solutions after elimination.
+     */
+    std::vector<double> pBRe;
+    std::vector<double> pBIm;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<int> plistSingular; /**< One entry for each sample in the batch.  1 if the sample is singular. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // ENSEMBLESOLVER_H
@@ -0,0 +1,349 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "lufactor.h"
+
+using namespace arma;
+using namespace std;
+using namespace osea::ofreq;
+
+//The bundled Armadillo does not wrap the packed symmetric factorization, so declare it here.
+#if defined(ARMA_BLAS_CAPITALS)
+    #define osea_zsptrf ZSPTRF
+#else
+    #define osea_zsptrf zsptrf
+#endif
+
+extern "C"
+{
+    void arma_fortran_noprefix(osea_zsptrf)(char* uplo, blas_int* n, void* ap, blas_int* ipiv, blas_int* info);
+}
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+LUFactor::LUFactor()
+{
+    pFactored = false;
+    pSymmetric = false;
+    pSize = 0;
+    pSymTol = 1.0e-10;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+LUFactor::~LUFactor()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void LUFactor::factor(const cx_mat &matIn)
+{
+    factor(matIn, matIn.n_rows == matIn.n_cols && checkSymmetric(matIn));
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void LUFactor::factor(const cx_mat &matIn, bool symIn)
+{
+    clear();
+
+    if (matIn.n_rows != matIn.n_cols)
+        throw std::runtime_error("LU factorization requires a square matrix.");
+
+    //Complex symmetric matrices use the symmetric indefinite factorization.
+    if (symIn)
+    {
+        factorSym(matIn);
+        return;
+    }
+
+    //Factor with partial pivoting.  [P] * [A] = [L] * [U]
+    if (!lu(pL, pU, pP, matIn))
+        throw std::runtime_error("LU factorization failed.");
+
+    //Check for zero pivots.  The matrix is singular if any are found.
+    for (unsigned int i = 0; i < pU.n_rows; i++)
+    {
+        if (abs(pU(i,i)) == 0.0)
+        {
+            clear();
+            throw std::runtime_error("Matrix is singular.  Zero pivot found in row " + itoa(i + 1) + ".");
+        }
+    }
+
+    pSize = pU.n_rows;
+    pFactored = true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat LUFactor::solve(const cx_mat &rhsIn)
+{
+    if (!pFactored)
+        throw std::runtime_error("LU factors used before the matrix was factored.");
+
+    if (pSymmetric)
+        return solveSym(rhsIn);
+
+    //[L] * [y] = [P] * [b]
+    cx_mat y = arma::solve(trimatl(pL), pP * rhsIn);
+
+    //[U] * [x] = [y]
+    return arma::solve(trimatu(pU), y);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat LUFactor::solveTrans(const cx_mat &rhsIn)
+{
+    if (!pFactored)
+        throw std::runtime_error("LU factors used before the matrix was factored.");
+
+    //[A]^T = [A] for a symmetric matrix.
+    if (pSymmetric)
+        return solveSym(rhsIn);
+
+    //[A]^T = [U]^T * [L]^T * [P]
+    //[U]^T * [y] = [b]
+    cx_mat UT = strans(pU);
+    cx_mat y = arma::solve(trimatl(UT), rhsIn);
+
+    //[L]^T * [z] = [y]
+    cx_mat LT = strans(pL);
+    cx_mat z = arma::solve(trimatu(LT), y);
+
+    //[x] = [P]^T * [z]
+    return strans(pP) * z;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool LUFactor::isFactored()
+{
+    return pFactored;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int LUFactor::getSize()
+{
+    return pSize;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool LUFactor::isSymmetric()
+{
+    return pSymmetric;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void LUFactor::setSymTolerance(double tolIn)
+{
+    pSymTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double LUFactor::getSymTolerance()
+{
+    return pSymTol;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void LUFactor::clear()
+{
+    pL.reset();
+    pU.reset();
+    pP.reset();
+    pPacked.reset();
+    plistPivot.clear();
+    pFactored = false;
+    pSymmetric = false;
+    pSize = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool LUFactor::checkSymmetric(const cx_mat &matIn)
+{
+    if (pSymTol < 0)
+        return false;
+
+    //Tolerance is relative to the largest magnitude in the matrix.
+    double tol = pSymTol * max(max(abs(matIn)));
+
+    for (unsigned int j = 0; j < matIn.n_cols; j++)
+    {
+        for (unsigned int i = j + 1; i < matIn.n_rows; i++)
+        {
+            if (abs(matIn(i,j) - matIn(j,i)) > tol)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void LUFactor::factorSym(const cx_mat &matIn)
+{
+    char uplo = 'L';
+    blas_int n = matIn.n_rows;
+    blas_int info = 0;
+    plistPivot.assign(n, 0);
+
+    //Copy only the lower triangle, straight into packed storage.
+    pSize = n;
+    pPacked.set_size(n * (n + 1) / 2);
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = j; i < n; i++)
+            pPacked(packInd(i, j)) = matIn(i,j);
+    }
+
+    //Factor in place.  [P] * [A] * [P]^T = [L] * [D] * [L]^T
+    if (n > 0)
+        arma_fortran_noprefix(osea_zsptrf)(&uplo, &n, pPacked.memptr(), &plistPivot[0], &info);
+
+    if (info < 0)
+    {
+        clear();
+        throw std::runtime_error("Symmetric factorization failed.");
+    }
+    if (info > 0)
+    {
+        clear();
+        throw std::runtime_error("Matrix is singular.  Zero pivot found in row " + itoa(info) + ".");
+    }
+
+    pSymmetric = true;
+    pFactored = true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat LUFactor::solveSym(const cx_mat &rhsIn)
+{
+    int n = pSize;
+    cx_mat x = rhsIn;
+
+    //Solve [L] * [D] * [y] = [P] * [b], one pivot block at a time.
+    int k = 0;
+    while (k < n)
+    {
+        if (plistPivot.at(k) > 0)
+        {
+            //1x1 diagonal block.
+            int kp = plistPivot.at(k) - 1;
+            if (kp != k)
+                x.swap_rows(k, kp);
+
+            for (unsigned int c = 0; c < x.n_cols; c++)
+            {
+                for (int i = k + 1; i < n; i++)
+                    x(i,c) -= pPacked(packInd(i, k)) * x(k,c);
+
+                x(k,c) /= pPacked(packInd(k, k));
+            }
+            k += 1;
+        }
+        else
+        {
+            //2x2 diagonal block.
+            int kp = -plistPivot.at(k) - 1;
+            if (kp != k + 1)
+                x.swap_rows(k + 1, kp);
+
+            cx_double akm1k = pPacked(packInd(k + 1, k));
+            cx_double akm1 = pPacked(packInd(k, k)) / akm1k;
+            cx_double ak = pPacked(packInd(k + 1, k + 1)) / akm1k;
+            cx_double denom = akm1 * ak - 1.0;
+
+            for (unsigned int c = 0; c < x.n_cols; c++)
+            {
+                for (int i = k + 2; i < n; i++)
+                    x(i,c) -= pPacked(packInd(i, k)) * x(k,c) + pPacked(packInd(i, k + 1)) * x(k + 1,c);
+
+                cx_double bkm1 = x(k,c) / akm1k;
+                cx_double bk = x(k + 1,c) / akm1k;
+                x(k,c) = (ak * bkm1 - bk) / denom;
+                x(k + 1,c) = (akm1 * bk - bkm1) / denom;
+            }
+            k += 2;
+        }
+    }
+
+    //Solve [L]^T * [P] * [x] = [y], in reverse.
+    k = n - 1;
+    while (k >= 0)
+    {
+        if (plistPivot.at(k) > 0)
+        {
+            //1x1 diagonal block.
+            for (unsigned int c = 0; c < x.n_cols; c++)
+            {
+                for (int i = k + 1; i < n; i++)
+                    x(k,c) -= pPacked(packInd(i, k)) * x(i,c);
+            }
+
+            int kp = plistPivot.at(k) - 1;
+            if (kp != k)
+                x.swap_rows(k, kp);
+            k -= 1;
+        }
+        else
+        {
+            //2x2 diagonal block.  Row k is the second row of the block.
+            for (unsigned int c = 0; c < x.n_cols; c++)
+            {
+                for (int i = k + 1; i < n; i++)
+                {
+                    x(k,c) -= pPacked(packInd(i, k)) * x(i,c);
+                    x(k - 1,c) -= pPacked(packInd(i, k - 1)) * x(i,c);
+                }
+            }
+
+            int kp = -plistPivot.at(k) - 1;
+            if (kp != k)
+                x.swap_rows(k, kp);
+            k -= 2;
+        }
+    }
+
+    return x;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int LUFactor::packInd(int rowIn, int colIn)
+{
+    return rowIn + (2 * pSize - colIn - 1) * colIn / 2;
+}
@@ -0,0 +1,257 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef LUFACTOR_H
+#define LUFACTOR_H
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include <vector>
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The LUFactor holds the LU factorization of the global reactive force matrix (the A matrix) for a single wave
+ * frequency and single wave direction.  The factorization is:
+ * [P] * [A] = [L] * [U]
+ * Once factored, the object solves the system for any number of right hand sides with two triangular solves each.
+ * It also solves the transposed system, [A]^T * [x] = [b], from the same factors.  The transposed system is the
+ * adjoint system used to calculate sensitivities of the solution.  Note that this is the plain transpose, not the
+ * conjugate transpose.
+ *
+ * With reciprocal hydrodynamics and symmetric user forces, the matrix is complex symmetric, [A] = [A]^T.  Note this
+ * is not Hermitian.  The object checks for symmetry before it factors.  A symmetric matrix is factored with the
+ * symmetric indefinite factorization (Bunch-Kaufman pivoting):
+ * [P] * [A] * [P]^T = [L] * [D] * [L]^T
+ * where [D] has 1x1 and 2x2 diagonal blocks.  This takes about half the operations of the LU factorization.  Only
+ * the lower triangle of the factors is kept, in packed storage, so the stored factors take about one sixth of the
+ * memory of [L], [U], and [P].  The transposed system is the same as the original system.  Any matrix that is not
+ * symmetric within the tolerance uses the LU factorization.
+ */
+class LUFactor : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    LUFactor();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~LUFactor();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Factors the matrix.  Replaces any previous factorization.  Throws an error if the matrix is not square
+     * or is singular.
+     * @param matIn The matrix to factor.  Must be square.  Variable passed by reference.
+     */
+    void factor(const arma::cx_mat &matIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Factors the matrix, with the symmetry already known.  Use when the caller has checked the matrix with
+     * checkSymmetric(), so the check is not repeated.  Replaces any previous factorization.  Throws an error if the
+     * matrix is not square or is singular.
+     * @param matIn The matrix to factor.  Must be square.  Variable passed by reference.
+     * @param symIn Boolean.  True uses the symmetric indefinite factorization.  Only the lower triangle is then
+     * read.  False uses LU.  Variable passed by value.
+     */
+    void factor(const arma::cx_mat &matIn, bool symIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the system [A] * [x] = [b] with the stored factors.
+     * @param rhsIn The right hand side.  May have any number of columns.  Variable passed by reference.
+     * @return Returns a matrix of complex doubles.  The solution, same size as the right hand side.  Returned
+     * variable passed by value.
+     */
+    arma::cx_mat solve(const arma::cx_mat &rhsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the transposed system [A]^T * [x] = [b] with the stored factors.
+     * @param rhsIn The right hand side.  May have any number of columns.  Variable passed by reference.
+     * @return Returns a matrix of complex doubles.  The solution, same size as the right hand side.  Returned
+     * variable passed by value.
+     */
+    arma::cx_mat solveTrans(const arma::cx_mat &rhsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the object holds a valid factorization.
+     * @return Boolean.  True if factored.  Returned variable passed by value.
+     */
+    bool isFactored();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the size of the factored matrix.
+     * @return Integer.  The number of rows in the factored matrix.  Zero if not factored.  Returned variable passed by
+     * value.
+     */
+    int getSize();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the stored factors are the symmetric indefinite factors.
+     * @return Boolean.  True if the factored matrix was complex symmetric.  Returned variable passed by value.
+     */
+    bool isSymmetric();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the tolerance for the symmetry check.  The matrix is symmetric if the difference between each pair
+     * of elements, [A](i,j) and [A](j,i), is no more than the tolerance times the largest magnitude in the matrix.
+     * A negative tolerance turns off the symmetric factorization.  Default is 1.0e-10.
+     * @param tolIn Double.  The relative tolerance.  Variable passed by value.
+     */
+    void setSymTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the tolerance for the symmetry check.
+     * @return Double.  The relative tolerance.  Negative if the symmetric factorization is turned off.  Returned
+     * variable passed by value.
+     */
+    double getSymTolerance();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears the factorization.
+     */
+    void clear();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Checks if the matrix is complex symmetric within the tolerance.
+     * @param matIn The matrix to check.  Must be square.  Variable passed by reference.
+     * @return Boolean.  True if symmetric.  Returned variable passed by value.
+     */
+    bool checkSymmetric(const arma::cx_mat &matIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Factors a complex symmetric matrix with the LAPACK routine zsptrf.  Only the lower triangle is copied,
+     * straight into packed storage, and factored in place.  No full size work matrix is made.
+     * @param matIn The matrix to factor.  Must be square and symmetric.  Variable passed by reference.
+     */
+    void factorSym(const arma::cx_mat &matIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the system with the symmetric indefinite factors.  Follows the LAPACK routine zsptrs, with the
+     * factors in packed storage.
+     * @param rhsIn The right hand side.  May have any number of columns.  Variable passed by reference.
+     * @return Returns a matrix of complex doubles.  The solution, same size as the right hand side.  Returned
+     * variable passed by value.
+     */
+    arma::cx_mat solveSym(const arma::cx_mat &rhsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the index of an element of the lower triangle in packed storage.  Columns are stored one after the
+     * other, starting from the diagonal.
+     * @param rowIn Integer.  The row.  Must be greater than or equal to the column.  Variable passed by value.
+     * @param colIn Integer.  The column.  Variable passed by value.
+     * @return Integer.  The index in pPacked.  Returned variable passed by value.
+     */
+    int packInd(int rowIn, int colIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_mat pL; /**< Lower triangular factor, unit diagonal. */
+    arma::cx_mat pU; /**< Upper triangular factor. */
+    arma::cx_mat pP; /**< Row permutation matrix. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_vec pPacked; /**< Lower triangle of the symmetric indefinite factors, [L] and [D], in packed storage. */
+    std::vector<arma::blas_int> plistPivot; /**< Pivot indices from zsptrf.  One based.  Negative for 2x2 blocks. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pFactored; /**< Boolean to record if the matrix was factored. */
+    bool pSymmetric; /**< Boolean to record if the stored factors are the symmetric indefinite factors. */
+    int pSize; /**< Number of rows in the factored matrix. */
+    double pSymTol; /**< Relative tolerance for the symmetry check.  Negative is off. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // LUFACTOR_H
@@ -36,6 +36,8 @@ using namespace osea::ofreq;
 //------------------------------------------Function Separator --------------------------------------------------------
 matBody::matBody()
 {
+    //No id assigned yet.
+    pId = -1;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -0,0 +1,309 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "matbodybuilder.h"
+#include "../system_objects/system.h"
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+MatBodyBuilder::MatBodyBuilder()
+{
+    ptSystem = NULL;
+    pFreq = -1.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+MatBodyBuilder::~MatBodyBuilder()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MatBodyBuilder::setSystem(System *ptIn)
+{
+    ptSystem = ptIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MatBodyBuilder::setFreq(double freqIn)
+{
+    pFreq = freqIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MatBodyBuilder::buildMatBody(vector<matBody> &listOut, int bod, bool useCoeff)
+{
+    try
+    {
+        //First assign the basic properties for the matbody.
+        listOut.at(bod).setId(bod);
+        Body* MyBod;         //The current body that I am working with
+        MotionModel* MyModel; //The current motion model that I am working with
+
+        //Resolve links between bodies to integer indices, if not already done.
+        if (!ptSystem->isIndexResolved())
+            ptSystem->resolveIndex();
+
+        MyBod = &(ptSystem->listBody(bod));   //Get the current body to work with.
+        MyModel = &(MyBod->getMotionModel());  //Get the current motion model to work with.
+
+        //Now know the correct motion model to use.
+        //Create initial setup.
+        MyModel->setlistBody(ptSystem->listBody());   //Feed the list of bodies
+        MyModel->setBody(bod);       //Set which body to use as the current body
+        if (pFreq < 0)
+            MyModel->setFreq(ptSystem->getCurFreqInd(),
+                             ptSystem->getCurFreq());    //Assign the current frequency and frequency index.
+        else
+            MyModel->setFreq(ptSystem->getCurFreqInd(), pFreq);
+        MyModel->CoefficientOnly() = useCoeff;  //Let it know to only calculate coefficients.
+        MyModel->Reset();   //Give it a reset just for good measure.
+
+        //Iterate through all the active forces, user
+        //------------------------------------------
+        for (unsigned int i = 0; i < MyBod->listForceActive_user().size(); i++)
+        {
+            listOut.at(bod).listForceActive_user().push_back(matForceActive());
+            listOut.at(bod).listForceActive_user(i).listCoefficient() = MyModel->getMatForceActive_user(i);
+            //Print out active force matrix.  For Debugging.
+            //listOut.at(bod).listForceActive_user(i).listCoefficient().print("Active Force: " + i);
+
+            //Create force ID.
+            listOut.at(bod).listForceActive_user(i).setId(i);
+        }
+
+        //Iterate through all the active forces, hydro
+        //------------------------------------------
+        for(unsigned int i = 0; i < MyBod->listForceActive_hydro().size(); i++)
+        {
+            listOut.at(bod).listForceActive_hydro().push_back(matForceActive());
+            listOut.at(bod).listForceActive_hydro(i).listCoefficient() = MyModel->getMatForceActive_hydro(i);
+            //Print out active force matrix.  For Debugging.
+            //listOut.at(bod).listForceActive_hydro(i).listCoefficient().print("Active Force: " + i);
+
+            //Create force ID.
+            listOut.at(bod).listForceActive_hydro(i).setId(i);
+        }
+
+        //Use this pointer for referencing the forces
+        matForceReact* ptForce;
+        ForceReact* ptReact;
+
+        //Iterate through all the reactive forces, user
+        //------------------------------------------
+        for (unsigned int i = 0; i < MyBod->listForceReact_user().size(); i++)
+        {
+            listOut.at(bod).listForceReact_user().push_back(matForceReact());
+            //Create pointer
+            ptForce = &listOut.at(bod).listForceReact_user(i);
+
+            //Assign id for force.
+            ptForce->setId(i);
+
+            ptReact = MyBod->listForceReact_user(i);
+
+            //Iterate through each derivative.
+            for (int j = 0; j <= ptReact->getMaxOrd(); j++)
+            {
+                //Check for a zero entry.
+                if (ptReact->listDerivative().size() == 0)
+                    break;
+
+                //Assign matrices
+                ptForce->listDerivative().push_back(MyModel->getMatForceReact_user(i,j));
+
+                //Print out Matrix.  For debugging.
+                //listOut.at(bod).listForceReact_user(0).listDerivative(0).print("Reactive Force:  ");
+            }
+        }
+
+        //Iterate through all the reactive forces, hydro
+        //------------------------------------------
+        for (unsigned int i = 0; i < MyBod->listForceReact_hydro().size(); i++)
+        {
+            listOut.at(bod).listForceReact_hydro().push_back(matForceReact());
+            //Create pointer
+            ptForce = & listOut.at(bod).listForceReact_hydro(i);
+
+            //Assign id for force.
+            ptForce->setId(i);
+
+            ptReact = MyBod->listForceReact_hydro(i);
+
+            //Iterate through each derivative.
+            for (int j = 0; j <= ptReact->getMaxOrd(); j++)
+            {
+                //Check for a zero entry.
+                if (ptReact->listDerivative().size() == 0)
+                    break;
+
+                //Assign matrices
+                ptForce->listDerivative().push_back(MyModel->getMatForceReact_hydro(i,j));
+            }
+        }
+
+        matForceCross* ptForce2;
+        ForceCross* ptCross;
+
+        //Iterate through all the cross body forces, user
+        //------------------------------------------
+        for (unsigned int i = 0; i < MyBod->listForceCross_user().size(); i++)
+        {
+            listOut.at(bod).listForceCross_user().push_back(matForceCross());
+            //Create pointer
+            ptForce2 = &listOut.at(bod).listForceCross_user(i);
+
+            //Assign id for force.
+            ptForce2->setId(i);
+
+            //Assign cross body
+            int link = MyBod->getCrossIndex_user(i);      //Index resolved by System::resolveIndex()
+            for (unsigned int k = 0; (link < 0) && (k < ptSystem->listBody().size()); k++)
+            {
+                //Index not resolved.  Search by pointer instead.
+                if (&ptSystem->listBody(k) == &(MyBod->listCrossBody_user(i)))
+                    link = k;
+            }
+            if (link >= 0)
+            {
+                //Assign cross body
+                ptForce2->setLinkedBody(&(listOut.at(link)));
+                //Set linked body id.  This should be automatic, but the program produced unreliable results.
+                ptForce2->setLinkedId(link);
+            }
+
+            //Assign pointer
+            ptCross = ptSystem->listBody(bod).listForceCross_user(i);
+
+            //Iterate through each derivative.
+            for (int j = 0; j <= ptCross->getMaxOrd(); j++)
+            {
+                //Check for a zero entry.
+                if (ptCross->listDerivative().size() == 0)
+                    continue;
+
+                //Assign matrices
+                ptForce2->listDerivative().push_back(MyModel->getMatForceCross_user(i,j));
+            }
+        }
+
+        //Iterate through all the cross body forces, hydro
+        //------------------------------------------
+        for (unsigned int i = 0; i < MyBod->listForceCross_hydro().size(); i++)
+        {
+            listOut.at(bod).listForceCross_hydro().push_back(matForceCross());
+            //Create pointer
+            ptForce2 = &listOut.at(bod).listForceCross_hydro(i);
+
+            //Assign id for force.
+            ptForce2->setId(i);
+
+            //Assign cross body
+            int link = MyBod->getCrossIndex_hydro(i);      //Index resolved by System::resolveIndex()
+            for (unsigned int k = 0; (link < 0) && (k < ptSystem->listBody().size()); k++)
+            {
+                //Index not resolved.  Search by pointer instead.
+                if (&ptSystem->listBody(k) == &(MyBod->listCrossBody_hydro(i)))
+                    link = k;
+            }
+            if (link >= 0)
+            {
+                //Assign cross body
+                ptForce2->setLinkedBody(&(listOut.at(link)));
+                //Set linked body id.  This should be automatic, but the program produced unreliable results.
+                ptForce2->setLinkedId(link);
+            }
+
+            //Assign pointer
+            ptCross = ptSystem->listBody(bod).listForceCross_hydro(i);
+
+            //Iterate through each derivative.
+            for (int j = 0; j <= ptCross->getMaxOrd(); j++)
+            {
+                //Check for a zero entry.
+                if (ptCross->listDerivative().size() == 0)
+                    continue;
+
+                //Assign matrices
+                ptForce2->listDerivative().push_back(MyModel->getMatForceCross_hydro(i,j));
+            }
+        }
+
+        //Get the mass matrix
+        //------------------------------------------
+        listOut.at(bod).refMass() = MyModel->getMatForceMass();
+        //print out mass matrix.  For debugging.
+        //listOut.at(bod).refMass().print("Mass:");
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+arma::cx_mat MatBodyBuilder::buildMass(int bod)
+{
+    arma::cx_mat output;
+
+    try
+    {
+        //Resolve links between bodies to integer indices, if not already done.
+        if (!ptSystem->isIndexResolved())
+            ptSystem->resolveIndex();
+
+        MotionModel* MyModel = &(ptSystem->listBody(bod).getMotionModel());
+
+        MyModel->setlistBody(ptSystem->listBody());   //Feed the list of bodies
+        MyModel->setBody(bod);       //Set which body to use as the current body
+        MyModel->CoefficientOnly() = true;  //The mass matrix only needs coefficients.
+        MyModel->Reset();
+
+        output = MyModel->getMatForceMass();
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+
+    return output;
+}
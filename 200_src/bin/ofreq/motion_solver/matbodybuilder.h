@@ -0,0 +1,155 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef MATBODYBUILDER_H
+#define MATBODYBUILDER_H
+#include <vector>
+#include "matbody.h"
+#include "matforceactive.h"
+#include "matforcereact.h"
+#include "matforcecross.h"
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations.
+class System;
+
+//######################################### Class Separator ###########################################################
+/**
+ * The MatBodyBuilder converts the Body objects of a System into matBody objects for the motion solver.  It uses the
+ * motion model identified by each Body object, at the current wave frequency of the System.  It holds no state of its
+ * own besides the System pointer, so each program that solves the equations of motion (ofreq, obatch) shares the
+ * same conversion.
+ */
+class MatBodyBuilder : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    MatBodyBuilder();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~MatBodyBuilder();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the System object that holds the Body objects.
+     * @param ptIn Pointer to the System object.  Variable passed by value.
+     */
+    void setSystem(ofreq::System *ptIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets a wave frequency to use instead of the current wave frequency of the System.  otime uses a
+     * frequency of 1.0 rad/s to recover the time domain coefficients of each derivative.
+     * @param freqIn Double.  The wave frequency, in rad/s.  A negative value returns to the current wave frequency of
+     * the System.  Variable passed by value.
+     */
+    void setFreq(double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds a matrix body object for the body specified by the integer.  Uses the motion model identified by
+     * the Body object.
+     * @param listOut The list of matrix bodies.  Must already be sized to the number of Body objects.  Cross-body
+     * forces link to other entries in this list.  Variable passed by reference.
+     * @param bod Integer.  Which body to use for building the matrix body.  Variable passed by value.
+     * @param useCoeff Boolean.  True to let the motion model only calculate coefficients.  Variable passed by value.
+     */
+    void buildMatBody(std::vector<ofreq::matBody> &listOut, int bod, bool useCoeff = true);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds only the mass matrix of a body, through the motion model identified by the Body object.  The mass
+     * matrix does not depend on wave frequency, so this skips all the forces.
+     * @param bod Integer.  Which body to use.  Variable passed by value.
+     * @return Returns a matrix of complex doubles.  The mass matrix of the body, the same as the mass matrix of the
+     * matrix body.  Returned variable passed by value.
+     */
+    arma::cx_mat buildMass(int bod);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    ofreq::System *ptSystem; /**< Pointer to the System object. */
+    double pFreq; /**< Wave frequency that overrides the System.  Negative to use the System. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // MATBODYBUILDER_H
@@ -127,7 +127,7 @@ matForceActive matForceActive::operator *(double scalar)
     //Multiply to each element
     for (int i = 0; i < this->pCoeff.n_rows; i++)
     {
-        output.pCoeff.at(i,1) = pCoeff.at(i,1) * scalar;
+        output.pCoeff.at(i,0) = pCoeff.at(i,0) * scalar;
     }
 
     //Write output
@@ -0,0 +1,196 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "mixedsolver.h"
+#include <cmath>
+#include <limits>
+
+using namespace arma;
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+MixedSolver::MixedSolver()
+{
+    pTol = 0.0;
+    pMaxIter = 30;
+    pResidual = 0.0;
+    pCondEst = 0.0;
+    pIter = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+MixedSolver::~MixedSolver()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool MixedSolver::solve(const cx_mat &matIn, const cx_mat &rhsIn, cx_mat &solnOut)
+{
+    pResidual = numeric_limits<double>::infinity();
+    pCondEst = 0.0;
+    pIter = 0;
+
+    if ((matIn.n_rows != matIn.n_cols) || (matIn.n_rows != rhsIn.n_rows) || (matIn.n_rows == 0))
+        return false;
+
+    //Factor in single precision.  [P] * [A] = [L] * [U]
+    cx_fmat matSingle = conv_to<cx_fmat>::from(matIn);
+    if (!lu(pL, pU, pP, matSingle))
+        return false;
+
+    //Check for zero pivots, or pivots lost to the range of single precision.
+    for (unsigned int i = 0; i < pU.n_rows; i++)
+    {
+        float piv = abs(pU(i,i));
+        if ((piv == 0.0f) || !std::isfinite(piv))
+            return false;
+    }
+
+    //Tolerance on the backward error.
+    double tol = pTol;
+    if (tol <= 0.0)
+        tol = sqrt(static_cast<double>(matIn.n_rows)) * numeric_limits<double>::epsilon();
+
+    double normA = normInf(matIn);
+    double normB = normInf(rhsIn);
+    double corrLast = 0.0;
+
+    solnOut = solveSingle(rhsIn);
+
+    for (pIter = 0; pIter <= pMaxIter; pIter++)
+    {
+        //Residual in double precision.
+        cx_mat resid = rhsIn - matIn * solnOut;
+
+        double normX = normInf(solnOut);
+        double denom = normA * normX + normB;
+        pResidual = (denom > 0.0) ? normInf(resid) / denom : 0.0;
+
+        if (!std::isfinite(pResidual))
+            return false;
+        if (pResidual <= tol)
+            return true;
+        if (pIter == pMaxIter)
+            break;
+
+        //Correction from the single precision factors.
+        cx_mat corr = solveSingle(resid);
+        double corrSize = (normX > 0.0) ? normInf(corr) / normX : 0.0;
+
+        //The first correction is about the condition number times the single precision epsilon.
+        if (pIter == 0)
+            pCondEst = corrSize / numeric_limits<float>::epsilon();
+
+        //Corrections that do not shrink will not converge.
+        if ((pIter > 0) && (corrSize > 0.5 * corrLast))
+            break;
+        corrLast = corrSize;
+
+        solnOut += corr;
+    }
+
+    return false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MixedSolver::setTolerance(double tolIn)
+{
+    pTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MixedSolver::setMaxIter(int iterIn)
+{
+    pMaxIter = iterIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double MixedSolver::getResidual()
+{
+    return pResidual;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double MixedSolver::getCondEst()
+{
+    return pCondEst;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int MixedSolver::getIterations()
+{
+    return pIter;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat MixedSolver::solveSingle(const cx_mat &rhsIn)
+{
+    cx_fmat rhsSingle = conv_to<cx_fmat>::from(rhsIn);
+
+    //[L] * [y] = [P] * [b]
+    cx_fmat y = arma::solve(trimatl(pL), pP * rhsSingle);
+
+    //[U] * [x] = [y]
+    cx_fmat x = arma::solve(trimatu(pU), y);
+
+    return conv_to<cx_mat>::from(x);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double MixedSolver::normInf(const cx_mat &matIn)
+{
+    double out = 0.0;
+
+    for (unsigned int i = 0; i < matIn.n_rows; i++)
+    {
+        double sum = 0.0;
+        for (unsigned int j = 0; j < matIn.n_cols; j++)
+            sum += abs(matIn(i,j));
+
+        if (sum > out)
+            out = sum;
+    }
+
+    return out;
+}
@@ -0,0 +1,196 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef MIXEDSOLVER_H
+#define MIXEDSOLVER_H
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "../system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The MixedSolver class solves the system [A] * [x] = [b] with a single precision LU factorization, and recovers
+ * double precision accuracy through iterative refinement.
+ *
+ * The factorization is the expensive step for large systems, and single precision roughly halves its cost and its
+ * memory.  Each refinement step calculates the residual [r] = [b] - [A] * [x] in double precision, solves for a
+ * correction with the single precision factors, and adds the correction to the solution.  Refinement stops when the
+ * normwise backward error drops below the tolerance.
+ *
+ * Refinement only converges if the matrix is not too ill conditioned for single precision, roughly a condition
+ * number below 1e7.  The size of the first correction gives an estimate of the condition number.  If refinement
+ * does not converge, solve() returns false and the caller should solve again in double precision.
+ */
+class MixedSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    MixedSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~MixedSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the system [A] * [x] = [b].
+     * @param matIn The matrix [A].  Must be square.  Variable passed by reference.
+     * @param rhsIn The right hand side [b].  May have any number of columns.  Variable passed by reference.
+     * @param solnOut The solution [x], same size as the right hand side.  Variable passed by reference.  Only valid
+     * if the function returns true.
+     * @return Returns true if refinement converged to the tolerance.  Returns false if the matrix could not be
+     * factored in single precision, or if refinement did not converge.  Returned variable passed by value.
+     */
+    bool solve(const arma::cx_mat &matIn, const arma::cx_mat &rhsIn, arma::cx_mat &solnOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the tolerance on the normwise backward error.  Zero or less uses the default, which is the square
+     * root of the matrix size times the double precision machine epsilon.
+     * @param tolIn Double.  The tolerance.  Variable passed by value.
+     */
+    void setTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the maximum number of refinement steps.  Default is 30.
+     * @param iterIn Integer.  The maximum number of refinement steps.  Variable passed by value.
+     */
+    void setMaxIter(int iterIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the normwise backward error of the last solution:  ||r|| / (||A|| * ||x|| + ||b||), in the
+     * infinity norm.
+     * @return Double.  The backward error.  Returned variable passed by value.
+     */
+    double getResidual();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the estimate of the condition number of the matrix from the last solution.  Taken from the size
+     * of the first refinement correction relative to the solution, divided by the single precision machine epsilon.
+     * Only an order of magnitude estimate.  Zero if no correction was needed.
+     * @return Double.  The condition number estimate.  Returned variable passed by value.
+     */
+    double getCondEst();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of refinement steps used by the last solution.
+     * @return Integer.  The number of refinement steps.  Returned variable passed by value.
+     */
+    int getIterations();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves with the single precision factors.
+     * @param rhsIn The right hand side.  Variable passed by reference.
+     * @return Returns the solution, converted back to double precision.  Returned variable passed by value.
+     */
+    arma::cx_mat solveSingle(const arma::cx_mat &rhsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the infinity norm of a matrix:  the largest sum of absolute values across a row.
+     * @param matIn The matrix.  Variable passed by reference.
+     * @return Double.  The infinity norm.  Returned variable passed by value.
+     */
+    double normInf(const arma::cx_mat &matIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_fmat pL; /**< Lower triangular factor, unit diagonal, single precision. */
+    arma::cx_fmat pU; /**< Upper triangular factor, single precision. */
+    arma::cx_fmat pP; /**< Row permutation matrix. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pTol; /**< Tolerance on the backward error.  Zero or less for the default. */
+    int pMaxIter; /**< Maximum number of refinement steps. */
+    double pResidual; /**< Backward error of the last solution. */
+    double pCondEst; /**< Condition number estimate from the last solution. */
+    int pIter; /**< Number of refinement steps used by the last solution. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // MIXEDSOLVER_H
@@ -41,7 +41,7 @@ MotionSolver::MotionSolver()
 //------------------------------------------Function Separator --------------------------------------------------------
 MotionSolver::MotionSolver(vector<matBody> listBodIn)
 {
-    for (unsigned int i; i < listBodIn.size(); i++)
+    for (unsigned int i = 0; i < listBodIn.size(); i++)
     {
         this->addBody(listBodIn.at(i));
     }
@@ -84,7 +84,7 @@ matForceReact *MotionSolver::sumReactSet(vector<matForceReact> listForces)
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-vector<matForceCross *> MotionSolver::sumCrossSet(vector<matForceCross> listForces)
+vector<matForceCross *> MotionSolver::sumCrossSet(vector<matForceCross> &listForces)
 {
     vector<matForceCross *> output;     //The output from the function.
 
@@ -102,36 +102,37 @@ vector<matForceCross *> MotionSolver::sumCrossSet(vector<matForceCross> listForc
         //Each entry in the list matches a body id.  If no forces are found that match
         //the body ID, leave that entry as NULL.
 
-        for (unsigned int j = 0; j < plistBody.size(); j++)
+        for (unsigned int i = 0; i < listForces.size(); i++)
         {
-            for (unsigned int i = 0; i < listForces.size(); i++)
+            //Find the body that matches the linked id.
+            int id = listForces.at(i).getLinkedId();
+            if ((id < 0) ||
+                    (id >= static_cast<int>(plistBodyIndex.size())) ||
+                    (plistBodyIndex.at(id) < 0))
+                continue;
+
+            int j = plistBodyIndex.at(id);
+            matForceCross *ptOutput;
+
+            //Create a new output force and add it in at that specific entry.
+            if (output.at(j) == NULL)
             {
-                //Check if body id matches.
-                if (listForces.at(i).getLinkedId() == plistBody.at(j).getId())
-                {
-                    matForceCross *ptOutput;
-
-                    //Create a new output force and add it in at that specific entry.
-                    if (output.at(j) == NULL)
-                    {
-                        ptOutput = new matForceCross();
-
-                        //Assign to the output.
-                        output.at(j) = ptOutput;
+                ptOutput = new matForceCross();
 
-                        //Assign link id.
-                        output.at(j)->setLinkedId(plistBody.at(j).getId());
-                    }
-                    else
-                    {
-                        ptOutput = output.at(j);
-                    }
+                //Assign to the output.
+                output.at(j) = ptOutput;
 
-                    //Add the forces to the output.
-                    *ptOutput = *ptOutput + listForces.at(i);
-                }
+                //Assign link id.
+                output.at(j)->setLinkedId(plistBody.at(j).getId());
+            }
+            else
+            {
+                ptOutput = output.at(j);
             }
-        }       
+
+            //Add the forces to the output.
+            *ptOutput = *ptOutput + listForces.at(i);
+        }
 
         //Write output.
         return output;
@@ -149,11 +150,11 @@ cx_mat *MotionSolver::sumActiveSet(vector<matForceActive> listForces)
 
     else
     {
-        int MaxMatrixSize;
+        int MaxMatrixSize = 0;
         //Get max size of matrix
         for (unsigned int i = 0; i < listForces.size(); i++)
         {
-            if (MaxMatrixSize > listForces.at(i).getMatSize())
+            if (MaxMatrixSize < listForces.at(i).getMatSize())
             {
                 MaxMatrixSize = listForces.at(i).getMatSize();
             }
@@ -285,6 +286,19 @@ void MotionSolver::calculateOutputs()
     vector<matForceCross *> input2(plistBody.size()); //Temporary vector for input into cross-body
     vector < vector<matForceCross *> > tempCrossList_hydro(plistBody.size(), input2);
 
+    //Position of each body id in the list of bodies.
+    plistBodyIndex.clear();
+    for (unsigned int j = 0; j < plistBody.size(); j++)
+    {
+        int id = plistBody.at(j).getId();
+        if (id < 0)
+            continue;
+        if (id >= static_cast<int>(plistBodyIndex.size()))
+            plistBodyIndex.resize(id + 1, -1);
+        if (plistBodyIndex.at(id) < 0)
+            plistBodyIndex.at(id) = j;
+    }
+
     //Sum forces for each body in the list.
     for (curSumBody = 0; curSumBody < plistBody.size(); curSumBody++)
     {
@@ -485,7 +499,31 @@ void MotionSolver::calculateOutputs()
     //Solve for Unknown Matrix (the X Matrix) --    A*X=B where X is the unknown
     try
     {
-        globSolnMat = solve(globReactiveMat, globActiveMat, true); //true arg for more precise calculations
+        pMixedFallback = false;
+
+        if (pMixed)
+        {
+            //Factor in single precision and refine to double precision accuracy.
+            if (!pMixedSolver.solve(globReactiveMat, globActiveMat, globSolnMat))
+                pMixedFallback = true;
+        }
+
+        if (!pMixed || pMixedFallback)
+        {
+            pFactor.clear();
+
+            //Check symmetry once.  The factorization reuses the result.
+            bool sym = pFactor.checkSymmetric(globReactiveMat);
+
+            if (pKeep || sym)
+            {
+                //Keep the factors so other objects can reuse them.
+                pFactor.factor(globReactiveMat, sym);
+                globSolnMat = pFactor.solve(globActiveMat);
+            }
+            else
+                globSolnMat = solve(globReactiveMat, globActiveMat, true);
+        }
     }
     catch (const std::exception &err)
     {
@@ -503,6 +541,10 @@ void MotionSolver::calculateOutputs()
     {
         plistSolution.push_back(globSolnMat.submat(matStart.at(i), 0, matEnd.at(i), 0));
     }
+
+    //Keep the position of each body in the global matrices.
+    plistMatStart = matStart;
+    plistMatEnd = matEnd;
 }
 
 
@@ -529,6 +571,115 @@ cx_mat &MotionSolver::listSolution(unsigned int bod)
     }
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat &MotionSolver::refReactiveMat()
+{
+    return globReactiveMat;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat &MotionSolver::refSolnMat()
+{
+    return globSolnMat;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat &MotionSolver::refActiveMat()
+{
+    return globActiveMat;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+LUFactor &MotionSolver::refFactor()
+{
+    return pFactor;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MotionSolver::setMixedPrecision(bool mixedIn)
+{
+    pMixed = mixedIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MotionSolver::setKeepFactor(bool keepIn)
+{
+    pKeep = keepIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void MotionSolver::setSymTolerance(double tolIn)
+{
+    pFactor.setSymTolerance(tolIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool MotionSolver::getMixedFallback()
+{
+    return pMixedFallback;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+MixedSolver &MotionSolver::refMixedSolver()
+{
+    return pMixedSolver;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat MotionSolver::getForceReact_user(int bod, int forceInd)
+{
+    cx_mat output;
+    output.zeros(globReactiveMat.n_rows, globReactiveMat.n_cols);
+
+    //Sum the derivatives at the current wave frequency.
+    cx_mat *force = sumDerivative(&(plistBody.at(bod).listForceReact_user(forceInd)));
+
+    if (force != NULL)
+    {
+        //Place in the diagonal block of the body.
+        if ((force->n_rows == ((unsigned int)(plistMatEnd.at(bod) - plistMatStart.at(bod) + 1)))
+                && (force->n_cols == force->n_rows))
+            output.submat(plistMatStart.at(bod), plistMatStart.at(bod), plistMatEnd.at(bod), plistMatEnd.at(bod))
+                    = *force;
+
+        delete force;
+    }
+
+    //Write output
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat MotionSolver::getForceCross_user(int bod, int forceInd)
+{
+    cx_mat output;
+    output.zeros(globReactiveMat.n_rows, globReactiveMat.n_cols);
+
+    matForceCross *ptCross = &(plistBody.at(bod).listForceCross_user(forceInd));
+    int link = ptCross->getLinkedId();
+
+    //Cross-body forces are only included in the global matrix for other bodies.
+    if ((link < 0) || (link >= static_cast<int>(plistBody.size())) || (link == bod))
+        return output;
+
+    //Sum the derivatives at the current wave frequency.
+    cx_mat *force = sumDerivative(ptCross);
+
+    if (force != NULL)
+    {
+        //Place in the off-diagonal block between the body and the linked body.
+        if ((force->n_rows == ((unsigned int)(plistMatEnd.at(bod) - plistMatStart.at(bod) + 1)))
+                && (force->n_cols == ((unsigned int)(plistMatEnd.at(link) - plistMatStart.at(link) + 1))))
+            output.submat(plistMatStart.at(bod), plistMatStart.at(link), plistMatEnd.at(bod), plistMatEnd.at(link))
+                    = *force;
+
+        delete force;
+    }
+
+    //Write output
+    return output;
+}
+
 //==========================================Section Separator =========================================================
 //Protected Functions
 
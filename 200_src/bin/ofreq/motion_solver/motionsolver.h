@@ -48,6 +48,8 @@
 #include "matbody.h"
 #include "matforcereact.h"
 #include "matforcecross.h"
+#include "lufactor.h"
+#include "mixedsolver.h"
 #include "../system_objects/ofreqcore.h"
 
 //######################################### Class Separator ###########################################################
@@ -151,11 +153,13 @@ public:
      * body for the force depends on whether two objects are summed together.  Output from this function is a
      * vector of cross-body forces.  Each entry in the vector contains a cross-body force object.  If the input list
      * of forces (listForces) is empty, the function returns a NULL pointer.
-     * @param CrossBodMat The vector of cross-body force matrices.
+     * The linked body of each force is found through plistBodyIndex, so the cost only depends on the number of
+     * forces.
+     * @param CrossBodMat The vector of cross-body force matrices.  Variable passed by reference.
      * @return A vector of complex matrices, with each entry in the vectors representing a cross-body force linked to
      * a specific body.  Returned variable is a pointer.
      */
-    std::vector<matForceCross *> sumCrossSet(std::vector<matForceCross> listForces);
+    std::vector<matForceCross *> sumCrossSet(std::vector<matForceCross> &listForces);
 
     //------------------------------------------Function Separator ----------------------------------------------------
 	/**
@@ -251,7 +255,114 @@ public:
      */
     arma::cx_mat &listSolution(unsigned int bod);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the global reactive force matrix (the A matrix) assembled by calculateOutputs().
+     * @return Returns a matrix of complex doubles.  The global reactive force matrix for all bodies.  Returned
+     * variable passed by reference.
+     */
+    arma::cx_mat &refReactiveMat();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the global solution matrix (the X matrix) calculated by calculateOutputs().
+     * @return Returns a column matrix of complex doubles.  The solution for all bodies.  Returned variable passed by
+     * reference.
+     */
+    arma::cx_mat &refSolnMat();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns a reference to the global active force matrix (the F matrix).  Only valid after
+     * calculateOutputs() is run.
+     * @return Returns a reference to the global active force matrix.  Variable passed by reference.
+     */
+    arma::cx_mat &refActiveMat();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the LU factors of the global reactive force matrix, calculated by calculateOutputs().  Only holds
+     * valid factors when setKeepFactor() was true, or when the matrix was complex symmetric.
+     * @return Returns the LUFactor object.  Returned variable passed by reference.
+     */
+    LUFactor &refFactor();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether calculateOutputs() solves with a single precision factorization and iterative refinement.
+     *
+     * If refinement does not converge, the solver falls back to the full double precision factorization.  In mixed
+     * precision mode, refFactor() only holds valid factors after a fall back, so mixed precision must not be used
+     * when the factors are needed, such as for adjoint reports or a parametric scan.  Default is false.
+     * @param mixedIn Boolean.  True to use mixed precision.  Variable passed by value.
+     * @sa MixedSolver
+     */
+    void setMixedPrecision(bool mixedIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether calculateOutputs() keeps the LU factors of the global reactive force matrix.
+     *
+     * Only needed when the factors are reused, such as for adjoint reports or a parametric scan.  Otherwise the
+     * system is solved directly, without storing [L], [U], and [P].  A complex symmetric matrix still uses the
+     * symmetric indefinite factorization, since its packed factors cost less than the direct solve.  Default is
+     * false.
+     * @param keepIn Boolean.  True to keep the factors.  Variable passed by value.
+     */
+    void setKeepFactor(bool keepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the tolerance for the symmetry check before the global reactive force matrix is factored.  A
+     * complex symmetric matrix uses the symmetric indefinite factorization.  Negative turns it off.
+     * @param tolIn Double.  The relative tolerance.  Variable passed by value.
+     * @sa LUFactor::setSymTolerance()
+     */
+    void setSymTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the last call to calculateOutputs() fell back from mixed precision to double precision.
+     * @return Boolean.  True if the solver fell back to double precision.  Returned variable passed by value.
+     */
+    bool getMixedFallback();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the mixed precision solver.  Holds the backward error, condition number estimate, and number of
+     * refinement steps from the last call to calculateOutputs() in mixed precision mode.
+     * @return Returns the MixedSolver object.  Returned variable passed by reference.
+     */
+    MixedSolver &refMixedSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the contribution of a single user reactive force to the global reactive force matrix.
+     *
+     * The derivatives of the force are summed at the current wave frequency and placed in the diagonal block of the
+     * specified body.  All other entries are zero.  Must be called after calculateOutputs().
+     * @param bod Integer.  The index of the body, in the sequence the bodies were added.  Variable passed by value.
+     * @param forceInd Integer.  The index of the user reactive force in the matBody object.  Variable passed by
+     * value.
+     * @return Returns a matrix of complex doubles, the same size as the global reactive force matrix.  Returned
+     * variable passed by value.
+     */
+    arma::cx_mat getForceReact_user(int bod, int forceInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Get the contribution of a single user cross-body force to the global reactive force matrix.
+     *
+     * The derivatives of the force are summed at the current wave frequency and placed in the off-diagonal block
+     * between the specified body and the linked body.  All other entries are zero.  Must be called after
+     * calculateOutputs().
+     * @param bod Integer.  The index of the body, in the sequence the bodies were added.  Variable passed by value.
+     * @param forceInd Integer.  The index of the user cross-body force in the matBody object.  Variable passed by
+     * value.
+     * @return Returns a matrix of complex doubles, the same size as the global reactive force matrix.  Returned
+     * variable passed by value.
+     */
+    arma::cx_mat getForceCross_user(int bod, int forceInd);
 
 //==========================================Section Separator =========================================================
 protected:
@@ -264,6 +375,11 @@ private:
     arma::cx_mat globReactiveMat; /**< A Matrix (Reactive Force Matrix Global)*/
     arma::cx_mat globActiveMat;   /**< F Matrix (Active Force Matirx Global)*/
     arma::cx_mat globSolnMat;	  /**< X Matrix (Solution Column Matrix)*/
+    LUFactor pFactor;             /**< LU factors of the A Matrix. */
+    MixedSolver pMixedSolver;     /**< Mixed precision solver for the A Matrix. */
+    bool pMixed = false;          /**< Boolean to solve in mixed precision. */
+    bool pKeep = false;           /**< Boolean to keep the LU factors. */
+    bool pMixedFallback = false;  /**< Boolean to record if mixed precision fell back to double precision. */
 
     //Output solution values
     /**
@@ -273,6 +389,10 @@ private:
      */
     std::vector<arma::cx_mat> plistSolution;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<int> plistMatStart; /**< Starting row of each body in the global matrices. */
+    std::vector<int> plistMatEnd; /**< Ending row of each body in the global matrices. */
+
     //------------------------------------------Function Separator ----------------------------------------------------
     std::vector<matBody> plistBody; /**< Body with Force Coefficients */
 
@@ -286,6 +406,15 @@ private:
      */
     int curSumBody;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The position in plistBody for each body id.  Entries are -1 for ids that are not used.
+     *
+     * Built at the start of calculateOutputs(), so that cross-body forces can be matched to the linked body without
+     * searching through the list of bodies.
+     */
+    std::vector<int> plistBodyIndex;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Adds the two matrices together, anticipating possibilities for various combinations of pointers.
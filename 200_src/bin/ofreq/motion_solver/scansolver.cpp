@@ -0,0 +1,194 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "scansolver.h"
+
+using namespace arma;
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ScanSolver::ScanSolver()
+{
+    pFactored = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ScanSolver::~ScanSolver()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ScanSolver::setBaseline(cx_mat solnIn)
+{
+    pSoln = solnIn;
+    plistForce.clear();
+    pFactored = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ScanSolver::addForce(cx_mat forceIn)
+{
+    plistForce.push_back(forceIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ScanSolver::factor(LUFactor &factorIn)
+{
+    if (!factorIn.isFactored() || (factorIn.getSize() != static_cast<int>(pSoln.n_rows)))
+        throw std::runtime_error("Scan solver needs the LU factors of the baseline system.");
+
+    //Find the rows and columns touched by any of the forces.
+    vector<unsigned int> listRows;
+    vector<unsigned int> listCols;
+
+    vector<bool> touchRow(pSoln.n_rows, false);
+    vector<bool> touchCol(pSoln.n_rows, false);
+
+    for (unsigned int f = 0; f < plistForce.size(); f++)
+    {
+        for (unsigned int i = 0; i < plistForce.at(f).n_rows; i++)
+        {
+            for (unsigned int j = 0; j < plistForce.at(f).n_cols; j++)
+            {
+                if (plistForce.at(f)(i,j) != complex<double>(0.0, 0.0))
+                {
+                    touchRow.at(i) = true;
+                    touchCol.at(j) = true;
+                }
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < touchRow.size(); i++)
+    {
+        if (touchRow.at(i))
+            listRows.push_back(i);
+    }
+
+    for (unsigned int j = 0; j < touchCol.size(); j++)
+    {
+        if (touchCol.at(j))
+            listCols.push_back(j);
+    }
+
+    pRows = conv_to<uvec>::from(listRows);
+    pCols = conv_to<uvec>::from(listCols);
+
+    if ((pRows.n_elem > 0) && (pCols.n_elem > 0))
+    {
+        //Solve for the selected rows.  Reuses the factors of [A] for all right hand sides.
+        cx_mat E_R;
+        E_R.zeros(pSoln.n_rows, pRows.n_elem);
+        for (unsigned int i = 0; i < pRows.n_elem; i++)
+            E_R(pRows(i), i) = 1.0;
+
+        pZ = factorIn.solve(E_R);
+
+        //Only keep the touched block of each force.
+        for (unsigned int f = 0; f < plistForce.size(); f++)
+            plistForce.at(f) = plistForce.at(f).submat(pRows, pCols);
+    }
+    else
+    {
+        //No force touches the system.  Every set of factors gives the baseline solution.
+        for (unsigned int f = 0; f < plistForce.size(); f++)
+            plistForce.at(f).reset();
+    }
+
+    pFactored = true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat ScanSolver::getSolution(vector<double> factorIn)
+{
+    cx_mat output = pSoln;
+
+    //Misuse is an error, not a singular update.  The baseline solution would silently stand in for the result.
+    if (!pFactored)
+        throw std::runtime_error("Scan solver used before it was factored.");
+
+    if (factorIn.size() != plistForce.size())
+        throw std::runtime_error("Number of scan factors does not match the number of scanned forces.");
+
+    try
+    {
+        if (pCols.n_elem == 0)
+            return output;
+
+        //Change to the touched block of the global reactive matrix.
+        cx_mat D;
+        D.zeros(pRows.n_elem, pCols.n_elem);
+        for (unsigned int f = 0; f < plistForce.size(); f++)
+        {
+            if (factorIn.at(f) != 1.0)
+                D += (factorIn.at(f) - 1.0) * plistForce.at(f);
+        }
+
+        //Woodbury update of the baseline solution.
+        cx_mat U = pZ * D;
+        cx_mat M = eye<cx_mat>(pCols.n_elem, pCols.n_elem) + U.rows(pCols);
+        cx_mat y = solve(M, pSoln.rows(pCols), true);
+
+        output = pSoln - U * y;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string("Failed to solve parameter set.  Updated system may be singular.\n")
+                     + string("Error Message:  ") + std::string(err.what()));
+
+        output.set_size(pSoln.n_rows, pSoln.n_cols);
+        output.fill(complex<double>(datum::nan, datum::nan));
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int ScanSolver::getRank()
+{
+    return pCols.n_elem;
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
@@ -0,0 +1,195 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+
+//######################################### Class Separator ###########################################################
+#ifndef SCANSOLVER_H
+#define SCANSOLVER_H
+#include <complex>
+#include <vector>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "../system_objects/ofreqcore.h"
+#include "lufactor.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The ScanSolver re-solves the equations of motion for many values of a small number of user forces, without
+ * assembling and solving the full global matrix for each value.  It applies to a single wave frequency and single
+ * wave direction.
+ *
+ * Each scanned force is scaled by a factor.  The global reactive matrix for a set of factors is:
+ * [A'] = [A] + sum( (s_f - 1) * [K_f] )
+ * where [A] is the baseline global reactive matrix and [K_f] is the contribution of force f to [A].  User forces
+ * typically only touch a few rows and columns of [A] (a power take-off on one degree of freedom, for example).
+ * So the change to [A] is low rank.  The solver uses the Sherman-Morrison-Woodbury identity to update the
+ * baseline solution:
+ * 1.)  Find the rows R and columns C where any scanned force is non-zero.
+ * 2.)  Solve [A] * [Z] = [E_R] once, where [E_R] selects the rows R.  Reuses the factors of [A] from the motion
+ *      solver, so [A] is never factored again.
+ * 3.)  For each set of factors, form [D] = sum( (s_f - 1) * [K_f](R,C) ).
+ * 4.)  [U] = [Z] * [D], and [x'] = [x] - [U] * inv([I] + [U](C,:)) * [x](C).
+ * Step 4 only requires a solve of size C for each set of factors.
+ *
+ * The full matrices are discarded once the solver is factored.  Only the low rank data is kept, so one ScanSolver
+ * can be kept for every wave direction and wave frequency.
+ */
+class ScanSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    ScanSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~ScanSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the baseline system.  Clears any forces previously added.
+     * @param solnIn The baseline global solution (the X matrix).  Variable passed by value.
+     */
+    void setBaseline(arma::cx_mat solnIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the contribution of one scanned force to the global reactive force matrix.  Forces must be added
+     * in the same sequence as the factors supplied to getSolution().
+     * @param forceIn The contribution of the force to the global reactive force matrix, at a factor of 1.0.  Must
+     * be the same size as the global reactive force matrix.  Variable passed by value.
+     */
+    void addForce(arma::cx_mat forceIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Factors the baseline system for the rows and columns touched by the scanned forces.  Discards the full
+     * matrices afterwards.  Must be called after all forces are added and before getSolution().
+     * @param factorIn The LU factors of the baseline global reactive force matrix (the A matrix), from the motion
+     * solver.  Must be factored.  Variable passed by reference.  Throws an error if the factors are missing or do
+     * not match the size of the baseline system.
+     * @sa MotionSolver::setKeepFactor()
+     */
+    void factor(LUFactor &factorIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the global solution for a set of factors.
+     * @param factorIn Vector of doubles.  One factor for each force added, in the same sequence.  Variable passed by
+     * value.
+     * @return Returns a column matrix of complex doubles.  The global solution for all bodies.  If the updated
+     * system is singular, all values are NaN.  Throws an error if the solver was not factored, or if the number of
+     * factors does not match the number of forces.  Returned variable passed by value.
+     */
+    arma::cx_mat getSolution(std::vector<double> factorIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the rank of the update.  This is the number of columns touched by the scanned forces, and the
+     * size of the system solved for each set of factors.
+     * @return Integer.  The rank of the update.  Returned variable passed by value.
+     */
+    int getRank();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_mat pSoln; /**< Baseline global solution. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Contribution of each scanned force.  Full size before factoring.  Only the rows R and columns C after
+     * factoring.
+     */
+    std::vector<arma::cx_mat> plistForce;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::uvec pRows; /**< Rows R touched by any scanned force. */
+    arma::uvec pCols; /**< Columns C touched by any scanned force. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::cx_mat pZ; /**< Solution of [A] * [Z] = [E_R]. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pFactored; /**< Boolean to record if the solver was factored. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // SCANSOLVER_H
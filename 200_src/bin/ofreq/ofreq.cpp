@@ -39,8 +39,12 @@
 //######################################### Include Statements ########################################################
 #include <QCoreApplication>
 #include "./motion_solver/motionsolver.h"
+#include "./motion_solver/scansolver.h"
+#include "./motion_solver/ensemblesolver.h"
+#include "./motion_solver/dragsolver.h"
 #include "./motion_model/motionmodel.h"
 #include "./motion_solver/matbody.h"
+#include "./motion_solver/matbodybuilder.h"
 #include "./motion_solver/matforceactive.h"
 #include "./motion_solver/matforcecross.h"
 #include "./motion_solver/matforcereact.h"
@@ -56,11 +60,17 @@
 #include "./file_reader/dictoutputs.h"
 #include "./hydro_reader/hydroreader.h"
 #include "./system_objects/ofreqcore.h"
+#include "./system_objects/checkpoint.h"
+#include "./system_objects/ofreqserver.h"
+#include "./system_objects/shard.h"
+#include "./reports/ensemblestats.h"
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <stdio.h>
 #include <QtGlobal>
+#include <QDir>
+#include <QStringList>
 #ifdef Q_OS_WIN
     //----------- Windows Inclusions ------------
     #include <direct.h>
@@ -86,12 +96,16 @@ using namespace std;
 
 //########################################## Global Variables #########################################################
 
-//Create matrix bodies.
-vector<matBody> listMatBody;
-
 //System object.  Used to control entire execution.
 System sysofreq;
 
+//Checkpoint object.  Stores each completed solution so an interrupted run can resume.
+Checkpoint ckptofreq;
+
+//Scan solvers for a parametric scan of user forces.  The first index is the wave direction.  The second index is the
+//wave frequency.  Only used if a scan is defined.
+vector< vector<ScanSolver> > listScanSolver;
+
 //Name of executable file itself
 const std::string EXECNAME = "ofreq";
 
@@ -110,16 +124,43 @@ const std::string ETCFOLDER = "etc";
 //Name of binaries folder
 const std::string BINFOLDER = "bin";
 
-//######################################### Function Prototypes #######################################################
+//Name of the checkpoint file.  Written in the run directory.
+const std::string CKPTFILE = "ofreq.ckpt";
 
-//------------------------------------------Function Separator --------------------------------------------------------
-/**
- * @brief Builds a matrix body object for the body specified by the integer.  Uses the motion model identified by the
- * Body object.
- * @param bod Which body to use for building the matix body.
- * @return Returns a matBody object, fully provisioned with all necessary data.
- */
-void buildMatBody(int bod, bool useCoeff=true);
+//Command line option to store each solution in the checkpoint file, and resume from any solutions already stored.
+const std::string ARG_CHECKPOINT = "--checkpoint";
+
+//Command line option to only write reports from the solutions stored in the checkpoint file.
+const std::string ARG_REPORTSONLY = "--reports-only";
+
+//Command line option to keep the loaded case resident and answer requests on a Unix socket.
+const std::string ARG_SERVER = "--server";
+
+//Command line option to send requests to a running server.
+const std::string ARG_CLIENT = "--client";
+
+//Command line option to solve only one shard of the wave directions and wave frequencies.
+const std::string ARG_SHARD = "--shard";
+
+//Command line option to merge the checkpoint files of all shards and write the reports.
+const std::string ARG_MERGE = "--merge";
+
+//Tag added to the names of the checkpoint file and log files of a shard.
+const std::string SHARDTAG = ".shard_";
+
+//Name of the directory prefix for reports of each parameter set in a parametric scan.
+const std::string SCANFOLDER = "scan";
+
+//Name of the file that lists the factors for each parameter set in a parametric scan.
+const std::string SCANFILE = "scanset.out";
+
+//Name of the directory for the summary statistics of an ensemble study.
+const std::string ENSFOLDER = "ensemble";
+
+//Names of the subdirectories for each statistic of an ensemble study.  In the order used by EnsembleStats.
+const std::string ENSSTAT[4] = {"mean", "stdev", "min", "max"};
+
+//######################################### Function Prototypes #######################################################
 
 //------------------------------------------Function Separator --------------------------------------------------------
 /**
@@ -127,9 +168,13 @@ void buildMatBody(int bod, bool useCoeff=true);
  * using Qt slots and signals.  Finally proceeds through each file and reads it.  All parsing is accomplished by
  * the FileReader object.  File interpretation is processed through the Dictionary objects.
  * @param runPath String.  The path to the root directory of the input files.
+ * @param selective Boolean.  True to only load the hydrodynamic data for the wave directions, wave frequencies and
+ * bodies of the run.  Must be false if they can change after loading, as in server mode.
+ * @param keyCheckpoint Boolean.  True to key the checkpoint file to the input files and hydrodynamic data files
+ * that were read.
  * @sa Dictionary
  */
-void ReadFiles(string runPath);
+void ReadFiles(string runPath, bool selective = true, bool keyCheckpoint = false);
 
 //------------------------------------------Function Separator --------------------------------------------------------
 /**
@@ -168,6 +213,65 @@ void writeMonitor(int dirIn, int freqIn, int iterIn);
  */
 void writeLogHeader();
 
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Checks that every force listed in the parametric scan matches a user reactive force or user cross-body
+ * force.  Throws an error if not.
+ */
+void checkScanForces();
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Builds the scan solver for the current wave direction and wave frequency.
+ *
+ * Takes the baseline global matrices from the motion solver.  Collects the contribution of each scanned user force
+ * from every body that uses it.  Then factors the scan solver.  Throws an error if the scan solver can not be built,
+ * so the run stops instead of writing scan reports from an unfactored point.
+ * @param dirIn Integer.  Variable passed by value.  The index of the current wave direction.
+ * @param freqIn Integer.  Variable passed by value.  The index of the current wave frequency.
+ * @param solverIn The motion solver, after calculateOutputs() was run.  Variable passed by reference.
+ */
+void buildScanSolver(int dirIn, int freqIn, MotionSolver &solverIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Writes the reports for each parameter set of the parametric scan.
+ *
+ * For each parameter set, the scanned user forces are scaled and the solutions are updated with the scan solvers.
+ * The reports are then written to a separate directory for each parameter set, under the run directory.  The
+ * original forces and solutions are restored afterwards.
+ */
+void writeScanReports();
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Sums the contribution of a user force to the global reactive force matrix, over every body that uses it.
+ * @param nameIn String.  The name of the user reactive force or user cross-body force.  Variable passed by value.
+ * @param solverIn The motion solver, after calculateOutputs() was run.  Variable passed by reference.
+ * @return Matrix of complex doubles.  Same size as the global reactive force matrix.  Returned variable passed by
+ * value.
+ */
+arma::cx_mat getUserForceMat(string nameIn, MotionSolver &solverIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Checks that every ensemble parameter names an existing body and mass property, or an existing user
+ * reactive force or user cross-body force.  Throws an error if not.
+ */
+void checkEnsemble();
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Runs the ensemble study and writes the summary statistics of the reports.
+ *
+ * For each wave direction, the baseline system is assembled once for each wave frequency.  The samples are then
+ * solved in batches with the ensemble solvers.  Each sample is applied to the bodies and forces, the reports are
+ * calculated in memory, and the results are added to the running statistics.  No files are written for individual
+ * samples.  The statistics are written to a separate directory for each statistic, under the run directory.  The
+ * original bodies, forces, and solutions are restored afterwards.
+ */
+void runEnsemble();
+
 //############################################ Class Prototypes #######################################################
 
 
@@ -194,6 +298,23 @@ void writeLogHeader();
  * 7.  Repeat steps 4 through 6 for each wave direction and wave frequency.
  * 8.  Use the results to calculate derived outputs.
  * 9.  Write the calculated outputs to output files.
+ *
+ * Use the --checkpoint option to store each solution in a checkpoint file as soon as it is calculated.  If the run is
+ * restarted with the same option and the same input files, any stored solutions are loaded and only the remaining
+ * points are solved.  Use the --reports-only option to skip steps 3 through 7 and write the reports directly from a
+ * complete checkpoint file.  Without any of these options, no checkpoint file is read or written.
+ *
+ * Use the --server <socket> option to stop after step 2 and keep the loaded case resident.  The server then answers
+ * requests on the Unix socket until it receives a shutdown command.  Use the --client <socket> option to send
+ * requests to a running server.  Each following argument is one command.  With no commands, they are read from
+ * standard input.  See OfreqServer for the list of commands.
+ *
+ * Use the --shard <spec> option to solve only part of the wave directions and wave frequencies.  See Shard for the
+ * format of the specification.  Each shard writes its solutions to its own checkpoint file and log files in the run
+ * directory, and writes no reports.  Shards may run as separate processes, on separate machines, as long as they
+ * share the run directory.  Once every shard is finished, use the --merge option to load the checkpoint files of all
+ * shards and write the reports.  Each point is solved by exactly one shard, so the merged solutions do not depend
+ * on the order the shards ran or finished.
  */
 
 int main(int argc, char *argv[])
@@ -203,11 +324,83 @@ int main(int argc, char *argv[])
 	//if command line arg supplied, use that directory
 	//or assume the current working directory
 
-    if (argc == 2)
+    bool useCheckpoint = false;         //Boolean to store solutions in the checkpoint file.
+    bool reportsOnly = false;          //Boolean to only write reports from stored solutions.
+    string runPath = "";
+    string serverSocket = "";           //Socket path for server mode.
+    Shard shard;                        //Shard of the wave directions and wave frequencies to solve.
+    bool mergeShards = false;           //Boolean to merge the checkpoint files of all shards.
+
+    for (int i = 1; i < argc; i++)
     {
-        sysofreq.setPath(argv[1]);
+        if (string(argv[i]) == ARG_CHECKPOINT)
+            useCheckpoint = true;
+        else if (string(argv[i]) == ARG_REPORTSONLY)
+            reportsOnly = true;
+        else if ((string(argv[i]) == ARG_SERVER) && (i + 1 < argc))
+            serverSocket = argv[++i];
+        else if ((string(argv[i]) == ARG_SHARD) && (i + 1 < argc))
+        {
+            //No log files exist yet.  Report a bad specification on the console.
+            try
+            {
+                shard.setSpec(argv[++i]);
+            }
+            catch(const std::exception &err)
+            {
+                cerr << err.what() << endl;
+                return 1;
+            }
+        }
+        else if (string(argv[i]) == ARG_MERGE)
+        {
+            //Merging only loads stored solutions.  Same as writing the reports only.
+            mergeShards = true;
+            reportsOnly = true;
+        }
+        else if ((string(argv[i]) == ARG_CLIENT) && (i + 1 < argc))
+        {
+            //Client mode.  Send the commands and print the response.  No log files are used.
+            string socketPath = argv[++i];
+            string request;
+
+            if (i + 1 < argc)
+            {
+                for (i = i + 1; i < argc; i++)
+                    request += string(argv[i]) + "\n";
+            }
+            else
+            {
+                string line;
+                while (getline(cin, line))
+                    request += line + "\n";
+            }
+
+            try
+            {
+                string response = OfreqServer::request(socketPath, request);
+                cout << response;
+                return ((response.find("error ") == 0) || (response.find("\nerror ") != string::npos)) ? 1 : 0;
+            }
+            catch(const std::exception &err)
+            {
+                cerr << err.what() << endl;
+                return 1;
+            }
+        }
+        else
+            runPath = argv[i];
     }
-    else if (argc == 1)
+
+    //A shard stores its solutions for the merge run.
+    if (shard.isSet())
+        useCheckpoint = true;
+
+    if (!runPath.empty())
+    {
+        sysofreq.setPath(runPath);
+    }
+    else
     {
         //Get current working directory
         char cCurrentPath[FILENAME_MAX];
@@ -221,7 +414,11 @@ int main(int argc, char *argv[])
 
     //Setup the output log files
     //---------------------------------------------------------------------------
-    sysofreq.setLogFiles(sysofreq.getPath());
+    //Each shard has its own log files, so shards can share the run directory.
+    if (shard.isSet())
+        sysofreq.setLogFiles(sysofreq.getPath(), false, SHARDTAG + shard.getName());
+    else
+        sysofreq.setLogFiles(sysofreq.getPath());
 
     //Clear the screen and create an introductory header
     //---------------------------------------------------------------------------
@@ -233,16 +430,83 @@ int main(int argc, char *argv[])
         //---------------------------------------------------------------------------
         sysofreq.logStd.Write("Reading input files",3);
         sysofreq.logStd.Write("=================================================================================",3);
-        ReadFiles(sysofreq.getPath());
+        //A server can change the wave directions and wave frequencies, so it needs all the hydrodynamic data.
+        ReadFiles(sysofreq.getPath(), serverSocket.empty(), useCheckpoint || reportsOnly);
         sysofreq.logStd.Write("\n\n\n",3);
 
         //Set the active sea model
         //---------------------------------------------------------------------------
         sysofreq.setActiveSeaModel();
 
-        //Clear out any previous output files
+        //Resolve links between bodies and hydrodynamic data to integer indices
+        //---------------------------------------------------------------------------
+        sysofreq.resolveIndex();
+
+        //Resample the hydrodynamic data onto the wave frequencies
+        //---------------------------------------------------------------------------
+        sysofreq.resampleHydro();
+
+        //Replace the cross-body data of distant bodies with the far-field approximation
         //---------------------------------------------------------------------------
-        sysofreq.refReportManager().clearFiles();
+        sysofreq.applyFarField();
+
+        //In server mode, keep the loaded case resident and answer requests.
+        //---------------------------------------------------------------------------
+        if (!serverSocket.empty())
+        {
+            sysofreq.logStd.Write("\n\n\n",3);
+            sysofreq.logStd.Write("Server Mode",3);
+            sysofreq.logStd.Write("=================================================================================",3);
+
+            OfreqServer server;
+            server.setSystem(&sysofreq);
+            server.setHeaderPath(getPath("var"));
+            return server.run(serverSocket);
+        }
+
+        //Check the parametric scan definition
+        //---------------------------------------------------------------------------
+        checkScanForces();
+        bool useScan = (sysofreq.getNumScanSets() > 0) && !reportsOnly && !shard.isSet();
+        if ((sysofreq.getNumScanSets() > 0) && reportsOnly)
+        {
+            sysofreq.logStd.Write("Parametric scan skipped.  Option " + ARG_REPORTSONLY + " does not solve any equations.",3);
+        }
+        if ((sysofreq.getNumScanSets() > 0) && shard.isSet())
+        {
+            sysofreq.logStd.Write("Parametric scan skipped.  Option " + ARG_SHARD + " does not write any reports.",3);
+        }
+
+        //Check the ensemble definition
+        //---------------------------------------------------------------------------
+        checkEnsemble();
+        bool useEnsemble = (sysofreq.getEnsembleSize() > 0) && !reportsOnly && !shard.isSet();
+        if ((sysofreq.getEnsembleSize() > 0) && reportsOnly)
+        {
+            sysofreq.logStd.Write("Ensemble skipped.  Option " + ARG_REPORTSONLY + " does not solve any equations.",3);
+        }
+        if ((sysofreq.getEnsembleSize() > 0) && shard.isSet())
+        {
+            sysofreq.logStd.Write("Ensemble skipped.  Option " + ARG_SHARD + " does not write any reports.",3);
+        }
+
+        //Linearize the quadratic drag forces
+        //The stored solutions already include the linear damping, so reports only runs skip this.
+        //---------------------------------------------------------------------------
+        if ((sysofreq.listForceDrag().size() > 0) && !reportsOnly)
+        {
+            sysofreq.logStd.Write("Linearizing drag forces",3);
+            sysofreq.logStd.Write("=================================================================================",3);
+            DragSolver drag;
+            drag.setSystem(&sysofreq);
+            drag.solve();
+            sysofreq.logStd.Write("\n\n\n",3);
+        }
+        if ((sysofreq.listForceDrag().size() > 0) && reportsOnly)
+        {
+            sysofreq.logStd.Write("Drag linearization skipped.  Option " + ARG_REPORTSONLY + " does not solve any "
+                                  "equations.  Reports of reactive forces do not include the drag damping.",3);
+        }
 
 
 
@@ -260,329 +524,246 @@ int main(int argc, char *argv[])
                                                  sysofreq.listWaveFrequencies().size()));
         }
 
-        //Iterate through each wave direction and wave frequency to solve
+        //Load any solutions stored from a previous run
         //---------------------------------------------------------------------------
-        //Create an iterator to track the loops.
-        int itertrack = 0;
-
-        sysofreq.logStd.Write("Solving equations",3);
-        sysofreq.logStd.Write("=================================================================================",3);
+        //A shard keeps its solutions in its own checkpoint file.
+        string ckptPath = sysofreq.getPath() + seperator + CKPTFILE;
+        if (shard.isSet())
+            ckptPath += SHARDTAG + shard.getName();
 
-        for(unsigned int i = 0; i < sysofreq.listWaveDirections().size(); i++)
+        //Only read when writing the reports from stored solutions.
+        if (useCheckpoint || reportsOnly)
         {
-            //Set the current wave direction
-            sysofreq.setCurWaveDirInd(i);
-
-            for(unsigned int j = 0; j < sysofreq.listWaveFrequencies().size(); j++)
+            ckptofreq.setSystem(&sysofreq);
+            int nStored = ckptofreq.open(ckptPath, reportsOnly);
+            if (nStored > 0)
             {
-                //Set the current wave frequency
-                sysofreq.setCurFreqInd(j);
-
-                //Update hydrodynamic forces
-                sysofreq.updateHydroForce();
-
-                //Build the matrix bodies
-                //---------------------------------------------------------------------------
-                //Build operation stuck inside the wave iteration loop because the forces may change with
-                //wave direction.  Also inside the wave frequency loop because the forces may change
-                //with wave frequency.
-
-                //Clear the list of matrix bodies.
-                listMatBody.clear();
+                sysofreq.logStd.Write("Loaded " + ckptofreq.itoa(nStored) + " stored solutions from checkpoint file.",3);
+            }
+        }
 
-                //Resize matrix bodies vector.
-                listMatBody.resize(sysofreq.listBody().size());
+        //Merge the checkpoint files of all shards.  Sorted by name so the merge always runs in the same order.
+        if (mergeShards)
+        {
+            QDir runDir(QString::fromStdString(sysofreq.getPath()));
+            QStringList listShardFiles = runDir.entryList(
+                        QStringList(QString::fromStdString(CKPTFILE + SHARDTAG + "*")), QDir::Files, QDir::Name);
 
-                bool coeffonly = true;              //Boolean to tell the motion model to only use coefficients.
-                //Iterate through each body and build.
-                for (unsigned int i2 = 0; i2 < sysofreq.listBody().size(); i2++)
-                {
-                    //Build the body.
-                    //Will automatically use the correct bodies.
-                    buildMatBody(i2, coeffonly);
-                }
+            for (int k = 0; k < listShardFiles.size(); k++)
+            {
+                string shardPath = runDir.filePath(listShardFiles.at(k)).toStdString();
+                int nMerged = ckptofreq.merge(shardPath);
+                sysofreq.logStd.Write("Merged " + ckptofreq.itoa(nMerged) + " stored solutions from shard file:  " +
+                                      shardPath,3);
+            }
 
+            if (listShardFiles.size() == 0)
+                sysofreq.logStd.Write("No shard checkpoint files found in the run directory.",3);
+        }
 
+        if (reportsOnly && !ckptofreq.isComplete())
+            throw std::runtime_error("Option " + (mergeShards ? ARG_MERGE : ARG_REPORTSONLY) + " requires "
+                                     "checkpoint files that cover every wave direction and wave frequency, and match "
+                                     "the current input files:  " + ckptPath);
 
+        //Clear out any previous output files
+        //Only cleared once the stored solutions are known to be usable, so a failed report-only or merge run leaves
+        //the existing reports in place.  A shard writes no reports, so it leaves the output files of other runs alone.
+        //---------------------------------------------------------------------------
+        if (!shard.isSet())
+            sysofreq.refReportManager().clearFiles();
 
-    //Matrix Solution Section
-    //=================================================================================================================
+        //Size the scan solvers
+        if (useScan)
+        {
+            listScanSolver.assign(sysofreq.listWaveDirections().size(),
+                                  vector<ScanSolver>(sysofreq.listWaveFrequencies().size()));
+        }
 
-                //Create motion solver and feed in the body data.
-                MotionSolver theMotionSolver(listMatBody);
-                //Set the current wave frequency
-                theMotionSolver.setWaveFreq(sysofreq.getCurFreq());
-                //Solve the system of equations.
-                theMotionSolver.calculateOutputs();
+        //Iterate through each wave direction and wave frequency to solve
+        //---------------------------------------------------------------------------
+        //Create an iterator to track the loops.
+        int itertrack = 0;
+        bool solvedLast = false;            //Boolean to record if the final point was solved in this run.
+        int nMixed = 0;                     //Number of points solved in mixed precision.
+        int nFallback = 0;                  //Number of mixed precision points that fell back to double precision.
+        double maxResidual = 0.0;           //Largest backward error of the mixed precision solutions.
+        double maxCondEst = 0.0;            //Largest condition number estimate of the mixed precision solutions.
+        int nFactor = 0;                    //Number of points solved in double precision.
+        int nSymmetric = 0;                 //Number of points that used the symmetric factorization.
 
-                //assign each solution per frequency to a body
-                for(unsigned int k = 0; k < sysofreq.listBody().size(); k++)
-                {
-                    Solution soln;
-                    //soln.refBody() = sysofreq.listBody(k);
-                    soln.setBody(&sysofreq.listBody(k));
-                    soln.setSolnMat(theMotionSolver.listSolution(k));
-                    sysofreq.listSolutionSet().at(k).setSolnMat(i, j, soln);
-                }
+        sysofreq.logStd.Write("Solving equations",3);
+        sysofreq.logStd.Write("=================================================================================",3);
 
-                //Update the iterator
+        //Skip any point that belongs to another shard, or that is already stored in the checkpoint file.
+        //A parametric scan or an adjoint report still needs the global matrices, so those points are solved again.
+        //A shard writes no reports, so it never needs them.
+        auto skipPoint = [&](int i, int j)
+        {
+            if (!shard.contains(i, j, sysofreq.listWaveFrequencies().size()) ||
+                    (ckptofreq.isDone(i, j) && ((!useScan && !sysofreq.getKeepFactor()) || shard.isSet())))
+            {
                 itertrack += 1;
+                solvedLast = false;
+                return true;
+            }
+            return false;
+        };
 
-                //Update the monitor log
-                writeMonitor(i,j,itertrack);
+        //The parametric scan needs the factors of each point.
+        sysofreq.solveSweep(true, useScan, [&](int i, int j, MotionSolver &theMotionSolver)
+        {
+            //Track the accuracy of the mixed precision solutions.
+            bool mixed = sysofreq.getMixedPrecision() && !sysofreq.getKeepFactor() && !useScan;
+            if (mixed)
+            {
+                nMixed += 1;
+                if (theMotionSolver.getMixedFallback())
+                    nFallback += 1;
+                if (theMotionSolver.refMixedSolver().getResidual() > maxResidual)
+                    maxResidual = theMotionSolver.refMixedSolver().getResidual();
+                if (theMotionSolver.refMixedSolver().getCondEst() > maxCondEst)
+                    maxCondEst = theMotionSolver.refMixedSolver().getCondEst();
+            }
 
-                //Write output to standard log
-                string msg;
-                ostringstream convert;
-                msg = "Wave Direction:  ";
-                convert << (i+1);
-                msg += convert.str() + " of ";
-                convert.str("");
-                convert << sysofreq.listWaveDirections().size();
-                msg += convert.str();
-                convert.str("");
-                msg += "\t\tFrequency:  ";
-                convert << (j+1);
-                msg += convert.str() + " of ";
-                convert.str("");
-                convert << sysofreq.listWaveFrequencies().size();
-                msg += convert.str();
-                sysofreq.logStd.Write(msg,3);
-                convert.str("");
+            //Track which double precision solutions used the symmetric factorization.
+            if (!mixed || theMotionSolver.getMixedFallback())
+            {
+                nFactor += 1;
+                if (theMotionSolver.refFactor().isSymmetric())
+                    nSymmetric += 1;
             }
-        }
 
+            //Build the scan solver for this point.
+            if (useScan)
+                buildScanSolver(i, j, theMotionSolver);
 
+            //Store the solution in the checkpoint file.
+            if (!ckptofreq.isDone(i, j))
+                ckptofreq.write(i, j);
+            solvedLast = true;
 
+            //Update the iterator
+            itertrack += 1;
 
-    //Post Processing Section
-    //=================================================================================================================
+            //Update the monitor log
+            writeMonitor(i,j,itertrack);
 
-        //Read in header file for output reports
-        sysofreq.refReportManager().setHeader(
-                    getPath("var")
-                    );
+            //Write output to standard log
+            string msg;
+            ostringstream convert;
+            msg = "Wave Direction:  ";
+            convert << (i+1);
+            msg += convert.str() + " of ";
+            convert.str("");
+            convert << sysofreq.listWaveDirections().size();
+            msg += convert.str();
+            convert.str("");
+            msg += "\t\tFrequency:  ";
+            convert << (j+1);
+            msg += convert.str() + " of ";
+            convert.str("");
+            convert << sysofreq.listWaveFrequencies().size();
+            msg += convert.str();
+            sysofreq.logStd.Write(msg,3);
+            convert.str("");
+        }, skipPoint);
 
 
-        //Write outputs
-        //---------------------------------------------------------------------------
-        //Writes reports for all wave directions and all bodies.
-        sysofreq.refReportManager().writeReport();
 
-        sysofreq.logStd.Write("\n\n\n",3);
-        sysofreq.logStd.Write("=================================================================================",3);
-        sysofreq.logStd.Write("oFreq completed successfully.",3);
-        return 0;
-    }
-    catch(const std::exception &err)
-    {
-        sysofreq.logStd.Notify();
-        return 1;
-        sysofreq.logErr.Write(ID + std::string(err.what()));
-    }
-}
-
-//####################################### buildMatBody Function #######################################################
-void buildMatBody(int bod, bool useCoeff)
-{
-    try
-    {
-        //First assign the basic properties for the matbody.
-        listMatBody.at(bod).setId(bod);
-        Body* MyBod;         //The current body that I am working with
-        MotionModel* MyModel; //The current motion model that I am working with
-
-        MyBod = &(sysofreq.listBody(bod));   //Get the current body to work with.
-        MyModel = &(MyBod->getMotionModel());  //Get the current motion model to work with.
 
-        //Now know the correct motion model to use.
-        //Create initial setup.
-        MyModel->setlistBody(sysofreq.listBody());   //Feed the list of bodies
-        MyModel->setBody(bod);       //Set which body to use as the current body
-        MyModel->setFreq(sysofreq.getCurFreqInd(),
-                         sysofreq.getCurFreq());    //Assign the current frequency and frequency index.
-        MyModel->CoefficientOnly() = useCoeff;  //Let it know to only calculate coefficients.
-        MyModel->Reset();   //Give it a reset just for good measure.
+    //Post Processing Section
+    //=================================================================================================================
 
-        //Iterate through all the active forces, user
-        //------------------------------------------
-        for (unsigned int i = 0; i < MyBod->listForceActive_user().size(); i++)
+        //Summary of the mixed precision solutions.
+        if (nMixed > 0)
         {
-            listMatBody.at(bod).listForceActive_user().push_back(matForceActive());
-            listMatBody.at(bod).listForceActive_user(i).listCoefficient() = MyModel->getMatForceActive_user(i);
-            //Print out active force matrix.  For Debugging.
-            //listMatBody.at(bod).listForceActive_user(i).listCoefficient().print("Active Force: " + i);
-
-            //Create force ID.
-            listMatBody.at(bod).listForceActive_user(i).setId(i);
+            ostringstream summary;
+            summary << "Mixed precision solver:  " << nMixed << " points solved, " << nFallback
+                    << " fell back to double precision.\n"
+                    << "Largest backward error:  " << maxResidual
+                    << "\tLargest condition number estimate:  " << maxCondEst;
+            sysofreq.logStd.Write("\n" + summary.str(),3);
         }
 
-        //Iterate through all the active forces, hydro
-        //------------------------------------------
-        for(unsigned int i = 0; i < MyBod->listForceActive_hydro().size(); i++)
+        //Summary of the symmetric factorizations.
+        if (nFactor > 0)
         {
-            listMatBody.at(bod).listForceActive_hydro().push_back(matForceActive());
-            listMatBody.at(bod).listForceActive_hydro(i).listCoefficient() = MyModel->getMatForceActive_hydro(i);
-            //Print out active force matrix.  For Debugging.
-            //listMatBody.at(bod).listForceActive_hydro(i).listCoefficient().print("Active Force: " + i);
-
-            //Create force ID.
-            listMatBody.at(bod).listForceActive_hydro(i).setId(i);
+            ostringstream summary;
+            summary << "Symmetric factorization:  " << nSymmetric << " of " << nFactor
+                    << " double precision points were complex symmetric.";
+            sysofreq.logStd.Write("\n" + summary.str(),3);
         }
 
-        //Use this pointer for referencing the forces
-        matForceReact* ptForce;
-        ForceReact* ptReact;
-
-        //Iterate through all the reactive forces, user
-        //------------------------------------------
-        for (unsigned int i = 0; i < MyBod->listForceReact_user().size(); i++)
+        //A shard only stores its solutions.  The merge run writes the reports.
+        if (shard.isSet())
         {
-            listMatBody.at(bod).listForceReact_user().push_back(matForceReact());
-            //Create pointer
-            ptForce = &listMatBody.at(bod).listForceReact_user(i);
-
-            //Assign id for force.
-            ptForce->setId(i);
-
-            ptReact = MyBod->listForceReact_user(i);
-
-            //Iterate through each derivative.
-            for (int j = 0; j <= ptReact->getMaxOrd(); j++)
-            {
-                //Check for a zero entry.
-                if (ptReact->listDerivative().size() == 0)
-                    break;
-
-                //Assign matrices
-                ptForce->listDerivative().push_back(MyModel->getMatForceReact_user(i,j));
-
-                //Print out Matrix.  For debugging.
-                //listMatBody.at(bod).listForceReact_user(0).listDerivative(0).print("Reactive Force:  ");
-            }
+            ckptofreq.close();
+            sysofreq.logStd.Write("\n\n\n",3);
+            sysofreq.logStd.Write("=================================================================================",3);
+            sysofreq.logStd.Write("oFreq shard " + shard.getName() + " completed successfully.  Run oFreq with option " +
+                                  ARG_MERGE + " once all shards are complete.",3);
+            return 0;
         }
 
-        //Iterate through all the reactive forces, hydro
-        //------------------------------------------
-        for (unsigned int i = 0; i < MyBod->listForceReact_hydro().size(); i++)
+        //Reports use the hydrodynamic forces left from the final point.  If that point was loaded from the
+        //checkpoint file, update the forces so the reports match a full run.  The motion models only get their list
+        //of bodies from the solver, so feed it here in case no point was solved at all.
+        if (!solvedLast && (sysofreq.listWaveDirections().size() > 0) && (sysofreq.listWaveFrequencies().size() > 0))
         {
-            listMatBody.at(bod).listForceReact_hydro().push_back(matForceReact());
-            //Create pointer
-            ptForce = & listMatBody.at(bod).listForceReact_hydro(i);
-
-            //Assign id for force.
-            ptForce->setId(i);
-
-            ptReact = MyBod->listForceReact_hydro(i);
-
-            //Iterate through each derivative.
-            for (int j = 0; j <= ptReact->getMaxOrd(); j++)
-            {
-                //Check for a zero entry.
-                if (ptReact->listDerivative().size() == 0)
-                    break;
-
-                //Assign matrices
-                ptForce->listDerivative().push_back(MyModel->getMatForceReact_hydro(i,j));
-            }
+            sysofreq.setCurWaveDirInd(sysofreq.listWaveDirections().size() - 1);
+            sysofreq.setCurFreqInd(sysofreq.listWaveFrequencies().size() - 1);
+            sysofreq.updateHydroForce();
+
+            if (!sysofreq.isIndexResolved())
+                sysofreq.resolveIndex();
+            for (unsigned int k = 0; k < sysofreq.listModel().size(); k++)
+                sysofreq.listModel().at(k)->setlistBody(sysofreq.listBody());
         }
+        ckptofreq.close();
 
-        matForceCross* ptForce2;
-        ForceCross* ptCross;
-
-        //Iterate through all the cross body forces, user
-        //------------------------------------------
-        for (unsigned int i = 0; i < MyBod->listForceCross_user().size(); i++)
-        {
-            listMatBody.at(bod).listForceCross_user().push_back(matForceCross());
-            //Create pointer
-            ptForce2 = &listMatBody.at(bod).listForceCross_user(i);
-
-            //Assign id for force.
-            ptForce2->setId(i);
-
-            //Assign cross body
-            for (unsigned int k = 0; k < sysofreq.listBody().size(); k++)
-            {
-                if (&sysofreq.listBody(k) == &(MyBod->listCrossBody_user(i)))
-                {
-                    //Assign cross body
-                    ptForce2->setLinkedBody(&(listMatBody.at(k)));
-                    //Set linked body id.  This should be automatic, but the program produced unreliable results.
-                    ptForce2->setLinkedId(k);
-                    break;
-                }
-            }
+        //Read in header file for output reports
+        sysofreq.refReportManager().setHeader(
+                    getPath("var")
+                    );
 
-            //Assign pointer
-            ptCross = sysofreq.listBody(bod).listForceCross_user(i);
 
-            //Iterate through each derivative.
-            for (int j = 0; j <= ptCross->getMaxOrd(); j++)
-            {
-                //Check for a zero entry.
-                if (ptCross->listDerivative().size() == 0)
-                    continue;
+        //Write outputs
+        //---------------------------------------------------------------------------
+        //Writes reports for all wave directions and all bodies.
+        sysofreq.refReportManager().writeReport();
 
-                //Assign matrices
-                ptForce2->listDerivative().push_back(MyModel->getMatForceCross_user(i,j));
-            }
+        //Writes reports for each parameter set of the parametric scan.
+        //The stored factors only match the baseline solutions, so they are not used for the scan reports.
+        if (useScan)
+        {
+            sysofreq.clearFactor();
+            writeScanReports();
         }
 
-        //Iterate through all the cross body forces, hydro
-        //------------------------------------------
-        for (unsigned int i = 0; i < MyBod->listForceCross_hydro().size(); i++)
+        //Writes the summary statistics of the ensemble study.
+        //The stored factors only match the baseline solutions, so adjoint reports are left out of the statistics.
+        if (useEnsemble)
         {
-            listMatBody.at(bod).listForceCross_hydro().push_back(matForceCross());
-            //Create pointer
-            ptForce2 = &listMatBody.at(bod).listForceCross_hydro(i);
-
-            //Assign id for force.
-            ptForce2->setId(i);
-
-            //Assign cross body
-            for (unsigned int k = 0; k < sysofreq.listBody().size(); k++)
-            {
-                if (&sysofreq.listBody(k) == &(MyBod->listCrossBody_hydro(i)))
-                {
-                    //Assign cross body
-                    ptForce2->setLinkedBody(&(listMatBody.at(k)));
-                    //Set linked body id.  This should be automatic, but the program produced unreliable results.
-                    ptForce2->setLinkedId(k);
-                    break;
-                }
-            }
-
-            //Assign pointer
-            ptCross = sysofreq.listBody(bod).listForceCross_hydro(i);
-
-            //Iterate through each derivative.
-            for (int j = 0; j <= ptCross->getMaxOrd(); j++)
-            {
-                //Check for a zero entry.
-                if (ptCross->listDerivative().size() == 0)
-                    continue;
-
-                //Assign matrices
-                ptForce2->listDerivative().push_back(MyModel->getMatForceCross_hydro(i,j));
-            }
+            sysofreq.clearFactor();
+            runEnsemble();
         }
 
-        //Get the mass matrix
-        //------------------------------------------
-        listMatBody.at(bod).refMass() = MyModel->getMatForceMass();
-        //print out mass matrix.  For debugging.
-        //listMatBody.at(bod).refMass().print("Mass:");
+        sysofreq.logStd.Write("\n\n\n",3);
+        sysofreq.logStd.Write("=================================================================================",3);
+        sysofreq.logStd.Write("oFreq completed successfully.",3);
+        return 0;
     }
     catch(const std::exception &err)
     {
         sysofreq.logStd.Notify();
         sysofreq.logErr.Write(ID + std::string(err.what()));
+        return 1;
     }
 }
 
 //######################################## ReadFiles Function #########################################################
-void ReadFiles(string runPath)
+void ReadFiles(string runPath, bool selective, bool keyCheckpoint)
 {
     //Reads in all the input files
 
@@ -638,7 +819,10 @@ void ReadFiles(string runPath)
         //So far, input files only specified the location of the hydrodynamic data.  Now need to actually  read it.
         HydroReader hydroIn;            //Create hydroreader.
         hydroIn.setSystem( &sysofreq);
+        //The wave directions and wave frequencies are fixed for the run.  Only load the data they need.
+        hydroIn.setSelective(selective);
 
+        vector<string> listHydroFiles;  //Hydro files actually read, for the checkpoint key.
         if (fileIn.listDataFiles().size() > 0)
         {
             for (unsigned int i = 0; i < fileIn.listDataFiles().size(); i++)
@@ -646,6 +830,21 @@ void ReadFiles(string runPath)
                 //Iterate through each of the items on the list of hydro files and read them.
                 hydroIn.setPath(fileIn.listDataFiles(i));           //Set the path to the hydro system.
                 hydroIn.readHydroSys();
+                listHydroFiles.insert(listHydroFiles.end(), hydroIn.listReadFiles().begin(),
+                                      hydroIn.listReadFiles().end());
+            }
+        }
+
+        //Key the checkpoint file to the input files and hydrodynamic data that define the solution.
+        if (keyCheckpoint)
+        {
+            for (unsigned int i = 0; i < fileIn.listInputFiles().size(); i++)
+            {
+                ckptofreq.addInput(fileIn.listInputFiles().at(i));
+            }
+            for (unsigned int i = 0; i < listHydroFiles.size(); i++)
+            {
+                ckptofreq.addData(listHydroFiles.at(i));
             }
         }
     }
@@ -801,3 +1000,574 @@ void writeLogHeader()
     sysofreq.logStd.Write("System Status",3,-1);
     sysofreq.logStd.Write("=================================================================================",3,-1);
 }
+
+//###################################### checkScanForces Function #####################################################
+void checkScanForces()
+{
+    for (unsigned int i = 0; i < sysofreq.listScanForce().size(); i++)
+    {
+        ScanForce &scan = sysofreq.listScanForce(i);
+        bool found = false;
+
+        //Search the user reactive forces.
+        for (unsigned int k = 0; k < sysofreq.listForceReact_user().size(); k++)
+        {
+            if (sysofreq.listForceReact_user(k).getForceName() == scan.getForceName())
+                found = true;
+        }
+
+        //Search the user cross-body forces.
+        for (unsigned int k = 0; k < sysofreq.listForceCross_user().size(); k++)
+        {
+            if (sysofreq.listForceCross_user(k).getForceName() == scan.getForceName())
+                found = true;
+        }
+
+        if (!found)
+            throw std::runtime_error("No user reactive or cross-body force found for parametric scan.  "
+                                     "Offending entry:  " + scan.getForceName());
+
+        if (scan.listFactor().size() == 0)
+            throw std::runtime_error("No factors specified for parametric scan of force:  " + scan.getForceName());
+    }
+}
+
+//###################################### buildScanSolver Function #####################################################
+void buildScanSolver(int dirIn, int freqIn, MotionSolver &solverIn)
+{
+    //Errors are not caught here.  An unfactored scan solver would give wrong scan reports, so the run stops.
+    ScanSolver &scan = listScanSolver.at(dirIn).at(freqIn);
+
+    //Set the baseline system.
+    scan.setBaseline(solverIn.refSolnMat());
+
+    //Collect the contribution of each scanned force.
+    for (unsigned int f = 0; f < sysofreq.listScanForce().size(); f++)
+        scan.addForce(getUserForceMat(sysofreq.listScanForce(f).getForceName(), solverIn));
+
+    //Factor the scan solver.  Reuses the factors of the motion solver.
+    scan.factor(solverIn.refFactor());
+}
+
+//###################################### writeScanReports Function ####################################################
+void writeScanReports()
+{
+    string basePath = sysofreq.getPath();
+    ofreq::oFreqCore convert;
+
+    //Keep the original forces and solutions.
+    vector<ForceReact> backupReact = sysofreq.listForceReact_user();
+    vector<ForceCross> backupCross = sysofreq.listForceCross_user();
+    vector< vector< vector<arma::cx_mat> > > backupSoln(sysofreq.listBody().size());
+    for (unsigned int b = 0; b < sysofreq.listBody().size(); b++)
+    {
+        backupSoln.at(b).resize(sysofreq.listWaveDirections().size());
+        for (unsigned int i = 0; i < sysofreq.listWaveDirections().size(); i++)
+        {
+            for (unsigned int j = 0; j < sysofreq.listWaveFrequencies().size(); j++)
+            {
+                backupSoln.at(b).at(i).push_back(
+                            sysofreq.listSolutionSet(b).refSolution(i, j).getSolnMat());
+            }
+        }
+    }
+
+    int nSets = sysofreq.getNumScanSets();
+
+    sysofreq.logStd.Write("\n\n\n",3);
+    sysofreq.logStd.Write("Parametric Scan",3);
+    sysofreq.logStd.Write("=================================================================================",3);
+
+    for (int s = 0; s < nSets; s++)
+    {
+        try
+        {
+            vector<double> factors = sysofreq.getScanSet(s);
+
+            sysofreq.logStd.Write("Parameter Set:  " + convert.itoa(s + 1) + " of " + convert.itoa(nSets),3);
+
+            //Scale the scanned forces.  Always start from the original forces.
+            for (unsigned int k = 0; k < backupReact.size(); k++)
+            {
+                sysofreq.listForceReact_user(k) = backupReact.at(k);
+                for (unsigned int f = 0; f < factors.size(); f++)
+                {
+                    if (backupReact.at(k).getForceName() == sysofreq.listScanForce(f).getForceName())
+                        sysofreq.listForceReact_user(k).scaleCoefficient(factors.at(f));
+                }
+            }
+            for (unsigned int k = 0; k < backupCross.size(); k++)
+            {
+                sysofreq.listForceCross_user(k) = backupCross.at(k);
+                for (unsigned int f = 0; f < factors.size(); f++)
+                {
+                    if (backupCross.at(k).getForceName() == sysofreq.listScanForce(f).getForceName())
+                        sysofreq.listForceCross_user(k).scaleCoefficient(factors.at(f));
+                }
+            }
+
+            //Update the solutions.
+            for (unsigned int i = 0; i < sysofreq.listWaveDirections().size(); i++)
+            {
+                for (unsigned int j = 0; j < sysofreq.listWaveFrequencies().size(); j++)
+                {
+                    arma::cx_mat soln = listScanSolver.at(i).at(j).getSolution(factors);
+
+                    //Split into the solution for each body.
+                    unsigned int start = 0;
+                    for (unsigned int b = 0; b < sysofreq.listBody().size(); b++)
+                    {
+                        unsigned int nRows = backupSoln.at(b).at(i).at(j).n_rows;
+                        sysofreq.listSolutionSet(b).refSolution(i, j).refSolnMat() =
+                                soln.submat(start, 0, start + nRows - 1, 0);
+                        start += nRows;
+                    }
+                }
+            }
+
+            //Write the reports to the directory for this parameter set.
+            sysofreq.setPath(basePath + seperator + SCANFOLDER + convert.itoa(s + 1));
+            sysofreq.refReportManager().clearFiles();
+            sysofreq.refReportManager().writeReport();
+
+            //Record the factors used for this parameter set.
+            ofstream scanOut((sysofreq.getPath() + seperator + SCANFILE).c_str(), std::ios::out | std::ios::trunc);
+            for (unsigned int f = 0; f < factors.size(); f++)
+            {
+                scanOut << "force \"" << sysofreq.listScanForce(f).getForceName() << "\";  "
+                        << "factor " << convert.ftoa(factors.at(f)) << ";" << endl;
+            }
+            scanOut.close();
+        }
+        catch(const std::exception &err)
+        {
+            sysofreq.logStd.Notify();
+            sysofreq.logErr.Write(ID + std::string(err.what()));
+        }
+    }
+
+    //Restore the original forces, solutions, and path.
+    sysofreq.setPath(basePath);
+    for (unsigned int k = 0; k < backupReact.size(); k++)
+        sysofreq.listForceReact_user(k) = backupReact.at(k);
+    for (unsigned int k = 0; k < backupCross.size(); k++)
+        sysofreq.listForceCross_user(k) = backupCross.at(k);
+    for (unsigned int b = 0; b < sysofreq.listBody().size(); b++)
+    {
+        for (unsigned int i = 0; i < sysofreq.listWaveDirections().size(); i++)
+        {
+            for (unsigned int j = 0; j < sysofreq.listWaveFrequencies().size(); j++)
+            {
+                sysofreq.listSolutionSet(b).refSolution(i, j).refSolnMat() = backupSoln.at(b).at(i).at(j);
+            }
+        }
+    }
+}
+
+//###################################### getUserForceMat Function #####################################################
+arma::cx_mat getUserForceMat(string nameIn, MotionSolver &solverIn)
+{
+    arma::cx_mat forceMat;
+    forceMat.zeros(solverIn.refReactiveMat().n_rows, solverIn.refReactiveMat().n_cols);
+
+    //The same force may be used by more than one body.
+    for (unsigned int b = 0; b < sysofreq.listBody().size(); b++)
+    {
+        Body &bod = sysofreq.listBody(b);
+
+        for (unsigned int k = 0; k < bod.listForceReact_user().size(); k++)
+        {
+            if (bod.listForceReact_user(k)->getForceName() == nameIn)
+                forceMat += solverIn.getForceReact_user(b, k);
+        }
+
+        for (unsigned int k = 0; k < bod.listForceCross_user().size(); k++)
+        {
+            if (bod.listForceCross_user(k)->getForceName() == nameIn)
+                forceMat += solverIn.getForceCross_user(b, k);
+        }
+    }
+
+    return forceMat;
+}
+
+//####################################### checkEnsemble Function ######################################################
+void checkEnsemble()
+{
+    for (unsigned int i = 0; i < sysofreq.listEnsemble().size(); i++)
+    {
+        EnsembleParam &param = sysofreq.listEnsemble(i);
+        bool isBody = !param.getBodyName().empty();
+        bool isForce = !param.getForceName().empty();
+
+        if (isBody == isForce)
+            throw std::runtime_error("Each ensemble parameter must name either a body or a user force.  Offending "
+                                     "entry:  " + sysofreq.itoa(i + 1));
+
+        bool found = false;
+
+        if (isBody)
+        {
+            //Search the bodies.
+            for (unsigned int b = 0; b < sysofreq.listBody().size(); b++)
+            {
+                if (sysofreq.listBody(b).getBodyName() == param.getBodyName())
+                    found = true;
+            }
+
+            if (!found)
+                throw std::runtime_error("No body found for ensemble parameter.  Offending entry:  " +
+                                         param.getBodyName());
+
+            if (param.getProperty() < 0)
+                throw std::runtime_error("No mass property specified for ensemble parameter of body:  " +
+                                         param.getBodyName());
+        }
+        else
+        {
+            //Search the user reactive forces.
+            for (unsigned int k = 0; k < sysofreq.listForceReact_user().size(); k++)
+            {
+                if (sysofreq.listForceReact_user(k).getForceName() == param.getForceName())
+                    found = true;
+            }
+
+            //Search the user cross-body forces.
+            for (unsigned int k = 0; k < sysofreq.listForceCross_user().size(); k++)
+            {
+                if (sysofreq.listForceCross_user(k).getForceName() == param.getForceName())
+                    found = true;
+            }
+
+            if (!found)
+                throw std::runtime_error("No user reactive or cross-body force found for ensemble parameter.  "
+                                         "Offending entry:  " + param.getForceName());
+        }
+    }
+
+    if ((sysofreq.listEnsemble().size() > 0) && (sysofreq.getEnsembleSize() <= 0))
+        throw std::runtime_error("No samples specified for the ensemble study.  Set the number of samples, or give a "
+                                 "sample table.");
+}
+
+//######################################## runEnsemble Function #######################################################
+void runEnsemble()
+{
+    string basePath = sysofreq.getPath();
+    ofreq::oFreqCore convert;
+    ReportManager &manager = sysofreq.refReportManager();
+    vector<EnsembleParam> &listParam = sysofreq.listEnsemble();
+
+    unsigned int nBody = sysofreq.listBody().size();
+    unsigned int nDir = sysofreq.listWaveDirections().size();
+    unsigned int nFreq = sysofreq.listWaveFrequencies().size();
+
+    sysofreq.logStd.Write("\n\n\n",3);
+    sysofreq.logStd.Write("Ensemble",3);
+    sysofreq.logStd.Write("=================================================================================",3);
+
+    //Draw the samples.  One row for each parameter, one column for each sample.
+    arma::mat samples = sysofreq.drawEnsemble();
+    int nSample = samples.n_cols;
+
+    //Sort the parameters into user forces and body mass properties.
+    //---------------------------------------------------------------------------
+    vector<string> listForceName;           //Names of the varied user forces.
+    vector<int> listParamForce;             //For each parameter, the index in listForceName.  -1 for a body.
+    vector<int> listParamBody;              //For each parameter, the index of the body.  -1 for a force.
+    vector<bool> listVaryBody(nBody, false); //True for each body with a varied mass property.
+
+    for (unsigned int p = 0; p < listParam.size(); p++)
+    {
+        int force = -1;
+        int bod = -1;
+
+        if (listParam.at(p).getForceName().empty())
+        {
+            for (unsigned int b = 0; (bod < 0) && (b < nBody); b++)
+            {
+                if (sysofreq.listBody(b).getBodyName() == listParam.at(p).getBodyName())
+                    bod = b;
+            }
+            listVaryBody.at(bod) = true;
+        }
+        else
+        {
+            for (unsigned int f = 0; (force < 0) && (f < listForceName.size()); f++)
+            {
+                if (listForceName.at(f) == listParam.at(p).getForceName())
+                    force = f;
+            }
+            if (force < 0)
+            {
+                force = listForceName.size();
+                listForceName.push_back(listParam.at(p).getForceName());
+            }
+        }
+
+        listParamForce.push_back(force);
+        listParamBody.push_back(bod);
+    }
+
+    //The factor on each varied force.  A force listed more than once gets the product of its factors.
+    arma::mat factors(listForceName.size(), nSample);
+    factors.fill(1.0);
+    for (unsigned int p = 0; p < listParam.size(); p++)
+    {
+        if (listParamForce.at(p) >= 0)
+            factors.row(listParamForce.at(p)) %= samples.row(p);
+    }
+
+    //Keep the original forces, mass properties, and solutions.
+    //---------------------------------------------------------------------------
+    vector<ForceReact> backupReact = sysofreq.listForceReact_user();
+    vector<ForceCross> backupCross = sysofreq.listForceCross_user();
+    vector<double> backupValue(listParam.size(), 0.0);
+    for (unsigned int p = 0; p < listParam.size(); p++)
+    {
+        if (listParamBody.at(p) >= 0)
+            backupValue.at(p) = listParam.at(p).getBodyValue(sysofreq.listBody(listParamBody.at(p)));
+    }
+    vector< vector< vector<arma::cx_mat> > > backupSoln(nBody);
+    for (unsigned int b = 0; b < nBody; b++)
+    {
+        backupSoln.at(b).resize(nDir);
+        for (unsigned int i = 0; i < nDir; i++)
+        {
+            for (unsigned int j = 0; j < nFreq; j++)
+            {
+                backupSoln.at(b).at(i).push_back(
+                            sysofreq.listSolutionSet(b).refSolution(i, j).getSolnMat());
+            }
+        }
+    }
+
+    //Change in the global mass matrix for each sample.  The mass does not depend on wave frequency, so this is only
+    //done once.
+    //---------------------------------------------------------------------------
+    vector<arma::mat> listMass;
+    if (find(listVaryBody.begin(), listVaryBody.end(), true) != listVaryBody.end())
+    {
+        MatBodyBuilder builder;
+        builder.setSystem(&sysofreq);
+
+        vector<arma::cx_mat> listBaseMass(nBody);
+        vector<int> listStart(nBody, 0);
+        int nTotal = 0;
+        for (unsigned int b = 0; b < nBody; b++)
+        {
+            listBaseMass.at(b) = builder.buildMass(b);
+            listStart.at(b) = nTotal;
+            nTotal += listBaseMass.at(b).n_rows;
+        }
+
+        for (int s = 0; s < nSample; s++)
+        {
+            for (unsigned int p = 0; p < listParam.size(); p++)
+            {
+                if (listParamBody.at(p) >= 0)
+                    listParam.at(p).setBodyValue(sysofreq.listBody(listParamBody.at(p)), samples(p, s));
+            }
+
+            arma::mat dMass;
+            dMass.zeros(nTotal, nTotal);
+            for (unsigned int b = 0; b < nBody; b++)
+            {
+                if (!listVaryBody.at(b) || (listBaseMass.at(b).n_rows == 0))
+                    continue;
+
+                dMass.submat(listStart.at(b), listStart.at(b),
+                             listStart.at(b) + listBaseMass.at(b).n_rows - 1,
+                             listStart.at(b) + listBaseMass.at(b).n_rows - 1) =
+                        arma::real(builder.buildMass(b) - listBaseMass.at(b));
+            }
+            listMass.push_back(dMass);
+
+            //Restore in reverse, so the original value is set last if a property is listed twice.
+            for (int p = listParam.size() - 1; p >= 0; p--)
+            {
+                if (listParamBody.at(p) >= 0)
+                    listParam.at(p).setBodyValue(sysofreq.listBody(listParamBody.at(p)), backupValue.at(p));
+            }
+        }
+    }
+
+    //Reports for the statistics.  Adjoint reports need the LU factors of each sample, which are not kept.
+    //---------------------------------------------------------------------------
+    vector<Report *> listCalc;
+    repPowerGradient tempGrad;
+    for (unsigned int r = 0; r < manager.listReport().size(); r++)
+    {
+        if (manager.listReportPt(r)->getClass() != tempGrad.getClass())
+            listCalc.push_back(manager.listReportPt(r));
+    }
+
+    //Clear the statistics directories and write the wave directions and wave frequencies into each.
+    for (int k = 0; k < 4; k++)
+    {
+        sysofreq.setPath(basePath + seperator + ENSFOLDER + seperator + ENSSTAT[k]);
+        QDir().mkpath(QString::fromStdString(sysofreq.getPath()));
+        manager.clearFiles();
+
+        repDirections repDir(&manager);
+        manager.writeReport(0, &repDir);
+        repFrequencies repFreq(&manager);
+        manager.writeReport(0, &repFreq);
+    }
+    sysofreq.setPath(basePath);
+
+    //Solve the samples and gather the statistics, one wave direction at a time.
+    //---------------------------------------------------------------------------
+    EnsembleStats stats;
+    int nSingular = 0;              //Number of samples with a singular system at any point.
+    vector<bool> listSingular(nSample, false);  //Whether each sample was singular in any wave direction.
+
+    for (unsigned int i = 0; i < nDir; i++)
+    {
+        try
+        {
+            sysofreq.setCurWaveDirInd(i);
+
+            //Baseline system for each wave frequency.
+            vector<EnsembleSolver> listSolver(nFreq);
+            sysofreq.solveSweep(false, false, [&](int, int j, MotionSolver &theMotionSolver)
+            {
+                listSolver.at(j).setBaseline(theMotionSolver.refReactiveMat(), theMotionSolver.refActiveMat(),
+                                             sysofreq.getCurFreq());
+                for (unsigned int f = 0; f < listForceName.size(); f++)
+                    listSolver.at(j).addForce(getUserForceMat(listForceName.at(f), theMotionSolver));
+            }, [&](int d, int) { return d != static_cast<int>(i); });
+
+            //Reports use the hydrodynamic forces left from the final point, the same as the baseline reports.
+            sysofreq.setCurWaveDirInd(nDir - 1);
+            sysofreq.setCurFreqInd(nFreq - 1);
+            sysofreq.updateHydroForce();
+
+            stats.clear();
+
+            for (int first = 0; first < nSample; first += EnsembleSolver::BATCH)
+            {
+                int count = min(EnsembleSolver::BATCH, nSample - first);
+
+                //Solve the whole batch for each wave frequency.
+                for (unsigned int j = 0; j < nFreq; j++)
+                    listSolver.at(j).solve(factors, listMass, first, count);
+
+                for (int k = 0; k < count; k++)
+                {
+                    int s = first + k;
+
+                    //Apply the sample to the forces and bodies, so the reports see it.
+                    for (unsigned int m = 0; m < backupReact.size(); m++)
+                    {
+                        sysofreq.listForceReact_user(m) = backupReact.at(m);
+                        for (unsigned int f = 0; f < listForceName.size(); f++)
+                        {
+                            if (backupReact.at(m).getForceName() == listForceName.at(f))
+                                sysofreq.listForceReact_user(m).scaleCoefficient(factors(f, s));
+                        }
+                    }
+                    for (unsigned int m = 0; m < backupCross.size(); m++)
+                    {
+                        sysofreq.listForceCross_user(m) = backupCross.at(m);
+                        for (unsigned int f = 0; f < listForceName.size(); f++)
+                        {
+                            if (backupCross.at(m).getForceName() == listForceName.at(f))
+                                sysofreq.listForceCross_user(m).scaleCoefficient(factors(f, s));
+                        }
+                    }
+                    for (unsigned int p = 0; p < listParam.size(); p++)
+                    {
+                        if (listParamBody.at(p) >= 0)
+                            listParam.at(p).setBodyValue(sysofreq.listBody(listParamBody.at(p)), samples(p, s));
+                    }
+
+                    //Split the solutions into each body.
+                    bool singular = false;
+                    for (unsigned int j = 0; j < nFreq; j++)
+                    {
+                        arma::cx_mat soln = listSolver.at(j).getSolution(k);
+                        if (!soln.is_finite())
+                            singular = true;
+
+                        unsigned int start = 0;
+                        for (unsigned int b = 0; b < nBody; b++)
+                        {
+                            unsigned int nRows = backupSoln.at(b).at(i).at(j).n_rows;
+                            sysofreq.listSolutionSet(b).refSolution(i, j).refSolnMat() =
+                                    soln.submat(start, 0, start + nRows - 1, 0);
+                            start += nRows;
+                        }
+                    }
+
+                    //A singular sample has no meaningful response.  Leave it out of the statistics.
+                    if (singular)
+                    {
+                        if (!listSingular.at(s))
+                            nSingular += 1;
+                        listSingular.at(s) = true;
+                        continue;
+                    }
+
+                    //Calculate the reports in memory and add them to the statistics.
+                    manager.clearCache();
+                    for (unsigned int r = 0; r < listCalc.size(); r++)
+                    {
+                        listCalc.at(r)->clearData();
+                        manager.calcReport(i, listCalc.at(r));
+                    }
+                    stats.addSample(listCalc);
+                }
+            }
+
+            //Write the statistics for this wave direction.
+            for (int k = 0; k < 4; k++)
+            {
+                sysofreq.setPath(basePath + seperator + ENSFOLDER + seperator + ENSSTAT[k]);
+                for (unsigned int r = 0; r < listCalc.size(); r++)
+                {
+                    stats.fillReport(r, listCalc.at(r), k);
+                    manager.writeStored(i, listCalc.at(r));
+                }
+            }
+            sysofreq.setPath(basePath);
+
+            sysofreq.logStd.Write("Wave Direction:  " + convert.itoa(i + 1) + " of " + convert.itoa(nDir) +
+                                  "\t\tSamples:  " + convert.itoa(stats.getCount()),3);
+        }
+        catch(const std::exception &err)
+        {
+            sysofreq.setPath(basePath);
+            sysofreq.logStd.Notify();
+            sysofreq.logErr.Write(ID + std::string(err.what()));
+        }
+    }
+
+    sysofreq.logStd.Write("Ensemble of " + convert.itoa(nSample) + " samples solved in batches of " +
+                          convert.itoa(EnsembleSolver::BATCH) + ".  " + convert.itoa(nSingular) +
+                          " samples were singular in at least one wave direction and left out of the statistics there.",3);
+
+    //Restore the original forces, mass properties, solutions, and path.
+    //---------------------------------------------------------------------------
+    sysofreq.setPath(basePath);
+    for (unsigned int k = 0; k < backupReact.size(); k++)
+        sysofreq.listForceReact_user(k) = backupReact.at(k);
+    for (unsigned int k = 0; k < backupCross.size(); k++)
+        sysofreq.listForceCross_user(k) = backupCross.at(k);
+    for (int p = listParam.size() - 1; p >= 0; p--)
+    {
+        if (listParamBody.at(p) >= 0)
+            listParam.at(p).setBodyValue(sysofreq.listBody(listParamBody.at(p)), backupValue.at(p));
+    }
+    for (unsigned int b = 0; b < nBody; b++)
+    {
+        for (unsigned int i = 0; i < nDir; i++)
+        {
+            for (unsigned int j = 0; j < nFreq; j++)
+            {
+                sysofreq.listSolutionSet(b).refSolution(i, j).refSolnMat() = backupSoln.at(b).at(i).at(j);
+            }
+        }
+    }
+    manager.clearReports();
+}
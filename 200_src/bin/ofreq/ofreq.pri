@@ -0,0 +1,220 @@
+#-------------------------------------------------
+#
+# Source files shared by every program built on the ofreq solver.
+# Included by ofreq.pro and the other programs built on the solver.
+#
+#-------------------------------------------------
+
+SOURCES += \
+    $$PWD/motion_solver/motionsolver.cpp \
+    $$PWD/motion_solver/matbody.cpp \
+    $$PWD/motion_model/equationofmotion.cpp \
+    $$PWD/motion_model/motionmodel.cpp \
+    $$PWD/global_objects/solution.cpp \
+    $$PWD/file_reader/filereader.cpp \
+    $$PWD/file_reader/parser.cpp \
+    $$PWD/file_reader/objectgroup.cpp \
+    $$PWD/file_reader/dictionary.cpp \
+    $$PWD/file_reader/dictcontrol.cpp \
+    $$PWD/file_reader/dictforces.cpp \
+    $$PWD/file_reader/dictbodies.cpp \
+    $$PWD/global_objects/solutionset.cpp \
+    $$PWD/motion_solver/matforcecross.cpp \
+    $$PWD/motion_solver/matforceactive.cpp \
+    $$PWD/motion_solver/matforcereact.cpp \
+    $$PWD/global_objects/forcereact.cpp \
+    $$PWD/global_objects/forcecross.cpp \
+    $$PWD/global_objects/forceactive.cpp \
+    $$PWD/global_objects/force.cpp \
+    $$PWD/global_objects/equation.cpp \
+    $$PWD/global_objects/derivative.cpp \
+    $$PWD/global_objects/body.cpp \
+    $$PWD/motion_model/eqntranslation.cpp \
+    $$PWD/motion_model/eqnrotation.cpp \
+    $$PWD/motion_model/model6dof.cpp \
+    $$PWD/system_objects/system.cpp \
+    $$PWD/system_objects/log.cpp \
+    $$PWD/system_objects/ofreqcore.cpp \
+    $$PWD/global_objects/ioword.cpp \
+    $$PWD/wave_spectra/wavespec.cpp \
+    $$PWD/sea_models/seamodel.cpp \
+    $$PWD/wave_spectra/specpm.cpp \
+    $$PWD/wave_spectra/wavespecbase.cpp \
+    $$PWD/wave_spectra/specbretschneider.cpp \
+    $$PWD/wave_spectra/specjonswap.cpp \
+    $$PWD/sea_models/seamodel_singledirection.cpp \
+    $$PWD/sea_models/seamodel_dualdirection.cpp \
+    $$PWD/file_reader/dictseaenv.cpp \
+    $$PWD/sea_models/seamodel_longcrest.cpp \
+    $$PWD/sea_models/seamodel_uniform.cpp \
+    $$PWD/sea_models/seamodel_spreading.cpp \
+    $$PWD/hydro_data/hydrodata.cpp \
+    $$PWD/global_objects/mathinterp.cpp \
+    $$PWD/hydro_reader/hydroreader.cpp \
+    $$PWD/hydro_reader/hydroimport.cpp \
+    $$PWD/hydro_data/hydromanager.cpp \
+    $$PWD/hydro_data/farfield.cpp \
+    $$PWD/hydro_reader/dicthydrodirection.cpp \
+    $$PWD/hydro_reader/dicthydroenv.cpp \
+    $$PWD/hydro_reader/dicthydrofrequency.cpp \
+    $$PWD/hydro_reader/dictcrossdamp.cpp \
+    $$PWD/hydro_reader/dictcrossmass.cpp \
+    $$PWD/hydro_reader/dictcrossstiff.cpp \
+    $$PWD/hydro_reader/dictforceexcite.cpp \
+    $$PWD/hydro_reader/dicthydrodamp.cpp \
+    $$PWD/hydro_reader/dicthydromass.cpp \
+    $$PWD/hydro_reader/dicthydrostiff.cpp \
+    $$PWD/hydro_reader/dicthydroreact.cpp \
+    $$PWD/hydro_reader/dictcrossreact.cpp \
+    $$PWD/file_reader/dictdata.cpp \
+    $$PWD/reports/data.cpp \
+    $$PWD/reports/report.cpp \
+    $$PWD/reports/reportmanager.cpp \
+    $$PWD/reports/reportwriter.cpp \
+    $$PWD/reports/repdirections.cpp \
+    $$PWD/reports/repfrequencies.cpp \
+    $$PWD/file_reader/dictoutputs.cpp \
+    $$PWD/reports/replocalsolution.cpp \
+    $$PWD/reports/replocalacceleration.cpp \
+    $$PWD/reports/repwavespectra.cpp \
+    $$PWD/reports/repstaticbodyaccel.cpp \
+    $$PWD/reports/repdesignaccel.cpp \
+    $$PWD/reports/repdynfreeboard.cpp \
+    $$PWD/reports/repbodforces.cpp \
+    $$PWD/reports/repbodpower.cpp \
+    $$PWD/reports/repcapturewidth.cpp \
+    $$PWD/reports/repreleff.cpp \
+    $$PWD/reports/repabseff.cpp \
+    $$PWD/reports/repglobsolution.cpp \
+    $$PWD/reports/repglobacceleration.cpp \
+    $$PWD/reports/repglobmotion.cpp \
+    $$PWD/reports/repglobvelocity.cpp \
+    $$PWD/reports/repbodsolution.cpp \
+    $$PWD/reports/repbodmotion.cpp \
+    $$PWD/reports/repbodvelocity.cpp \
+    $$PWD/reports/repbodacceleration.cpp \
+    $$PWD/system_objects/checkpoint.cpp \
+    $$PWD/global_objects/scanforce.cpp \
+    $$PWD/global_objects/forcedrag.cpp \
+    $$PWD/motion_solver/scansolver.cpp \
+    $$PWD/global_objects/ensembleparam.cpp \
+    $$PWD/motion_solver/ensemblesolver.cpp \
+    $$PWD/reports/ensemblestats.cpp \
+    $$PWD/motion_solver/lufactor.cpp \
+    $$PWD/motion_solver/mixedsolver.cpp \
+    $$PWD/motion_solver/dragsolver.cpp \
+    $$PWD/reports/reppowergradient.cpp \
+    $$PWD/reports/timesynth.cpp \
+    $$PWD/reports/reptimehistory.cpp \
+    $$PWD/motion_solver/matbodybuilder.cpp \
+    $$PWD/system_objects/ofreqengine.cpp
+
+HEADERS += \
+    $$PWD/motion_solver/motionsolver.h \
+    $$PWD/motion_solver/matbody.h \
+    $$PWD/motion_model/equationofmotion.h \
+    $$PWD/motion_model/motionmodel.h \
+    $$PWD/global_objects/solution.h \
+    $$PWD/file_reader/filereader.h \
+    $$PWD/file_reader/parser.h \
+    $$PWD/file_reader/objectgroup.h \
+    $$PWD/file_reader/dictionary.h \
+    $$PWD/file_reader/dictcontrol.h \
+    $$PWD/file_reader/dictforces.h \
+    $$PWD/file_reader/dictbodies.h \
+    $$PWD/global_objects/solutionset.h \
+    $$PWD/motion_solver/matforcecross.h \
+    $$PWD/motion_solver/matforceactive.h \
+    $$PWD/motion_solver/matforcereact.h \
+    $$PWD/global_objects/forcereact.h \
+    $$PWD/global_objects/forcecross.h \
+    $$PWD/global_objects/forceactive.h \
+    $$PWD/global_objects/force.h \
+    $$PWD/global_objects/equation.h \
+    $$PWD/global_objects/derivative.h \
+    $$PWD/global_objects/body.h \
+    $$PWD/motion_model/eqntranslation.h \
+    $$PWD/motion_model/eqnrotation.h \
+    $$PWD/motion_model/model6dof.h \
+    $$PWD/system_objects/system.h \
+    $$PWD/system_objects/log.h \
+    $$PWD/system_objects/ofreqcore.h \
+    $$PWD/global_objects/ioword.h \
+    $$PWD/wave_spectra/wavespec.h \
+    $$PWD/sea_models/seamodel.h \
+    $$PWD/wave_spectra/specpm.h \
+    $$PWD/wave_spectra/wavespecbase.h \
+    $$PWD/wave_spectra/specbretschneider.h \
+    $$PWD/wave_spectra/specjonswap.h \
+    $$PWD/sea_models/seamodel_singledirection.h \
+    $$PWD/sea_models/seamodel_dualdirection.h \
+    $$PWD/file_reader/dictseaenv.h \
+    $$PWD/sea_models/seamodel_longcrest.h \
+    $$PWD/sea_models/seamodel_uniform.h \
+    $$PWD/sea_models/seamodel_spreading.h \
+    $$PWD/hydro_data/hydrodata.h \
+    $$PWD/global_objects/mathinterp.h \
+    $$PWD/hydro_reader/hydroreader.h \
+    $$PWD/hydro_reader/hydroimport.h \
+    $$PWD/hydro_data/hydromanager.h \
+    $$PWD/hydro_data/farfield.h \
+    $$PWD/hydro_reader/dicthydrodirection.h \
+    $$PWD/hydro_reader/dicthydroenv.h \
+    $$PWD/hydro_reader/dicthydrofrequency.h \
+    $$PWD/hydro_reader/dictcrossdamp.h \
+    $$PWD/hydro_reader/dictcrossmass.h \
+    $$PWD/hydro_reader/dictcrossstiff.h \
+    $$PWD/hydro_reader/dictforceexcite.h \
+    $$PWD/hydro_reader/dicthydrodamp.h \
+    $$PWD/hydro_reader/dicthydromass.h \
+    $$PWD/hydro_reader/dicthydrostiff.h \
+    $$PWD/hydro_reader/dicthydroreact.h \
+    $$PWD/hydro_reader/dictcrossreact.h \
+    $$PWD/file_reader/dictdata.h \
+    $$PWD/reports/data.h \
+    $$PWD/reports/report.h \
+    $$PWD/reports/reportmanager.h \
+    $$PWD/reports/reportwriter.h \
+    $$PWD/reports/repdirections.h \
+    $$PWD/reports/repfrequencies.h \
+    $$PWD/file_reader/dictoutputs.h \
+    $$PWD/reports/replocalsolution.h \
+    $$PWD/reports/replocalacceleration.h \
+    $$PWD/reports/repwavespectra.h \
+    $$PWD/reports/repstaticbodyaccel.h \
+    $$PWD/reports/repdesignaccel.h \
+    $$PWD/reports/repdynfreeboard.h \
+    $$PWD/reports/repbodforces.h \
+    $$PWD/reports/repbodpower.h \
+    $$PWD/reports/repcapturewidth.h \
+    $$PWD/reports/repreleff.h \
+    $$PWD/reports/repabseff.h \
+    $$PWD/reports/repglobacceleration.h \
+    $$PWD/reports/repglobmotion.h \
+    $$PWD/reports/repglobsolution.h \
+    $$PWD/reports/repglobvelocity.h \
+    $$PWD/reports/repbodsolution.h \
+    $$PWD/reports/repbodmotion.h \
+    $$PWD/reports/repbodvelocity.h \
+    $$PWD/reports/repbodacceleration.h \
+    $$PWD/system_objects/checkpoint.h \
+    $$PWD/global_objects/scanforce.h \
+    $$PWD/global_objects/forcedrag.h \
+    $$PWD/motion_solver/scansolver.h \
+    $$PWD/global_objects/ensembleparam.h \
+    $$PWD/motion_solver/ensemblesolver.h \
+    $$PWD/reports/ensemblestats.h \
+    $$PWD/motion_solver/lufactor.h \
+    $$PWD/motion_solver/mixedsolver.h \
+    $$PWD/motion_solver/dragsolver.h \
+    $$PWD/reports/reppowergradient.h \
+    $$PWD/reports/timesynth.h \
+    $$PWD/reports/reptimehistory.h \
+    $$PWD/motion_solver/matbodybuilder.h \
+    $$PWD/system_objects/ofreqengine.h
+
+# Time history synthesis runs seeds on several threads.
+unix {
+    QMAKE_CXXFLAGS += -pthread
+    LIBS += -pthread
+}
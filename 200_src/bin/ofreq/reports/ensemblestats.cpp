@@ -0,0 +1,217 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "ensemblestats.h"
+#include <cmath>
+#include <complex>
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleStats::EnsembleStats()
+{
+    pCount = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+EnsembleStats::~EnsembleStats()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleStats::clear()
+{
+    plistShapeData.clear();
+    plistShapeRAO.clear();
+    plistMean.clear();
+    plistM2.clear();
+    plistMin.clear();
+    plistMax.clear();
+    pCount = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleStats::addSample(vector<Report *> &listIn)
+{
+    //The first sample sets the layout.
+    if (pCount == 0)
+    {
+        clear();
+
+        for (unsigned int r = 0; r < listIn.size(); r++)
+        {
+            plistShapeData.push_back(listIn.at(r)->listData());
+            plistShapeRAO.push_back(listIn.at(r)->listRAO());
+
+            int nVal = 0;
+            for (unsigned int d = 0; d < listIn.at(r)->listData().size(); d++)
+                nVal += listIn.at(r)->listData(d).listValue().size();
+            for (unsigned int d = 0; d < listIn.at(r)->listRAO().size(); d++)
+                nVal += listIn.at(r)->listRAO(d).listValue().size();
+
+            plistMean.push_back(vector<double>(nVal, 0.0));
+            plistM2.push_back(vector<double>(nVal, 0.0));
+            plistMin.push_back(vector<double>(nVal, HUGE_VAL));
+            plistMax.push_back(vector<double>(nVal, -HUGE_VAL));
+        }
+    }
+
+    if (listIn.size() != plistMean.size())
+        throw std::runtime_error("Ensemble sample has a different number of reports than the first sample.");
+
+    pCount += 1;
+
+    for (unsigned int r = 0; r < listIn.size(); r++)
+    {
+        int start = 0;
+        addData(listIn.at(r)->listData(), r, start);
+        addData(listIn.at(r)->listRAO(), r, start);
+
+        if (start != static_cast<int>(plistMean.at(r).size()))
+            throw std::runtime_error("Ensemble sample has a different number of values than the first sample.  "
+                                     "Report name:  " + listIn.at(r)->getName());
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleStats::fillReport(int indexIn, Report *ReportIn, int statIn)
+{
+    ReportIn->clearData();
+
+    if ((indexIn < 0) || (indexIn >= static_cast<int>(plistMean.size())))
+        return;
+
+    int start = 0;
+    ReportIn->listData() = getData(plistShapeData.at(indexIn), indexIn, statIn, start);
+    ReportIn->listRAO() = getData(plistShapeRAO.at(indexIn), indexIn, statIn, start);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int EnsembleStats::getCount()
+{
+    return pCount;
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void EnsembleStats::addData(vector<Data> &listIn, int indexIn, int &startIn)
+{
+    vector<double> &mean = plistMean.at(indexIn);
+    vector<double> &m2 = plistM2.at(indexIn);
+    vector<double> &low = plistMin.at(indexIn);
+    vector<double> &high = plistMax.at(indexIn);
+
+    for (unsigned int d = 0; d < listIn.size(); d++)
+    {
+        Data &dat = listIn.at(d);
+
+        for (unsigned int j = 0; j < dat.listValue().size(); j++)
+        {
+            if (startIn >= static_cast<int>(mean.size()))
+            {
+                startIn += 1;
+                continue;
+            }
+
+            //Complex values use the magnitude.
+            double val;
+            if (dat.getDataType() == 0)
+                val = abs(dat.listValue(j));
+            else
+                val = dat.listValue(j).real();
+
+            //Welford's update.
+            double delta = val - mean.at(startIn);
+            mean.at(startIn) += delta / pCount;
+            m2.at(startIn) += delta * (val - mean.at(startIn));
+
+            if (val < low.at(startIn))
+                low.at(startIn) = val;
+            if (val > high.at(startIn))
+                high.at(startIn) = val;
+
+            startIn += 1;
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<Data> EnsembleStats::getData(vector<Data> &listIn, int indexIn, int statIn, int &startIn)
+{
+    vector<Data> output;
+
+    for (unsigned int d = 0; d < listIn.size(); d++)
+    {
+        Data dat(listIn.at(d).getIndex());
+
+        //String values have no statistics.  Keep them from the first sample.
+        if (listIn.at(d).getDataType() == 3)
+        {
+            for (unsigned int j = 0; j < listIn.at(d).listString().size(); j++)
+                dat.addString(listIn.at(d).listString(j));
+        }
+
+        for (unsigned int j = 0; j < listIn.at(d).listValue().size(); j++)
+        {
+            double val;
+
+            if (statIn == 0)
+                val = plistMean.at(indexIn).at(startIn);
+            else if (statIn == 1)
+                val = (pCount > 1) ? sqrt(plistM2.at(indexIn).at(startIn) / (pCount - 1)) : 0.0;
+            else if (statIn == 2)
+                val = plistMin.at(indexIn).at(startIn);
+            else
+                val = plistMax.at(indexIn).at(startIn);
+
+            dat.addValue(val);
+            startIn += 1;
+        }
+
+        output.push_back(dat);
+    }
+
+    return output;
+}
@@ -0,0 +1,196 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+//Include statements and headers
+#ifndef ENSEMBLESTATS_H
+#define ENSEMBLESTATS_H
+#include <vector>
+#include "../system_objects/ofreqcore.h"
+#include "report.h"
+#include "data.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * @brief Summary statistics of the report results across the samples of an ensemble.
+ *
+ * An ensemble study may run thousands of samples.  Writing the reports for each sample would produce thousands of
+ * output files that the user then has to reduce.  Instead, the reports for each sample are calculated in memory, and
+ * the EnsembleStats object adds each value to running statistics with Welford's method.  Only the statistics get
+ * written.  The object holds the statistics for a single wave direction, the same as the reports themselves.
+ *
+ * Complex values are reduced to their magnitude before the statistics are taken.  The phase of a response is not
+ * meaningful across samples with different natural frequencies.  Double and integer values are used as they are.
+ * String values are copied from the first sample.
+ *
+ * Statistics are identified by an integer:
+ * 0 = Mean.
+ * 1 = Standard deviation.  Uses the sample variance, with n - 1 in the denominator.
+ * 2 = Minimum.
+ * 3 = Maximum.
+ */
+class EnsembleStats : public ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    EnsembleStats();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~EnsembleStats();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears all statistics.  Use before starting a new wave direction.
+     */
+    void clear();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the results of one sample to the statistics.
+     *
+     * The first sample sets the layout of the results.  Every later sample must produce the same number of values
+     * for each report.
+     * @param listIn The list of reports, after calculating the results for the sample.  Variable passed by
+     * reference.
+     */
+    void addSample(std::vector<ofreq::Report *> &listIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Replaces the data of a report with one of the statistics.  The report can then be written as usual.
+     * @param indexIn Integer.  The index of the report in the list supplied to addSample().  Variable passed by
+     * value.
+     * @param ReportIn Pointer to the report to fill.  Pointer passed by value.
+     * @param statIn Integer.  Which statistic to use.  See the class description.  Variable passed by value.
+     */
+    void fillReport(int indexIn, ofreq::Report *ReportIn, int statIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of samples added since the statistics were cleared.
+     * @return Integer.  The number of samples.  Returned variable passed by value.
+     */
+    int getCount();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the values from a list of data objects to the statistics of one report.
+     * @param listIn The list of data objects from the report.  Variable passed by reference.
+     * @param indexIn Integer.  The index of the report.  Variable passed by value.
+     * @param startIn Integer.  The position of the first value in the statistics of the report.  Updated to the
+     * position after the last value.  Variable passed by reference.
+     */
+    void addData(std::vector<ofreq::Data> &listIn, int indexIn, int &startIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds a list of data objects from the statistics of one report.
+     * @param listIn The layout of the data objects, from the first sample.  Variable passed by reference.
+     * @param indexIn Integer.  The index of the report.  Variable passed by value.
+     * @param statIn Integer.  Which statistic to use.  Variable passed by value.
+     * @param startIn Integer.  The position of the first value in the statistics of the report.  Updated to the
+     * position after the last value.  Variable passed by reference.
+     * @return Vector of data objects.  Returned variable passed by value.
+     */
+    std::vector<ofreq::Data> getData(std::vector<ofreq::Data> &listIn, int indexIn, int statIn, int &startIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Layout of the results of each report, taken from the first sample.  One entry for each report.
+     */
+    std::vector< std::vector<ofreq::Data> > plistShapeData;
+    std::vector< std::vector<ofreq::Data> > plistShapeRAO;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Running statistics for each report.  One entry for each report.  Each entry holds the values of all the
+     * data objects in sequence, followed by the values of all the RAO data objects.
+     */
+    std::vector< std::vector<double> > plistMean;
+    std::vector< std::vector<double> > plistM2;     /**< Sum of squared differences from the mean. */
+    std::vector< std::vector<double> > plistMin;
+    std::vector< std::vector<double> > plistMax;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pCount; /**< Number of samples added. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // ENSEMBLESTATS_H
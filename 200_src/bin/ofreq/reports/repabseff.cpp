@@ -82,32 +82,43 @@ void repAbsEff::calcReport(int freqInd)
             pConstCalc = false;
         }
 
-        //Create a new report.
-        ofreq::repBodPower repPower(this->ptManager);
+        //Check if the power report was already calculated for this body and frequency.
+        std::string key = ptManager->getCacheKey(ptPower, pBodIndex);
+        Data powData;
 
-        //Feed the body to the report.
-        repPower.setBody(this->ptBody);
-
-        //Feed constants to report.
-        for (unsigned int i = 0; i < ptPower->listConstKey().size(); i++)
+        if (!ptManager->findCache(key, freqInd, powData))
         {
-            repPower.addConst(
-                        ptPower->listConstKey(i),
-                        ptPower->listConstVal(i)
-                        );
-        }
+            //Create a new report.
+            ofreq::repBodPower repPower(this->ptManager);
 
-        //Calculate the report.
-        repPower.calcReport(freqInd);
+            //Feed the body to the report.
+            repPower.setBody(this->ptBody);
+
+            //Feed constants to report.
+            for (unsigned int i = 0; i < ptPower->listConstKey().size(); i++)
+            {
+                repPower.addConst(
+                            ptPower->listConstKey(i),
+                            ptPower->listConstVal(i)
+                            );
+            }
+
+            //Calculate the report.
+            repPower.calcReport(freqInd);
+
+            //Share the result with other reports.
+            powData = repPower.listData(0);
+            ptManager->addCache(key, freqInd, powData);
+        }
 
         //Output vector
         std::vector<double> Pow;
 
         //Get result.
-        for (unsigned int i = 0; i < repPower.listData(0).listValue().size(); i++)
+        for (unsigned int i = 0; i < powData.listValue().size(); i++)
         {
             Pow.push_back(
-                        repPower.listData(0).listValueDouble(i)
+                        powData.listValueDouble(i)
                         );
         }
 
@@ -153,7 +164,7 @@ void repAbsEff::calcRAO(int freqInd)
         if (pCalcRAO)
         {
             //Get amplitude.
-            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
@@ -188,6 +199,21 @@ string repAbsEff::getFileName()
     return "efficiency_absolute.out";
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> repAbsEff::listDepend()
+{
+    vector<string> output;
+
+    //The power report is the only report referenced.
+    for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+    {
+        if ((plistConst_Key.at(i) == KEY_POWERREP) && (plistConst_Val.at(i).listString().size() > 0))
+            output.push_back(plistConst_Val.at(i).listString(0));
+    }
+
+    return output;
+}
+
 //==========================================Section Separator =========================================================
 //Protected Functions
 
@@ -283,6 +309,13 @@ double repAbsEff::calcWavePow(int freqInd)
     {
         //Calculate maximum wave power that can be captured by the device.
 
+        //Check if the maximum wave power was already calculated for this body, frequency, and report settings.
+        std::string key = ptManager->getCacheKey("maxWavePower", this, pBodIndex);
+        Data powData;
+
+        if (ptManager->findCache(key, freqInd, powData))
+            return powData.listValueDouble(0);
+
         //Create pointer to motion model.
         MotionModel *ptMotion = &(ptBody->getMotionModel());
 
@@ -359,6 +392,10 @@ double repAbsEff::calcWavePow(int freqInd)
         }
 
 
+        //Share the result with other reports.
+        powData.addValue(maxPow);
+        ptManager->addCache(key, freqInd, powData);
+
         return maxPow;
     }
     catch(const std::exception &err)
@@ -159,6 +159,25 @@ public:
      */
     virtual std::string getFileName();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Lists the names of the other reports that this Report depends on.  This is the power report named by
+     * the constant KEY_POWERREP.
+     * @return Returns a vector of strings, variable passed by value.  The name of the power report, if one is set.
+     */
+    virtual std::vector<std::string> listDepend();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the maximum wave power that can be extracted.
+     *
+     * This is the denominator term used to calculate the absolute efficiency.  It only depends on the hydrodynamic
+     * forces, so other reports may use it directly.  The body must be set first.
+     * @param freqInd Integer, variable passed by value.  The index of the body encounter frequency to use.
+     * @return Returns double, variable passed by value.  The value of the average power calculated.
+     */
+    double calcWavePow(int freqInd);
+
 
 //==========================================Section Separator =========================================================
 protected:
@@ -180,16 +199,6 @@ private:
     //------------------------------------------Function Separator ----------------------------------------------------
     std::vector<int> plistVars; /**< The list of variables to sum the power for. */
 
-    //------------------------------------------Function Separator ----------------------------------------------------
-    /**
-     * @brief Calculates the maximum wave power that can be extracted.
-     *
-     * This is the denominator term used to calculate the absolute efficiency.
-     * @param freqInd Integer, variable passed by value.  The index of the body encounter frequency to use.
-     * @return Returns double, variable passed by value.  The value of the average power calculated.
-     */
-    double calcWavePow(int freqInd);
-
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Calculates the reactive force coefficient, hydro.  Used to calculate maximum power.
@@ -290,7 +290,7 @@ void repBodPower::calcRAO(int freqInd)
             double amp;
 
             //Get amplitude.
-            amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+            amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
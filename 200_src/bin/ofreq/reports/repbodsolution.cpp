@@ -143,7 +143,7 @@ void repBodSolution::calcRAO(int freqInd)
             complex<double> amp;
 
             //Get amplitude.
-            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd));
+            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd));
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
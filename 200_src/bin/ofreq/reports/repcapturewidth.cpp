@@ -80,32 +80,43 @@ void repCaptureWidth::calcReport(int freqInd)
             pConstCalc = false;
         }
 
-        //Create a new report.
-        ofreq::repBodPower repPower(this->ptManager);
+        //Check if the power report was already calculated for this body and frequency.
+        std::string key = ptManager->getCacheKey(ptPower, pBodIndex);
+        Data powData;
 
-        //Feed the body to the report.
-        repPower.setBody(this->ptBody);
-
-        //Feed constants to report.
-        for (unsigned int i = 0; i < ptPower->listConstKey().size(); i++)
+        if (!ptManager->findCache(key, freqInd, powData))
         {
-            repPower.addConst(
-                        ptPower->listConstKey(i),
-                        ptPower->listConstVal(i)
-                        );
-        }
+            //Create a new report.
+            ofreq::repBodPower repPower(this->ptManager);
+
+            //Feed the body to the report.
+            repPower.setBody(this->ptBody);
+
+            //Feed constants to report.
+            for (unsigned int i = 0; i < ptPower->listConstKey().size(); i++)
+            {
+                repPower.addConst(
+                            ptPower->listConstKey(i),
+                            ptPower->listConstVal(i)
+                            );
+            }
+
+            //Calculate the report.
+            repPower.calcReport(freqInd);
 
-        //Calculate the report.
-        repPower.calcReport(freqInd);
+            //Share the result with other reports.
+            powData = repPower.listData(0);
+            ptManager->addCache(key, freqInd, powData);
+        }
 
         //Output vector
         std::vector<double> Pow;
 
         //Get result.
-        for (unsigned int i = 0; i < repPower.listData(0).listValue().size(); i++)
+        for (unsigned int i = 0; i < powData.listValue().size(); i++)
         {
             Pow.push_back(
-                        repPower.listData(0).listValueDouble(i)
+                        powData.listValueDouble(i)
                         );
         }
 
@@ -151,7 +162,7 @@ void repCaptureWidth::calcRAO(int freqInd)
         if (pCalcRAO)
         {
             //Get amplitude.
-            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
@@ -186,6 +197,21 @@ string repCaptureWidth::getFileName()
     return "capture_width.out";
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> repCaptureWidth::listDepend()
+{
+    vector<string> output;
+
+    //The power report is the only report referenced.
+    for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+    {
+        if ((plistConst_Key.at(i) == KEY_POWERREP) && (plistConst_Val.at(i).listString().size() > 0))
+            output.push_back(plistConst_Val.at(i).listString(0));
+    }
+
+    return output;
+}
+
 //==========================================Section Separator =========================================================
 //Protected Functions
 
@@ -285,10 +311,10 @@ double repCaptureWidth::calcWavePow(int freqInd)
         double dens = ptSystem->listHydroManager(ptBody->getBodyName()).listHydroData(0,0).getDensity();
 
         //Get the wave amplitude from the system.
-        double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+        double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
 
-        //Get the current wave frequency from the system.
-        double freq = ptSystem->getCurFreq();
+        //Get the wave frequency from the system.
+        double freq = ptSystem->listWaveFrequencies(freqInd);
 
         //Calculate result and write out.
         return 0.25 * dens * pow(GRAVITY, 2) * pow(amp, 2) / freq;
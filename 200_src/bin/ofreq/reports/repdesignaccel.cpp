@@ -94,48 +94,78 @@ void repDesignAccel::calcReport(int freqInd)
             pConstCalc = false;
         }
 
-        //Create an internal report for static acceleration and local acceleration
-        repStaticBodyAccel repStatic(this->ptManager);
-        repLocalAcceleration repAccel(this->ptManager);
+        //Static acceleration and local acceleration may already be calculated by other reports.
+        std::string keyStatic = string("staticAccel::") + itoa(pBodIndex);
+        std::string keyLocal = string("localAccel::") + itoa(pBodIndex);
+        int locInd = -1;
 
-        //Set body for both reports.
-        repStatic.setBody(this->ptBody);
-        repAccel.setBody(this->ptBody);
-
-        //Set location for local acceleration.
         for (unsigned int i = 0; i < plistConst_Key.size(); i++)
         {
             if (plistConst_Key.at(i) == KEY_LOCATION)
             {
-                repAccel.addConst(
-                            plistConst_Key.at(i)
-                            ,
-                            plistConst_Val.at(i).listValue());
+                locInd = i;
 
+                //Location is part of the key for local acceleration.
+                for (unsigned int j = 0; j < plistConst_Val.at(i).listValue().size(); j++)
+                {
+                    keyLocal += string("::") + ftoa(plistConst_Val.at(i).listValueDouble(j));
+                }
                 break;
             }
         }
 
-        //Calculate static accel
-        repStatic.calcReport(freqInd);
+        Data dataStatic;
+        Data dataAccel;
+
+        if (!ptManager->findCache(keyStatic, freqInd, dataStatic))
+        {
+            //Create an internal report for static acceleration
+            repStaticBodyAccel repStatic(this->ptManager);
+            repStatic.setBody(this->ptBody);
+
+            //Calculate static accel
+            repStatic.calcReport(freqInd);
+
+            dataStatic = repStatic.listData().back();
+            ptManager->addCache(keyStatic, freqInd, dataStatic);
+        }
 
-        //Calculate local accel
-        repAccel.calcReport(freqInd);
+        if (!ptManager->findCache(keyLocal, freqInd, dataAccel))
+        {
+            //Create an internal report for local acceleration
+            repLocalAcceleration repAccel(this->ptManager);
+            repAccel.setBody(this->ptBody);
+
+            //Set location for local acceleration.
+            if (locInd >= 0)
+            {
+                repAccel.addConst(
+                            plistConst_Key.at(locInd)
+                            ,
+                            plistConst_Val.at(locInd).listValue());
+            }
+
+            //Calculate local accel
+            repAccel.calcReport(freqInd);
+
+            dataAccel = repAccel.listData().back();
+            ptManager->addCache(keyLocal, freqInd, dataAccel);
+        }
 
-        //Get the last entry and combine.
+        //Combine the two.
         vector<double> output(3);
 
         //Get X-axis
-        output.at(0) = repAccel.listData().back().listValueDouble(0)
-                       + repStatic.listData().back().listValueDouble(0);
+        output.at(0) = dataAccel.listValueDouble(0)
+                       + dataStatic.listValueDouble(0);
 
         //Get Y-axis
-        output.at(1) = repAccel.listData().back().listValueDouble(1)
-                       - repStatic.listData().back().listValueDouble(1);
+        output.at(1) = dataAccel.listValueDouble(1)
+                       - dataStatic.listValueDouble(1);
 
         //Get Z-axis
-        output.at(2) = repAccel.listData().back().listValueDouble(2)
-                       + repStatic.listData().back().listValueDouble(2);
+        output.at(2) = dataAccel.listValueDouble(2)
+                       + dataStatic.listValueDouble(2);
 
         //Write results back to results list.
         plistData.push_back(
@@ -165,7 +195,7 @@ void repDesignAccel::calcRAO(int freqInd)
             complex<double> amp;
 
             //Get amplitude.
-            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd));
+            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd));
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
@@ -114,7 +114,7 @@ void repDynFreeboard::calcReport(int freqInd)
 
         //Get amplitude.
         complex<double> amp;
-        amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd));
+        amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd));
 
         //Calculate output list.
         //Z-axis outputs.  (S_z = T_z + p_y * R_x + p_x * R_y - Z_0)
@@ -144,7 +144,7 @@ void repDynFreeboard::calcRAO(int freqInd)
             complex<double> amp;
 
             //Get amplitude.
-            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd));
+            amp.real(ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd));
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
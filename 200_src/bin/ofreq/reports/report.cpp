@@ -164,10 +164,24 @@ void Report::calcRAO(bool calcYes)
     pCalcRAO = calcYes;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void Report::finishReport()
+{
+    //Do nothing.  Only reports that combine wave directions need this.
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<std::string> Report::listDepend()
+{
+    //No dependencies.  Only reports that reference another report need this.
+    return std::vector<std::string>();
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void Report::clearData()
 {
     plistData.clear();
+    plistRAO.clear();
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
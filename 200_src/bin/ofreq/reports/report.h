@@ -250,7 +250,29 @@ public:
 
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
-     * @brief Clears the list of Data objects.  Erases any existing data objects.
+     * @brief Finishes the Report after all wave directions were written.
+     *
+     * Called once by the ReportManager, after the Report was calculated and written for every wave direction.
+     * Reports that combine results across wave directions and wave frequencies do that work here.  The default
+     * function does nothing.
+     */
+    virtual void finishReport();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Lists the names of the other reports that this Report depends on.
+     *
+     * The ReportManager builds its dependency graph from this list.  Every Report listed gets calculated first, and
+     * shares its results through the cache.  Each Report class declares which of its constants name another Report.
+     * The default function returns an empty list.
+     * @return Returns a vector of strings, variable passed by value.  The names of the reports this Report depends
+     * on.
+     */
+    virtual std::vector<std::string> listDepend();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears the list of Data objects and the list of RAO objects.  Erases any existing data objects.
      */
     void clearData();
 
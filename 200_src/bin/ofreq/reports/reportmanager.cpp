@@ -39,6 +39,10 @@ using namespace osea::ofreq;
 //Filename Specification
 string ReportManager::HEADER_FILENAME = "openseaheader.txt";
 
+//------------------------------------------Function Separator ----------------------------------------------------
+//Cache Key Specification
+string ReportManager::SEPARATOR = "::";
+
 //------------------------------------------Function Separator ----------------------------------------------------
 //Directory Specifications
 QString ReportManager::NAME_DIR = "d"; /**< The starting character for the wave direction directory.**/
@@ -47,13 +51,13 @@ QString ReportManager::NAME_BOD = "body"; /**< The starting characters for the b
 
 //------------------------------------------Function Separator ----------------------------------------------------
 //General File Content Marks
-QString ReportManager::KEY_NAME = "name";
-QString ReportManager::KEY_DATA = "data";
-QString ReportManager::KEY_RAO = "RAO";
-QString ReportManager::KEY_VALUE = "value";
-QString ReportManager::KEY_FREQUENCY = "frequency";
-QString ReportManager::KEY_DIRECTION = "direction";
-QString ReportManager::KEY_BODY = "body";
+string ReportManager::KEY_NAME = "name";
+string ReportManager::KEY_DATA = "data";
+string ReportManager::KEY_RAO = "RAO";
+string ReportManager::KEY_VALUE = "value";
+string ReportManager::KEY_FREQUENCY = "frequency";
+string ReportManager::KEY_DIRECTION = "direction";
+string ReportManager::KEY_BODY = "body";
 
 
 //==========================================Section Separator =========================================================
@@ -113,6 +117,10 @@ void ReportManager::writeReport()
     logStd.Write("Calculating Outputs",3);
     logStd.Write("=================================================================================",3);
 
+    //Sort reports so that referenced reports get calculated first.
+    if (!pGraphBuilt)
+        buildGraph();
+
     //Create a wave directions report and execute it.
     Report *RepPt = new repDirections(this);
     writeReport(0, RepPt);
@@ -137,6 +145,21 @@ void ReportManager::writeReport()
             logErr.Write(ID + string(err.what()));
         }
     }
+
+    //Finish any reports that combine results from all wave directions.
+    for (unsigned int i = 0; i < plistReport.size(); i++)
+    {
+        try
+        {
+            plistReport.at(i)->finishReport();
+        }
+        catch(const std::exception &err)
+        {
+            //Error handler.
+            logStd.Notify();
+            logErr.Write(ID + string(err.what()));
+        }
+    }
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -149,13 +172,20 @@ void ReportManager::writeReport(int waveIndexIn)
                  + itoa(ptSystem->listWaveDirections().size() + 1 - 1) //+1 = conversion to 1-based count. -1 = offset for vector count.
                  ,3);
 
+    //Sort reports so that referenced reports get calculated first.
+    if (!pGraphBuilt)
+        buildGraph();
+
+    //Intermediate results only apply to a single wave direction.
+    clearCache();
+
     //Iterate through each report in the list of reports and write out report.
-    for (unsigned int i = 0; i < plistReport.size(); i++)
+    for (unsigned int i = 0; i < plistOrder.size(); i++)
     {
         try
         {
             //Calculate each report.
-            writeReport(waveIndexIn, plistReport.at(i));
+            writeReport(waveIndexIn, plistReport.at(plistOrder.at(i)));
         }
         catch(const std::exception &err)
         {
@@ -192,18 +222,40 @@ void ReportManager::writeReport(int waveIndexIn, ofreq::Report *ReportIn)
         //Calculate the report for the specified wave direction and specified report.
         calcReport(waveIndexIn, ReportIn);
 
+        //Write the results.
+        writeStored(waveIndexIn, ReportIn);
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::writeStored(int waveIndexIn, ofreq::Report *ReportIn)
+{
+    try
+    {
+        //Set the current wave index.  The directory depends on it.
+        setWaveInd(waveIndexIn);
+
         //Setup the correct directory.
         QString path = setDirectory(ReportIn);
 
         //Setup the correct file.
         setFile(ReportIn, path);
 
-        //Use the current output file to get an output stream.
-        pFileOutput.open(QIODevice::Append);
-        QTextStream FileOut(&pFileOutput);
+        //Use the current output file for the report writer.
+        if (!pWriter.open(std::string(QFile::encodeName(pFileOutput.fileName()).constData())))
+        {
+            throw std::runtime_error(string("Could not open report file.  Report name:  ")
+                                     + ReportIn->getName());
+        }
 
         //Parse the report into the output file.
-        bool writeTrue = parseReport(ReportIn, FileOut);
+        bool writeTrue = parseReport(ReportIn, pWriter);
 
         //Check if wrote correctly.
         if (!writeTrue)
@@ -222,6 +274,7 @@ void ReportManager::writeReport(int waveIndexIn, ofreq::Report *ReportIn)
     try
     {
         //Close the file.
+        pWriter.close();
         pFileOutput.close();
 
         //Clear the results data from the report.
@@ -238,13 +291,17 @@ void ReportManager::writeReport(int waveIndexIn, ofreq::Report *ReportIn)
 //------------------------------------------Function Separator --------------------------------------------------------
 void ReportManager::calcReport(int waveIndexIn)
 {
+    //Sort reports so that referenced reports get calculated first.
+    if (!pGraphBuilt)
+        buildGraph();
+
     //Iterate through each report in the list of reports and calculate data.
-    for (unsigned int i = 0; i < plistReport.size(); i++)
+    for (unsigned int i = 0; i < plistOrder.size(); i++)
     {
         try
         {
             //Calculate each report.
-            calcReport(waveIndexIn, plistReport.at(i));
+            calcReport(waveIndexIn, plistReport.at(plistOrder.at(i)));
         }
         catch(const std::exception &err)
         {
@@ -264,10 +321,41 @@ void ReportManager::calcReport(int waveIndexIn, ofreq::Report *ReportIn)
         //Set the current wave index
         setWaveInd(waveIndexIn);
 
+        //Check if other reports reference this report.
+        bool shared = false;
+        for (unsigned int i = 0; i < plistShared.size(); i++)
+        {
+            if (plistReport.at(i) == ReportIn)
+            {
+                shared = plistShared.at(i);
+                break;
+            }
+        }
+
         //Calculate report, for all wave frequencies.
         for (unsigned int i = 0; i < ptSystem->listWaveFrequencies().size(); i++)
         {
-            ReportIn->calcReport(i);
+            if (!shared)
+            {
+                ReportIn->calcReport(i);
+                continue;
+            }
+
+            //Reuse results already calculated for dependent reports, and store new ones for them.
+            std::string key = getCacheKey(ReportIn, ReportIn->getBodIndex());
+            Data result;
+
+            if (findCache(key, i, result))
+            {
+                ReportIn->listData().push_back(result);
+            }
+            else
+            {
+                ReportIn->calcReport(i);
+
+                if (ReportIn->listData().size() > 0)
+                    addCache(key, i, ReportIn->listData().back());
+            }
         }
 
         //Calculate RAO, for all wave frequencies.
@@ -344,6 +432,9 @@ bool ReportManager::clearFiles()
 void ReportManager::addReport(ofreq::Report *ReportIn)
 {
     plistReport.push_back(ReportIn);
+
+    //Dependency graph needs to be rebuilt.
+    pGraphBuilt = false;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -389,6 +480,72 @@ void ReportManager::setHeader(string filePathIn)
     }
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+bool ReportManager::findCache(string keyIn, int freqInd, ofreq::Data &dataOut)
+{
+    std::map<std::string, Data>::iterator it;
+
+    it = pmapCache.find(keyIn
+                        + SEPARATOR + itoa(ptSystem->getCurWaveDirInd())
+                        + SEPARATOR + itoa(freqInd));
+
+    if (it == pmapCache.end())
+        return false;
+
+    dataOut = it->second;
+    return true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::addCache(string keyIn, int freqInd, ofreq::Data dataIn)
+{
+    pmapCache[keyIn
+            + SEPARATOR + itoa(ptSystem->getCurWaveDirInd())
+            + SEPARATOR + itoa(freqInd)] = dataIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::clearCache()
+{
+    pmapCache.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string ReportManager::getCacheKey(ofreq::Report *ReportIn, int bodIndex)
+{
+    return ReportIn->getClass()
+            + SEPARATOR + ReportIn->getName()
+            + SEPARATOR + itoa(bodIndex);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string ReportManager::getCacheKey(string resultIn, ofreq::Report *ReportIn, int bodIndex)
+{
+    std::stringstream output;
+    output.precision(17);
+
+    output << resultIn
+           << SEPARATOR << ReportIn->getClass()
+           << SEPARATOR << bodIndex
+           << SEPARATOR << ptSystem->getCurWaveDirInd();
+
+    //Every constant of the report, so reports with different settings never share a result.
+    for (unsigned int i = 0; i < ReportIn->listConstKey().size(); i++)
+    {
+        output << SEPARATOR << ReportIn->listConstKey(i);
+
+        for (unsigned int j = 0; j < ReportIn->listConstVal(i).listString().size(); j++)
+            output << SEPARATOR << ReportIn->listConstVal(i).listString(j);
+
+        for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
+            output << SEPARATOR << ReportIn->listConstVal(i).listValue(j).real()
+                   << "," << ReportIn->listConstVal(i).listValue(j).imag();
+    }
+
+    return output.str();
+}
+
+
 
 //==========================================Section Separator =========================================================
 //Protected Functions
@@ -528,489 +685,277 @@ void ReportManager::setFile(ofreq::Report *ReportIn, QString dirIn)
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-bool ReportManager::parseReport(ofreq::Report *ReportIn, QTextStream &fileOut)
+bool ReportManager::parseReport(ofreq::Report *ReportIn, ReportWriter &fileOut)
 {
-    //Set output
-    bool status = false;
     //Write report class name and opening brackets.
-    fileOut << a2Qstr(BREAK_TOP + EOL);
-    fileOut << a2Qstr(ReportIn->getClass()
-                      + SPACE
-                      + OBJECT_BEGIN
-                      + EOL);
+    fileOut.write(BREAK_TOP + EOL);
+    fileOut.write(ReportIn->getClass()
+                  + SPACE
+                  + OBJECT_BEGIN
+                  + EOL);
 
     //Write out object key and name.
-    fileOut << TAB() << KEY_NAME << a2Qstr(SPACE + QUOTE + ReportIn->getName() + QUOTE + END + EOL);
+    fileOut.writeTab();
+    fileOut.write(KEY_NAME + SPACE + QUOTE + ReportIn->getName() + QUOTE + END + EOL);
 
     //---------------------------------------
     //Write out each of the object constants.
     for (unsigned int i = 0; i < ReportIn->listConstKey().size(); i++)
     {
+        Data &constVal = ReportIn->listConstVal(i);
+
         //---------------------------------------
         //Write out key name
-        fileOut << TAB() << a2Qstr(ReportIn->listConstKey(i) + SPACE);
+        fileOut.writeTab();
+        fileOut.write(ReportIn->listConstKey(i) + SPACE);
 
-        if ((ReportIn->listConstVal(i).listValue().size() > 1)
-                || (ReportIn->listConstVal(i).listString().size() > 1))
+        if ((constVal.listValue().size() > 1)
+                || (constVal.listString().size() > 1))
         {
             //---------------------------------------
             //Multiple key values
 
             //First create the opening bracket
-            fileOut << a2Qstr(LIST_BEGIN + EOL);
-
-            //Check Data type
-            if (ReportIn->listConstVal(i).getDataType() == 0)
-            {
-                //Complex list.
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(2)
-                               + Val2String(
-                                          ReportIn->listConstVal(i).listValue(j))
-                               + a2Qstr(EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 1)
-            {
-                //Double list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(2)
-                               + Val2String(
-                                          ReportIn->listConstVal(i).listValueDouble(j))
-                               + a2Qstr(EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 2)
-            {
-                //Integer list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(2)
-                               + Val2String(
-                                          ReportIn->listConstVal(i).listValueInt(j))
-                               + a2Qstr(EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 3)
-            {
-                //String list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listString().size(); j++)
-                {
-                    fileOut << TAB(2)
-                            << a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listConstVal(i).listString(j))
-                                   + a2Qstr(
-                                        QUOTE
-                                        + EOL
-                                   );
-                }
-            }
+            fileOut.write(LIST_BEGIN + EOL);
+            writeValues(fileOut, constVal, 2, EOL);
 
             //Create the closing bracket
-            fileOut << TAB() << a2Qstr(LIST_END + END + EOL);
+            fileOut.writeTab();
+            fileOut.write(LIST_END + END + EOL);
         }
         else
         {
             //---------------------------------------
             //Single key value
-
-            //Check Data Type
-            if (ReportIn->listConstVal(i).getDataType() == 0)
-            {
-                //Complex list.
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                  ReportIn->listConstVal(i).listValue(j))
-                            + a2Qstr(END + EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 1)
-            {
-                //Double list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                    ReportIn->listConstVal(i).listValueDouble(j))
-                                + a2Qstr(END + EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 2)
-            {
-                //Integer list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                    ReportIn->listConstVal(i).listValueInt(j))
-                                + a2Qstr(END + EOL);
-                }
-            }
-
-            else if (ReportIn->listConstVal(i).getDataType() == 3)
-            {
-                //String list
-                for (unsigned int j = 0; j < ReportIn->listConstVal(i).listString().size(); j++)
-                {
-                    fileOut << a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listConstVal(i).listString(j))
-                               + a2Qstr(
-                                   QUOTE
-                                   + END
-                                   + EOL
-                                   );
-                }
-            }
+            writeValues(fileOut, constVal, 0, END + EOL);
         }
     }
 
     //---------------------------------------
     //Write out the object data
-
     for (unsigned int i = 0; i < ReportIn->listData().size(); i++)
-    {
-        //Start with the data keyword and object starter.
-        fileOut << TAB()
-                << KEY_DATA
-                << a2Qstr(SPACE
-                                          + OBJECT_BEGIN
-                                          + EOL);
-
-        //Write out the frequency index keyword and value.
-        fileOut << TAB(2)
-                + KEY_FREQUENCY
-                + a2Qstr(SPACE)
-                + Val2String(
-                          ReportIn->listData(i).getIndex() + 1)
-                + a2Qstr(
-                       END + EOL);
+        writeData(fileOut, ReportIn->listData(i), KEY_DATA);
 
-        //---------------------------------------
-        //Write out the values from the data object.
+    //---------------------------------------
+    //Write out the RAO data
 
-        //First create keyword
-        fileOut << TAB(2) + KEY_VALUE + a2Qstr(SPACE);
+    if (ReportIn->listRAO().size() > 0)
+    {
+        //Write out a small separator.
+        fileOut.write(EOL + EOL);
+        fileOut.writeTab();
+        fileOut.write(BREAK_MIDDLE + EOL);
+        fileOut.writeTab();
+        fileOut.write(string("//RAO Data") + EOL);
+    }
 
-        //---------------------------------------
-        //Check if writing single value or multiple.
-        if (ReportIn->listData(i).listValue().size() > 1)
-        {
-            //---------------------------------------
-            //Multiple values
+    for (unsigned int i = 0; i < ReportIn->listRAO().size(); i++)
+        writeData(fileOut, ReportIn->listRAO(i), KEY_RAO);
 
-            //Write out beginning of list
-            fileOut << a2Qstr(LIST_BEGIN + EOL);
+    //---------------------------------------
+    //Closing bracket to object.
+    fileOut.write(OBJECT_END + EOL);
 
-            //Check Data type
+    //End mark.
+    fileOut.write(BREAK_BOTTOM + EOL + EOL + EOL + EOL);
 
-            if (ReportIn->listData(i).getDataType() == 0)
-            {
-                //Complex data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(3) + Val2String(
-                                  ReportIn->listData(i).listValue(j))
-                            + a2Qstr(EOL);
-                }
-            }
+    //Return result.
+    return fileOut.flush();
+}
 
-            else if (ReportIn->listData(i).getDataType() == 1)
-            {
-                //Double data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(3) + Val2String(
-                                    ReportIn->listData(i).listValueDouble(j))
-                                + a2Qstr(EOL);
-                }
-            }
 
-            else if (ReportIn->listData(i).getDataType() == 2)
-            {
-                //Integer data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(3) + Val2String(
-                                    ReportIn->listData(i).listValueInt(j))
-                                + a2Qstr(EOL);
-                }
-            }
+//==========================================Section Separator =========================================================
+//Private Functions
 
-            else if (ReportIn->listData(i).getDataType() == 3)
-            {
-                //String data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listString().size(); j++)
-                {
-                    fileOut << TAB(3) + a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listData(i).listString(j))
-                               + a2Qstr(
-                                   QUOTE
-                                   + EOL
-                                   );
-                }
-            }
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::setWaveInd(int indexIn)
+{
+    curWaveInd = indexIn;
 
-            //Write out end of list
-            fileOut << TAB(2) + a2Qstr(LIST_END + END + EOL);
-        }
-        else
-        {
-            //---------------------------------------
-            //Single value
+    ptSystem->setCurWaveDirInd(curWaveInd);
+}
 
-            //Check Data type
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::writeData(ReportWriter &fileOut, Data &dataIn, string keyIn)
+{
+    //Start with the data keyword and object starter.
+    fileOut.writeTab();
+    fileOut.write(keyIn + SPACE + OBJECT_BEGIN + EOL);
 
-            if (ReportIn->listData(i).getDataType() == 0)
-            {
-                //Complex data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                  ReportIn->listData(i).listValue(j))
-                            + a2Qstr(END + EOL);
-                }
-            }
+    //Write out the frequency index keyword and value.
+    fileOut.writeTab(2);
+    fileOut.write(KEY_FREQUENCY + SPACE);
+    fileOut.writeValue(dataIn.getIndex() + 1);
+    fileOut.write(END + EOL);
 
-            else if (ReportIn->listData(i).getDataType() == 1)
-            {
-                //Double data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                    ReportIn->listData(i).listValueDouble(j))
-                                + a2Qstr(END + EOL);
-                }
-            }
+    //---------------------------------------
+    //Write out the values from the data object.
 
-            else if (ReportIn->listData(i).getDataType() == 2)
-            {
-                //Integer data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                    ReportIn->listData(i).listValueInt(j))
-                                + a2Qstr(END + EOL);
-                }
-            }
+    //First create keyword
+    fileOut.writeTab(2);
+    fileOut.write(KEY_VALUE + SPACE);
 
-            else if (ReportIn->listData(i).getDataType() == 3)
-            {
-                //String data type
-                for (unsigned int j = 0; j < ReportIn->listData(i).listString().size(); j++)
-                {
-                    fileOut << a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listData(i).listString(j))
-                               + a2Qstr(
-                                   QUOTE
-                                   + END
-                                   + EOL
-                                   );
-                }
-            }
-        }
+    //---------------------------------------
+    //Check if writing single value or multiple.
+    if (dataIn.listValue().size() > 1)
+    {
+        //Multiple values
+        fileOut.write(LIST_BEGIN + EOL);
+        writeValues(fileOut, dataIn, 3, EOL);
 
-        //---------------------------------------
-        //Closing bracket to object.
-        fileOut << TAB() + a2Qstr(OBJECT_END + EOL + EOL);
+        fileOut.writeTab(2);
+        fileOut.write(LIST_END + END + EOL);
+    }
+    else
+    {
+        //Single value
+        writeValues(fileOut, dataIn, 0, END + EOL);
     }
 
     //---------------------------------------
-    //Write out the RAO data
+    //Closing bracket to object.
+    fileOut.writeTab();
+    fileOut.write(OBJECT_END + EOL + EOL);
+}
 
-    if (ReportIn->listRAO().size() > 0)
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::writeValues(ReportWriter &fileOut, Data &dataIn, int tabIn, string endIn)
+{
+    //Check Data type
+    if (dataIn.getDataType() == 0)
     {
-        //Write out a small separator.
-        fileOut << a2Qstr(EOL + EOL) + TAB()
-                + a2Qstr(BREAK_MIDDLE + EOL);
-        fileOut << TAB()
-                + QString("//RAO Data") + a2Qstr(EOL);
+        //Complex data type
+        for (unsigned int j = 0; j < dataIn.listValue().size(); j++)
+        {
+            fileOut.writeTab(tabIn);
+            fileOut.writeValue(dataIn.listValue(j));
+            fileOut.write(endIn);
+        }
     }
 
-    for (unsigned int i = 0; i < ReportIn->listRAO().size(); i++)
+    else if (dataIn.getDataType() == 1)
     {
-        //Start with the data keyword and object starter.
-        fileOut << TAB()
-                << KEY_RAO
-                << a2Qstr(SPACE + OBJECT_BEGIN + EOL);
-
-        //Write out the frequency index keyword and value.
-        fileOut << TAB(2)
-                + KEY_FREQUENCY
-                + a2Qstr(SPACE)
-                + Val2String(ReportIn->listRAO(i).getIndex() + 1)
-                + a2Qstr(END + EOL);
-
-        //---------------------------------------
-        //Write out the values from the data object.
+        //Double data type
+        for (unsigned int j = 0; j < dataIn.listValue().size(); j++)
+        {
+            fileOut.writeTab(tabIn);
+            fileOut.writeValue(dataIn.listValueDouble(j));
+            fileOut.write(endIn);
+        }
+    }
 
-        //First create keyword
-        fileOut << TAB(2) + KEY_VALUE + a2Qstr(SPACE);
+    else if (dataIn.getDataType() == 2)
+    {
+        //Integer data type
+        for (unsigned int j = 0; j < dataIn.listValue().size(); j++)
+        {
+            fileOut.writeTab(tabIn);
+            fileOut.writeValue(dataIn.listValueInt(j));
+            fileOut.write(endIn);
+        }
+    }
 
-        //---------------------------------------
-        //Check if writing single value or multiple.
-        if (ReportIn->listRAO(i).listValue().size() > 1)
+    else if (dataIn.getDataType() == 3)
+    {
+        //String data type
+        for (unsigned int j = 0; j < dataIn.listString().size(); j++)
         {
-            //---------------------------------------
-            //Multiple values
+            fileOut.writeTab(tabIn);
+            fileOut.write(QUOTE + dataIn.listString(j) + QUOTE + endIn);
+        }
+    }
+}
 
-            //Write out beginning of list
-            fileOut << a2Qstr(LIST_BEGIN + EOL);
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportManager::buildGraph()
+{
+    int nRep = plistReport.size();
+    std::vector< std::vector<int> > listDepend(nRep);     //Reports that each report references.
+    std::vector<int> state(nRep, 0);                       //0 = not visited, 1 = visiting, 2 = done.
 
-            //Check Data type
+    plistOrder.clear();
+    plistShared.assign(nRep, false);
 
-            if (ReportIn->listRAO(i).getDataType() == 0)
-            {
-                //Complex data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(3) + Val2String(
-                                  ReportIn->listRAO(i).listValue(j))
-                            + a2Qstr(EOL);
-                }
-            }
+    //Find references between reports.  Each report declares the names of the reports it depends on.
+    for (int i = 0; i < nRep; i++)
+    {
+        std::vector<std::string> listName = plistReport.at(i)->listDepend();
 
-            else if (ReportIn->listRAO(i).getDataType() == 1)
-            {
-                //Double data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
-                {
-                    fileOut << TAB(3) + Val2String(
-                                    ReportIn->listRAO(i).listValueDouble(j))
-                                + a2Qstr(EOL);
-                }
-            }
+        for (unsigned int k = 0; k < listName.size(); k++)
+        {
+            bool found = false;
 
-            else if (ReportIn->listRAO(i).getDataType() == 2)
+            for (int m = 0; m < nRep; m++)
             {
-                //Integer data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
+                if ((m != i) && (plistReport.at(m)->getName() == listName.at(k)))
                 {
-                    fileOut << TAB(3) + Val2String(
-                                    ReportIn->listRAO(i).listValueInt(j))
-                                + a2Qstr(EOL);
+                    listDepend.at(i).push_back(m);
+                    plistShared.at(m) = true;
+                    found = true;
+                    break;
                 }
             }
 
-            else if (ReportIn->listRAO(i).getDataType() == 3)
+            if (!found)
             {
-                //String data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listString().size(); j++)
-                {
-                    fileOut << TAB(3) + a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listRAO(i).listString(j))
-                               + a2Qstr(
-                                   QUOTE
-                                   + EOL
-                                   );
-                }
+                logStd.Notify();
+                logErr.Write(ID + string("Report depends on a report that was not found.  Report:  ")
+                             + plistReport.at(i)->getName()
+                             + string(" depends on report:  ")
+                             + listName.at(k));
             }
-
-            //Write out end of list
-            fileOut << TAB(2) + a2Qstr(LIST_END + END + EOL);
         }
-        else
-        {
-            //---------------------------------------
-            //Single value
+    }
 
-            //Check Data type
+    //Depth first search, so that every report comes after the reports it references.
+    for (int i = 0; i < nRep; i++)
+    {
+        if (state.at(i) != 0)
+            continue;
 
-            if (ReportIn->listRAO(i).getDataType() == 0)
-            {
-                //Complex data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
-                {
-                    fileOut << Val2String(
-                                  ReportIn->listRAO(i).listValue(j))
-                            + a2Qstr(END + EOL);
-                }
-            }
+        std::vector<int> stack;     //Stack of report indices.
+        std::vector<unsigned int> next;     //Next dependency to visit for each report on the stack.
+
+        stack.push_back(i);
+        next.push_back(0);
+        state.at(i) = 1;
+
+        while (stack.size() > 0)
+        {
+            int cur = stack.back();
 
-            else if (ReportIn->listRAO(i).getDataType() == 1)
+            if (next.back() < listDepend.at(cur).size())
             {
-                //Double data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
+                int dep = listDepend.at(cur).at(next.back());
+                next.back()++;
+
+                if (state.at(dep) == 0)
                 {
-                    fileOut << Val2String(
-                                    ReportIn->listRAO(i).listValueDouble(j))
-                                + a2Qstr(END + EOL);
+                    stack.push_back(dep);
+                    next.push_back(0);
+                    state.at(dep) = 1;
                 }
-            }
-
-            else if (ReportIn->listRAO(i).getDataType() == 2)
-            {
-                //Integer data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listValue().size(); j++)
+                else if (state.at(dep) == 1)
                 {
-                    fileOut << Val2String(
-                                    ReportIn->listRAO(i).listValueInt(j))
-                                + a2Qstr(END + EOL);
+                    logStd.Notify();
+                    logErr.Write(ID + string("Circular reference between reports.  Report:  ")
+                                 + plistReport.at(cur)->getName()
+                                 + string(" references report:  ")
+                                 + plistReport.at(dep)->getName());
                 }
             }
-
-            else if (ReportIn->listRAO(i).getDataType() == 3)
+            else
             {
-                //String data type
-                for (unsigned int j = 0; j < ReportIn->listRAO(i).listString().size(); j++)
-                {
-                    fileOut << a2Qstr(
-                                   QUOTE)
-                                   + Val2String(
-                                       ReportIn->listRAO(i).listString(j))
-                               + a2Qstr(
-                                   QUOTE
-                                   + END
-                                   + EOL
-                                   );
-                }
+                //All dependencies placed.  Place the report.
+                state.at(cur) = 2;
+                plistOrder.push_back(cur);
+                stack.pop_back();
+                next.pop_back();
             }
         }
-
-        //---------------------------------------
-        //Closing bracket to object.
-        fileOut << TAB() + a2Qstr(OBJECT_END + EOL + EOL);
     }
 
-    //---------------------------------------
-    //Closing bracket to object.
-    fileOut << a2Qstr(OBJECT_END + EOL);
-
-    //End mark.
-    fileOut << a2Qstr(BREAK_BOTTOM + EOL + EOL + EOL + EOL);
-
-    //Set status to success.
-    status = true;
-
-    //Return result.
-    return status;
-}
-
-
-//==========================================Section Separator =========================================================
-//Private Functions
-
-//------------------------------------------Function Separator --------------------------------------------------------
-void ReportManager::setWaveInd(int indexIn)
-{
-    curWaveInd = indexIn;
-
-    ptSystem->setCurWaveDirInd(curWaveInd);
+    pGraphBuilt = true;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -1090,60 +1035,6 @@ bool ReportManager::createDir(QString path)
     return dir.mkpath(".");
 }
 
-//------------------------------------------Function Separator --------------------------------------------------------
-QString ReportManager::Val2String(std::string valIn)
-{
-    //Convert string to QString
-    return a2Qstr(valIn);
-}
-
-//------------------------------------------Function Separator --------------------------------------------------------
-QString ReportManager::Val2String(int valIn)
-{
-    //Convert to QString
-    return a2Qstr(itoa(valIn));
-}
-
-//------------------------------------------Function Separator --------------------------------------------------------
-QString ReportManager::Val2String(double valIn)
-{
-    QString output;
-    QTextStream convert;
-    convert.setString(&output);
-    convert.setRealNumberNotation(QTextStream::ScientificNotation);
-    convert << valIn;
-
-    //Write output.
-    return output;
-}
-
-//------------------------------------------Function Separator --------------------------------------------------------
-QString ReportManager::Val2String(std::complex<double> valIn)
-{
-    QString output;
-    QTextStream convert;
-    convert.setString(&output);
-    convert.setRealNumberNotation(QTextStream::ScientificNotation);
-
-    //Create opening brackets
-    convert << a2Qstr(LIST_BEGIN);
-
-    //Enter real number
-    convert << valIn.real();
-
-    //Enter separation mark
-    convert << a2Qstr(COMPLEX_COORD);
-
-    //Enter imaginary part
-    convert << valIn.imag();
-
-    //Enter closing brackets
-    convert << a2Qstr(LIST_END);
-
-    //Write output
-    return output;
-}
-
 //------------------------------------------Function Separator --------------------------------------------------------
 QString ReportManager::a2Qstr(std::string valIn)
 {
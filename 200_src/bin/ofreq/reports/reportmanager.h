@@ -40,6 +40,7 @@
 #define REPORTMANAGER_H
 #include <string>
 #include <typeinfo>
+#include <map>
 #include <QtGlobal>
 #include <QDir>
 #include <QFile>
@@ -49,6 +50,7 @@
 #include "../system_objects/ofreqcore.h"
 #include "report.h"
 #include "../global_objects/ioword.h"
+#include "reportwriter.h"
 
 //Report Classes
 #include "repdirections.h"
@@ -72,6 +74,8 @@
 #include "repbodmotion.h"
 #include "repbodvelocity.h"
 #include "repbodsolution.h"
+#include "reppowergradient.h"
+#include "reptimehistory.h"
 
 //######################################### Class Separator ###########################################################
 //Namespace declarations
@@ -208,6 +212,18 @@ public:
      */
     void writeReport(int waveIndexIn, ofreq::Report *ReportIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the data already stored in the report to the output file for a single wave direction.
+     *
+     * Does not calculate the report.  Used when the report data comes from somewhere other than the report itself,
+     * such as the summary statistics of an ensemble.
+     * @param waveIndexIn Integer, variable passed by value.  The index of the wave direction that the data belongs
+     * to.
+     * @param ReportIn Pointer to the Report that you want to write out.  Pointer passed by value.
+     */
+    void writeStored(int waveIndexIn, ofreq::Report *ReportIn);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Calculates all reports for a single wave direction.
@@ -270,6 +286,66 @@ public:
      */
     void setHeader(std::string filePathIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Searches the shared results cache for an intermediate result.
+     *
+     * Reports often need the same intermediate results as other reports:  the power absorbed by a body, the wave
+     * power available, or the local kinematics at a point.  Instead of recalculating these for each report, the first
+     * report to calculate the result stores it in the ReportManager, and all other reports retrieve it from here.
+     * Results are stored for the current wave direction only.  The cache gets cleared each time the ReportManager
+     * moves to a new wave direction.
+     * @param keyIn String, variable passed by value.  The key that identifies the intermediate result.  The key must
+     * include everything the result depends on, except the wave direction and wave frequency.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency for the result.
+     * @param dataOut Data object, passed by reference.  If the result was found, it is copied into this object.
+     * @return Returns true if the result was found in the cache.  Returns false if the result still needs to be
+     * calculated.
+     */
+    bool findCache(std::string keyIn, int freqInd, ofreq::Data &dataOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds an intermediate result to the shared results cache.
+     * @param keyIn String, variable passed by value.  The key that identifies the intermediate result.  Same key as
+     * used for findCache().
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency for the result.
+     * @param dataIn Data object, passed by value.  The result to store.
+     * @sa findCache()
+     */
+    void addCache(std::string keyIn, int freqInd, ofreq::Data dataIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears all results from the shared results cache.
+     */
+    void clearCache();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Creates the cache key for the result of a named Report.
+     *
+     * Reports that reference another Report by name (such as the efficiency reports referencing a power report) use
+     * this key to share the results of the referenced Report.
+     * @param ReportIn Pointer to the Report that produces the result.  Pointer passed by value.
+     * @param bodIndex Integer, variable passed by value.  The index of the Body that the result gets calculated for.
+     * @return Returns string, variable passed by value.  The cache key for the Report result.
+     */
+    std::string getCacheKey(ofreq::Report *ReportIn, int bodIndex);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Creates the cache key for an intermediate result that a Report calculates for itself.
+     *
+     * The key holds the name of the result, the class of the Report, the body, the current wave direction, and every
+     * constant of the Report with its values.  Two reports only share the result if all of these match.
+     * @param resultIn String, variable passed by value.  The name of the intermediate result.
+     * @param ReportIn Pointer to the Report that calculates the result.  Pointer passed by value.
+     * @param bodIndex Integer, variable passed by value.  The index of the Body that the result gets calculated for.
+     * @return Returns string, variable passed by value.  The cache key for the intermediate result.
+     */
+    std::string getCacheKey(std::string resultIn, ofreq::Report *ReportIn, int bodIndex);
+
 
 //==========================================Section Separator =========================================================
 protected:
@@ -314,11 +390,11 @@ protected:
      * Iterates through all the Data objects generated by the report.  With each Data object, it writes the output
      * to the report file.
      * @param ReportIn Pointer to Report object, pointer passed by value.
-     * @param fileOut QTextStream file, file passed by reference.  The output file stream that the text will be
+     * @param fileOut ReportWriter object, passed by reference.  The open report writer that the text will be
      * written to.
      * @return Returns boolean variable, variable passed by value.  Returns true if successful.
      */
-    bool parseReport(ofreq::Report *ReportIn, QTextStream &fileOut);
+    bool parseReport(ofreq::Report *ReportIn, ReportWriter &fileOut);
 
 //==========================================Section Separator =========================================================
 private:
@@ -331,6 +407,19 @@ private:
      */
     void setWaveInd(int indexIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds the dependency graph between the reports in the list of reports.
+     *
+     * Each Report declares the names of the reports it depends on with Report::listDepend().  (Such as the
+     * efficiency reports, which reference a power report.)  The function records which reports are referenced by
+     * others, and sorts the reports so that every referenced Report gets calculated before the reports that depend on
+     * it.  Referenced reports then store their results in the shared cache, and the dependent reports retrieve them
+     * instead of calculating them again.  Circular references and references to a missing Report are reported as
+     * errors.  The reports involved in a circular reference are calculated in the order they were listed.
+     */
+    void buildGraph();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Pointer to the System object.
@@ -358,6 +447,32 @@ private:
      */
     int curWaveInd;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The shared cache of intermediate results.
+     *
+     * Key is the result key, combined with the wave direction index and wave frequency index.  Only holds results for
+     * the current wave direction.
+     */
+    std::map<std::string, ofreq::Data> pmapCache;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The order to calculate reports in.  Each entry is an index in the list of reports.  Reports referenced by
+     * other reports come first.
+     */
+    std::vector<int> plistOrder;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief List of booleans, one for each report in the list of reports.  True if the report is referenced by
+     * another report, and its results should be stored in the shared cache.
+     */
+    std::vector<bool> plistShared;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pGraphBuilt = false;   /**< Boolean to track if the dependency graph matches the list of reports. */
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Output file that Report is written to.
@@ -368,6 +483,13 @@ private:
      */
     QFile pFileOutput;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Buffered writer for the report text.  Opened on the file set by setFile().  Kept as a member so the
+     * text buffer is reused between reports.
+     */
+    ReportWriter pWriter;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     std::string header; /**< The filename for the header to be included in all files */
 
@@ -409,35 +531,23 @@ private:
 
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
-     * @brief Converts a string input into a QString output.
-     * @param valIn String input, passed by value.
-     * @return Returns QString output, with all proper formatting brackets and ready for insert into output file.
+     * @brief Writes a Data object as a keyword block, with the frequency index and the values.  Used for both the
+     * report data and the RAO data.
+     * @param fileOut ReportWriter object, passed by reference.  The open report writer.
+     * @param dataIn Data object, passed by reference.  The data to write.
+     * @param keyIn String.  The keyword that starts the block.  Variable passed by value.
      */
-    QString Val2String(std::string valIn);
+    void writeData(ReportWriter &fileOut, ofreq::Data &dataIn, std::string keyIn);
 
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
-     * @brief Converts a int input into a QString output.
-     * @param valIn int input, passed by value.
-     * @return Returns QString output, with all proper formatting brackets and ready for insert into output file.
+     * @brief Writes each value of a Data object on its own line, in the format of its data type.
+     * @param fileOut ReportWriter object, passed by reference.  The open report writer.
+     * @param dataIn Data object, passed by reference.  The data to write.
+     * @param tabIn Integer.  The indentation level before each value.  Variable passed by value.
+     * @param endIn String.  The text written after each value.  Variable passed by value.
      */
-    QString Val2String(int valIn);
-
-    //------------------------------------------Function Separator ----------------------------------------------------
-    /**
-     * @brief Converts a double input into a QString output.
-     * @param valIn Double input, passed by value.
-     * @return Returns QString output, with all proper formatting brackets and ready for insert into output file.
-     */
-    QString Val2String(double valIn);
-
-    //------------------------------------------Function Separator ----------------------------------------------------
-    /**
-     * @brief Converts a complex<double> input into a QString output.
-     * @param valIn complex<double> input, passed by value.
-     * @return Returns QString output, with all proper formatting brackets and ready for insert into output file.
-     */
-    QString Val2String(std::complex<double> valIn);
+    void writeValues(ReportWriter &fileOut, ofreq::Data &dataIn, int tabIn, std::string endIn);
 
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
@@ -471,6 +581,10 @@ private:
     //Filename Specification
     static std::string HEADER_FILENAME; /**< The filename of the header file to read. **/
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Cache Key Specification
+    static std::string SEPARATOR; /**< Separator between the parts of a cache key. **/
+
     //------------------------------------------Function Separator ----------------------------------------------------
     //Directory Specifications
     static QString NAME_DIR; /**< The starting character for the wave direction directory.**/
@@ -479,13 +593,13 @@ private:
 
     //------------------------------------------Function Separator ----------------------------------------------------
     //Key-Value Markers
-    static QString KEY_NAME; /**< Key to mark name of object being described. */
-    static QString KEY_DATA; /**< Key to mark data for an object */
-    static QString KEY_RAO; /**< Key to mark RAO data for an object. */
-    static QString KEY_VALUE; /**< Key to mark the values for an object */
-    static QString KEY_FREQUENCY; /**< Key to mark a frequency value */
-    static QString KEY_DIRECTION; /**< Key to mark a direction value */
-    static QString KEY_BODY; /**< Key to mark a body object */
+    static std::string KEY_NAME; /**< Key to mark name of object being described. */
+    static std::string KEY_DATA; /**< Key to mark data for an object */
+    static std::string KEY_RAO; /**< Key to mark RAO data for an object. */
+    static std::string KEY_VALUE; /**< Key to mark the values for an object */
+    static std::string KEY_FREQUENCY; /**< Key to mark a frequency value */
+    static std::string KEY_DIRECTION; /**< Key to mark a direction value */
+    static std::string KEY_BODY; /**< Key to mark a body object */
 
 
 };
@@ -0,0 +1,197 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "reportwriter.h"
+#include <cmath>
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+unsigned int ReportWriter::BUFFER_SIZE = 1048576; /**< Size of the text buffer, in bytes.  The buffer is written when full. */
+int ReportWriter::MAX_TAB = 8; /**< Number of indentation levels built in advance. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ReportWriter::ReportWriter()
+{
+    ptFile = NULL;
+    pError = false;
+    pBuffer.reserve(BUFFER_SIZE);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ReportWriter::~ReportWriter()
+{
+    close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool ReportWriter::open(string pathIn)
+{
+    close();
+
+    //Build the indentation strings once.  Not done in the constructor, because the report manager of the global
+    //system object may be constructed before TAB_REF is initialized.
+    if (plistTab.empty())
+    {
+        plistTab.push_back(string(""));
+        for (int i = 1; i <= MAX_TAB; i++)
+            plistTab.push_back(plistTab.back() + TAB_REF);
+    }
+
+    //Binary mode.  Line endings are written exactly as given, the same on every platform.
+    ptFile = std::fopen(pathIn.c_str(), "ab");
+    pError = false;
+
+    return (ptFile != NULL);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool ReportWriter::close()
+{
+    bool output = flush();
+
+    if (ptFile)
+    {
+        if (std::fclose(ptFile) != 0)
+            output = false;
+        ptFile = NULL;
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool ReportWriter::flush()
+{
+    if (ptFile && (pBuffer.size() > 0))
+    {
+        if (std::fwrite(pBuffer.data(), 1, pBuffer.size(), ptFile) != pBuffer.size())
+            pError = true;
+    }
+
+    //Clearing keeps the capacity of the buffer.
+    pBuffer.clear();
+
+    return !pError;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::write(const string &textIn)
+{
+    pBuffer.append(textIn);
+
+    if (pBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::writeTab(int num)
+{
+    if (num <= MAX_TAB)
+        pBuffer.append(plistTab.at(num));
+    else
+    {
+        for (int i = 0; i < num; i++)
+            pBuffer.append(TAB_REF);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::writeValue(int valIn)
+{
+    char text[16];
+    int n = std::snprintf(text, sizeof(text), "%d", valIn);
+
+    pBuffer.append(text, n);
+
+    if (pBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::writeValue(double valIn)
+{
+    appendDouble(valIn);
+
+    if (pBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::writeValue(std::complex<double> valIn)
+{
+    pBuffer.append(LIST_BEGIN);
+    appendDouble(valIn.real());
+    pBuffer.append(COMPLEX_COORD);
+    appendDouble(valIn.imag());
+    pBuffer.append(LIST_END);
+
+    if (pBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void ReportWriter::appendDouble(double valIn)
+{
+    //Values that are not numbers.  Written without a sign for nan, the same as the report files have always used.
+    if (std::isnan(valIn))
+    {
+        pBuffer.append("nan");
+        return;
+    }
+    if (std::isinf(valIn))
+    {
+        pBuffer.append(valIn < 0 ? "-inf" : "inf");
+        return;
+    }
+
+    char text[32];
+    int n = std::snprintf(text, sizeof(text), "%.6e", valIn);
+
+    //The decimal mark always follows the first digit.  Force it to a period, regardless of the locale.
+    text[(text[0] == '-') ? 2 : 1] = '.';
+
+    pBuffer.append(text, n);
+}
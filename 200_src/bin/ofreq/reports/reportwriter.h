@@ -0,0 +1,190 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef REPORTWRITER_H
+#define REPORTWRITER_H
+#include <string>
+#include <vector>
+#include <complex>
+#include <cstdio>
+#include "../global_objects/ioword.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The ReportWriter class writes the text of output reports to a file.
+ *
+ * Reports can hold many thousands of values for a large sweep of wave frequencies and wave directions.  The writer
+ * formats each value directly into a large text buffer and only writes to the file when the buffer fills or the file
+ * is closed.  Indentation strings are built once and reused.  The writer uses only the standard library.
+ *
+ * Number formats are the same as the report files have always used.  Doubles are written in scientific notation
+ * with six decimal places, with at least two digits in the exponent.  Integers are written in
+ * plain decimal.  Complex numbers are written as (real,imaginary).  The decimal mark is always a period,
+ * regardless of the locale of the program.
+ */
+class ReportWriter : public ofreq::ioword
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    ReportWriter();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Writes any remaining text and closes the file.
+     */
+    ~ReportWriter();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Opens a file for writing.  Text is appended to the end of any existing file.  Closes any file already
+     * open.
+     * @param pathIn String.  The full path of the file.  Variable passed by value.
+     * @return Returns true if the file opened.  Returns false otherwise.
+     */
+    bool open(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes any remaining text and closes the file.
+     * @return Returns true if all text was written.  Returns false if any write failed.
+     */
+    bool close();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the text in the buffer to the file.
+     * @return Returns true if all text was written.  Returns false if the write failed.
+     */
+    bool flush();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes text.
+     * @param textIn String.  The text to write.  Variable passed by reference.
+     */
+    void write(const std::string &textIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes indentation.  Uses the TAB_REF string for each level.
+     * @param num Integer.  The number of indentation levels.  Variable passed by value.
+     */
+    void writeTab(int num = 1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes an integer in plain decimal.
+     * @param valIn Integer.  The value to write.  Variable passed by value.
+     */
+    void writeValue(int valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes a double in scientific notation, with six decimal places.
+     * @param valIn Double.  The value to write.  Variable passed by value.
+     */
+    void writeValue(double valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes a complex number as (real,imaginary).  Each part is written the same as a double.
+     * @param valIn Complex double.  The value to write.  Variable passed by value.
+     */
+    void writeValue(std::complex<double> valIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Appends a double to the buffer, in scientific notation, with six decimal places.
+     * @param valIn Double.  The value to write.  Variable passed by value.
+     */
+    void appendDouble(double valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::FILE *ptFile; /**< The open file.  NULL if no file is open. */
+    std::string pBuffer; /**< Text waiting to be written to the file. */
+    bool pError; /**< Boolean to record if any write to the file failed. */
+    std::vector<std::string> plistTab; /**< Indentation strings, indexed by the number of levels. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static unsigned int BUFFER_SIZE; /**< Size of the text buffer, in bytes.  The buffer is written when full. */
+    static int MAX_TAB; /**< Number of indentation levels built in advance. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // REPORTWRITER_H
@@ -0,0 +1,532 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+//Inclusions and namespaces
+#include "reppowergradient.h"
+#include "../system_objects/system.h"
+
+
+using namespace std;
+using namespace osea::ofreq;
+using namespace arma;
+
+//==========================================Section Separator =========================================================
+//Static variables
+string repPowerGradient::KEY_BODY = "body";    /**< Name of the body to associate with.*/
+string repPowerGradient::KEY_FORCENAME = "forcename"; /**< Name of the user reactive force that absorbs the power. */
+string repPowerGradient::KEY_QUANTITY = "quantity";    /**< The objective, power or efficiency. */
+string repPowerGradient::QUANT_POWER = "power";    /**< Value of KEY_QUANTITY for power. */
+string repPowerGradient::QUANT_EFFICIENCY = "efficiency";  /**< Value of KEY_QUANTITY for absolute efficiency. */
+string repPowerGradient::SEPARATOR = "::"; /**< Separator between parts of a block label. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repPowerGradient::repPowerGradient()
+{
+    //Assign a default value to the name.
+    this->setName("Power Gradient");
+
+    pForceName = "";
+    pEfficiency = false;
+    plistAdded = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repPowerGradient::repPowerGradient(ReportManager *ptIn) : repPowerGradient()
+{
+    this->setManager(ptIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repPowerGradient::calcReport(int freqInd)
+{
+    int prevFreqInd = ptSystem->getCurFreqInd();   //Frequency index of the System, restored when done.
+
+    try
+    {
+        if (pConstCalc)
+        {
+            //Define constants
+            for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+            {
+                this->defineConst(i);
+            }
+
+            //Add list of gradient blocks
+            if (!plistAdded)
+                addBlockNames();
+
+            //Turn off const calculation
+            pConstCalc = false;
+        }
+
+        //Check to make sure the body and force were assigned.
+        if (!ptBody)
+            throw std::runtime_error(string("No body found which matches the given body name."));
+
+        int forceInd = -1;
+        for (unsigned int i = 0; i < ptBody->listForceReact_user().size(); i++)
+        {
+            if (ptBody->listForceReact_user(i)->getForceName() == pForceName)
+            {
+                forceInd = i;
+                break;
+            }
+        }
+        if (forceInd < 0)
+            throw std::runtime_error(string("No user reactive force found on the body which matches the given force ")
+                                     + string("name:  ") + pForceName);
+
+        int dirInd = ptSystem->getCurWaveDirInd();
+        double freq = ptSystem->listWaveFrequencies(freqInd);
+
+        //Get the LU factors kept from the motion solver.
+        LUFactor *ptFactor = &(ptSystem->refFactor(dirInd, freqInd));
+
+        //Assemble the global solution, in the same sequence as the motion solver.
+        //---------------------------------------------------------------------------
+        vector<int> matStart;
+        cx_mat X(ptFactor->getSize(), 1);
+        int row = 0;
+        for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+        {
+            cx_mat soln = ptSystem->listSolutionSet(b).refSolution(dirInd, freqInd).getSolnMat();
+
+            matStart.push_back(row);
+            for (unsigned int i = 0; i < soln.n_rows; i++)
+                X(row + i, 0) = soln(i, 0);
+            row += soln.n_rows;
+        }
+        if (row != ptFactor->getSize())
+            throw std::runtime_error(string("Stored solutions do not match the size of the stored LU factors."));
+
+        //Calculate the weights of |X|^2 in the objective.
+        //P = SUM over odd u { 1/2 * pow(-1,(u+3)/2) * freq^(u+1) * Re(D(u)) * |X|^2 }
+        //where D(u) is the coefficient matrix from the motion model.
+        //---------------------------------------------------------------------------
+        MotionModel *ptMotion = &(ptBody->getMotionModel());
+
+        ptMotion->setBody(pBodIndex);
+        ptMotion->setSolutionSet(
+                    &(ptSystem->listSolutionSet())
+                    );
+        ptMotion->setWaveDirInd(dirInd);
+        ptMotion->setFreq(freqInd, freq);
+        ptMotion->CoefficientOnly() = true;
+        //The motion model reads the frequency index from the System.  Restored once the coefficients are read.
+        ptSystem->setCurFreqInd(freqInd);
+        ptMotion->Reset();
+
+        int nBod = ptMotion->getNumEquations();
+        int bodStart = matStart.at(pBodIndex);
+        int maxOrd = ptBody->listForceReact_user(forceInd)->getMaxOrd();
+
+        vector<double> weight(nBod, 0.0);
+
+        for (int ord = 1; ord <= maxOrd; ord += 2)
+        {
+            cx_mat coeff = ptMotion->getMatForceReact_user(forceInd, ord);
+            double negative = pow(-1, (ord + 3) / 2);
+
+            for (unsigned int i = 0; i < coeff.n_rows; i++)
+            {
+                for (unsigned int j = 0; j < coeff.n_cols; j++)
+                {
+                    weight.at(j) += 0.5 * negative * pow(freq, ord + 1) * coeff(i,j).real();
+                }
+            }
+        }
+        ptSystem->setCurFreqInd(prevFreqInd);
+
+        //Calculate the objective.
+        double objective = 0;
+        for (int j = 0; j < nBod; j++)
+            objective += weight.at(j) * std::norm(X(bodStart + j, 0));
+
+        //Solve the adjoint system.  [A]^T * [lambda] = [w] * conj([X])
+        //---------------------------------------------------------------------------
+        cx_mat rhs;
+        rhs.zeros(X.n_rows, 1);
+        for (int j = 0; j < nBod; j++)
+            rhs(bodStart + j, 0) = weight.at(j) * std::conj(X(bodStart + j, 0));
+
+        cx_mat lambda = ptFactor->solveTrans(rhs);
+
+        //Scale factor for efficiency.
+        double scale = 1.0;
+        if (pEfficiency)
+        {
+            repAbsEff repEff(this->ptManager);
+            repEff.setBody(this->ptBody);
+            scale = 1.0 / repEff.calcWavePow(freqInd);
+        }
+
+        //Write results to results list.
+        plistData.push_back(Data(freqInd));
+        plistData.back().addValue(objective * scale);
+
+        //Gradient for user reactive forces.
+        //---------------------------------------------------------------------------
+        for (unsigned int k = 0; k < ptSystem->listForceReact_user().size(); k++)
+        {
+            ForceReact *ptForce = &(ptSystem->listForceReact_user(k));
+
+            for (int ord = 0; ord <= ptForce->getMaxOrd(); ord++)
+            {
+                mat grad;
+                complex<double> dA = coeffScale(ord, freq);
+
+                for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+                {
+                    Body *ptBod = &(ptSystem->listBody(b));
+
+                    for (unsigned int f = 0; f < ptBod->listForceReact_user().size(); f++)
+                    {
+                        if (ptBod->listForceReact_user(f)->getForceName() != ptForce->getForceName())
+                            continue;
+
+                        int n = ptBod->getEquationCount();
+                        if (grad.n_rows == 0)
+                            grad.zeros(n, n);
+
+                        //Implicit term, through the solution.
+                        for (int r = 0; (r < n) && (r < static_cast<int>(grad.n_rows)); r++)
+                        {
+                            for (int c = 0; (c < n) && (c < static_cast<int>(grad.n_cols)); c++)
+                            {
+                                grad(r,c) += -2.0 * (lambda(matStart.at(b) + r, 0) * dA
+                                                     * X(matStart.at(b) + c, 0)).real();
+                            }
+                        }
+
+                        //Explicit term, for the force that absorbs the power.
+                        if ((static_cast<int>(b) == pBodIndex)
+                                && (static_cast<int>(f) == forceInd)
+                                && (ord % 2 != 0))
+                        {
+                            double explicitTerm = 0.5 * pow(-1, (ord + 3) / 2) * pow(freq, ord + 1);
+
+                            for (int r = 0; (r < n) && (r < static_cast<int>(grad.n_rows)); r++)
+                            {
+                                for (int c = 0; (c < n) && (c < static_cast<int>(grad.n_cols)); c++)
+                                {
+                                    grad(r,c) += explicitTerm * std::norm(X(matStart.at(b) + c, 0));
+                                }
+                            }
+                        }
+                    }
+                }
+
+                //Write the block, in row major order.
+                for (unsigned int r = 0; r < grad.n_rows; r++)
+                {
+                    for (unsigned int c = 0; c < grad.n_cols; c++)
+                        plistData.back().addValue(grad(r,c) * scale);
+                }
+            }
+        }
+
+        //Gradient for user cross-body forces.
+        //---------------------------------------------------------------------------
+        for (unsigned int k = 0; k < ptSystem->listForceCross_user().size(); k++)
+        {
+            ForceCross *ptForce = &(ptSystem->listForceCross_user(k));
+
+            //Each block has a row for each equation of the body, and a column for each equation of the linked body.
+            int nRow, nCol;
+            if (!getCrossSize(ptForce->getForceName(), nRow, nCol))
+                continue;
+
+            for (int ord = 0; ord <= ptForce->getMaxOrd(); ord++)
+            {
+                mat grad;
+                grad.zeros(nRow, nCol);
+                complex<double> dA = coeffScale(ord, freq);
+
+                for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+                {
+                    Body *ptBod = &(ptSystem->listBody(b));
+
+                    for (unsigned int f = 0; f < ptBod->listForceCross_user().size(); f++)
+                    {
+                        if (ptBod->listForceCross_user(f)->getForceName() != ptForce->getForceName())
+                            continue;
+
+                        //Cross-body forces are only included in the global matrix for other bodies.
+                        int link = ptBod->listCrossIndex_user().at(f);
+                        if ((link < 0) || (link == static_cast<int>(b)))
+                            continue;
+
+                        for (int r = 0; r < nRow; r++)
+                        {
+                            for (int c = 0; c < nCol; c++)
+                            {
+                                grad(r,c) += -2.0 * (lambda(matStart.at(b) + r, 0) * dA
+                                                     * X(matStart.at(link) + c, 0)).real();
+                            }
+                        }
+                    }
+                }
+
+                //Write the block, in row major order.
+                for (unsigned int r = 0; r < grad.n_rows; r++)
+                {
+                    for (unsigned int c = 0; c < grad.n_cols; c++)
+                        plistData.back().addValue(grad(r,c) * scale);
+                }
+            }
+        }
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        ptSystem->setCurFreqInd(prevFreqInd);
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repPowerGradient::calcRAO(int freqInd)
+{
+    try
+    {
+        if (pCalcRAO)
+        {
+            //Get amplitude.
+            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
+
+            //Power scales with amplitude squared.  Efficiency does not depend on amplitude.
+            double scale = 1.0;
+            if (!pEfficiency)
+                scale = 1.0 / pow(amp, 2);
+
+            //Write result to results list.
+            plistRAO.push_back(Data(freqInd));
+
+            //Add values to Data object.
+            for (unsigned int i = 0; i < plistData.at(freqInd).listValue().size(); i++)
+            {
+                plistRAO.back().addValue(plistData.at(freqInd).listValueDouble(i)
+                                              * scale);
+            }
+        }
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string repPowerGradient::getClass()
+{
+    //Name of the class
+    return "repPowerGradient";
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string repPowerGradient::getFileName()
+{
+    //Filename for the class.
+    return "power_gradient.out";
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repPowerGradient::defineConst(int constIndex)
+{
+    //Define constants for report.
+
+    try
+    {
+        if (plistConst_Key.at(constIndex) == KEY_FORCENAME)
+        {
+            //Process force name.
+            pForceName = plistConst_Val.at(constIndex).listString(0);
+        }
+
+        if (plistConst_Key.at(constIndex) == KEY_QUANTITY)
+        {
+            //Process objective.
+            string quant = plistConst_Val.at(constIndex).listString(0);
+
+            if (quant == QUANT_EFFICIENCY)
+                pEfficiency = true;
+            else if (quant == QUANT_POWER)
+                pEfficiency = false;
+            else
+                throw std::runtime_error(string("Quantity not recognized.  Use ") + QUANT_POWER + string(" or ")
+                                         + QUANT_EFFICIENCY + string(".  Offending value:  ") + quant);
+        }
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+complex<double> repPowerGradient::coeffScale(int ord, double freq)
+{
+    //The time derivative, (j * freq)^ord, applied by the motion solver.
+    return pow(complex<double>(0.0, freq), ord);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repPowerGradient::addBlockNames()
+{
+    try
+    {
+        //Add the labels of each block of values, for user reference in output.
+        plistConst_Key.push_back(string("values_included "));
+        plistConst_Val.push_back(Data());
+
+        plistConst_Val.back().addString(string("objective"));
+
+        for (unsigned int k = 0; k < ptSystem->listForceReact_user().size(); k++)
+        {
+            ForceReact *ptForce = &(ptSystem->listForceReact_user(k));
+
+            //Skip forces not used by any body.  They have no entries in the output.
+            int n = -1;
+            for (unsigned int b = 0; (b < ptSystem->listBody().size()) && (n < 0); b++)
+            {
+                for (unsigned int f = 0; f < ptSystem->listBody(b).listForceReact_user().size(); f++)
+                {
+                    if (ptSystem->listBody(b).listForceReact_user(f)->getForceName() == ptForce->getForceName())
+                    {
+                        n = ptSystem->listBody(b).getEquationCount();
+                        break;
+                    }
+                }
+            }
+            if (n < 0)
+                continue;
+
+            for (int ord = 0; ord <= ptForce->getMaxOrd(); ord++)
+            {
+                plistConst_Val.back().addString(
+                            string("react") + SEPARATOR + ptForce->getForceName() + SEPARATOR + itoa(ord)
+                            + SEPARATOR + itoa(n) + string("x") + itoa(n)
+                            );
+            }
+        }
+
+        for (unsigned int k = 0; k < ptSystem->listForceCross_user().size(); k++)
+        {
+            ForceCross *ptForce = &(ptSystem->listForceCross_user(k));
+
+            //Skip forces not linking any two bodies.  They have no entries in the output.
+            int nRow, nCol;
+            if (!getCrossSize(ptForce->getForceName(), nRow, nCol))
+                continue;
+
+            for (int ord = 0; ord <= ptForce->getMaxOrd(); ord++)
+            {
+                plistConst_Val.back().addString(
+                            string("cross") + SEPARATOR + ptForce->getForceName() + SEPARATOR + itoa(ord)
+                            + SEPARATOR + itoa(nRow) + string("x") + itoa(nCol)
+                            );
+            }
+        }
+
+        //Set the boolean to note that the list was already added.
+        plistAdded = true;
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool repPowerGradient::getCrossSize(string forceName, int &nRow, int &nCol)
+{
+    bool found = false;
+    nRow = 0;
+    nCol = 0;
+
+    //The linked bodies are found through the indices resolved at load.
+    if (!ptSystem->isIndexResolved())
+        ptSystem->resolveIndex();
+
+    for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+    {
+        Body *ptBod = &(ptSystem->listBody(b));
+
+        for (unsigned int f = 0; f < ptBod->listForceCross_user().size(); f++)
+        {
+            if (ptBod->listForceCross_user(f)->getForceName() != forceName)
+                continue;
+
+            int link = ptBod->listCrossIndex_user().at(f);
+            if ((link < 0) || (link == static_cast<int>(b)))
+                continue;
+
+            int n = ptBod->getEquationCount();
+            int nLink = ptSystem->listBody(link).getEquationCount();
+
+            if (!found)
+            {
+                nRow = n;
+                nCol = nLink;
+                found = true;
+            }
+            else if ((nRow != n) || (nCol != nLink))
+            {
+                //The coefficients are shared, so every pair of bodies must have the same size.
+                throw std::runtime_error(string("User cross-body force links bodies with different numbers of ")
+                                         + string("equations.  Gradient can not be calculated for force:  ")
+                                         + forceName);
+            }
+        }
+    }
+
+    return found;
+}
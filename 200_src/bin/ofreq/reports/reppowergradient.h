@@ -0,0 +1,235 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef REPPOWERGRADIENT_H
+#define REPPOWERGRADIENT_H
+#include "report.h"
+#include "repabseff.h"
+
+#ifdef Q_OS_WIN
+    //Any windows specific inclusions go in here.
+#elif defined Q_OS_LINUX
+    //Any linux specific inclusions go in here.
+#endif
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * @brief The Report for the gradient of absorbed power with respect to every user force coefficient.
+ *
+ * The objective is the average power absorbed by one user reactive force on one body, summed over all motion
+ * variables.  This uses the same formula as the body power report:
+ * P = sum over odd orders u { 1/2 * pow(-1,(u+3)/2) * freq^(u+1) * k(u) * |X|^2 }
+ * The Report can also give the absolute efficiency instead, which divides the power by the maximum wave power.  The
+ * maximum wave power only depends on the hydrodynamic forces, so the gradient is scaled the same way.
+ *
+ * The gradient is calculated with the adjoint method.  The solution X solves [A] * [X] = [F].  For a coefficient k
+ * that enters the global reactive matrix [A]:
+ * dP/dk = explicit term - 2 * Re( [lambda]^T * dA/dk * [X] )
+ * where [lambda] solves the adjoint system [A]^T * [lambda] = [w] * conj([X]), and [w] are the weights of |X|^2 in
+ * the objective.  The adjoint system reuses the LU factors kept from the motion solver.  So the cost is one extra
+ * pair of triangular solves per wave frequency, regardless of the number of coefficients.  The factors are only
+ * kept when a Report of this type is defined.
+ *
+ * Gradients are given for every coefficient of every user reactive force and user cross-body force, for every
+ * order of derivative.  A force used by several bodies shares its coefficients, so its gradient is summed over the
+ * bodies.  The coefficients are treated as real numbers, as entered in the forces input file.  The first value for
+ * each wave frequency is the objective itself.  Then each force and order of derivative follows as a block of
+ * values, with coefficients in row major order.  A cross-body block has a row for each equation of the body and a
+ * column for each equation of the linked body.  The labels of the blocks are written as a constant of the Report.
+ *
+ * The following keywords are declared:
+ *
+ * KEY_BODY:        String.  Name of the body to associate with.
+ * KEY_FORCENAME:   String.  Name of the user reactive force that absorbs the power.
+ * KEY_QUANTITY:    String.  The objective.  Either "power" (default) or "efficiency".
+ */
+class repPowerGradient : public ofreq::Report
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor object.
+     */
+    repPowerGradient();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.  Sets a pointer to the system object.
+     * @param ptIn Pointer to ReportManager object that owns this Report object, pointer passed by value.
+     */
+    repPowerGradient(ofreq::ReportManager *ptIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Generates the Report Data.
+     *
+     * Writes the results of the calculation to the vector of Data values.  Calling the calcReport function only
+     * generates the values.  They must be retrieved from the object after calculation, using the listData() function.
+     * @param freqInd Integer, variable passed by value.  The wave frequency index to use for calculating the Report
+     * object's data.  Specifies the index of the wave frequency to retrieve from the list of wave frequencies.
+     */
+    virtual void calcReport(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the RAO report data.
+     *
+     * Power scales with the square of the wave amplitude.  So the RAO of the power gradient divides by the square of
+     * the wave amplitude.  Efficiency does not depend on wave amplitude, so it is copied unchanged.
+     * @param freqInd Integer, variable passed by value.  The wave frequency index to use for calculating the Report
+     * object's data.
+     */
+    virtual void calcRAO(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the class associated with this Report object.
+     * @return Returns the name of the Report class.  Returned variable is a string, variable passed by value.
+     */
+    virtual std::string getClass();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides the filename associated with this Report object.
+     * @return Returns a string object, passed by value.  String is the filename associated with this Report.
+     */
+    virtual std::string getFileName();
+
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads through each of the constants assigned to this report object and processes them as needed.
+     * @param constIndex Integer, passed by value.  The index of the Report constant value to evaluate.
+     */
+    void defineConst(int constIndex);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the scale factor that takes a user force coefficient into the global reactive matrix.
+     *
+     * The motion model returns the coefficient itself.  The motion solver applies the time derivative when it sums
+     * the orders of derivative.  The gradient follows the matrix as it is assembled.
+     * @param ord Integer, passed by value.  The order of derivative.
+     * @param freq Double, passed by value.  The wave frequency.
+     * @return Returns complex double, passed by value.  The scale factor, dA/dk.
+     */
+    std::complex<double> coeffScale(int ord, double freq);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the labels of the gradient blocks to the constants of the Report, for user reference in output.
+     */
+    void addBlockNames();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds the size of the gradient block for a user cross-body force.
+     *
+     * The block has a row for each equation of the body that owns the force, and a column for each equation of the
+     * linked body.  A force used by several pairs of bodies shares its coefficients, so every pair must have the
+     * same size.  Throws std::runtime_error if not.
+     * @param forceName String, passed by value.  The name of the user cross-body force.
+     * @param nRow Integer, passed by reference.  Set to the number of rows of the block.
+     * @param nCol Integer, passed by reference.  Set to the number of columns of the block.
+     * @return Returns boolean, passed by value.  False if no body links to another body with the force.  The force
+     * has no block in the output.
+     */
+    bool getCrossSize(std::string forceName, int &nRow, int &nCol);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pForceName; /**< Name of the user reactive force that absorbs the power. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pEfficiency = false; /**< Boolean to record if the objective is absolute efficiency. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool plistAdded = false; /**< Boolean to track if the list of block labels was already added. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static variables
+    static std::string KEY_BODY;        /**< Name of the body to associate with.*/
+    static std::string KEY_FORCENAME;   /**< Name of the user reactive force that absorbs the power. */
+    static std::string KEY_QUANTITY;    /**< The objective, power or efficiency. */
+    static std::string QUANT_POWER;     /**< Value of KEY_QUANTITY for power. */
+    static std::string QUANT_EFFICIENCY;    /**< Value of KEY_QUANTITY for absolute efficiency. */
+    static std::string SEPARATOR;       /**< Separator between parts of a block label. */
+};
+
+}   //Namespace ofreq
+
+}   //Namespace osea
+
+#endif // REPPOWERGRADIENT_H
@@ -131,7 +131,7 @@ void repRelEff::calcRAO(int freqInd)
         if (pCalcRAO)
         {
             //Get amplitude.
-            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+            double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
 
             //Write result to results list.
             plistRAO.push_back(Data(freqInd));
@@ -164,6 +164,21 @@ std::string repRelEff::getFileName()
     return "efficiency_relative.out";
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> repRelEff::listDepend()
+{
+    vector<string> output;
+
+    //The power report is the only report referenced.
+    for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+    {
+        if ((plistConst_Key.at(i) == KEY_POWERREP) && (plistConst_Val.at(i).listString().size() > 0))
+            output.push_back(plistConst_Val.at(i).listString(0));
+    }
+
+    return output;
+}
+
 
 //==========================================Section Separator =========================================================
 //Protected Functions
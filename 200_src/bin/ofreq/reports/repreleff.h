@@ -160,6 +160,14 @@ public:
      */
     virtual std::string getFileName();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Lists the names of the other reports that this Report depends on.  This is the power report named by
+     * the constant KEY_POWERREP.
+     * @return Returns a vector of strings, variable passed by value.  The name of the power report, if one is set.
+     */
+    virtual std::vector<std::string> listDepend();
+
 
 //==========================================Section Separator =========================================================
 protected:
@@ -0,0 +1,333 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "reptimehistory.h"
+#include "../system_objects/system.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace osea::ofreq;
+using namespace arma;
+
+//==========================================Section Separator =========================================================
+//Static variables
+string repTimeHistory::KEY_BODY = "body";    /**< Name of the body to associate with.*/
+string repTimeHistory::KEY_ORDER = "order";  /**< Order of derivative. */
+string repTimeHistory::KEY_DURATION = "duration";    /**< Duration of each time history. */
+string repTimeHistory::KEY_TIMESTEP = "timestep";    /**< Time step of each time history. */
+string repTimeHistory::KEY_SEEDS = "seeds";  /**< The number of seeds. */
+string repTimeHistory::KEY_SEED = "seed";    /**< The first seed. */
+string repTimeHistory::KEY_THREADS = "threads";  /**< The number of threads. */
+string repTimeHistory::FILE_STEM = "timehistory";    /**< Start of the name of each time history file. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repTimeHistory::repTimeHistory()
+{
+    //Assign a default value to the name.
+    this->setName("Time History");
+
+    pOrd = 0;
+    pDuration = 3600.0;
+    pTimeStep = 0.1;
+    pNumSeed = 1;
+    pFirstSeed = 1;
+    pThreads = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+repTimeHistory::repTimeHistory(ReportManager *ptIn) : repTimeHistory()
+{
+    this->setManager(ptIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repTimeHistory::calcReport(int freqInd)
+{
+    try
+    {
+        if (pConstCalc)
+        {
+            //Define constants
+            for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+            {
+                this->defineConst(i);
+            }
+
+            //Turn off const calculation
+            pConstCalc = false;
+        }
+
+        cx_mat output = calcTransfer(ptSystem->getCurWaveDirInd(), freqInd);
+
+        //Write result to results list.
+        plistData.push_back(Data(freqInd));
+
+        //Add values to Data object.
+        for (unsigned int i = 0; i < output.n_rows; i++)
+        {
+            plistData.back().addValue(
+                        output(i,0));
+        }
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repTimeHistory::calcRAO(int freqInd)
+{
+    //Nothing to do.  The report data is already normalized by wave amplitude.
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repTimeHistory::finishReport()
+{
+    try
+    {
+        if (pConstCalc)
+        {
+            //Define constants
+            for (unsigned int i = 0; i < plistConst_Key.size(); i++)
+            {
+                this->defineConst(i);
+            }
+
+            //Turn off const calculation
+            pConstCalc = false;
+        }
+
+        //Check to make sure the body was assigned.
+        if (!ptBody || (this->getBodIndex() < 0))
+            throw std::runtime_error(string("No body found which matches the given body name."));
+
+        logStd.Write(getClass() + string("::") + ptBody->getBodyName() + string("::  ") + getName(), 3);
+
+        //Wave frequencies in increasing order.
+        vector<double> &freq = ptSystem->listWaveFrequencies();
+        vector<int> order;
+        for (unsigned int i = 0; i < freq.size(); i++)
+            order.push_back(i);
+        std::sort(order.begin(), order.end(), [&freq](int a, int b){return freq.at(a) < freq.at(b);});
+        int nFreq = order.size();
+
+        //Set up the synthesis.
+        TimeSynth synth;
+        synth.setDuration(pDuration);
+        synth.setTimeStep(pTimeStep);
+        if (pThreads > 0)
+            synth.setThreads(pThreads);
+        synth.setFreqRange(freq.at(order.front()), freq.at(order.back()));
+
+        vector<double> grid = synth.listFreq();
+        double step = 2.0 * M_PI / pDuration;
+        int nGrid = grid.size();
+
+        int nVar = ptSystem->listSolutionSet(this->getBodIndex()).refSolution(0,0).refSolnMat().n_rows;
+        vector<string> label;
+        for (int i = 0; i < nVar; i++)
+            label.push_back(ptBody->getBodyName() + string("_") + itoa(i + 1));
+        synth.setLabel(label);
+
+        //Wave components for each wave direction.
+        //---------------------------------------------------------------------------
+        for (unsigned int d = 0; d < ptSystem->listWaveDirections().size(); d++)
+        {
+            double dir = ptSystem->listWaveDirections(d);
+
+            //RAOs at the wave frequencies, in increasing order.
+            cx_mat rao(nVar, nFreq);
+            for (int k = 0; k < nFreq; k++)
+                rao.col(k) = calcTransfer(d, order.at(k));
+
+            //Interpolate RAOs onto the refined grid.  Wave amplitudes use the same definition as
+            //SeaModel::getWaveAmp(), with the spacing of the refined grid.
+            vec amp(nGrid);
+            cx_mat trans(nVar, nGrid);
+            int k = 0;
+            for (int m = 0; m < nGrid; m++)
+            {
+                if (nFreq == 1)
+                {
+                    trans.col(m) = rao.col(0);
+                }
+                else
+                {
+                    while ((k < nFreq - 2) && (freq.at(order.at(k + 1)) < grid.at(m)))
+                        k++;
+
+                    double f0 = freq.at(order.at(k));
+                    double f1 = freq.at(order.at(k + 1));
+                    double w = (f1 > f0) ? (grid.at(m) - f0) / (f1 - f0) : 0.0;
+                    trans.col(m) = complex<double>(1.0 - w, 0.0) * rao.col(k)
+                                   + complex<double>(w, 0.0) * rao.col(k + 1);
+                }
+
+                double energy = ptSystem->refActiveSeaModel().getWaveEnergy(dir, grid.at(m));
+                amp(m) = (energy > 0.0) ? sqrt(2.0 * energy * step) : 0.0;
+            }
+
+            synth.addDirection(amp, trans);
+        }
+
+        //Synthesize each seed.
+        //---------------------------------------------------------------------------
+        string stem = ptSystem->getPath() + SLASH + FILE_STEM + string("_body") + itoa(this->getBodIndex() + 1);
+        synth.runSeeds(pFirstSeed, pNumSeed, stem);
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string repTimeHistory::getClass()
+{
+    return "repTimeHistory";
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string repTimeHistory::getFileName()
+{
+    return "timehistory.out";
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void repTimeHistory::defineConst(int constIndex)
+{
+    //Define constants for report.
+
+    try
+    {
+        if (plistConst_Key.at(constIndex) == KEY_BODY)
+        {
+            //Process body.
+            //Get the correct body and assign it.
+            for (unsigned int i = 0; i < ptSystem->listBody().size(); i++)
+            {
+                if (ptSystem->listBody(i).getBodyName() == plistConst_Val.at(constIndex).listString(0))
+                {
+                    ptBody = &(ptSystem->listBody(i));
+                    break;
+                }
+            }
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_ORDER)
+        {
+            //Process order of derivative.
+            pOrd = plistConst_Val.at(constIndex).listValueInt(0);
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_DURATION)
+        {
+            pDuration = plistConst_Val.at(constIndex).listValueDouble(0);
+            if (pDuration <= 0.0)
+                throw std::runtime_error(string("Time history duration must be greater than zero."));
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_TIMESTEP)
+        {
+            pTimeStep = plistConst_Val.at(constIndex).listValueDouble(0);
+            if (pTimeStep <= 0.0)
+                throw std::runtime_error(string("Time history time step must be greater than zero."));
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_SEEDS)
+        {
+            pNumSeed = plistConst_Val.at(constIndex).listValueInt(0);
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_SEED)
+        {
+            pFirstSeed = plistConst_Val.at(constIndex).listValueInt(0);
+        }
+
+        else if (plistConst_Key.at(constIndex) == KEY_THREADS)
+        {
+            pThreads = plistConst_Val.at(constIndex).listValueInt(0);
+        }
+
+        else
+        {
+            //throw an error.
+            throw std::runtime_error(string("Unknown key specified.  Offending key:  ") + plistConst_Key.at(constIndex));
+        }
+    }
+    catch(const std::exception &err)
+    {
+        //Error handler.
+        logStd.Notify();
+        logErr.Write(ID + string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_mat repTimeHistory::calcTransfer(int dirInd, int freqInd)
+{
+    cx_mat output = ptSystem->listSolutionSet(this->getBodIndex()).refSolution(dirInd, freqInd).getSolnMat();
+
+    //Wave amplitude used by the motion solver for this point.
+    double freq = ptSystem->listWaveFrequencies(freqInd);
+    double amp = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->listWaveDirections(dirInd), freqInd);
+
+    if (amp <= 0.0)
+    {
+        //No wave energy, so the RAO is unknown.  Leave it out of the time history.
+        output.zeros();
+        return output;
+    }
+
+    return output * (pow(complex<double>(0.0, freq), pOrd) / amp);
+}
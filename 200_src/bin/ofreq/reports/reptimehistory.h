@@ -0,0 +1,210 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef REPTIMEHISTORY_H
+#define REPTIMEHISTORY_H
+#include "report.h"
+#include "timesynth.h"
+
+#ifdef Q_OS_WIN
+    //Any windows specific inclusions go in here.
+#elif defined Q_OS_LINUX
+    //Any linux specific inclusions go in here.
+#endif
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * @brief Report that synthesizes irregular sea time histories of Body motions.
+ *
+ * For each wave direction, the report writes the RAO of each global motion variable of the body, like
+ * repGlobSolution.  After all wave directions are written, the RAOs are interpolated onto a refined frequency grid
+ * and combined with wave amplitudes from the active sea model and random phases.  The time histories are produced
+ * with the TimeSynth class, one binary file for each seed, in the case directory.  Files are named
+ * timehistory_body<n>_seed<k>.bin.  The following keywords are declared:
+ *
+ * KEY_BODY:        String.  Name of the body to associate with.
+ * KEY_ORDER:       Integer.  The order of the derivative.  Default is 0, motions.
+ * KEY_DURATION:    Double.  Duration of each time history, in seconds.  Default is 3600 s.
+ * KEY_TIMESTEP:    Double.  Time step of each time history, in seconds.  Default is 0.1 s.
+ * KEY_SEEDS:       Integer.  The number of seeds to synthesize.  Default is 1.
+ * KEY_SEED:        Integer.  The first seed.  Default is 1.
+ * KEY_THREADS:     Integer.  The number of threads.  Default is the number of processors.
+ */
+class repTimeHistory : public ofreq::Report
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    repTimeHistory();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Constructor with pointer to the ReportManager that owns this report.
+     * @param ptIn Pointer to ReportManager object, pointer passed by value.
+     */
+    repTimeHistory(ofreq::ReportManager *ptIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the RAO of each global motion variable for the current wave direction.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     */
+    virtual void calcReport(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Does nothing.  The report data is already the RAO.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     */
+    virtual void calcRAO(int freqInd = -1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Synthesizes and writes the time histories, using all wave directions.
+     */
+    virtual void finishReport();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of the class associated with this Report object.
+     * @return Returns the name of the Report class.  Returned variable is a string, variable passed by value.
+     */
+    virtual std::string getClass();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides the filename associated with this Report object.
+     * @return Returns a string object, passed by value.  String is the filename associated with this Report.
+     */
+    virtual std::string getFileName();
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Defines the constants of the report from the list of user inputs.
+     * @param constIndex Integer, variable passed by value.  The index of the constant to define.
+     */
+    void defineConst(int constIndex);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the RAO of each global motion variable, for one wave direction and wave frequency.
+     * @param dirInd Integer, variable passed by value.  The index of the wave direction.
+     * @param freqInd Integer, variable passed by value.  The index of the wave frequency.
+     * @return Returns complex matrix with one column.  One row for each motion variable.  Variable passed by value.
+     * RAOs are zero where the wave amplitude is zero.
+     */
+    arma::cx_mat calcTransfer(int dirInd, int freqInd);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pOrd; /**< The order of derivative. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pDuration; /**< Duration of each time history, in seconds. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pTimeStep; /**< Time step of each time history, in seconds. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pNumSeed; /**< The number of seeds to synthesize. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pFirstSeed; /**< The first seed. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pThreads; /**< The number of threads.  Zero uses the number of processors. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static variables
+    static std::string KEY_BODY;        /**< Name of the body to associate with.*/
+    static std::string KEY_ORDER;       /**< Order of derivative. */
+    static std::string KEY_DURATION;    /**< Duration of each time history. */
+    static std::string KEY_TIMESTEP;    /**< Time step of each time history. */
+    static std::string KEY_SEEDS;       /**< The number of seeds. */
+    static std::string KEY_SEED;        /**< The first seed. */
+    static std::string KEY_THREADS;     /**< The number of threads. */
+    static std::string FILE_STEM;       /**< Start of the name of each time history file. */
+};
+
+}   //Namespace ofreq
+
+}   //Namespace osea
+
+#endif // REPTIMEHISTORY_H
@@ -112,7 +112,7 @@ void repWaveSpectra::calcReport(int freqInd)
         if (pCalcAmp)
         {
             //Get wave amplitude.
-            output = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDirInd(), freqInd);
+            output = ptSystem->refActiveSeaModel().getWaveAmp(ptSystem->getCurWaveDir(), freqInd);
         }
         else
         {
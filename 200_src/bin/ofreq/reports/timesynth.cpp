@@ -0,0 +1,317 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "timesynth.h"
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string TimeSynth::MAGIC = "OSEATS01"; /**< Identifier at the start of every binary time history file. */
+int TimeSynth::ROWBLOCK = 4096; /**< The number of rows written to the file at a time. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSynth::TimeSynth()
+{
+    pDuration = 3600.0;
+    pTimeStep = 0.1;
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+    pFirstBin = 0;
+    pNumBin = 0;
+    pNumSample = 0;
+    pNext = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSynth::~TimeSynth()
+{
+    //Nothing to clean up.
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::setDuration(double durationIn)
+{
+    if (durationIn <= 0.0)
+        throw std::invalid_argument("Time history duration must be greater than zero.");
+    pDuration = durationIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::setTimeStep(double stepIn)
+{
+    if (stepIn <= 0.0)
+        throw std::invalid_argument("Time history time step must be greater than zero.");
+    pTimeStep = stepIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::setThreads(int threadsIn)
+{
+    pThreads = (threadsIn < 1) ? 1 : threadsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::setFreqRange(double minIn, double maxIn)
+{
+    double step = 2.0 * M_PI / pDuration;
+
+    //Grid frequencies inside the range.  The zero frequency never gets a wave component.
+    pFirstBin = static_cast<int>(ceil(minIn / step));
+    if (pFirstBin < 1)
+        pFirstBin = 1;
+    int lastBin = static_cast<int>(floor(maxIn / step));
+    pNumBin = lastBin - pFirstBin + 1;
+
+    if (pNumBin < 1)
+        throw std::runtime_error("No frequencies of the refined grid are inside the range of wave frequencies.  "
+                                 "Increase the duration of the time history.");
+
+    plistAmp.clear();
+    plistTrans.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> TimeSynth::listFreq()
+{
+    vector<double> output;
+    double step = 2.0 * M_PI / pDuration;
+
+    for (int i = 0; i < pNumBin; i++)
+        output.push_back((pFirstBin + i) * step);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::setLabel(vector<string> labelIn)
+{
+    plistLabel = labelIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::addDirection(vec ampIn, cx_mat transIn)
+{
+    if ((static_cast<int>(ampIn.n_elem) != pNumBin) || (static_cast<int>(transIn.n_cols) != pNumBin))
+        throw std::invalid_argument("Wave components do not match the number of grid frequencies.");
+    if (transIn.n_rows != plistLabel.size())
+        throw std::invalid_argument("Transfer functions do not match the number of channels.");
+
+    plistAmp.push_back(ampIn);
+    plistTrans.push_back(transIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::run(int seedIn, string fileIn)
+{
+    prepare();
+    synthesize(seedIn, fileIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::runSeeds(int firstIn, int numIn, string stemIn)
+{
+    prepare();
+
+    //Each thread takes the next seed from the shared counter.
+    pNext = 0;
+    int nThread = (pThreads < numIn) ? pThreads : numIn;
+
+    vector<std::thread> listThread;
+    for (int t = 0; t < nThread; t++)
+        listThread.push_back(std::thread(&TimeSynth::runWorker, this, firstIn, numIn, stemIn));
+
+    for (unsigned int t = 0; t < listThread.size(); t++)
+        listThread.at(t).join();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string TimeSynth::getSeedFile(string stemIn, int seedIn)
+{
+    return stemIn + "_seed" + std::to_string(seedIn) + ".bin";
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::prepare()
+{
+    if (plistAmp.size() == 0)
+        throw std::runtime_error("No wave components defined for the time history.");
+
+    //Number of samples, so the duration holds a whole number of time steps.
+    pNumSample = static_cast<int>(ceil(pDuration / pTimeStep - 1e-9));
+
+    //The highest wave component must stay below the Nyquist frequency.
+    int lastBin = pFirstBin + pNumBin - 1;
+    if (2 * lastBin >= pNumSample)
+        throw std::runtime_error(string("Time step too large for the highest wave frequency.  Use a time step ")
+                                 + string("less than ") + std::to_string(pDuration / (2 * lastBin + 1))
+                                 + string(" s."));
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::synthesize(int seedIn, string fileIn)
+{
+    int nChan = plistLabel.size() + 1;      //Wave elevation plus each channel.
+    int nCol = nChan + 1;                   //Time plus each channel.
+    double step = pDuration / pNumSample;
+
+    //Combine the wave directions.  One random phase for each wave direction and frequency.
+    //---------------------------------------------------------------------------
+    std::mt19937 gen(static_cast<unsigned int>(seedIn));
+    cx_mat comp(nChan, pNumBin);
+    comp.zeros();
+
+    for (unsigned int d = 0; d < plistAmp.size(); d++)
+    {
+        for (int m = 0; m < pNumBin; m++)
+        {
+            double phase = 2.0 * M_PI * (static_cast<double>(gen()) / 4294967296.0);
+            complex<double> wave = std::polar(plistAmp.at(d)(m), phase);
+
+            comp(0, m) += wave;
+            for (int c = 1; c < nChan; c++)
+                comp(c, m) += plistTrans.at(d)(c - 1, m) * wave;
+        }
+    }
+
+    //One inverse real FFT for each channel.
+    //x(t) = Re( sum( comp * exp(i * w * t) ) ), and the inverse FFT divides by the number of samples.
+    //---------------------------------------------------------------------------
+    mat hist(pNumSample, nChan);
+    alglib::complex_1d_array spec;
+    alglib::real_1d_array line;
+    spec.setlength(pNumSample / 2 + 1);
+
+    for (int c = 0; c < nChan; c++)
+    {
+        for (int k = 0; k < spec.length(); k++)
+            spec[k] = alglib::complex(0.0, 0.0);
+
+        for (int m = 0; m < pNumBin; m++)
+        {
+            complex<double> val = comp(c, m) * (pNumSample / 2.0);
+            spec[pFirstBin + m] = alglib::complex(val.real(), val.imag());
+        }
+
+        alglib::fftr1dinv(spec, pNumSample, line);
+
+        for (int i = 0; i < pNumSample; i++)
+            hist(i, c) = line[i];
+    }
+
+    //Write the file.
+    //---------------------------------------------------------------------------
+    ofstream out(fileIn.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::ios_base::failure("Could not write time history file:  " + fileIn);
+
+    vector<string> label;
+    label.push_back("time");
+    label.push_back("wave");
+    label.insert(label.end(), plistLabel.begin(), plistLabel.end());
+
+    out.write(MAGIC.c_str(), MAGIC.size());
+    int32_t count = nCol;
+    out.write(reinterpret_cast<const char *>(&count), sizeof(int32_t));
+    for (unsigned int i = 0; i < label.size(); i++)
+    {
+        int32_t len = label.at(i).size();
+        out.write(reinterpret_cast<const char *>(&len), sizeof(int32_t));
+        out.write(label.at(i).c_str(), len);
+    }
+
+    //Rows are written in blocks, to keep the file writes large.
+    vector<double> buffer;
+    buffer.reserve(ROWBLOCK * nCol);
+    for (int i = 0; i < pNumSample; i++)
+    {
+        buffer.push_back(i * step);
+        for (int c = 0; c < nChan; c++)
+            buffer.push_back(hist(i, c));
+
+        if ((static_cast<int>(buffer.size()) >= ROWBLOCK * nCol) || (i == pNumSample - 1))
+        {
+            out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(double));
+            buffer.clear();
+        }
+    }
+
+    if (!out)
+        throw std::ios_base::failure("Error writing time history file:  " + fileIn);
+    out.close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSynth::runWorker(int firstIn, int numIn, string stemIn)
+{
+    while (true)
+    {
+        int next = pNext++;
+        if (next >= numIn)
+            break;
+
+        int seed = firstIn + next;
+        try
+        {
+            synthesize(seed, getSeedFile(stemIn, seed));
+            logStd.Write("Time history written for seed " + std::to_string(seed), 3);
+        }
+        catch(const std::exception &err)
+        {
+            //Error handler.  One failed seed does not stop the others.
+            logStd.Notify();
+            logErr.Write(ID + string(err.what()));
+        }
+    }
+}
@@ -0,0 +1,267 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef TIMESYNTH_H
+#define TIMESYNTH_H
+#include <string>
+#include <vector>
+#include <complex>
+#include <atomic>
+#include <armadillo>
+#include "../system_objects/ofreqcore.h"
+#include "fasttransforms.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The TimeSynth synthesizes irregular sea time histories from frequency domain transfer functions.
+ *
+ * Each wave component has an amplitude from the sea spectrum and a random phase.  The response of each channel is
+ * the sum over all wave directions of amplitude, transfer function, and phase.  Summing cosines directly costs one
+ * evaluation per wave component per time step.  Instead, the wave components are placed on a refined frequency grid,
+ * with a spacing of 2 * pi / duration, and each channel is produced with one inverse real FFT.  The time history then
+ * repeats exactly once over the duration.
+ *
+ * The transfer functions and amplitudes are set once.  Only the random phases depend on the seed, so several seeds
+ * can be synthesized in parallel from the same data.  Phases come from a std::mt19937 generator with the seed, so a
+ * seed gives the same time history on every platform.
+ *
+ * Each time history is written as a binary time history file:  the identifier OSEATS01, the number of columns as a
+ * 32 bit integer, the label of each column as a 32 bit length and the characters, and then each row as doubles.  The
+ * first column is time and the second column is the wave elevation at the origin.  ofourier reads these files
+ * directly.
+ */
+class TimeSynth : public ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    TimeSynth();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~TimeSynth();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the duration of the time history.  This sets the spacing of the refined frequency grid.
+     * @param durationIn Double.  The duration, in seconds.  Variable passed by value.
+     */
+    void setDuration(double durationIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the requested time step.  The time step used is adjusted down so the duration holds a whole number
+     * of time steps.
+     * @param stepIn Double.  The time step, in seconds.  Variable passed by value.
+     */
+    void setTimeStep(double stepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads used to synthesize seeds.
+     * @param threadsIn Integer.  The number of threads.  Variable passed by value.
+     */
+    void setThreads(int threadsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the range of wave frequencies with transfer functions.  Only grid frequencies inside this range get
+     * wave components.  Clears any transfer functions already added.
+     * @param minIn Double.  The lowest wave frequency, in rad/s.  Variable passed by value.
+     * @param maxIn Double.  The highest wave frequency, in rad/s.  Variable passed by value.
+     */
+    void setFreqRange(double minIn, double maxIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The frequencies of the refined grid that get wave components.  Call after setDuration() and
+     * setFreqRange().
+     * @return Returns vector of doubles.  Frequencies in rad/s.  Variable passed by value.
+     */
+    std::vector<double> listFreq();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the label of each channel.  Also sets the number of channels.
+     * @param labelIn Vector of strings.  One label for each channel.  Variable passed by value.
+     */
+    void setLabel(std::vector<std::string> labelIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the wave components of one wave direction.
+     * @param ampIn Vector of wave amplitudes, in m.  One entry for each frequency from listFreq().  Variable passed
+     * by value.
+     * @param transIn Complex matrix of transfer functions.  One row for each channel, one column for each frequency
+     * from listFreq().  Variable passed by value.
+     */
+    void addDirection(arma::vec ampIn, arma::cx_mat transIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Synthesizes the time history for one seed and writes it to a file.
+     * @param seedIn Integer.  The seed for the random phases.  Variable passed by value.
+     * @param fileIn String.  Full path of the output file.  Variable passed by value.
+     */
+    void run(int seedIn, std::string fileIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Synthesizes a range of seeds in parallel.  Each seed is written to its own file, named with the stem
+     * and the seed number.
+     * @param firstIn Integer.  The first seed.  Variable passed by value.
+     * @param numIn Integer.  The number of seeds.  Variable passed by value.
+     * @param stemIn String.  Full path and start of the file name for each output file.  Variable passed by value.
+     */
+    void runSeeds(int firstIn, int numIn, std::string stemIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The file name used for a seed by runSeeds().
+     * @param stemIn String.  Full path and start of the file name.  Variable passed by value.
+     * @param seedIn Integer.  The seed.  Variable passed by value.
+     * @return Returns string.  The full file name.  Variable passed by value.
+     */
+    static std::string getSeedFile(std::string stemIn, int seedIn);
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Checks the settings and calculates the number of samples.
+     */
+    void prepare();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Synthesizes the time history for one seed and writes it to a file.  Call prepare() first.
+     * @param seedIn Integer.  The seed for the random phases.  Variable passed by value.
+     * @param fileIn String.  Full path of the output file.  Variable passed by value.
+     */
+    void synthesize(int seedIn, std::string fileIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Worker function for one thread.  Takes seeds from the shared counter until none remain.
+     * @param firstIn Integer.  The first seed.  Variable passed by value.
+     * @param numIn Integer.  The number of seeds.  Variable passed by value.
+     * @param stemIn String.  Full path and start of the file name.  Variable passed by value.
+     */
+    void runWorker(int firstIn, int numIn, std::string stemIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pDuration; /**< The duration of the time history, in seconds. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pTimeStep; /**< The requested time step, in seconds. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pThreads; /**< The number of threads. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pFirstBin; /**< Index of the first grid frequency with a wave component.  Grid frequency is index * step. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pNumBin; /**< The number of grid frequencies with wave components. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pNumSample; /**< The number of samples in each time history. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<std::string> plistLabel; /**< The label of each channel. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<arma::vec> plistAmp; /**< The wave amplitudes for each wave direction. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<arma::cx_mat> plistTrans; /**< The transfer functions for each wave direction. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::atomic<int> pNext; /**< The next seed offset to synthesize.  Shared between worker threads. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static std::string MAGIC;   /**< Identifier at the start of every binary time history file. */
+    static int ROWBLOCK;        /**< The number of rows written to the file at a time. */
+};
+
+}   //Namespace ofreq
+
+}   //Namespace osea
+
+#endif // TIMESYNTH_H
@@ -0,0 +1,372 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//==========================================Section Separator =========================================================
+//Inclusions and namespaces
+#include "seamodel_spreading.h"
+#include <stdexcept>
+
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+
+using namespace std;
+using namespace osea;
+using namespace arma;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+int SeaModel_Spreading::NPOINT = 4096;
+int SeaModel_Spreading::NHARMONIC = 4;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+SeaModel_Spreading::SeaModel_Spreading() : SeaModel()
+{
+    pSpreadType = 0;
+    pSpread = 2.0;
+    pTolerance = 1.0E-3;
+    pMaxDir = 15;
+    pNorm = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+SeaModel_Spreading::~SeaModel_Spreading()
+{
+
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::setSpreadType(int typeIn)
+{
+    pSpreadType = typeIn;
+    pNorm = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int SeaModel_Spreading::getSpreadType()
+{
+    return pSpreadType;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::setSpread(double spreadIn)
+{
+    pSpread = spreadIn;
+    pNorm = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getSpread()
+{
+    return pSpread;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::setTolerance(double tolIn)
+{
+    pTolerance = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::setMaxDirections(int numIn)
+{
+    pMaxDir = numIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getSpreadFunction(double dirIn)
+{
+    if (pNorm <= 0)
+        calcNorm();
+
+    //Angle relative to the primary wave direction, in the range from -pi to pi.
+    double ang = fmod(dirIn - listWaveDir(0), 2 * M_PI);
+
+    if (ang > M_PI)
+        ang -= 2 * M_PI;
+    else if (ang < -M_PI)
+        ang += 2 * M_PI;
+
+    return pNorm * getSpreadRaw(ang);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::calcQuadrature()
+{
+    try
+    {
+        if (plistWaveDir.size() == 0)
+            throw std::runtime_error("Directional spreading sea model requires a primary wave direction.  Sea model:  "
+                                     + pName);
+
+        if (pSpread <= 0)
+            throw std::runtime_error("Directional spreading parameter must be greater than zero.  Sea model:  "
+                                     + pName);
+
+        plistQuadDir.clear();
+        plistQuadWeight.clear();
+
+        //Discretize the spreading function over the full circle.  The spreading function is periodic, so the
+        //midpoint rule converges quickly.
+        double step = 2 * M_PI / NPOINT;
+        vec ang(NPOINT);
+        vec wt(NPOINT);
+
+        for (int i = 0; i < NPOINT; i++)
+        {
+            ang(i) = -M_PI + (i + 0.5) * step;
+            wt(i) = getSpreadRaw(ang(i));
+        }
+
+        pNorm = 1.0 / (accu(wt) * step);
+        wt = wt / accu(wt);
+
+        //Harmonics of wave direction for the exact spreading function.
+        vec harmCos(NHARMONIC);
+        vec harmSin(NHARMONIC);
+
+        for (int k = 0; k < NHARMONIC; k++)
+        {
+            harmCos(k) = accu(wt % cos((k + 1) * ang));
+            harmSin(k) = accu(wt % sin((k + 1) * ang));
+        }
+
+        //Recurrence coefficients of the polynomials orthonormal with respect to the spreading function.
+        //Stieltjes procedure on the discretized spreading function.
+        vec alpha = zeros<vec>(pMaxDir);
+        vec beta = zeros<vec>(pMaxDir);
+        vec polyLast = zeros<vec>(NPOINT);
+        vec poly = ones<vec>(NPOINT);
+        int nMax = pMaxDir;
+
+        for (int j = 0; j < pMaxDir; j++)
+        {
+            alpha(j) = accu(wt % ang % poly % poly);
+
+            vec polyNext = (ang - alpha(j)) % poly - beta(j) * polyLast;
+            double norm = sqrt(accu(wt % polyNext % polyNext));
+
+            if (j + 1 < pMaxDir)
+            {
+                //A very narrow spreading function runs out of independent polynomials.
+                if (norm < 1.0E-12)
+                {
+                    nMax = j + 1;
+                    break;
+                }
+                beta(j + 1) = norm;
+            }
+
+            polyLast = poly;
+            poly = polyNext / norm;
+        }
+
+        //Add quadrature directions until the harmonics are integrated within the tolerance.
+        vec node;
+        vec weight;
+        double err = 0;
+
+        for (int n = 1; n <= nMax; n++)
+        {
+            //Gauss quadrature from the eigenvalues of the Jacobi matrix.
+            mat jacobi = diagmat(alpha.rows(0, n - 1));
+            for (int j = 1; j < n; j++)
+            {
+                jacobi(j, j - 1) = beta(j);
+                jacobi(j - 1, j) = beta(j);
+            }
+
+            mat eigVec;
+            eig_sym(node, eigVec, jacobi);
+            weight = trans(square(eigVec.row(0)));
+
+            err = 0;
+            for (int k = 0; k < NHARMONIC; k++)
+            {
+                err = max(err, fabs(accu(weight % cos((k + 1) * node)) - harmCos(k)));
+                err = max(err, fabs(accu(weight % sin((k + 1) * node)) - harmSin(k)));
+            }
+
+            if (err <= pTolerance)
+                break;
+        }
+
+        if (err > pTolerance)
+        {
+            logStd.Notify();
+            logErr.Write(ID + string("Directional spreading quadrature did not reach the tolerance with ")
+                         + itoa(node.n_elem) + string(" directions.  Sea model:  ") + pName, 1);
+        }
+
+        //Convert to global wave directions.
+        for (unsigned int i = 0; i < node.n_elem; i++)
+        {
+            double dir = fmod(listWaveDir(0) + node(i), 2 * M_PI);
+            if (dir < 0)
+                dir += 2 * M_PI;
+
+            plistQuadDir.push_back(dir);
+            plistQuadWeight.push_back(weight(i) / accu(weight));
+        }
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<double> &SeaModel_Spreading::listQuadDir()
+{
+    return plistQuadDir;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<double> &SeaModel_Spreading::listQuadWeight()
+{
+    return plistQuadWeight;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getWaveEnergy(double dirIn, int freqIndex)
+{
+    //Get the wave frequency.
+    double freqIn = plistWaveFreq.at(freqIndex);
+
+    //Calculate the result
+    return getWaveEnergy(dirIn, freqIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getWaveEnergy(double dirIn, double freqIn)
+{
+    //Scale the wave spectrum energy by the spreading function.
+    return getSpreadFunction(dirIn) *
+            listWaveScale(0) *
+            listWaveSpec(0)->getSpecEnergy(freqIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getWaveAmp(double dirIn, int freqIndex)
+{
+    double WaveEnergy;
+    int quad = findQuadDir(dirIn);
+
+    //Quadrature directions carry the fraction of wave energy in the quadrature weight.
+    if (quad >= 0)
+        WaveEnergy = plistQuadWeight.at(quad) * listWaveScale(0) *
+                listWaveSpec(0)->getSpecEnergy(plistWaveFreq.at(freqIndex));
+    else
+        WaveEnergy = getWaveEnergy(dirIn, freqIndex);
+
+    //Next get the frequency step for the defined frequency index.
+    double stepsize = getFreqStep(freqIndex);
+
+    //Finally, calculate the wave amplitude
+    try
+    {
+        //Check for negative number.
+        if (WaveEnergy < 0)
+        {
+            std::string msg;                    //Error message.
+
+            msg = string("Wave energy was negative for the requested wave direction and ") +
+                  string("frequency.  Please check the sea model.\nWave Direction:  ") +
+                  std::to_string(dirIn) + string(" rad\n") + string("Wave Frequency:  ") +
+                  std::to_string(plistWaveFreq.at(freqIndex)) + string(" rad/s");
+
+            //Throw the error message.
+            throw std::runtime_error(msg);
+        }
+
+        //Calculate wave amplitude
+        return sqrt(2 * WaveEnergy * stepsize);
+    }
+    catch (const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+        return 0;
+    }
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double SeaModel_Spreading::getSpreadRaw(double angIn)
+{
+    if (pSpreadType == 1)
+    {
+        //Wrapped normal.  The terms beyond one wrap in either direction are negligible.
+        double output = 0;
+        for (int k = -3; k <= 3; k++)
+            output += exp(-pow(angIn + 2 * M_PI * k, 2) / (2 * pow(pSpread, 2)));
+
+        return output;
+    }
+    else
+    {
+        //cos-2s
+        return pow(fabs(cos(angIn / 2)), 2 * pSpread);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void SeaModel_Spreading::calcNorm()
+{
+    double step = 2 * M_PI / NPOINT;
+    double sum = 0;
+
+    for (int i = 0; i < NPOINT; i++)
+        sum += getSpreadRaw(-M_PI + (i + 0.5) * step);
+
+    pNorm = 1.0 / (sum * step);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int SeaModel_Spreading::findQuadDir(double dirIn)
+{
+    for (unsigned int i = 0; i < plistQuadDir.size(); i++)
+    {
+        double diff = fabs(fmod(dirIn - plistQuadDir.at(i), 2 * M_PI));
+
+        if ((diff < 1.0E-9) || (fabs(diff - 2 * M_PI) < 1.0E-9))
+            return i;
+    }
+
+    return -1;
+}
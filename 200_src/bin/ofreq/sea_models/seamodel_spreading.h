@@ -0,0 +1,281 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef SEAMODEL_SPREADING_H
+#define SEAMODEL_SPREADING_H
+#include "../wave_spectra/wavespec.h"
+#include "seamodel.h"
+
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+//######################################### Class Separator ###########################################################
+/**
+ * @brief The SeaModel_Spreading class creates the model for a short crested sea, with the wave energy spread about
+ * one primary wave direction.
+ *
+ * The sea model uses a single wave spectrum and primary wave direction, at index 0 of the lists in the base sea
+ * model.  Wave energy is distributed about the primary wave direction with a directional spreading function.  Two
+ * spreading functions are available:
+ * 0.  cos-2s:  D(a) = C * cos(a/2)^(2s).  The spreading parameter is the exponent s.  Larger values of s give
+ *     narrower spreading.
+ * 1.  Wrapped normal:  The normal distribution, wrapped around the circle.  The spreading parameter is the standard
+ *     deviation, in units of radians.
+ * In both cases, the spreading function is normalized so that it integrates to one over the full circle.
+ *
+ * Instead of interpolating between a long list of user defined wave directions, the sea model picks a small set of
+ * solve directions and weights with Gauss quadrature, using the spreading function as the weight function.  The
+ * number of directions increases until the quadrature integrates the first few harmonics of wave direction within
+ * the requested tolerance.  Responses that vary smoothly with wave direction are then integrated with the same
+ * accuracy as a much longer list of directions.
+ *
+ * Wave amplitudes carry the quadrature weights.  For a wave direction that matches one of the quadrature
+ * directions, the wave amplitude is the amplitude of a wave component with the energy of the weight w:
+ * A = sqrt(2 * S(w) * w * dw).  Summing the response of each quadrature direction gives the response to the full
+ * short crested sea.  For any other wave direction, the wave amplitude follows the spreading function density, the
+ * same as the other sea models.
+ *
+ * The SeaModel must have a full list of wave frequencies before requesting wave amplitude.  The same limitation
+ * applies as with the base sea model.
+ */
+class SeaModel_Spreading : public SeaModel
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.  Inherits from SeaModel class.  Sets the cos-2s spreading function, with s = 2.
+     */
+    SeaModel_Spreading();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Nothing happens here.
+     */
+    ~SeaModel_Spreading();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the type of spreading function.
+     * @param typeIn Integer, variable passed by value.  The type of spreading function.
+     * 0 = cos-2s
+     * 1 = wrapped normal
+     */
+    void setSpreadType(int typeIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the type of spreading function.
+     * @return Returns integer, variable passed by value.  0 = cos-2s, 1 = wrapped normal.
+     */
+    int getSpreadType();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the spreading parameter.
+     * @param spreadIn Double, variable passed by value.  The exponent s for the cos-2s spreading function.  The
+     * standard deviation (in units of radians) for the wrapped normal spreading function.
+     */
+    void setSpread(double spreadIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the spreading parameter.
+     * @return Returns double, variable passed by value.  The spreading parameter.
+     */
+    double getSpread();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the accuracy requested for the directional quadrature.
+     * @param tolIn Double, variable passed by value.  The largest error allowed when integrating the harmonics of
+     * wave direction.  Default is 1E-3.
+     */
+    void setTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the largest number of quadrature directions allowed.
+     * @param numIn Integer, variable passed by value.  The largest number of quadrature directions.  Default is 15.
+     */
+    void setMaxDirections(int numIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the spreading function for the specified wave direction.
+     * @param dirIn Double, variable passed by value.  The wave direction, in units of radians.  Measured in the
+     * global coordinate system, not relative to the primary wave direction.
+     * @return Returns double, variable passed by value.  The density of the spreading function, in units of 1/rad.
+     */
+    double getSpreadFunction(double dirIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the quadrature directions and weights for the spreading function.
+     *
+     * Starts with a single direction and adds directions until the quadrature integrates the harmonics of wave
+     * direction within the tolerance.  Writes a warning if the tolerance is not met with the largest number of
+     * directions allowed.  Must be called again after changes to the spreading function or primary wave direction.
+     */
+    void calcQuadrature();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the list of quadrature directions.
+     * @return Returns reference to std::vector<double>.  Wave directions in units of radians, in the range from 0 to
+     * 2*pi.  Empty until calcQuadrature() is called.
+     */
+    std::vector<double> &listQuadDir();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the list of quadrature weights.
+     * @return Returns reference to std::vector<double>.  The fraction of wave energy assigned to each quadrature
+     * direction.  The weights add up to one.  Empty until calcQuadrature() is called.
+     */
+    std::vector<double> &listQuadWeight();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the wave energy from the sea model for the wave direction and wave frequency specified.
+     *
+     * The wave energy is the energy of the wave spectrum, multiplied by the spreading function and the wave scaling
+     * factor.
+     * @param dirIn Double, variable passed by value.  The wave direction for the requested result.  Direction
+     * measured in units of radians, in the global coordinate system.  True North represents a direction of zero.
+     * Positive angles are measured counter-clockwise (North to West).
+     * @param freqIndex The index of the frequency you want to use in the list of wave frequencies.  THe list of wave
+     * frequencies must be defined before calling this function.  You use the index to specify the requested frequency.
+     * @return Returns a double, variable passed by value.  Variable is the wave energy (in units of m^2/(rad/s)/rad)
+     * at the frequency and wave direction specified.
+     */
+    double getWaveEnergy(double dirIn, int freqIndex);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the wave energy from the sea model for the wave direction and wave frequency specified.
+     *
+     * The wave energy is the energy of the wave spectrum, multiplied by the spreading function and the wave scaling
+     * factor.
+     * @param dirIn Double, variable passed by value.  The wave direction for the requested result.  Direction
+     * measured in units of radians, in the global coordinate system.  True North represents a direction of zero.
+     * Positive angles are measured counter-clockwise (North to West).
+     * @param freqIn Double, variable passed by value.  The wave frequency desired.  Can be any wave frequency.
+     * @return Returns a double, variable passed by value.  Variable is the wave energy (in units of m^2/(rad/s)/rad)
+     * at the frequency and wave direction specified.
+     */
+    double getWaveEnergy(double dirIn, double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the wave amplitude from the sea model for the wave direction and wave frequency specified.
+     *
+     * If the wave direction matches a quadrature direction, the wave amplitude includes the quadrature weight.
+     * Otherwise the wave amplitude follows the density of the spreading function.
+     * @param dirIn Double, variable passed by value.  The wave direction for the requested result.  Direction
+     * measured in units of radians, in the global coordinate system.  True North represents a direction of zero.
+     * Positive angles are measured counter-clockwise (North to West).
+     * @param freqIndex The index of the frequency you want to use in the list of wave frequencies.  THe list of wave
+     * frequencies must be defined before calling this function.  You use the index to specify the requested frequency.
+     * @return Returns a double, variable passed by value.  Variable is the wave amplitude (in units of m) at the
+     * frqeuency and wave direction specified.
+     */
+    double getWaveAmp(double dirIn, int freqIndex);
+
+//==========================================Section Separator =========================================================
+protected:
+
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the spreading function, without normalization, relative to the primary wave direction.
+     * @param angIn Double, variable passed by value.  The angle relative to the primary wave direction, in units of
+     * radians.  Range from -pi to pi.
+     * @return Returns double, variable passed by value.  The spreading function, not normalized.
+     */
+    double getSpreadRaw(double angIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the normalization factor for the spreading function.  Integrates the spreading function
+     * numerically over the full circle.
+     */
+    void calcNorm();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Returns the index of the quadrature direction that matches the wave direction.
+     * @param dirIn Double, variable passed by value.  The wave direction, in units of radians.
+     * @return Returns integer, variable passed by value.  The index of the quadrature direction.  Returns -1 if no
+     * quadrature direction matches.
+     */
+    int findQuadDir(double dirIn);
+
+    int pSpreadType; /**< The type of spreading function.  0 = cos-2s, 1 = wrapped normal. */
+    double pSpread; /**< The spreading parameter.  Exponent s for cos-2s, standard deviation for wrapped normal. */
+    double pTolerance; /**< The largest error allowed when integrating the harmonics of wave direction. */
+    int pMaxDir; /**< The largest number of quadrature directions allowed. */
+    double pNorm; /**< Normalization factor so the spreading function integrates to one. */
+    std::vector<double> plistQuadDir; /**< The quadrature directions, in units of radians. */
+    std::vector<double> plistQuadWeight; /**< The quadrature weights.  Add up to one. */
+
+    static int NPOINT; /**< The number of points used to integrate the spreading function. */
+    static int NHARMONIC; /**< The number of harmonics of wave direction checked for the quadrature accuracy. */
+};
+
+} //Namespace osea
+
+#endif // SEAMODEL_SPREADING_H
@@ -0,0 +1,386 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "checkpoint.h"
+#include "system.h"
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+QByteArray Checkpoint::MAGIC = "OSEACKPT"; /**< Identifier written at the start of every checkpoint file. */
+qint32 Checkpoint::VERSION = 1; /**< Version of the checkpoint file format. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+Checkpoint::Checkpoint() : pHash(QCryptographicHash::Sha1)
+{
+    ptSystem = NULL;
+    pReadOnly = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+Checkpoint::~Checkpoint()
+{
+    close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::setSystem(ofreq::System *ptInput)
+{
+    ptSystem = ptInput;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::addInput(string pathIn)
+{
+    QString path = QString::fromStdString(pathIn);
+    QFile file(path);
+
+    //Record the name in the key, even if the file can not be read.
+    pHash.addData(QFileInfo(path).fileName().toUtf8());
+
+    if (file.open(QIODevice::ReadOnly))
+    {
+        pHash.addData(file.readAll());
+        file.close();
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::addData(string pathIn)
+{
+    QString path = QString::fromStdString(pathIn);
+    QFileInfo info(path);
+
+    //Only the file status is recorded.  The contents are never read again.
+    QByteArray stamp;
+    QDataStream stream(&stamp, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_4_6);
+    //Keyed on the absolute path, so a relative and an absolute path to the same run give the same key.
+    stream << info.absoluteFilePath().toUtf8();
+    if (info.exists())
+        stream << static_cast<qint64>(info.size()) << static_cast<qint64>(info.lastModified().toMSecsSinceEpoch());
+
+    pHash.addData(stamp);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Checkpoint::open(string pathIn, bool readOnly)
+{
+    int out = 0;
+
+    try
+    {
+        if (!ptSystem)
+            throw std::runtime_error("Pointer to system object not set.");
+
+        close();
+        pReadOnly = readOnly;
+
+        //Size of the problem.
+        qint32 nDir = ptSystem->listWaveDirections().size();
+        qint32 nFreq = ptSystem->listWaveFrequencies().size();
+
+        //Nothing stored yet.
+        plistDone.assign(nDir, vector<bool>(nFreq, false));
+
+        pFile.setFileName(QString::fromStdString(pathIn));
+
+        bool valid = false;
+        if (pFile.exists() && pFile.open(QIODevice::ReadWrite))
+        {
+            QDataStream stream(&pFile);
+            stream.setVersion(QDataStream::Qt_4_6);
+
+            //Read the header and check it against the current inputs.
+            valid = readHeader(stream);
+
+            //Read each record.
+            qint64 posGood = pFile.pos();
+            if (valid)
+                out = readRecords(stream, posGood);
+
+            //Drop any incomplete record so new records are appended after the last complete one.
+            if (valid && !readOnly)
+            {
+                pFile.resize(posGood);
+                pFile.seek(posGood);
+            }
+        }
+
+        if (!valid)
+        {
+            if (pFile.isOpen())
+                pFile.close();
+
+            if (readOnly)
+            {
+                logStd.Write("No checkpoint found that matches the current input files.",3);
+            }
+            else
+            {
+                //Start a new checkpoint file.
+                if (!pFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+                    throw std::runtime_error("Could not create checkpoint file:  " + pathIn);
+                writeHeader();
+            }
+        }
+
+        if (readOnly && pFile.isOpen())
+            pFile.close();
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Checkpoint::merge(string pathIn)
+{
+    int out = 0;
+
+    try
+    {
+        if (!ptSystem)
+            throw std::runtime_error("Pointer to system object not set.");
+        if (plistDone.size() == 0)
+            throw std::runtime_error("Checkpoint must be opened before merging other checkpoint files.");
+
+        QFile fileMerge(QString::fromStdString(pathIn));
+        if (!fileMerge.open(QIODevice::ReadOnly))
+            throw std::runtime_error("Could not open checkpoint file:  " + pathIn);
+
+        QDataStream stream(&fileMerge);
+        stream.setVersion(QDataStream::Qt_4_6);
+
+        if (readHeader(stream))
+        {
+            qint64 posGood = fileMerge.pos();
+            out = readRecords(stream, posGood);
+        }
+        else
+        {
+            logStd.Write("Checkpoint file does not match the current input files.  Skipped:  " + pathIn, 3);
+        }
+
+        fileMerge.close();
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::close()
+{
+    if (pFile.isOpen())
+        pFile.close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Checkpoint::isDone(int dir, int freq)
+{
+    if ((dir < 0) || (dir >= static_cast<int>(plistDone.size())))
+        return false;
+    if ((freq < 0) || (freq >= static_cast<int>(plistDone.at(dir).size())))
+        return false;
+
+    return plistDone.at(dir).at(freq);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Checkpoint::isComplete()
+{
+    if (plistDone.size() == 0)
+        return false;
+
+    for (unsigned int i = 0; i < plistDone.size(); i++)
+    {
+        for (unsigned int j = 0; j < plistDone.at(i).size(); j++)
+        {
+            if (!plistDone.at(i).at(j))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::write(int dir, int freq)
+{
+    if (pReadOnly || !pFile.isOpen())
+        return;
+
+    try
+    {
+        QDataStream stream(&pFile);
+        stream.setVersion(QDataStream::Qt_4_6);
+
+        stream << static_cast<qint32>(dir) << static_cast<qint32>(freq);
+
+        for (unsigned int k = 0; k < ptSystem->listBody().size(); k++)
+        {
+            cx_mat &soln = ptSystem->listSolutionSet(k).refSolution(dir, freq).refSolnMat();
+
+            stream << static_cast<qint32>(soln.n_rows) << static_cast<qint32>(soln.n_cols);
+            for (unsigned int n = 0; n < soln.n_elem; n++)
+                stream << soln(n).real() << soln(n).imag();
+        }
+
+        //Make sure the record reaches the disk before moving on.
+        pFile.flush();
+
+        if (stream.status() != QDataStream::Ok)
+            throw std::runtime_error("Could not write to checkpoint file:  " + pFile.fileName().toStdString());
+
+        plistDone.at(dir).at(freq) = true;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Checkpoint::readHeader(QDataStream &stream)
+{
+    QByteArray magic, key;
+    qint32 version, fileBody, fileDir, fileFreq;
+    stream >> magic >> version >> key >> fileBody >> fileDir >> fileFreq;
+
+    return (stream.status() == QDataStream::Ok) &&
+            (magic == MAGIC) &&
+            (version == VERSION) &&
+            (key == pHash.result()) &&
+            (fileBody == static_cast<qint32>(ptSystem->listBody().size())) &&
+            (fileDir == static_cast<qint32>(ptSystem->listWaveDirections().size())) &&
+            (fileFreq == static_cast<qint32>(ptSystem->listWaveFrequencies().size()));
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Checkpoint::readRecords(QDataStream &stream, qint64 &posGood)
+{
+    int out = 0;
+    qint32 nBody = ptSystem->listBody().size();
+    qint32 nDir = ptSystem->listWaveDirections().size();
+    qint32 nFreq = ptSystem->listWaveFrequencies().size();
+
+    while (!stream.atEnd())
+    {
+        qint32 dir, freq;
+        stream >> dir >> freq;
+        if ((stream.status() != QDataStream::Ok) ||
+                (dir < 0) || (dir >= nDir) ||
+                (freq < 0) || (freq >= nFreq))
+            break;
+
+        vector<cx_mat> listSoln(nBody);
+        for (int k = 0; k < nBody; k++)
+        {
+            qint32 rows, cols;
+            stream >> rows >> cols;
+            //The writer stores one column with a row for each equation of the body.  Anything else is torn.
+            if ((rows != ptSystem->listBody(k).getEquationCount()) || (cols != 1))
+                stream.setStatus(QDataStream::ReadCorruptData);
+            if (stream.status() != QDataStream::Ok)
+                break;
+
+            listSoln.at(k).set_size(rows, cols);
+            for (unsigned int n = 0; n < listSoln.at(k).n_elem; n++)
+            {
+                double re, im;
+                stream >> re >> im;
+                listSoln.at(k)(n) = complex<double>(re, im);
+            }
+        }
+        //Incomplete record.  The previous run stopped while writing it.
+        if (stream.status() != QDataStream::Ok)
+            break;
+
+        //Restore the solution for each body.
+        for (int k = 0; k < nBody; k++)
+        {
+            Solution soln;
+            soln.setBody(&ptSystem->listBody(k));
+            soln.setSolnMat(listSoln.at(k));
+            ptSystem->listSolutionSet(k).setSolnMat(dir, freq, soln);
+        }
+
+        if (!plistDone.at(dir).at(freq))
+            out += 1;
+        plistDone.at(dir).at(freq) = true;
+        posGood = stream.device()->pos();
+    }
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Checkpoint::writeHeader()
+{
+    QDataStream stream(&pFile);
+    stream.setVersion(QDataStream::Qt_4_6);
+
+    stream << MAGIC
+           << VERSION
+           << pHash.result()
+           << static_cast<qint32>(ptSystem->listBody().size())
+           << static_cast<qint32>(ptSystem->listWaveDirections().size())
+           << static_cast<qint32>(ptSystem->listWaveFrequencies().size());
+
+    pFile.flush();
+}
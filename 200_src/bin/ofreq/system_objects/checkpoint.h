@@ -0,0 +1,271 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+
+//######################################### Class Separator ###########################################################
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+#include <string>
+#include <vector>
+#include <QtGlobal>
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include "ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations.
+class System;
+
+//######################################### Class Separator ###########################################################
+/**
+ * The Checkpoint class stores the solution of each completed wave direction and wave frequency in a binary file.
+ * If a run of ofreq stops part way through the solution, a new run can load the stored solutions and only solve the
+ * remaining points.  The stored solutions also allow the reports to be written again without solving the equations
+ * of motion at all.
+ *
+ * The checkpoint file is keyed by a hash of the input files and hydrodynamic data that define the solution.  The
+ * input files are small, so their contents are hashed.  The hydrodynamic data files are only keyed by their absolute
+ * path, size, and modification time, so the database is not read a second time.  Only the files the readers actually
+ * parsed are part of the key.  If any of those files change, the stored solutions are discarded and the checkpoint
+ * starts over.  The outputs.in file is not part of the key, so changing the requested reports keeps the stored
+ * solutions.
+ *
+ * The file starts with a header that records the key and the size of the problem.  Each completed point is then
+ * appended as a single record:  the wave direction index, the wave frequency index, and the solution matrix of each
+ * body.  Records are flushed to disk as they are written.  An incomplete record at the end of the file (from a run
+ * that stopped while writing) is ignored when the file is loaded.
+ */
+class Checkpoint : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    Checkpoint();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Closes the checkpoint file.
+     */
+    ~Checkpoint();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the system object that the checkpoint reads solutions from and restores solutions to.
+     * @param ptInput Pointer to the System object.  Variable passed by value.
+     */
+    void setSystem(ofreq::System* ptInput);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds an input file to the key of the checkpoint.  The file is added by its name and contents.
+     * @param pathIn The full path to the file.  Variable passed by value.
+     */
+    void addInput(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a hydrodynamic data file to the key of the checkpoint.  The file is added by its absolute path,
+     * size, and modification time.  The contents are not read.
+     * @param pathIn The full path to the file.  Variable passed by value.
+     */
+    void addData(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Opens the checkpoint file.
+     *
+     * If the file exists and its key and problem size match the current inputs, all complete records are loaded
+     * into the list of SolutionSet objects in the System object.  Otherwise any existing file is replaced by a new
+     * file with only the header.  The list of SolutionSet objects must already be sized for all bodies, wave
+     * directions, and wave frequencies before calling this function.
+     * @param pathIn The full path to the checkpoint file.  Variable passed by value.
+     * @param readOnly Boolean.  Variable passed by value.  Set to true to only load stored solutions.  The file is
+     * not created or changed.  Default value is false.
+     * @return Returns the number of solution points loaded from the file.  Returned variable passed by value.
+     */
+    int open(std::string pathIn, bool readOnly = false);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Loads the stored solutions from another checkpoint file, such as the file written by one shard of a
+     * sharded run.
+     *
+     * The file is only read.  Its key and problem size must match the current inputs, or the file is skipped.
+     * Solutions already loaded are kept.  The checkpoint must be opened before calling this function.
+     * @param pathIn The full path to the other checkpoint file.  Variable passed by value.
+     * @return Returns the number of new solution points loaded from the file.  Returned variable passed by value.
+     */
+    int merge(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Closes the checkpoint file.
+     */
+    void close();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the solution for the specified wave direction and wave frequency is already stored.
+     * @param dir Integer.  Index of the wave direction.  Variable passed by value.
+     * @param freq Integer.  Index of the wave frequency.  Variable passed by value.
+     * @return Returns true if the solution is stored.  Returns false otherwise.  Returned variable passed by value.
+     */
+    bool isDone(int dir, int freq);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the solutions for all wave directions and wave frequencies are stored.
+     * @return Returns true if all solutions are stored.  Returned variable passed by value.
+     */
+    bool isComplete();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the solution for the specified wave direction and wave frequency to the checkpoint file.  Takes
+     * the solution from the list of SolutionSet objects in the System object.  Does nothing if the file was opened
+     * read only.
+     * @param dir Integer.  Index of the wave direction.  Variable passed by value.
+     * @param freq Integer.  Index of the wave frequency.  Variable passed by value.
+     */
+    void write(int dir, int freq);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads the header of a checkpoint file and checks it against the current inputs.
+     * @param stream The data stream of the checkpoint file, positioned at the start of the file.
+     * @return Returns true if the key and problem size match the current inputs.
+     */
+    bool readHeader(QDataStream &stream);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads every complete record from a checkpoint file and restores the solutions to the System object.
+     * Stops at the first incomplete or invalid record.
+     * @param stream The data stream of the checkpoint file, positioned after the header.
+     * @param posGood Integer, passed by reference.  Set to the file position after the last complete record.
+     * @return Returns the number of new solution points loaded.
+     */
+    int readRecords(QDataStream &stream, qint64 &posGood);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the header of a new checkpoint file.
+     */
+    void writeHeader();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Pointer to the System object.
+     */
+    ofreq::System* ptSystem;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Running hash of all inputs added to the key.
+     */
+    QCryptographicHash pHash;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The checkpoint file.
+     */
+    QFile pFile;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Boolean to record if the checkpoint file was opened read only.
+     */
+    bool pReadOnly;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Record of which points are stored.  The first index is the wave direction.  The second index is the
+     * wave frequency.
+     */
+    std::vector< std::vector<bool> > plistDone;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static QByteArray MAGIC; /**< Identifier written at the start of every checkpoint file. */
+    static qint32 VERSION; /**< Version of the checkpoint file format. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // CHECKPOINT_H
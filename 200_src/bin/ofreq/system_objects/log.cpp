@@ -57,6 +57,8 @@ Log::~Log()
 //------------------------------------------Function Separator --------------------------------------------------------
 void Log::Write(std::string msg, int severity, int timestamp, std::string output)
 {
+    std::lock_guard<std::mutex> lock(pMutex);
+
     //Write output of file
     std::string msgOut = "";        //THe output message.
     std::string prefix = "";        //THe prefix to put in front of output message.
@@ -170,7 +172,11 @@ void Log::Write(std::string msg, int severity, int timestamp, std::string output
 
     //Finally cancel program execution, if required.
     if (severity == 0)
-        exit(1);
+    {
+        pErrCount++;
+        if (pExit)
+            exit(1);
+    }
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -190,6 +196,8 @@ void Log::WriteScreen(std::string msg, int severity, int timestamp)
 //------------------------------------------Function Separator --------------------------------------------------------
 void Log::setLogFile(std::string pathIn)
 {
+    std::lock_guard<std::mutex> lock(pMutex);
+
     try
     {
         //Parse the log file
@@ -259,6 +267,12 @@ void Log::setDefaultOutput(std::string output)
     defaultOutput = output;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+std::string Log::getDefaultOutput()
+{
+    return defaultOutput;
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void Log::setDefaultTimeStamp(bool timein)
 {
@@ -268,6 +282,25 @@ void Log::setDefaultTimeStamp(bool timein)
         defaultTimestamp = -1;
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void Log::setExitOnError(bool exitIn)
+{
+    pExit = exitIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Log::getExitOnError()
+{
+    return pExit;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int Log::getErrorCount()
+{
+    std::lock_guard<std::mutex> lock(pMutex);
+    return pErrCount;
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void Log::Notify(std::string input)
 {
@@ -50,6 +50,7 @@
 #include <QString>
 #include <QFile>
 #include <exception>
+#include <mutex>
 
 
 
@@ -135,6 +136,7 @@ public:
      * Log, File, log, file =       Write only to the output file.
      * Screen, Message, screen, message =       Write only to the screen.
      * Both, Dual, All, both, dual, all =       Write the message to both the screen and the log file.
+     * None, none =       Write nothing.
      * @sa Log::setDefaultOutput()
      * @sa Log::setDefaultTimeStamp()
      */
@@ -235,11 +237,19 @@ public:
      * Log, File, log, file =       Write only to the output file.
      * Screen, Message, screen, message =       Write only to the screen.
      * Both, Dual, All, both, dual, all =       Write the message to both the screen and the log file.
+     * None, none =       Write nothing.
      * @param output Standard string variable.  Variable passed by value.  Specifies the default output destination.
      * Must be one of the key words listed above.
      */
     void setDefaultOutput(std::string output);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the default location for output.
+     * @return Standard string variable.  Variable passed by value.  One of the key words of setDefaultOutput().
+     */
+    std::string getDefaultOutput();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Determines the default value of the timestamp to use.
@@ -254,6 +264,31 @@ public:
      */
     void setDefaultTimeStamp(bool timein);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether an error (severity 0) stops program execution.
+     *
+     * Default is to stop.  A program that embeds the solver turns this off, so that an error in its inputs does not
+     * end the host program.  The error is still written and counted.
+     * @param exitIn Boolean.  Variable passed by value.  True to stop program execution on an error.
+     * @sa Log::getErrorCount()
+     */
+    void setExitOnError(bool exitIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets whether an error (severity 0) stops program execution.
+     * @return Boolean.  Variable passed by value.  True if an error stops program execution.
+     */
+    bool getExitOnError();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports the number of errors (severity 0) written to this log.
+     * @return Integer.  Variable passed by value.  Number of errors written since the log was created.
+     */
+    int getErrorCount();
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief The actual output file that the log writes to.  Simple ASCII text file.
@@ -305,6 +340,13 @@ private:
      */
     void parsePath(std::string pathIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Serializes writes to the log.  The logs are shared by every System object, and obatch runs several
+     * System objects on separate threads.
+     */
+    std::mutex pMutex;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     static std::string SLASH; /**< The directory level specifier.  Changes under windows or linux.*/
 
@@ -316,6 +358,7 @@ private:
      * Log, File, log, file =       Write only to the output file.
      * Screen, Message, screen, message =       Write only to the screen.
      * Both, Dual, All, both, dual, all =       Write the message to both the screen and the log file.
+     * None, none =       Write nothing.
      */
     std::string defaultOutput;
 
@@ -327,6 +370,12 @@ private:
      */
     int defaultTimestamp;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pExit = true; /**< Boolean to record if an error stops program execution. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pErrCount = 0; /**< The number of errors written to the log. */
+
 };
 
 }   //Namespace ofreq
@@ -0,0 +1,370 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "ofreqengine.h"
+#include "system.h"
+#include "../motion_solver/motionsolver.h"
+#include "../motion_solver/dragsolver.h"
+#include "../global_objects/solution.h"
+#include "../global_objects/solutionset.h"
+#include "../file_reader/filereader.h"
+#include "../file_reader/dictcontrol.h"
+#include "../file_reader/dictforces.h"
+#include "../file_reader/dictbodies.h"
+#include "../file_reader/dictseaenv.h"
+#include "../file_reader/dictdata.h"
+#include "../file_reader/dictoutputs.h"
+#include "../hydro_reader/hydroreader.h"
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+string OfreqEngine::CASE_PATH = "ofreq_case"; /**< The path given to the case directory.  Never read from disk. */
+string OfreqEngine::OUTPUTS = "system/outputs.in"; /**< The path of the outputs file, relative to the case directory. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+OfreqEngine::OfreqEngine()
+{
+    ptSystem = NULL;
+    pQuiet = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+OfreqEngine::~OfreqEngine()
+{
+    if (ptSystem)
+        delete ptSystem;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::setCaseFile(string fileIn, string textIn)
+{
+    pmapFiles[CASE_PATH + SLASH + fileIn] = textIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::setDataFile(string fileIn, string textIn)
+{
+    pmapFiles[fileIn] = textIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::clearFiles()
+{
+    pmapFiles.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::setQuiet(bool quietIn)
+{
+    pQuiet = quietIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool OfreqEngine::load()
+{
+    //Replace any case already loaded.
+    if (ptSystem)
+        delete ptSystem;
+    ptSystem = new System();
+    plistSolution.clear();
+    openLogs();
+    int nErr = countErrors();
+    bool out = false;
+
+    try
+    {
+        ptSystem->setPath(CASE_PATH);
+
+        //Read input files and interpret data.
+        //---------------------------------------------------------------------------
+        FileReader fileIn;                  //Create file reading objects
+        dictBodies dictBod;                 //Create dictionary object for bodies.in
+        dictForces dictForce;               //Create dictionary object for forces.in
+        dictControl dictCont;               //Create dictionary object for control.in
+        dictSeaEnv dictSea;                 //Create dictionary object for seaenv.in
+        dictData dictDat(&fileIn);          //Create dictionary object for data.in
+        dictOutputs dictOut;                //Create dictionary object for outputs.in
+
+        fileIn.setSystem(ptSystem);
+        dictBod.setSystem(ptSystem);
+        dictForce.setSystem(ptSystem);
+        dictCont.setSystem(ptSystem);
+        dictSea.setSystem(ptSystem);
+        dictDat.setSystem(ptSystem);
+        dictOut.setSystem(ptSystem);
+
+        fileIn.setPath(CASE_PATH);
+        fileIn.setMemoryFiles(&pmapFiles);
+
+        //Sequence of file reading is important.  Same as ofreq.
+        int out = 0;
+        fileIn.setDictionary(dictCont);
+        out += fileIn.readControl();
+        fileIn.setDictionary(dictSea);
+        out += fileIn.readSeaEnv();
+        fileIn.setDictionary(dictForce);
+        out += fileIn.readForces();
+        fileIn.setDictionary(dictBod);
+        out += fileIn.readBodies();
+        fileIn.setDictionary(dictDat);
+        out += fileIn.readData();
+
+        if ((out != 0) || (countErrors() != nErr))
+            throw std::runtime_error("Could not read the case input files.");
+
+        //Reports are optional for an embedded solve.
+        if (pmapFiles.find(CASE_PATH + SLASH + OUTPUTS) != pmapFiles.end())
+        {
+            fileIn.setDictionary(dictOut);
+            fileIn.readOutputs();
+        }
+
+        ptSystem->SearchActiveSeaModel();
+
+        //Read the hydrodynamic data.
+        HydroReader hydroIn;
+        hydroIn.setSystem(ptSystem);
+        hydroIn.setMemoryFiles(&pmapFiles);
+
+        for (unsigned int i = 0; i < fileIn.listDataFiles().size(); i++)
+        {
+            hydroIn.setPath(fileIn.listDataFiles(i));
+            if ((hydroIn.readHydroSys() != 0) || (countErrors() != nErr))
+                throw std::runtime_error("Could not read the hydrodynamic data:  " + fileIn.listDataFiles(i));
+        }
+
+        ptSystem->setActiveSeaModel();
+        ptSystem->resolveIndex();
+        ptSystem->resampleHydro();
+        ptSystem->applyFarField();
+
+        //The file reader and hydro reader log some errors without throwing.
+        if (countErrors() != nErr)
+            throw std::runtime_error("Errors found while loading the case.");
+
+        out = true;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+    }
+
+    closeLogs();
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+System &OfreqEngine::refSystem()
+{
+    return *ptSystem;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool OfreqEngine::setWaveFrequencies(vector<double> listIn)
+{
+    openLogs();
+
+    //Far-field pairs were chosen for the lowest wave frequency at load.  Their crossbody data is gone.
+    vector<double> listOld = ptSystem->listWaveFrequencies();
+    ptSystem->setWaveFrequencies(listIn);
+    bool out = ptSystem->checkFarField();
+    if (!out)
+    {
+        ptSystem->setWaveFrequencies(listOld);
+        logStd.Notify();
+        logErr.Write(ID + "Wave frequencies below " + ftoa(ptSystem->getFarFieldFreqMin()) +
+                     " are not allowed.  The far-field approximation was chosen for that wave frequency.  "
+                     "Frequencies not changed.", 1);
+    }
+    else
+    {
+        //Pass the wave frequencies on to the sea model and the hydrodynamic data.
+        ptSystem->setActiveSeaModel();
+        ptSystem->resampleHydro();
+    }
+
+    closeLogs();
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::setWaveDirections(vector<double> listIn)
+{
+    openLogs();
+    ptSystem->setWaveDirections(listIn);
+    ptSystem->setActiveSeaModel();
+    closeLogs();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool OfreqEngine::scaleForce(string forceIn, double factorIn)
+{
+    bool found = false;
+
+    for (unsigned int k = 0; k < ptSystem->listForceReact_user().size(); k++)
+    {
+        if (ptSystem->listForceReact_user(k).getForceName() == forceIn)
+        {
+            ptSystem->listForceReact_user(k).scaleCoefficient(factorIn);
+            found = true;
+        }
+    }
+
+    for (unsigned int k = 0; k < ptSystem->listForceCross_user().size(); k++)
+    {
+        if (ptSystem->listForceCross_user(k).getForceName() == forceIn)
+        {
+            ptSystem->listForceCross_user(k).scaleCoefficient(factorIn);
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool OfreqEngine::solve()
+{
+    openLogs();
+    int nErr = countErrors();
+    bool out = false;
+
+    try
+    {
+        if (!ptSystem)
+            throw std::runtime_error("No case loaded.");
+
+        int nDir = ptSystem->listWaveDirections().size();
+        int nFreq = ptSystem->listWaveFrequencies().size();
+
+        //Size the solutions for the current case.
+        ptSystem->listSolutionSet().clear();
+        for (unsigned int i = 0; i < ptSystem->listBody().size(); i++)
+            ptSystem->listSolutionSet().push_back(SolutionSet(nDir, nFreq));
+        ptSystem->clearFactor();
+        plistSolution.assign(ptSystem->listBody().size(), cx_cube());
+
+        //Linearize the quadratic drag forces.  Starts from the damping of the last solve.
+        DragSolver drag;
+        drag.setSystem(ptSystem);
+        drag.solve();
+
+        //Copy each solution into the solution tensor.
+        ptSystem->solveSweep(true, false, [&](int i, int j, MotionSolver &solver)
+        {
+            for (unsigned int k = 0; k < ptSystem->listBody().size(); k++)
+            {
+                cx_mat &solnMat = solver.listSolution(k);
+                if (plistSolution.at(k).n_elem == 0)
+                    plistSolution.at(k).zeros(solnMat.n_rows, nFreq, nDir);
+                plistSolution.at(k).slice(i).col(j) = solnMat.col(0);
+            }
+        });
+
+        if (countErrors() != nErr)
+            throw std::runtime_error("Errors found while solving the case.");
+
+        out = true;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+    }
+
+    closeLogs();
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<cx_cube> &OfreqEngine::listSolution()
+{
+    return plistSolution;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_cube &OfreqEngine::listSolution(int bodIndex)
+{
+    return plistSolution.at(bodIndex);
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int OfreqEngine::countErrors()
+{
+    return logStd.getErrorCount() + logErr.getErrorCount();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::openLogs()
+{
+    Log *listLog[3] = {&logStd, &logErr, &logMon};
+
+    for (int i = 0; i < 3; i++)
+    {
+        plistLogOutput[i] = listLog[i]->getDefaultOutput();
+        plistLogExit[i] = listLog[i]->getExitOnError();
+
+        //Errors are reported through the return values, never by ending the host program.
+        listLog[i]->setExitOnError(false);
+        if (pQuiet)
+            listLog[i]->setDefaultOutput("None");
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqEngine::closeLogs()
+{
+    Log *listLog[3] = {&logStd, &logErr, &logMon};
+
+    for (int i = 0; i < 3; i++)
+    {
+        listLog[i]->setDefaultOutput(plistLogOutput[i]);
+        listLog[i]->setExitOnError(plistLogExit[i]);
+    }
+}
@@ -0,0 +1,279 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef OFREQENGINE_H
+#define OFREQENGINE_H
+#include <string>
+#include <vector>
+#include <map>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    #include "../../lib/armadillo.h"  //References the armadillo library in lib folder.
+#elif defined Q_OS_LINUX
+    #include <armadillo>    //Armadillo library included with standard system libraries.
+#endif
+#include "ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations.
+class System;
+
+//######################################### Class Separator ###########################################################
+/**
+ * The OfreqEngine class is the programming interface for embedding the ofreq solver in another program.
+ *
+ * The engine runs a complete ofreq case without touching the file system.  The calling program supplies the text of
+ * each input file and each hydrodynamic data file in memory.  The text uses the same format as the files on disk
+ * and goes through the same parser and dictionaries as ofreq.  After loading, the calling program can change the
+ * case, either through the functions of the engine or directly through the System object.  The engine then solves
+ * the equations of motion for all wave directions and wave frequencies and returns the solutions as one tensor for
+ * each body.
+ *
+ * Input files are identified by their path.  The case files use the path relative to the case directory, for
+ * example "system/control.in" or "constant/forces.in".  The hydrodynamic data files use the path of the hydro system
+ * as listed in the data.in file, followed by the path of the file inside that hydro system, for example
+ * "hydro/environment.out" or "hydro/d1/forceexcite.out".  Any file not supplied in memory is read from disk.
+ *
+ * The log objects are shared by the whole program.  Use setQuiet() to stop all log output from the engine.  Errors
+ * are still reported through the return values of the engine.  While one of its functions runs, the engine turns off
+ * the exit on error of the log objects, so an error never ends the host program.  The previous log settings are
+ * restored before each function returns, so the engine never changes the logs of the host program or of other
+ * engines.  Any error written to the logs during load() or solve() makes it return false.
+ */
+class OfreqEngine : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    OfreqEngine();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Deletes the System object.
+     */
+    ~OfreqEngine();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the text of a case input file.
+     * @param fileIn String.  The path of the input file, relative to the case directory.  For example,
+     * "system/control.in".  Variable passed by value.
+     * @param textIn String.  The text of the input file.  Variable passed by value.
+     */
+    void setCaseFile(std::string fileIn, std::string textIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the text of a hydrodynamic data file.
+     * @param fileIn String.  The path of the hydro system, as listed in the data.in file, followed by the path of the
+     * file inside the hydro system.  For example, "hydro/d1/forceexcite.out".  Variable passed by value.
+     * @param textIn String.  The text of the data file.  Variable passed by value.
+     */
+    void setDataFile(std::string fileIn, std::string textIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears all input files held in memory.  Does not change a case already loaded.
+     */
+    void clearFiles();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Turns all log output from the engine on or off.  Applies to the standard, error, and monitor logs.
+     * @param quietIn Boolean.  True stops all log output while the engine runs.  False leaves the log output as the
+     * host program set it.  Variable passed by value.
+     */
+    void setQuiet(bool quietIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Loads the case from the input files.  Replaces any case already loaded.
+     *
+     * Reads the control, sea environment, forces, bodies, data, and outputs files, in the same sequence as ofreq.
+     * Then reads the hydrodynamic data and sets the active sea model.  The outputs file is optional.
+     * @return Returns true if the case loaded.  Returns false if any required input file could not be read, or the
+     * input files contain an error.
+     */
+    bool load();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reference to the System object of the loaded case.  Use to change the case directly.  Only valid
+     * after load().
+     * @return Returns a reference to the System object.  Variable passed by reference.
+     */
+    ofreq::System &refSystem();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Replaces the list of wave frequencies.  Frequencies below the lowest wave frequency used to choose the
+     * far-field pairs are rejected, and the wave frequencies are not changed.
+     * @param listIn Vector of doubles.  The wave frequencies, in the same units as the control.in file.  Variable
+     * passed by value.
+     * @return Boolean.  True if the wave frequencies were changed.  Returned variable passed by value.
+     * @sa System::checkFarField()
+     */
+    bool setWaveFrequencies(std::vector<double> listIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Replaces the list of wave directions.
+     * @param listIn Vector of doubles.  The wave directions, in the same units as the control.in file.  Variable
+     * passed by value.
+     */
+    void setWaveDirections(std::vector<double> listIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Scales all coefficients of a user reactive force or user cross-body force.
+     * @param forceIn String.  The force name.  Variable passed by value.
+     * @param factorIn Double.  The scale factor.  Variable passed by value.
+     * @return Returns true if a force matched the name.  Returns false otherwise.
+     */
+    bool scaleForce(std::string forceIn, double factorIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the equations of motion for all wave directions and wave frequencies.
+     *
+     * The solutions are stored in the System object, the same as ofreq, and copied into one tensor for each body.
+     * @return Returns true if the solve completed.  Returns false on any error.
+     */
+    bool solve();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The solution tensors from the last solve, one for each body.
+     *
+     * Each tensor has one row for each solution variable, one column for each wave frequency, and one slice for each
+     * wave direction.
+     * @return Returns the list of solution tensors.  Variable passed by reference.
+     */
+    std::vector<arma::cx_cube> &listSolution();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The solution tensor from the last solve for a single body.
+     * @param bodIndex Integer.  The index of the body.  Variable passed by value.
+     * @return Returns the solution tensor.  Variable passed by reference.
+     * @sa listSolution()
+     */
+    arma::cx_cube &listSolution(int bodIndex);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Pointer to the System object.  Created by load().  NULL until a case is loaded.
+     */
+    ofreq::System* ptSystem;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::map<std::string, std::string> pmapFiles; /**< Input files held in memory, keyed by full path. */
+    std::vector<arma::cx_cube> plistSolution; /**< Solution tensors from the last solve, one for each body. */
+    bool pQuiet; /**< Boolean to record if log output is stopped while the engine runs. */
+    std::string plistLogOutput[3]; /**< Default output of the standard, error, and monitor logs, saved by openLogs(). */
+    bool plistLogExit[3]; /**< Exit on error of the standard, error, and monitor logs, saved by openLogs(). */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Saves the settings of the log objects and applies the settings of the engine.  Called at the start of
+     * each function that runs the solver.
+     */
+    void openLogs();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Restores the settings of the log objects saved by openLogs().  Called before each function that runs
+     * the solver returns.
+     */
+    void closeLogs();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Counts the errors written to the logs.
+     * @return Integer.  Variable passed by value.  The total number of errors written to the standard log and the
+     * error log.
+     */
+    int countErrors();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static std::string CASE_PATH; /**< The path given to the case directory.  Never read from disk. */
+    static std::string OUTPUTS; /**< The path of the outputs file, relative to the case directory. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // OFREQENGINE_H
@@ -0,0 +1,527 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "ofreqserver.h"
+#include "system.h"
+#include "../motion_solver/dragsolver.h"
+#include "../global_objects/solution.h"
+#include "../global_objects/solutionset.h"
+#include <QDir>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#ifdef Q_OS_LINUX
+    //----------- Linux Inclusions ------------
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+using namespace arma;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+string OfreqServer::CMD_SCALE = "scale"; /**< Command to scale a user force. */
+string OfreqServer::CMD_COEFF = "coeff"; /**< Command to set the coefficients of one equation of a user force. */
+string OfreqServer::CMD_FREQ = "freq"; /**< Command to replace the wave frequencies. */
+string OfreqServer::CMD_DIR = "dir"; /**< Command to replace the wave directions. */
+string OfreqServer::CMD_SEA = "sea"; /**< Command to set the active sea model. */
+string OfreqServer::CMD_RESET = "reset"; /**< Command to restore the baseline case. */
+string OfreqServer::CMD_SOLVE = "solve"; /**< Command to solve and return the solutions. */
+string OfreqServer::CMD_REPORT = "report"; /**< Command to write the reports. */
+string OfreqServer::CMD_SHUTDOWN = "shutdown"; /**< Command to stop the server. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+OfreqServer::OfreqServer()
+{
+    ptSystem = NULL;
+    pHeaderPath = "";
+    pSocket = -1;
+    pSolved = false;
+    pStop = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+OfreqServer::~OfreqServer()
+{
+    #ifdef Q_OS_LINUX
+    if (pSocket >= 0)
+        ::close(pSocket);
+    #endif
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqServer::setSystem(ofreq::System *ptInput)
+{
+    ptSystem = ptInput;
+
+    //Record the baseline case.
+    plistBaseReact = ptSystem->listForceReact_user();
+    plistBaseCross = ptSystem->listForceCross_user();
+    plistBaseDrag = ptSystem->listForceDrag();
+    plistBaseFreq = ptSystem->listWaveFrequencies();
+    plistBaseDir = ptSystem->listWaveDirections();
+    pBaseSea = ptSystem->refActiveSeaModel().getName();
+
+    pSolved = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqServer::setHeaderPath(string pathIn)
+{
+    pHeaderPath = pathIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int OfreqServer::run(string socketPath)
+{
+    #ifdef Q_OS_LINUX
+    try
+    {
+        sockaddr_un addr;
+
+        if (socketPath.size() >= sizeof(addr.sun_path))
+            throw std::runtime_error("Socket path is too long:  " + socketPath);
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+        //Remove any socket left from a previous server.
+        unlink(socketPath.c_str());
+
+        pSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (pSocket < 0)
+            throw std::runtime_error("Could not create socket:  " + socketPath);
+
+        if ((bind(pSocket, (sockaddr*)&addr, sizeof(addr)) < 0)
+                || (listen(pSocket, 8) < 0))
+            throw std::runtime_error("Could not listen on socket:  " + socketPath);
+
+        logStd.Write("Server listening on socket:  " + socketPath, 3);
+
+        pStop = false;
+        while (!pStop)
+        {
+            int conn = accept(pSocket, NULL, NULL);
+            if (conn < 0)
+                continue;
+
+            //Read the whole transaction.  The client closes its side when done.
+            string request;
+            char buff[4096];
+            ssize_t len;
+            while ((len = recv(conn, buff, sizeof(buff), 0)) > 0)
+                request.append(buff, len);
+
+            //Process each command in order.
+            string response;
+            istringstream lines(request);
+            string line;
+            while (getline(lines, line))
+            {
+                if (line.find_first_not_of(" \t\r") == string::npos)
+                    continue;
+                response += processCommand(line);
+            }
+
+            //Write the response.
+            size_t sent = 0;
+            while (sent < response.size())
+            {
+                len = send(conn, response.data() + sent, response.size() - sent, 0);
+                if (len <= 0)
+                    break;
+                sent += len;
+            }
+
+            ::close(conn);
+        }
+
+        ::close(pSocket);
+        pSocket = -1;
+        unlink(socketPath.c_str());
+
+        logStd.Write("Server stopped.", 3);
+        return 0;
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+        return 1;
+    }
+    #else
+    logStd.Notify();
+    logErr.Write(ID + std::string("Server mode is only available on Linux."), 1);
+    return 1;
+    #endif
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string OfreqServer::processCommand(string lineIn)
+{
+    ostringstream out;
+    out << setprecision(17);
+
+    try
+    {
+        //Split the line into words.
+        istringstream words(lineIn);
+        vector<string> word;
+        string temp;
+        while (words >> temp)
+            word.push_back(temp);
+
+        if (word.size() == 0)
+            throw std::runtime_error("Empty command.");
+
+        string cmd = word.at(0);
+
+        if (cmd == CMD_SCALE)
+        {
+            if (word.size() != 3)
+                throw std::runtime_error("Usage:  " + CMD_SCALE + " <force> <factor>");
+
+            findForce(word.at(1))->scaleCoefficient(toDouble(word.at(2)));
+            pSolved = false;
+        }
+        else if (cmd == CMD_COEFF)
+        {
+            if (word.size() < 5)
+                throw std::runtime_error("Usage:  " + CMD_COEFF + " <force> <ord> <eqn> <c1> <c2> ...");
+
+            ForceReact *ptForce = findForce(word.at(1));
+            int ord = toInt(word.at(2));
+            int eqn = toInt(word.at(3)) - 1;
+
+            if ((ord < 0) || (ord > ptForce->getMaxOrd()))
+                throw std::runtime_error("Order of derivative out of range:  " + lineIn);
+
+            //Only change equations the force already has.  Looking up a missing equation would add it.
+            Derivative &derivIn = ptForce->listDerivative(ord);
+            if ((eqn < 0) || (eqn >= derivIn.getEquationListSize()))
+                throw std::runtime_error("Equation number out of range:  " + lineIn);
+
+            Equation *ptEqn = NULL;
+            for (unsigned int i = 0; i < derivIn.listDataEquation().size(); i++)
+            {
+                int index = derivIn.listDataEquation().at(i).getDataIndex();
+                if (((index < 0) ? static_cast<int>(i) : index) == eqn)
+                    ptEqn = &(derivIn.listDataEquation().at(i));
+            }
+            if (!ptEqn)
+                throw std::runtime_error("Equation number not defined for the force:  " + lineIn);
+
+            //One coefficient for each variable.  The force has one equation for each variable.
+            if (static_cast<int>(word.size() - 4) > derivIn.getEquationListSize())
+                throw std::runtime_error("More coefficients than equations of the force:  " + lineIn);
+
+            //Check every value before any is written, so a bad command leaves the force unchanged.
+            vector<double> listVal;
+            for (unsigned int i = 4; i < word.size(); i++)
+                listVal.push_back(toDouble(word.at(i)));
+
+            for (unsigned int i = 0; i < listVal.size(); i++)
+                ptEqn->listDataVariable(i) = listVal.at(i);
+            pSolved = false;
+        }
+        else if ((cmd == CMD_FREQ) || (cmd == CMD_DIR))
+        {
+            vector<double> listVal;
+            for (unsigned int i = 1; i < word.size(); i++)
+                listVal.push_back(toDouble(word.at(i)));
+
+            if (listVal.size() == 0)
+                throw std::runtime_error("No values given for command:  " + cmd);
+
+            if (cmd == CMD_FREQ)
+            {
+                //Far-field pairs were chosen for the lowest wave frequency at the start.  Their crossbody data is
+                //gone, so lower wave frequencies can not be solved.
+                vector<double> listOld = ptSystem->listWaveFrequencies();
+                ptSystem->setWaveFrequencies(listVal);
+                if (!ptSystem->checkFarField())
+                {
+                    ptSystem->setWaveFrequencies(listOld);
+                    throw std::runtime_error("Wave frequencies below " + ftoa(ptSystem->getFarFieldFreqMin()) +
+                                             " are not allowed.  The far-field approximation was chosen for that "
+                                             "wave frequency.  Frequencies not changed.");
+                }
+            }
+            else
+                ptSystem->setWaveDirections(listVal);
+
+            //Pass the wave frequencies on to the sea model and the hydrodynamic data.
+            ptSystem->setActiveSeaModel();
+            if (cmd == CMD_FREQ)
+                ptSystem->resampleHydro();
+            pSolved = false;
+        }
+        else if (cmd == CMD_SEA)
+        {
+            if (word.size() != 2)
+                throw std::runtime_error("Usage:  " + CMD_SEA + " <name>");
+
+            bool found = false;
+            for (unsigned int i = 0; i < ptSystem->listSeaModel().size(); i++)
+            {
+                if (ptSystem->listSeaModel().at(i)->getName() == word.at(1))
+                    found = true;
+            }
+            if (!found)
+                throw std::runtime_error("No sea model matches the name:  " + word.at(1));
+
+            ptSystem->setActiveSeaModel(word.at(1));
+            pSolved = false;
+        }
+        else if (cmd == CMD_RESET)
+        {
+            reset();
+        }
+        else if (cmd == CMD_SOLVE)
+        {
+            solve();
+
+            for (unsigned int b = 0; b < ptSystem->listBody().size(); b++)
+            {
+                for (unsigned int i = 0; i < ptSystem->listWaveDirections().size(); i++)
+                {
+                    for (unsigned int j = 0; j < ptSystem->listWaveFrequencies().size(); j++)
+                    {
+                        cx_mat soln = ptSystem->listSolutionSet(b).refSolution(i, j).getSolnMat();
+
+                        out << "soln " << (b + 1) << " " << (i + 1) << " " << (j + 1);
+                        for (unsigned int k = 0; k < soln.n_rows; k++)
+                            out << " " << soln(k, 0).real() << " " << soln(k, 0).imag();
+                        out << "\n";
+                    }
+                }
+            }
+        }
+        else if (cmd == CMD_REPORT)
+        {
+            if (word.size() != 2)
+                throw std::runtime_error("Usage:  " + CMD_REPORT + " <path>");
+
+            if (!pSolved)
+                solve();
+
+            //Reports go to the requested directory.
+            string basePath = ptSystem->getPath();
+            QDir().mkpath(QString::fromStdString(word.at(1)));
+            ptSystem->setPath(word.at(1));
+
+            try
+            {
+                ptSystem->refReportManager().clearFiles();
+                ptSystem->refReportManager().setHeader(pHeaderPath);
+                ptSystem->refReportManager().writeReport();
+            }
+            catch(...)
+            {
+                ptSystem->setPath(basePath);
+                throw;
+            }
+            ptSystem->setPath(basePath);
+        }
+        else if (cmd == CMD_SHUTDOWN)
+        {
+            pStop = true;
+        }
+        else
+        {
+            throw std::runtime_error("Unknown command:  " + cmd);
+        }
+
+        out << "ok " << cmd << "\n";
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()), 1);
+        out << "error " << err.what() << "\n";
+    }
+
+    return out.str();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string OfreqServer::request(string socketPath, string requestIn)
+{
+    #ifdef Q_OS_LINUX
+    sockaddr_un addr;
+
+    if (socketPath.size() >= sizeof(addr.sun_path))
+        throw std::runtime_error("Socket path is too long:  " + socketPath);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+    int conn = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (conn < 0)
+        throw std::runtime_error("Could not create socket.");
+
+    if (connect(conn, (sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        ::close(conn);
+        throw std::runtime_error("No server listening on socket:  " + socketPath);
+    }
+
+    //Send the commands, then close the writing side to mark the end of the transaction.
+    size_t sent = 0;
+    ssize_t len;
+    while (sent < requestIn.size())
+    {
+        len = send(conn, requestIn.data() + sent, requestIn.size() - sent, 0);
+        if (len <= 0)
+            break;
+        sent += len;
+    }
+    shutdown(conn, SHUT_WR);
+
+    //Read the response until the server closes the connection.
+    string response;
+    char buff[4096];
+    while ((len = recv(conn, buff, sizeof(buff), 0)) > 0)
+        response.append(buff, len);
+
+    ::close(conn);
+    return response;
+    #else
+    throw std::runtime_error("Server mode is only available on Linux.");
+    #endif
+}
+
+//==========================================Section Separator =========================================================
+//Protected Functions
+
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqServer::solve()
+{
+    int nDir = ptSystem->listWaveDirections().size();
+    int nFreq = ptSystem->listWaveFrequencies().size();
+
+    //Size the solutions for the current case.
+    ptSystem->listSolutionSet().clear();
+    for (unsigned int i = 0; i < ptSystem->listBody().size(); i++)
+        ptSystem->listSolutionSet().push_back(SolutionSet(nDir, nFreq));
+    ptSystem->clearFactor();
+
+    //Linearize the quadratic drag forces.  Starts from the damping of the last solve.
+    DragSolver drag;
+    drag.setSystem(ptSystem);
+    drag.solve();
+
+    //The motion models, hydrodynamic data and index links are already built.  Only the solution is repeated.
+    ptSystem->solveSweep(true);
+
+    pSolved = true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void OfreqServer::reset()
+{
+    for (unsigned int k = 0; k < plistBaseReact.size(); k++)
+        ptSystem->listForceReact_user(k) = plistBaseReact.at(k);
+    for (unsigned int k = 0; k < plistBaseCross.size(); k++)
+        ptSystem->listForceCross_user(k) = plistBaseCross.at(k);
+
+    //The next solve starts the drag linearization from the baseline damping again.
+    ptSystem->listForceDrag() = plistBaseDrag;
+
+    ptSystem->setWaveFrequencies(plistBaseFreq);
+    ptSystem->setWaveDirections(plistBaseDir);
+    ptSystem->setActiveSeaModel(pBaseSea);
+    ptSystem->resampleHydro();
+
+    pSolved = false;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ForceReact *OfreqServer::findForce(string nameIn)
+{
+    for (unsigned int k = 0; k < ptSystem->listForceReact_user().size(); k++)
+    {
+        if (ptSystem->listForceReact_user(k).getForceName() == nameIn)
+            return &(ptSystem->listForceReact_user(k));
+    }
+
+    for (unsigned int k = 0; k < ptSystem->listForceCross_user().size(); k++)
+    {
+        if (ptSystem->listForceCross_user(k).getForceName() == nameIn)
+            return &(ptSystem->listForceCross_user(k));
+    }
+
+    throw std::runtime_error("No user reactive or cross-body force matches the name:  " + nameIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double OfreqServer::toDouble(string valIn)
+{
+    char *end = NULL;
+    double out = strtod(valIn.c_str(), &end);
+
+    if (valIn.empty() || (*end != '\0'))
+        throw std::runtime_error("Not a number:  " + valIn);
+
+    return out;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int OfreqServer::toInt(string valIn)
+{
+    char *end = NULL;
+    long out = strtol(valIn.c_str(), &end, 10);
+
+    if (valIn.empty() || (*end != '\0'))
+        throw std::runtime_error("Not an integer:  " + valIn);
+
+    return static_cast<int>(out);
+}
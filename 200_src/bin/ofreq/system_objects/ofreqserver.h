@@ -0,0 +1,254 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+
+
+//######################################### Class Separator ###########################################################
+#ifndef OFREQSERVER_H
+#define OFREQSERVER_H
+#include <string>
+#include <vector>
+#include <QtGlobal>
+#include "ofreqcore.h"
+#include "../global_objects/forcereact.h"
+#include "../global_objects/forcecross.h"
+#include "../global_objects/forcedrag.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+//Prototype class declarations.
+class System;
+
+//######################################### Class Separator ###########################################################
+/**
+ * The OfreqServer class keeps a fully loaded System resident and answers requests over a local Unix socket.
+ *
+ * Starting ofreq pays for reading the input files, parsing the hydrodynamic databases and building the motion models
+ * before any equation is solved.  In server mode, ofreq does that work once.  The server then accepts case changes
+ * (user force coefficients, wave frequencies, wave directions, active sea model), solves the equations of motion, and
+ * returns the solutions or writes the reports.  Each change applies on top of the case as loaded from the input
+ * files, until the reset command restores it.
+ *
+ * Each connection carries one transaction.  The client writes one command per line and closes its side of the
+ * connection.  The server processes the commands in order, writes the response for each command, and closes the
+ * connection.  Every response ends with a line that starts with "ok" or "error".  Commands:
+ * - scale <force> <factor>:  Scales all coefficients of a user reactive or cross-body force.
+ * - coeff <force> <ord> <eqn> <c1> <c2> ...:  Sets the coefficients of one equation of a user reactive or
+ *   cross-body force.  The order of derivative and equation number are the same as in the forces.in file.  The
+ *   equation must already be defined for the force, and there can be no more coefficients than equations.
+ * - freq <f1> <f2> ...:  Replaces the list of wave frequencies.  Same units as the control.in file.
+ * - dir <d1> <d2> ...:  Replaces the list of wave directions.  Same units as the control.in file.
+ * - sea <name>:  Sets the active sea model.
+ * - reset:  Restores the case as loaded from the input files.
+ * - solve:  Solves all wave directions and wave frequencies.  Writes one line for each body, wave direction and
+ *   wave frequency:  soln <body> <dir> <freq> followed by the real and imaginary part of each solution variable.
+ *   Indices start from 1.
+ * - report <path>:  Solves, if needed, and writes all reports requested in outputs.in to the directory.
+ * - shutdown:  Stops the server after the current transaction.
+ * Numbers must be given in full.  A command with a word that is not a number is rejected and changes nothing.
+ *
+ * Server mode is only available on Linux.
+ */
+class OfreqServer : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    OfreqServer();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.  Closes the socket, if still open.
+     */
+    ~OfreqServer();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the system object that the server works on.  The System must already be fully loaded.  The server
+     * records the current forces, wave frequencies, wave directions and active sea model as the baseline case.
+     * @param ptInput Pointer to the System object.  Variable passed by value.
+     */
+    void setSystem(ofreq::System* ptInput);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the directory with the header file for output reports.
+     * @param pathIn String.  The directory of the header file.  Variable passed by value.
+     */
+    void setHeaderPath(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Listens on the socket and answers requests until a shutdown command is received.
+     * @param socketPath String.  The path of the Unix socket.  Any existing file at that path is removed first.
+     * Variable passed by value.
+     * @return Returns 0 if the server stopped after a shutdown command.  Returns 1 if the socket could not be opened.
+     */
+    int run(std::string socketPath);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Processes a single command line and writes the response.
+     *
+     * Used by run() for each line of a transaction.  Also usable directly, without a socket.
+     * @param lineIn String.  The command line.  Variable passed by value.
+     * @return Returns the response to the command, including the final "ok" or "error" line.  Variable passed by
+     * value.
+     */
+    std::string processCommand(std::string lineIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Client side.  Sends a transaction to a running server and returns the response.
+     * @param socketPath String.  The path of the Unix socket.  Variable passed by value.
+     * @param requestIn String.  The commands to send, one per line.  Variable passed by value.
+     * @return Returns the response from the server.  Throws an error if the server could not be reached.
+     */
+    static std::string request(std::string socketPath, std::string requestIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the equations of motion for all wave directions and wave frequencies, and stores the solutions
+     * in the System object.
+     */
+    void solve();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Restores the case as loaded from the input files.  Includes the linearized drag damping.  The
+     * hydrodynamic data is resampled onto the restored wave frequencies.
+     */
+    void reset();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Finds a user reactive or user cross-body force by name.  Throws an error if no force matches.
+     * @param nameIn String.  The force name.  Variable passed by value.
+     * @return Returns a pointer to the force.  Cross-body forces are returned through their ForceReact base.
+     */
+    ofreq::ForceReact *findForce(std::string nameIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts a word of a command to a double.  Throws an error if the whole word is not a number.
+     * @param valIn String.  The word to convert.  Variable passed by value.
+     * @return Returns the value.  Variable passed by value.
+     */
+    double toDouble(std::string valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Converts a word of a command to an integer.  Throws an error if the whole word is not an integer.
+     * @param valIn String.  The word to convert.  Variable passed by value.
+     * @return Returns the value.  Variable passed by value.
+     */
+    int toInt(std::string valIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Pointer to the System object.
+     */
+    ofreq::System* ptSystem;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pHeaderPath; /**< Directory with the header file for output reports. */
+    int pSocket; /**< File descriptor of the listening socket.  -1 if not open. */
+    bool pSolved; /**< Boolean to record if the stored solutions match the current case. */
+    bool pStop; /**< Boolean to record if a shutdown command was received. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Baseline case, as loaded from the input files.
+    std::vector<ofreq::ForceReact> plistBaseReact; /**< User reactive forces. */
+    std::vector<ofreq::ForceCross> plistBaseCross; /**< User cross-body forces. */
+    std::vector<ofreq::ForceDrag> plistBaseDrag; /**< Quadratic drag forces, with their linearized damping. */
+    std::vector<double> plistBaseFreq; /**< Wave frequencies. */
+    std::vector<double> plistBaseDir; /**< Wave directions. */
+    std::string pBaseSea; /**< Name of the active sea model. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static std::string CMD_SCALE; /**< Command to scale a user force. */
+    static std::string CMD_COEFF; /**< Command to set the coefficients of one equation of a user force. */
+    static std::string CMD_FREQ; /**< Command to replace the wave frequencies. */
+    static std::string CMD_DIR; /**< Command to replace the wave directions. */
+    static std::string CMD_SEA; /**< Command to set the active sea model. */
+    static std::string CMD_RESET; /**< Command to restore the baseline case. */
+    static std::string CMD_SOLVE; /**< Command to solve and return the solutions. */
+    static std::string CMD_REPORT; /**< Command to write the reports. */
+    static std::string CMD_SHUTDOWN; /**< Command to stop the server. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // OFREQSERVER_H
@@ -0,0 +1,176 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "shard.h"
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace std;
+using namespace osea::ofreq;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+Shard::Shard()
+{
+    pName = "";
+    pIndex = -1;
+    pCount = 1;
+    pDirFirst = 0;
+    pDirLast = -1;
+    pFreqFirst = 0;
+    pFreqLast = -1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Shard::setSpec(string specIn)
+{
+    *this = Shard();
+
+    if (specIn.empty())
+        throw std::invalid_argument("Empty shard specification.");
+
+    string::size_type slash = specIn.find('/');
+
+    if (slash != string::npos)
+    {
+        //Round robin shard k of n.
+        string textK = specIn.substr(0, slash);
+        string textN = specIn.substr(slash + 1);
+
+        if (textK.empty() || textN.empty() ||
+                (textK.find_first_not_of("0123456789") != string::npos) ||
+                (textN.find_first_not_of("0123456789") != string::npos))
+            throw std::invalid_argument("Shard specification not recognized:  " + specIn);
+
+        int k = atoi(textK.c_str());
+        int n = atoi(textN.c_str());
+
+        if ((n < 1) || (k < 1) || (k > n))
+            throw std::invalid_argument("Shard index must be from 1 to the number of shards:  " + specIn);
+
+        pIndex = k - 1;
+        pCount = n;
+        pName = textK + "of" + textN;
+    }
+    else
+    {
+        //Ranges of wave directions and wave frequencies.
+        bool haveDir = false;
+        bool haveFreq = false;
+        string::size_type start = 0;
+
+        while (start <= specIn.size())
+        {
+            string::size_type comma = specIn.find(',', start);
+            string part = specIn.substr(start, (comma == string::npos) ? string::npos : comma - start);
+
+            if ((part.size() > 1) && (part.at(0) == 'd') && !haveDir)
+            {
+                readRange(part.substr(1), pDirFirst, pDirLast);
+                haveDir = true;
+            }
+            else if ((part.size() > 1) && (part.at(0) == 'f') && !haveFreq)
+            {
+                readRange(part.substr(1), pFreqFirst, pFreqLast);
+                haveFreq = true;
+            }
+            else
+                throw std::invalid_argument("Shard specification not recognized:  " + specIn);
+
+            if (pName.size() > 0)
+                pName += "_";
+            pName += part;
+
+            if (comma == string::npos)
+                break;
+            start = comma + 1;
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Shard::isSet()
+{
+    return !pName.empty();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool Shard::contains(int dir, int freq, int nFreq)
+{
+    if (!isSet())
+        return true;
+
+    if (pIndex >= 0)
+        return ((dir * nFreq + freq) % pCount) == pIndex;
+
+    if ((dir < pDirFirst) || ((pDirLast >= 0) && (dir > pDirLast)))
+        return false;
+    if ((freq < pFreqFirst) || ((pFreqLast >= 0) && (freq > pFreqLast)))
+        return false;
+
+    return true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string Shard::getName()
+{
+    return pName;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void Shard::readRange(string textIn, int &firstOut, int &lastOut)
+{
+    string::size_type dash = textIn.find('-');
+    string textFirst = textIn.substr(0, dash);
+    string textLast = (dash == string::npos) ? textFirst : textIn.substr(dash + 1);
+
+    if (textFirst.empty() || textLast.empty() ||
+            (textFirst.find_first_not_of("0123456789") != string::npos) ||
+            (textLast.find_first_not_of("0123456789") != string::npos))
+        throw std::invalid_argument("Shard index range not recognized:  " + textIn);
+
+    firstOut = atoi(textFirst.c_str()) - 1;
+    lastOut = atoi(textLast.c_str()) - 1;
+
+    if ((firstOut < 0) || (lastOut < firstOut))
+        throw std::invalid_argument("Shard index range must count from 1 and not decrease:  " + textIn);
+}
@@ -0,0 +1,157 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef SHARD_H
+#define SHARD_H
+#include <string>
+#include "ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ofreq.
+ */
+namespace ofreq
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The Shard class selects the slice of the solution points that one ofreq process solves.
+ *
+ * A large sweep of wave directions and wave frequencies can be split across several processes, on one machine or
+ * on many machines with a shared file system.  Each process solves only the points in its shard and stores them in
+ * its own checkpoint file.  A final run with the merge option loads all shard checkpoint files and writes the
+ * reports.  No other coordination between the processes is needed.
+ *
+ * Two forms of shard specification are recognized:
+ * - k/n:  Round robin shard k of n, with k counted from 1.  Points are numbered in the order of the main loop,
+ *   wave frequencies within wave directions.  The shard takes every point whose number, modulo n, is k - 1.
+ * - d<a>-<b>,f<c>-<d>:  Ranges of wave direction and wave frequency indices, counted from 1 and inclusive.  Either
+ *   range may be left out to take all indices.  A single index may be given without the dash.  For example,
+ *   "d1-18" or "d5,f10-20".
+ */
+class Shard : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.  No shard is set, so every point is included.
+     */
+    Shard();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the shard from a shard specification.  Throws an error if the specification is not recognized.
+     * @param specIn String.  The shard specification.  Variable passed by value.
+     */
+    void setSpec(std::string specIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if a shard is set.
+     * @return Returns true if a shard is set.  Returns false if every point is included.
+     */
+    bool isSet();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if a point belongs to the shard.
+     * @param dir Integer.  Index of the wave direction, counted from 0.  Variable passed by value.
+     * @param freq Integer.  Index of the wave frequency, counted from 0.  Variable passed by value.
+     * @param nFreq Integer.  Number of wave frequencies.  Variable passed by value.
+     * @return Returns true if the point belongs to the shard, or if no shard is set.
+     */
+    bool contains(int dir, int freq, int nFreq);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Name of the shard, safe to use in a file name.  For example, "1of8" or "d1-18_f10-20".
+     * @return Returns the name of the shard.  Empty if no shard is set.
+     */
+    std::string getName();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads an index range of the form <a>-<b> or <a>.  Throws an error if the range is not valid.
+     * @param textIn String.  The range text, without the leading letter.  Variable passed by value.
+     * @param firstOut Integer, passed by reference.  The first index of the range, counted from 0.
+     * @param lastOut Integer, passed by reference.  The last index of the range, counted from 0.
+     */
+    void readRange(std::string textIn, int &firstOut, int &lastOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pName; /**< Name of the shard.  Empty if no shard is set. */
+    int pIndex; /**< Round robin shard index, counted from 0.  -1 for a range shard. */
+    int pCount; /**< Round robin number of shards. */
+    int pDirFirst; /**< First wave direction index of a range shard. */
+    int pDirLast; /**< Last wave direction index of a range shard.  -1 for no limit. */
+    int pFreqFirst; /**< First wave frequency index of a range shard. */
+    int pFreqLast; /**< Last wave frequency index of a range shard.  -1 for no limit. */
+};
+
+}   //Namespace ofreq
+}   //Namespace osea
+
+#endif // SHARD_H
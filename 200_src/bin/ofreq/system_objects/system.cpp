@@ -25,6 +25,10 @@
 \*-------------------------------------------------------------------------------------------------------------------*/
 
 #include "system.h"
+#include "../motion_solver/matbodybuilder.h"
+#include "../motion_solver/motionsolver.h"
+#include <algorithm>
+#include <set>
 
 using namespace std;
 using namespace osea;
@@ -49,6 +53,9 @@ System::System() : pWaveDirections(), pWaveFrequencies()
     //Set starting value for SeaModel index.
     pSeaModelIndex = -1;
 
+    //No indices resolved yet.
+    pIndexResolved = false;
+
     //Pass the system object to the report manager
     pReportManager.setSystem(this);
 }
@@ -99,25 +106,25 @@ std::string System::getPath()
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
-void System::setLogFiles(std::string pathIn, bool append)
+void System::setLogFiles(std::string pathIn, bool append, std::string tagIn)
 {
     if (!append)
     {
         //Don't append output files.  Start by deleting them.
-        string filename = pathIn + SLASH + "standard.log";
+        string filename = pathIn + SLASH + "standard" + tagIn + ".log";
         logStd.deleteLog(filename);
 
-        filename = pathIn + SLASH + "error.log";
+        filename = pathIn + SLASH + "error" + tagIn + ".log";
         logErr.deleteLog(filename);
 
-        filename = pathIn + SLASH + "monitor.log";
+        filename = pathIn + SLASH + "monitor" + tagIn + ".log";
         logMon.deleteLog(filename);
     }
 
     //Set the standard output directory options.
-    logStd.setLogFile(pathIn + SLASH + "standard.log");
-    logErr.setLogFile(pathIn + SLASH + "error.log");
-    logMon.setLogFile(pathIn + SLASH + "monitor.log");
+    logStd.setLogFile(pathIn + SLASH + "standard" + tagIn + ".log");
+    logErr.setLogFile(pathIn + SLASH + "error" + tagIn + ".log");
+    logMon.setLogFile(pathIn + SLASH + "monitor" + tagIn + ".log");
 
     //Set default output locations
     logStd.setDefaultOutput("Both");
@@ -522,6 +529,22 @@ void System::setActiveSeaModel(std::string NameIn)
     {
         //Sea Model index currently defined.
         plistSeaModel.at(pSeaModelIndex)->addWaveFreq(pWaveFrequencies);
+
+        //Directional spreading picks its own solve directions.
+        osea::SeaModel_Spreading *ptSpread = dynamic_cast<osea::SeaModel_Spreading*>(
+                    plistSeaModel.at(pSeaModelIndex));
+
+        if (ptSpread)
+        {
+            ptSpread->calcQuadrature();
+
+            if (ptSpread->listQuadDir().size() > 0)
+            {
+                pWaveDirections = ptSpread->listQuadDir();
+                logStd.Write(string("Directional spreading:  ") + itoa(pWaveDirections.size())
+                             + string(" quadrature wave directions replace the control file wave directions."), 3);
+            }
+        }
     }
 }
 
@@ -543,6 +566,192 @@ ofreq::SolutionSet &System::listSolutionSet(int indexIn)
     return plistSolutions.at(indexIn);
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<ofreq::ScanForce> &System::listScanForce()
+{
+    return plistScanForce;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ofreq::ScanForce &System::listScanForce(int indexIn)
+{
+    return plistScanForce.at(indexIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::addScanForce()
+{
+    plistScanForce.push_back(ScanForce());
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<ofreq::EnsembleParam> &System::listEnsemble()
+{
+    return plistEnsemble;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ofreq::EnsembleParam &System::listEnsemble(int indexIn)
+{
+    return plistEnsemble.at(indexIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::addEnsemble()
+{
+    plistEnsemble.push_back(EnsembleParam());
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setEnsembleSize(int nIn)
+{
+    pEnsembleSize = nIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int System::getEnsembleSize()
+{
+    if (plistEnsemble.size() == 0)
+        return 0;
+
+    if (pEnsembleSize > 0)
+        return pEnsembleSize;
+
+    //Size taken from the sample tables.
+    for (unsigned int i = 0; i < plistEnsemble.size(); i++)
+    {
+        if (plistEnsemble.at(i).getDistribution() == 2)
+            return plistEnsemble.at(i).listValue().size();
+    }
+
+    return 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setEnsembleSeed(unsigned int seedIn)
+{
+    pEnsembleSeed = seedIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+arma::mat System::drawEnsemble()
+{
+    int nSample = getEnsembleSize();
+    arma::mat output;
+    output.set_size(plistEnsemble.size(), nSample);
+
+    std::mt19937 gen(pEnsembleSeed);
+
+    for (unsigned int i = 0; i < plistEnsemble.size(); i++)
+    {
+        vector<double> values = plistEnsemble.at(i).drawSamples(nSample, gen);
+        for (int s = 0; s < nSample; s++)
+            output(i, s) = values.at(s);
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<ofreq::ForceDrag> &System::listForceDrag()
+{
+    return plistForceDrag;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+ofreq::ForceDrag &System::listForceDrag(unsigned int indexIn)
+{
+    //Check if index is out of bounds.  If so, resize vector.
+    if (indexIn >= plistForceDrag.size())
+        plistForceDrag.resize(indexIn + 1);
+
+    return plistForceDrag.at(indexIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int System::getNumScanSets()
+{
+    if (plistScanForce.size() == 0)
+        return 0;
+
+    //Every combination of factors across all parameters.
+    int output = 1;
+    for (unsigned int i = 0; i < plistScanForce.size(); i++)
+    {
+        output *= plistScanForce.at(i).listFactor().size();
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+std::vector<double> System::getScanSet(int indexIn)
+{
+    std::vector<double> output;
+
+    //Decode the index.  The first parameter varies fastest.
+    for (unsigned int i = 0; i < plistScanForce.size(); i++)
+    {
+        int n = plistScanForce.at(i).listFactor().size();
+        output.push_back(plistScanForce.at(i).listFactor(indexIn % n));
+        indexIn = indexIn / n;
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setKeepFactor(bool keepIn)
+{
+    pKeepFactor = keepIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool System::getKeepFactor()
+{
+    return pKeepFactor;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setMixedPrecision(bool mixedIn)
+{
+    pMixedPrecision = mixedIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool System::getMixedPrecision()
+{
+    return pMixedPrecision;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setFactor(int dirIn, int freqIn, LUFactor &factorIn)
+{
+    //Size the list on first use.
+    if (plistFactor.size() != pWaveDirections.size())
+        plistFactor.assign(pWaveDirections.size(), vector<LUFactor>(pWaveFrequencies.size()));
+
+    plistFactor.at(dirIn).at(freqIn) = factorIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+LUFactor &System::refFactor(int dirIn, int freqIn)
+{
+    if ((dirIn < 0) || (dirIn >= static_cast<int>(plistFactor.size()))
+            || (freqIn < 0) || (freqIn >= static_cast<int>(plistFactor.at(dirIn).size()))
+            || !plistFactor.at(dirIn).at(freqIn).isFactored())
+        throw std::runtime_error("No LU factors stored for wave direction " + itoa(dirIn + 1) + ", wave frequency "
+                                 + itoa(freqIn + 1) + ".");
+
+    return plistFactor.at(dirIn).at(freqIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::clearFactor()
+{
+    plistFactor.clear();
+}
+
 //==========================================Section Separator =========================================================
 //Public Slots
 
@@ -562,6 +771,7 @@ string System::getAnalysisType()
 void System::addBody(Body input)
 {
     plistBody.push_back(input);
+    pIndexResolved = false;
 
     //Return the system object.
     emit ReferenceSystem(this);
@@ -571,6 +781,7 @@ void System::addBody(Body input)
 void System::addBody()
 {
     plistBody.push_back(Body());
+    pIndexResolved = false;
 
     //Return the system object.
     emit ReferenceSystem(this);
@@ -626,7 +837,7 @@ void System::linkBodies(int bodID)
             if (name == listBody(j).getBodyName())
             {
                 //Assign the pointer for the body
-                plistBody.at(bodID).listCrossBody_user(i) = listBody(j);
+                plistBody.at(bodID).listCrossBody_user().at(i) = &(listBody(j));
                 //Quit the loop
                 break;
             }
@@ -722,6 +933,18 @@ void System::addSeaModel(osea::SeaModel_Uniform modelIn)
     SearchActiveSeaModel();
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::addSeaModel(osea::SeaModel_Spreading modelIn)
+{
+    //Create new sea model and assign it to the heap.
+    osea::SeaModel_Spreading* newModel = new osea::SeaModel_Spreading(modelIn);
+
+    plistSeaModel.push_back(newModel);
+
+    //Search for matching active sea models.
+    SearchActiveSeaModel();
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 void System::addSeaModel()
 {
@@ -870,12 +1093,14 @@ ofreq::HydroManager &System::listHydroManager(std::string bodNameIn)
 void System::addHydroManager(ofreq::HydroManager HydroIn)
 {
     plistHydroManager.push_back(HydroIn);
+    pIndexResolved = false;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
 void System::addHydroManager()
 {
     plistHydroManager.push_back(ofreq::HydroManager());
+    pIndexResolved = false;
 }
 
 //------------------------------------------Function Separator --------------------------------------------------------
@@ -915,6 +1140,10 @@ void System::updateHydroForce()
             this->listHydroManager(i).calcHydroData(Amp, Freq);
         }
 
+        //Resolve the body indices if this was not done after loading.
+        if (!pIndexResolved)
+            resolveIndex();
+
         //Now copy each of the forces out to the Body objects.
         /*
          *We must first update all the HydroManager objects before copying, because we cannot guarantee
@@ -926,24 +1155,17 @@ void System::updateHydroForce()
             Body *Bod = &(this->listBody(i));
 
             //Find the HydroManager that matches the the current Body object.
-            HydroManager *Hydro;
-            try
-            {
-                Hydro = &(this->listHydroManager(
-                              this->listBody(i).getHydroBodName()));
-            }
-            catch(...)
+            if (Bod->getHydroIndex() < 0)
             {
                 /*
-                 *Assume no HydroManager matched the given HydroBody name.
+                 *No HydroManager matched the given HydroBody name.
                  *We assume this is acceptable.  There are some user situations where the user may
                  *want a single Body to have no hydrodynamic data.
                  *In this case, we just skip it and move on to the next body.
                  */
                 continue;
             }
-
-            //Move forward having found the correct HydroManager.
+            HydroManager *Hydro = &(this->listHydroManager(Bod->getHydroIndex()));
 
             //Copy over active forces.
             Bod->listForceActive_hydro().clear();      //Clear any previous forces.
@@ -955,27 +1177,66 @@ void System::updateHydroForce()
 
             //Copy over Crossbody forces
             Bod->listForceCross_hydro().clear();        //Clear any previous forces.
-            for (unsigned int j = 0; j < this->listBody().size(); j++)
-            {
-                try
-                {
-                    //Copy over crossbody forces, searching by Body name.
-                    Bod->listForceCross_hydro().push_back(
-                                Hydro->getForceCross(
-                                    this->listBody(j).getHydroBodName()));
+            Bod->listCrossBody_hydro().clear();
+            Bod->listCrossIndex_hydro().clear();
 
-                    //Create a link to the corresponding body.
-                    Bod->listCrossBody_hydro().push_back(
-                                &(this->listBody(j)));
+            //Find the first crossbody block for each linked hydrobody name.
+            map<string, int> mapCross;
+            for (int c = 0; c < Hydro->getCrossCount(); c++)
+                mapCross.insert(make_pair(Hydro->getCrossName(c), c));
 
-                }
-                catch(...)
+            //Match each block to the bodies that use that hydrobody name.  Keep the order of the list of bodies.
+            vector< pair<int, int> > listLink;      //Body index and crossbody block index.
+            for (map<string, int>::iterator it = mapCross.begin(); it != mapCross.end(); ++it)
+            {
+                map<string, vector<int> >::iterator bod = pmapHydroBody.find(it->first);
+                if (bod == pmapHydroBody.end())
                 {
-                    //No hydrodata found for that body.  That can happen sometimes.  Its ok.
-                    //The user may supply a Body that has no hydrodynamic force crosslink.
-                    //Continue to the next iteration of the loop.
+                    //No body uses that hydrobody.  That can happen sometimes.  Its ok.
                     continue;
                 }
+
+                for (unsigned int k = 0; k < bod->second.size(); k++)
+                    listLink.push_back(make_pair(bod->second.at(k), it->second));
+            }
+            sort(listLink.begin(), listLink.end());
+
+            for (unsigned int k = 0; k < listLink.size(); k++)
+            {
+                //Copy over crossbody forces.
+                Bod->listForceCross_hydro().push_back(
+                            Hydro->getForceCross(listLink.at(k).second));
+
+                //Create a link to the corresponding body.
+                Bod->listCrossBody_hydro().push_back(
+                            &(this->listBody(listLink.at(k).first)));
+                Bod->listCrossIndex_hydro().push_back(listLink.at(k).first);
+            }
+        }
+
+        //Far-field interaction for distant bodies.  The list is sized once, so the pointers stay valid.
+        if (plistFarPair.size() > 0)
+        {
+            FarField far;
+            plistFarForce.assign(plistFarPair.size(), ForceCross());
+
+            for (unsigned int k = 0; k < plistFarPair.size(); k++)
+            {
+                Body *Bod = &(this->listBody(plistFarPair.at(k).first));
+                Body *Link = &(this->listBody(plistFarPair.at(k).second));
+                HydroManager *Hydro = &(this->listHydroManager(Bod->getHydroIndex()));
+
+                arma::cx_mat coupling = far.calcCoupling(*Hydro, this->listHydroManager(Link->getHydroIndex()),
+                                                   Bod->getLocationX() - Link->getLocationX(),
+                                                   Bod->getLocationY() - Link->getLocationY(), Freq);
+                if ((coupling.n_elem == 0) || (coupling.n_rows != coupling.n_cols))
+                    continue;
+
+                plistFarForce.at(k) = far.makeForce(coupling, Freq, Link->getHydroBodName());
+
+                Bod->listForceCross_hydro().push_back(&plistFarForce.at(k));
+                Bod->listCrossBody_hydro().push_back(Link);
+                Bod->listCrossIndex_hydro().push_back(plistFarPair.at(k).second);
             }
         }
     }
@@ -1005,6 +1266,317 @@ void System::updateHydroForce()
     }
 }
 
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::resolveIndex()
+{
+    try
+    {
+        //Index of each body name.  The first body with a given name wins, same as a search would.
+        map<string, int> mapBody;
+        for (unsigned int i = 0; i < plistBody.size(); i++)
+            mapBody.insert(make_pair(plistBody.at(i).getBodyName(), i));
+
+        //Index of each HydroManager name.
+        map<string, int> mapHydro;
+        for (unsigned int i = 0; i < plistHydroManager.size(); i++)
+            mapHydro.insert(make_pair(plistHydroManager.at(i).getHydroBodyName(), i));
+
+        pmapHydroBody.clear();
+        for (unsigned int i = 0; i < plistBody.size(); i++)
+        {
+            Body &bod = plistBody.at(i);
+
+            //HydroManager for the body.
+            map<string, int>::iterator it = mapHydro.find(bod.getHydroBodName());
+            if (it == mapHydro.end())
+                bod.setHydroIndex(-1);
+            else
+                bod.setHydroIndex(it->second);
+
+            //Bodies that use each hydrobody name.
+            pmapHydroBody[bod.getHydroBodName()].push_back(i);
+
+            //Linked bodies for user crossbody forces.
+            bod.listCrossIndex_user().assign(bod.listCrossBody_user().size(), -1);
+            for (unsigned int j = 0; j < bod.listCrossBody_user().size(); j++)
+            {
+                if (bod.listCrossBody_user().at(j) == NULL)
+                    continue;
+
+                it = mapBody.find(bod.listCrossBody_user(j).getBodyName());
+                if (it != mapBody.end())
+                    bod.listCrossIndex_user().at(j) = it->second;
+            }
+        }
+
+        pIndexResolved = true;
+    }
+    catch (const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool System::isIndexResolved()
+{
+    return pIndexResolved;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setFarField(double distIn)
+{
+    pFarField = distIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double System::getFarField()
+{
+    return pFarField;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setSymTolerance(double tolIn)
+{
+    pSymTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double System::getSymTolerance()
+{
+    return pSymTol;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::setRecipTolerance(double tolIn)
+{
+    pRecipTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double System::getRecipTolerance()
+{
+    return pRecipTol;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::applyFarField()
+{
+    //Pairs found earlier keep their approximation.  Their cross-body blocks are already removed.
+
+    if ((pFarField <= 0) || (pWaveFrequencies.size() == 0))
+        return;
+
+    try
+    {
+        if (!pIndexResolved)
+            resolveIndex();
+
+        //Longest deep water wave length.
+        double freqMin = *min_element(pWaveFrequencies.begin(), pWaveFrequencies.end());
+        if (freqMin <= 0)
+            throw std::runtime_error("Far-field interaction requires wave frequencies greater than zero.");
+
+        FarField approx;
+        double distMin = 0;
+        double errMax = 0;
+        double sumDiff = 0;
+        double sumFull = 0;
+        int nBlock = 0;
+        int nPair = 0;
+
+        for (unsigned int h = 0; h < plistHydroManager.size(); h++)
+        {
+            HydroManager &hydro = plistHydroManager.at(h);
+            if ((hydro.listHydroData().size() == 0) || (hydro.listHydroData().at(0).size() == 0))
+                continue;
+
+            if (distMin == 0)
+            {
+                vector<double> grav = hydro.getGravity();
+                double g = 0;
+                for (unsigned int i = 0; i < grav.size(); i++)
+                    g += grav.at(i) * grav.at(i);
+                g = (g > 0) ? sqrt(g) : 9.80665;
+                distMin = pFarField * 2 * M_PI * g / (freqMin * freqMin);
+            }
+
+            //Bodies that use this hydrobody.
+            vector<int> listBod;
+            for (unsigned int b = 0; b < plistBody.size(); b++)
+            {
+                if (plistBody.at(b).getHydroIndex() == static_cast<int>(h))
+                    listBod.push_back(b);
+            }
+
+            //Names of the linked hydrobodies.
+            set<string> listName;
+            hydroData &data = hydro.listHydroData(0, 0);
+            for (int c = 0; c < data.getCrossCount(0); c++)
+                listName.insert(data.getCrossName(0, c));
+
+            for (set<string>::iterator it = listName.begin(); it != listName.end(); ++it)
+            {
+                map<string, vector<int> >::iterator link = pmapHydroBody.find(*it);
+                if ((listBod.size() == 0) || (link == pmapHydroBody.end()))
+                    continue;
+
+                //Every pair that uses the block must be far apart.
+                bool isFar = true;
+                vector< pair<int, int> > listPair;
+                for (unsigned int i = 0; (i < listBod.size()) && isFar; i++)
+                {
+                    for (unsigned int j = 0; (j < link->second.size()) && isFar; j++)
+                    {
+                        int b = listBod.at(i);
+                        int c = link->second.at(j);
+                        if ((b == c) || (plistBody.at(c).getHydroIndex() < 0))
+                            continue;
+
+                        double dx = plistBody.at(b).getLocationX() - plistBody.at(c).getLocationX();
+                        double dy = plistBody.at(b).getLocationY() - plistBody.at(c).getLocationY();
+                        if (sqrt(dx * dx + dy * dy) < distMin)
+                            isFar = false;
+                        else
+                            listPair.push_back(make_pair(b, c));
+                    }
+                }
+
+                if (!isFar || (listPair.size() == 0))
+                    continue;
+
+                //Error estimate against the full crossbody data, before it is removed.
+                for (unsigned int k = 0; k < listPair.size(); k++)
+                {
+                    int b = listPair.at(k).first;
+                    int c = listPair.at(k).second;
+                    double pairDiff = 0;
+                    double pairFull = 0;
+
+                    approx.addError(hydro, plistHydroManager.at(plistBody.at(c).getHydroIndex()), *it,
+                                 plistBody.at(b).getLocationX() - plistBody.at(c).getLocationX(),
+                                 plistBody.at(b).getLocationY() - plistBody.at(c).getLocationY(),
+                                 pairDiff, pairFull);
+
+                    if (pairFull > 0)
+                        errMax = max(errMax, sqrt(pairDiff / pairFull));
+                    sumDiff += pairDiff;
+                    sumFull += pairFull;
+
+                    plistFarPair.push_back(listPair.at(k));
+                    nPair++;
+                }
+
+                nBlock += hydro.removeCross(*it);
+            }
+        }
+
+        sort(plistFarPair.begin(), plistFarPair.end());
+
+        //The pairs are only far enough apart for wave frequencies at or above the one used here.
+        if (nPair > 0)
+            pFarFreqMin = max(pFarFreqMin, freqMin);
+
+        logStd.Write(string("Far-field interaction:  ") + itoa(nPair) + string(" body pairs beyond ")
+                     + std::to_string(distMin) + string(" m use the far-field approximation.  ")
+                     + itoa(nBlock) + string(" crossbody blocks removed."), 3);
+
+        if (sumFull > 0)
+        {
+            logStd.Write(string("Far-field interaction:  Relative error against full crossbody data:  ")
+                         + std::to_string(100.0 * sqrt(sumDiff / sumFull)) + string("% overall, ")
+                         + std::to_string(100.0 * errMax) + string("% largest pair."), 3);
+        }
+    }
+    catch(const std::exception &err)
+    {
+        logStd.Notify();
+        logErr.Write(ID + std::string(err.what()));
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool System::checkFarField()
+{
+    if ((pFarFreqMin <= 0) || (pWaveFrequencies.size() == 0))
+        return true;
+
+    return *min_element(pWaveFrequencies.begin(), pWaveFrequencies.end()) >= pFarFreqMin;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double System::getFarFieldFreqMin()
+{
+    return pFarFreqMin;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::resampleHydro()
+{
+    for (unsigned int i = 0; i < plistHydroManager.size(); i++)
+        plistHydroManager.at(i).resample(pWaveFrequencies);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void System::solveSweep(bool storeIn, bool keepIn, function<void(int, int, MotionSolver &)> pointIn,
+                        function<bool(int, int)> skipIn)
+{
+    //Mixed precision does not keep the factors.
+    bool keep = keepIn || (storeIn && pKeepFactor);
+
+    MatBodyBuilder builder;
+    builder.setSystem(this);
+
+    for (unsigned int i = 0; i < pWaveDirections.size(); i++)
+    {
+        setCurWaveDirInd(i);
+
+        for (unsigned int j = 0; j < pWaveFrequencies.size(); j++)
+        {
+            setCurFreqInd(j);
+
+            if (skipIn && skipIn(i, j))
+                continue;
+
+            //Update hydrodynamic forces
+            updateHydroForce();
+
+            //Build the matrix bodies
+            vector<matBody> listMatBody(plistBody.size());
+            for (unsigned int k = 0; k < plistBody.size(); k++)
+                builder.buildMatBody(listMatBody, k, true);
+
+            //Solve the system of equations.
+            MotionSolver theMotionSolver(listMatBody);
+            theMotionSolver.setWaveFreq(getCurFreq());
+            theMotionSolver.setMixedPrecision(pMixedPrecision && !keep);
+            theMotionSolver.setKeepFactor(keep);
+            theMotionSolver.setSymTolerance(pSymTol);
+            theMotionSolver.calculateOutputs();
+
+            if (storeIn)
+            {
+                //Assign each solution to a body.
+                for (unsigned int k = 0; k < plistBody.size(); k++)
+                {
+                    Solution soln;
+                    soln.setBody(&plistBody.at(k));
+                    soln.setSolnMat(theMotionSolver.listSolution(k));
+                    plistSolutions.at(k).setSolnMat(i, j, soln);
+                }
+
+                //Keep the factors of the global matrix for adjoint reports.
+                if (pKeepFactor)
+                    setFactor(i, j, theMotionSolver.refFactor());
+            }
+
+            if (pointIn)
+                pointIn(i, j, theMotionSolver);
+        }
+    }
+}
+
 //------------------------------------------Function Separator --------------------------------------------------------
 ReportManager &System::refReportManager()
 {
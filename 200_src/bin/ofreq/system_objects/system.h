@@ -46,11 +46,18 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <map>
+#include <functional>
 #include <QObject>
 #include "../global_objects/body.h"
 #include "../system_objects/ofreqcore.h"
 #include "../hydro_data/hydromanager.h"
 #include "../reports/reportmanager.h"
+#include "../global_objects/scanforce.h"
+#include "../global_objects/ensembleparam.h"
+#include "../global_objects/forcedrag.h"
+#include "../hydro_data/farfield.h"
+#include "../motion_solver/lufactor.h"
 
 //Sea Models to Include
 #include "../sea_models/seamodel.h"
@@ -58,6 +65,7 @@
 #include "../sea_models/seamodel_singledirection.h"
 #include "../sea_models/seamodel_longcrest.h"
 #include "../sea_models/seamodel_uniform.h"
+#include "../sea_models/seamodel_spreading.h"
 
 //Wave Spectra to Include
 #include "../wave_spectra/specbretschneider.h"
@@ -105,6 +113,9 @@ namespace osea
 namespace ofreq
 {
 
+//Prototype class declarations.
+class MotionSolver;
+
 //######################################### Class Separator ###########################################################
 /**
  * This class holds data for the system object.  The system object controls the overall behavior of the program.
@@ -152,8 +163,10 @@ public:
      * passed by value.
      * @param append Boolean variable.  Desribes if the output files should be appended to, or overwritten.
      * default is to overwrite for each new session.
+     * @param tagIn String added to the name of each log file, before the extension.  Used so that several oFreq
+     * processes can share one run directory, such as the shards of a sharded run.  Default is no tag.
      */
-    void setLogFiles(std::string pathIn, bool append = false);
+    void setLogFiles(std::string pathIn, bool append = false, std::string tagIn = "");
 
     //------------------------------------------Function Separator ----------------------------------------------------
 	/**
@@ -496,6 +509,9 @@ public:
     /**
      * @brief Sets the active SeaModel that gets used for the current run of oFreq.  If the model with the matching
      * name does not currently exist in the list of sea models, then the name is stored and assigned later.
+     *
+     * If the active sea model uses directional spreading, the wave directions are replaced with the quadrature
+     * directions of the sea model.  The directions from the control file are not used.
      * @param NameIn The name which corresponds to the SeaModel object with the matching name.
      */
     void setActiveSeaModel(std::string NameIn = "");
@@ -532,6 +548,272 @@ public:
      */
     ofreq::SolutionSet &listSolutionSet(int indexIn);
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to the list of parameters for a parametric scan of user forces.
+     *
+     * Each entry defines one user force and the list of factors to scale it by.  If the list is empty, no scan is
+     * performed.
+     * @return Returns a vector of ScanForce objects, variable passed by reference.
+     */
+    std::vector<ofreq::ScanForce> &listScanForce();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to a single entry in the list of parameters for a parametric scan.
+     * @param indexIn Integer, variable passed by value.  The index of the entry that you want to retrieve.
+     * @return Returns a ScanForce object, variable passed by reference.
+     */
+    ofreq::ScanForce &listScanForce(int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a new, blank parameter to the list of parameters for a parametric scan.
+     */
+    void addScanForce();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to the list of uncertain parameters for an ensemble study.
+     *
+     * Each entry defines one body mass property or user force factor, and the distribution of its values.  If the
+     * list is empty, no ensemble is run.
+     * @return Returns a vector of EnsembleParam objects, variable passed by reference.
+     */
+    std::vector<ofreq::EnsembleParam> &listEnsemble();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to a single entry in the list of uncertain parameters for an ensemble study.
+     * @param indexIn Integer, variable passed by value.  The index of the entry that you want to retrieve.
+     * @return Returns an EnsembleParam object, variable passed by reference.
+     */
+    ofreq::EnsembleParam &listEnsemble(int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a new, blank parameter to the list of uncertain parameters for an ensemble study.
+     */
+    void addEnsemble();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of samples in the ensemble study.
+     * @param nIn Integer, variable passed by value.  The number of samples.  Zero uses the length of the sample
+     * tables.
+     */
+    void setEnsembleSize(int nIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of samples in the ensemble study.  If no size was set, the size is the length of the
+     * first sample table.
+     * @return Integer.  The number of samples.  Returns 0 if no ensemble is defined.  Returned variable passed by
+     * value.
+     */
+    int getEnsembleSize();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the seed of the random number generator for the ensemble study.  The same seed always gives the
+     * same samples.
+     * @param seedIn Integer, variable passed by value.  The seed.
+     */
+    void setEnsembleSeed(unsigned int seedIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Draws the value of every uncertain parameter for every sample of the ensemble study.
+     *
+     * Parameters draw their values in the order they are listed, from a single random number generator.
+     * @return Matrix of doubles.  One row for each entry in the list of EnsembleParam objects.  One column for each
+     * sample.  Returned variable passed by value.
+     */
+    arma::mat drawEnsemble();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to the list of quadratic drag forces.
+     *
+     * Each entry controls the equivalent linear damping of one user reactive force.  If the list is empty, no drag
+     * linearization is performed.
+     * @return Returns a vector of ForceDrag objects, variable passed by reference.
+     */
+    std::vector<ofreq::ForceDrag> &listForceDrag();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to a single entry in the list of quadratic drag forces.  Resizes the list if the
+     * index is out of bounds.
+     * @param indexIn Integer, variable passed by value.  The index of the entry that you want to retrieve.
+     * @return Returns a ForceDrag object, variable passed by reference.
+     */
+    ofreq::ForceDrag &listForceDrag(unsigned int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of parameter sets in the parametric scan.  This is the number of combinations of
+     * factors across all parameters.
+     * @return Integer.  The number of parameter sets.  Returns 0 if no scan is defined.  Returned variable passed by
+     * value.
+     */
+    int getNumScanSets();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the factors for one parameter set of the parametric scan.
+     *
+     * The first parameter in the list varies fastest.
+     * @param indexIn Integer, variable passed by value.  The index of the parameter set.  Start numbering from 0.
+     * @return Vector of doubles.  One factor for each entry in the list of ScanForce objects.  Returned variable
+     * passed by value.
+     */
+    std::vector<double> getScanSet(int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether the LU factors of the global reactive force matrix are kept for each wave direction and
+     * wave frequency.  Reports that solve the adjoint system set this when they are defined.  Default is false.
+     * @param keepIn Boolean, variable passed by value.  True to keep the factors.
+     */
+    void setKeepFactor(bool keepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets whether the LU factors of the global reactive force matrix are kept.
+     * @return Boolean.  True if the factors are kept.  Returned variable passed by value.
+     */
+    bool getKeepFactor();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets whether the motion solver factors the global reactive force matrix in single precision and
+     * refines the solution to double precision accuracy.  Set by the solver keyword in the control file.  The motion
+     * solver falls back to double precision for any point where refinement does not converge.  Default is false.
+     * @param mixedIn Boolean, variable passed by value.  True to use mixed precision.
+     */
+    void setMixedPrecision(bool mixedIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets whether the motion solver uses mixed precision.  Mixed precision does not keep the LU factors, so
+     * callers must still use double precision when getKeepFactor() is true.
+     * @return Boolean.  True if mixed precision is requested.  Returned variable passed by value.
+     */
+    bool getMixedPrecision();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the distance for far-field interaction, in wave lengths.  Set by the farfield keyword in the
+     * control file.  Bodies further apart than this use the far-field approximation instead of crossbody data.  The
+     * wave length is for the lowest wave frequency, in deep water.  Zero turns off far-field interaction.  Default is
+     * zero.
+     * @param distIn Double, variable passed by value.  The distance in wave lengths.
+     * @sa FarField
+     */
+    void setFarField(double distIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the distance for far-field interaction, in wave lengths.
+     * @return Double.  The distance in wave lengths.  Zero if far-field interaction is off.
+     */
+    double getFarField();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the tolerance for the symmetry check in the motion solver.  Set by the symtol keyword in the
+     * control file.  A global reactive force matrix that is complex symmetric within this relative tolerance uses the
+     * symmetric indefinite factorization.  Any other matrix uses the LU factorization.  Raise the tolerance for
+     * hydrodynamic data with small numerical asymmetry.  A negative value always uses the LU factorization.  Default
+     * is 1.0e-10.
+     * @param tolIn Double, variable passed by value.  The relative tolerance.
+     * @sa LUFactor
+     */
+    void setSymTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the tolerance for the symmetry check in the motion solver.
+     * @return Double.  The relative tolerance.  Negative if the symmetric factorization is off.
+     */
+    double getSymTolerance();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the tolerance to average reciprocal crossbody blocks.  Set by the reciptol keyword in the control
+     * file.  Crossbody blocks equal within round off are always stored once.  Blocks that only agree within this
+     * relative tolerance are averaged and stored once, which changes the input coefficients.  A negative value turns
+     * off averaging.  Default is off.
+     * @param tolIn Double, variable passed by value.  The relative tolerance.
+     * @sa hydroData::shareCross()
+     */
+    void setRecipTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the tolerance to average reciprocal crossbody blocks.
+     * @return Double.  The relative tolerance.  Negative if averaging is off.
+     */
+    double getRecipTolerance();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Replaces the crossbody data of distant bodies with the far-field approximation.
+     *
+     * Run once after the hydrodynamic data is read and resolveIndex() is called.  A crossbody block is only removed
+     * if every pair of bodies that uses it is beyond the far-field distance.  Before removing the data, the
+     * approximation is compared against it, and the relative error is logged.  The decision uses the wave
+     * frequencies at the time of the call.  Does nothing if far-field interaction is off.
+     */
+    void applyFarField();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Checks the current wave frequencies against the far-field decision of applyFarField().
+     *
+     * A lower wave frequency gives a longer wave length and a larger far-field distance.  Pairs chosen at a higher
+     * wave frequency may then be too close for the approximation, and their crossbody data is already removed.  Run
+     * after any change to the wave frequencies.
+     * @return Boolean.  False if any wave frequency is below the lowest wave frequency used by applyFarField() to
+     * choose the far-field pairs.  True otherwise, or if no pairs use the far-field approximation.  Returned
+     * variable passed by value.
+     */
+    bool checkFarField();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the lowest wave frequency allowed by the far-field pairs.
+     * @return Double.  The lowest wave frequency used by applyFarField() to choose the far-field pairs.  Zero if no
+     * pairs use the far-field approximation.  Returned variable passed by value.
+     */
+    double getFarFieldFreqMin();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Stores the LU factors of the global reactive force matrix for one wave direction and wave frequency.
+     * @param dirIn Integer, variable passed by value.  The index of the wave direction.
+     * @param freqIn Integer, variable passed by value.  The index of the wave frequency.
+     * @param factorIn The LU factors to store.  Variable passed by reference.
+     */
+    void setFactor(int dirIn, int freqIn, ofreq::LUFactor &factorIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Provides direct access to the stored LU factors for one wave direction and wave frequency.  Throws an
+     * error if no factors were stored for that point.
+     * @param dirIn Integer, variable passed by value.  The index of the wave direction.
+     * @param freqIn Integer, variable passed by value.  The index of the wave frequency.
+     * @return Returns the LUFactor object, variable passed by reference.
+     */
+    ofreq::LUFactor &refFactor(int dirIn, int freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Clears all stored LU factors.  Call this whenever the stored solutions no longer match the factors.
+     */
+    void clearFactor();
+
 //==========================================Section Separator =========================================================
 public slots:
     //------------------------------------------Function Separator ----------------------------------------------------
@@ -684,6 +966,7 @@ public slots:
     void addSeaModel(osea::SeaModel_SingleDirection modelIn);
     void addSeaModel(osea::SeaModel_LongCrest modelIn);
     void addSeaModel(osea::SeaModel_Uniform modelIn);
+    void addSeaModel(osea::SeaModel_Spreading modelIn);
 
     //-----------------------------------------Function Separator ----------------------------------------------------
     /**
@@ -780,6 +1063,66 @@ public slots:
      */
     void updateHydroForce();
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Resolves all name and pointer references between bodies into integer indices.
+     *
+     * Bodies reference each other by pointer (user crossbody forces) and reference their hydrodynamic data by name.
+     * Searching for those references at every wave frequency scales badly with the number of bodies.  This function
+     * runs once, after all input files are read.  It records the index of the HydroManager for each body, and the
+     * index of each linked body for user crossbody forces.  It also records which bodies use each hydrobody name, so
+     * that updateHydroForce() can link hydrodynamic crossbody forces without a search.
+     *
+     * Adding a body or a HydroManager clears the resolved indices.  They are then resolved again on the next call
+     * to updateHydroForce().
+     * @sa Body::getHydroIndex()
+     * @sa Body::listCrossIndex_user()
+     */
+    void resolveIndex();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reports if the indices between bodies are resolved.
+     * @return Returns boolean, variable passed by value.  True if resolveIndex() was called since the last body or
+     * HydroManager was added.
+     */
+    bool isIndexResolved();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Resamples all hydrodynamic data onto the current list of wave frequencies.
+     *
+     * Run once after the hydrodynamic data is read, and again after any change to the wave frequencies.  It moves
+     * the frequency interpolation out of updateHydroForce().  Skipping it only costs speed.  Wave frequencies that
+     * are not on the resampled grid are still interpolated.
+     * @sa hydroData::resample()
+     */
+    void resampleHydro();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the equations of motion for every wave direction and wave frequency.
+     *
+     * This is the one sweep over the wave directions and wave frequencies.  For each point, it updates the
+     * hydrodynamic forces, builds the matrix bodies, and runs a motion solver with the solver options of the
+     * system.  Callers only differ in what they do with each solved point.
+     * 1.)  If storeIn is true, the solution of each body goes into the list of solution sets.  The LU factors are
+     *      also stored when getKeepFactor() is true.  The solution sets must already be sized.
+     * 2.)  If skipIn is given and returns true, the point is not solved.
+     * 3.)  If pointIn is given, it is called after each point is solved, with the motion solver of that point.
+     * Mixed precision is only used when no LU factors are needed.
+     * @param storeIn Boolean.  True to store the solutions in the system.  Variable passed by value.
+     * @param keepIn Boolean.  True if pointIn needs the LU factors from the motion solver.  Variable passed by
+     * value.
+     * @param pointIn Function called after each point.  Arguments are the wave direction index, the wave
+     * frequency index, and the motion solver.  Optional.
+     * @param skipIn Function that returns true for any point to skip.  Arguments are the wave direction index and
+     * the wave frequency index.  Optional.
+     */
+    void solveSweep(bool storeIn, bool keepIn = false,
+                    std::function<void(int, int, ofreq::MotionSolver &)> pointIn = nullptr,
+                    std::function<bool(int, int)> skipIn = nullptr);
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief Provides access to the report manager.
@@ -939,6 +1282,18 @@ private:
     //------------------------------------------Function Separator ----------------------------------------------------
     std::vector<ofreq::HydroManager> plistHydroManager;
 
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief True if the indices between bodies are resolved.  See resolveIndex().
+     */
+    bool pIndexResolved;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of body indices that use each hydrobody name.  Keyed by the hydrobody name.
+     */
+    std::map<std::string, std::vector<int> > pmapHydroBody;
+
     //------------------------------------------Function Separator ----------------------------------------------------
     /**
      * @brief The path to the current working directory for the current oFreq run.  This is the root directory that
@@ -957,6 +1312,61 @@ private:
      * @brief The list of solution sets.  Each entry is the set of solutions for one object.
      */
     std::vector< ofreq::SolutionSet > plistSolutions;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of parameters for a parametric scan of user forces.
+     */
+    std::vector< ofreq::ScanForce > plistScanForce;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of uncertain parameters for an ensemble study.
+     */
+    std::vector< ofreq::EnsembleParam > plistEnsemble;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pEnsembleSize = 0; /**< Number of samples in the ensemble study.  Zero uses the length of the sample tables. */
+    unsigned int pEnsembleSeed = 1; /**< Seed of the random number generator for the ensemble study. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The list of quadratic drag forces.
+     */
+    std::vector< ofreq::ForceDrag > plistForceDrag;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The LU factors of the global reactive force matrix.  Indexed by wave direction, then wave frequency.
+     * Only filled when pKeepFactor is true.
+     */
+    std::vector< std::vector< ofreq::LUFactor > > plistFactor;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    bool pKeepFactor = false; /**< Boolean to record if the LU factors are kept. */
+    bool pMixedPrecision = false; /**< Boolean to record if the motion solver uses mixed precision. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pFarField = 0; /**< Distance for far-field interaction, in wave lengths.  Zero is off. */
+    double pSymTol = 1.0e-10; /**< Relative tolerance for the symmetry check in the motion solver.  Negative is off. */
+    double pRecipTol = -1.0; /**< Relative tolerance to average reciprocal crossbody blocks.  Negative is off. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The pairs of bodies that use the far-field approximation.  First is the index of the body that receives
+     * the force.  Second is the index of the linked body.
+     */
+    std::vector< std::pair<int, int> > plistFarPair;
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pFarFreqMin = 0; /**< Lowest wave frequency the far-field pairs were chosen for.  Zero if no pairs. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The far-field crossbody forces for the current wave frequency.  One for each entry in plistFarPair.
+     * The Body objects point into this list.
+     */
+    std::vector< ofreq::ForceCross > plistFarForce;
 };
 
 }   //Namespace ofreq
@@ -0,0 +1,312 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "bemsolver.h"
+#include <cmath>
+#include <thread>
+#include "greenfunc.h"
+#include "hmatrix.h"
+#include "gmressolver.h"
+
+using namespace std;
+using namespace arma;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BemSolver::BemSolver()
+{
+    ptMesh = NULL;
+    pDensity = 1025.0;
+    pGrav = 9.80665;
+    pThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (pThreads < 1)
+        pThreads = 1;
+    pAcaTol = 1e-4;
+    pSolveTol = 1e-6;
+    pNext = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setMesh(PanelMesh *meshIn)
+{
+    ptMesh = meshIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setFrequencies(vector<double> freqIn)
+{
+    plistFreq = freqIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setDirections(vector<double> dirIn)
+{
+    plistDir = dirIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setDensity(double densityIn)
+{
+    pDensity = densityIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setGravity(double gravIn)
+{
+    pGrav = gravIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setThreads(int threadsIn)
+{
+    if (threadsIn < 1)
+    {
+        threadsIn = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadsIn < 1)
+            threadsIn = 1;
+    }
+    pThreads = threadsIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setAcaTolerance(double tolIn)
+{
+    pAcaTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::setSolverTolerance(double tolIn)
+{
+    pSolveTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::run()
+{
+    if (!ptMesh || ptMesh->getPanelCount() == 0)
+        throw std::runtime_error("No panels below the free surface.");
+    if (plistFreq.empty())
+        throw std::runtime_error("No wave frequencies defined.");
+    for (unsigned int i = 0; i < plistFreq.size(); i++)
+    {
+        if (plistFreq[i] <= 0.0)
+            throw std::invalid_argument("Wave frequencies must be positive.");
+    }
+
+    pTree.build(ptMesh);
+    logStd.Write("Panels:  " + itoa(ptMesh->getPanelCount()) + ".  Matrix blocks:  " + itoa(pTree.getBlockCount()),
+                 3);
+
+    int nMode = 6 * ptMesh->getBodyCount();
+    plistMass.assign(plistFreq.size(), zeros<mat>(nMode, nMode));
+    plistDamp.assign(plistFreq.size(), zeros<mat>(nMode, nMode));
+    plistExcite.assign(plistFreq.size(), vector<cx_vec>(plistDir.size(), zeros<cx_vec>(nMode)));
+
+    //Each thread takes the next frequency from the shared counter.
+    pNext = 0;
+    int nThread = (pThreads < static_cast<int>(plistFreq.size())) ? pThreads : plistFreq.size();
+
+    vector<std::thread> listThread;
+    for (int t = 0; t < nThread; t++)
+        listThread.push_back(std::thread(&BemSolver::runWorker, this));
+
+    for (unsigned int t = 0; t < listThread.size(); t++)
+        listThread.at(t).join();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat &BemSolver::getAddedMass(int freqIn)
+{
+    return plistMass.at(freqIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat &BemSolver::getDamping(int freqIn)
+{
+    return plistDamp.at(freqIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_vec &BemSolver::getExcite(int freqIn, int dirIn)
+{
+    return plistExcite.at(freqIn).at(dirIn);
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::runWorker()
+{
+    while (true)
+    {
+        int next = pNext++;
+        if (next >= static_cast<int>(plistFreq.size()))
+            break;
+
+        try
+        {
+            solveFreq(next);
+        }
+        catch(const std::exception &err)
+        {
+            //Error handler.  One failed frequency does not stop the others.
+            logStd.Notify();
+            logErr.Write(ID + string(err.what()));
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BemSolver::solveFreq(int freqIn)
+{
+    double omega = plistFreq.at(freqIn);
+    double K = omega * omega / pGrav;
+    int nPan = ptMesh->getPanelCount();
+    int nBod = ptMesh->getBodyCount();
+    PanelMesh *mesh = ptMesh;
+
+    GreenFunc green;
+    green.setWaveNumber(K);
+
+    //Potential influence.  S(i, j) is the potential at panel i from a unit source strength on panel j.
+    HMatrix matPot;
+    matPot.build(&pTree,
+                 [mesh, &green](int i, int j) -> complex<double>
+                 {
+                     double pot, grad[3];
+                     complex<double> wave, waveGrad[3];
+                     mesh->evalRankine(mesh->getCentroid(i), j, i == j, pot, grad);
+                     green.evalWave(mesh->getCentroid(i), mesh->getCentroid(j), wave, waveGrad);
+                     return pot + wave * mesh->getArea(j);
+                 },
+                 pAcaTol);
+
+    //Normal velocity influence.  The diagonal includes the jump of -2 pi across the panel.
+    HMatrix matVel;
+    matVel.build(&pTree,
+                 [mesh, &green](int i, int j) -> complex<double>
+                 {
+                     double pot, grad[3];
+                     complex<double> wave, waveGrad[3];
+                     const double *norm = mesh->getNormal(i);
+                     mesh->evalRankine(mesh->getCentroid(i), j, i == j, pot, grad);
+                     green.evalWave(mesh->getCentroid(i), mesh->getCentroid(j), wave, waveGrad);
+                     complex<double> output = 0.0;
+                     for (int c = 0; c < 3; c++)
+                         output += norm[c] * (grad[c] + waveGrad[c] * mesh->getArea(j));
+                     if (i == j)
+                         output -= 2.0 * M_PI;
+                     return output;
+                 },
+                 pAcaTol);
+
+    GmresSolver solver;
+    solver.setTolerance(pSolveTol);
+    solver.setMatrix(&matVel);
+    int iterations = 0;
+
+    //Radiation problems.  One per mode of each body, with unit normal velocity on that body only.
+    cx_mat integral = zeros<cx_mat>(6 * nBod, 6 * nBod);
+    for (int b = 0; b < nBod; b++)
+    {
+        for (int k = 0; k < 6; k++)
+        {
+            cx_vec rhs = zeros<cx_vec>(nPan);
+            for (int i = 0; i < nPan; i++)
+            {
+                if (ptMesh->getBody(i) == b)
+                    rhs(i) = ptMesh->getGenNormal(i, k);
+            }
+
+            cx_vec phi = matPot.multiply(solver.solve(rhs));
+            iterations += solver.getIterations();
+
+            for (int i = 0; i < nPan; i++)
+            {
+                int row = 6 * ptMesh->getBody(i);
+                for (int j = 0; j < 6; j++)
+                    integral(row + j, 6 * b + k) += phi(i) * (ptMesh->getGenNormal(i, j) * ptMesh->getArea(i));
+            }
+        }
+    }
+
+    plistMass[freqIn] = -pDensity * real(integral);
+    plistDamp[freqIn] = omega * pDensity * imag(integral);
+
+    //Diffraction problems.  One per wave direction.
+    complex<double> iunit(0.0, 1.0);
+    for (unsigned int d = 0; d < plistDir.size(); d++)
+    {
+        double cosDir = cos(plistDir[d]);
+        double sinDir = sin(plistDir[d]);
+
+        //Incident wave potential and its normal derivative, for a unit amplitude wave.
+        cx_vec phiInc(nPan);
+        cx_vec rhs(nPan);
+        for (int i = 0; i < nPan; i++)
+        {
+            const double *cent = ptMesh->getCentroid(i);
+            const double *norm = ptMesh->getNormal(i);
+            phiInc(i) = iunit * (pGrav / omega) * exp(K * cent[2])
+                    * exp(-iunit * K * (cent[0] * cosDir + cent[1] * sinDir));
+            complex<double> dphi = phiInc(i) * (-iunit * K * cosDir * norm[0] - iunit * K * sinDir * norm[1]
+                                                + K * norm[2]);
+            rhs(i) = -dphi;
+        }
+
+        cx_vec phi = phiInc + matPot.multiply(solver.solve(rhs));
+        iterations += solver.getIterations();
+
+        cx_vec &force = plistExcite[freqIn][d];
+        force.zeros();
+        for (int i = 0; i < nPan; i++)
+        {
+            int row = 6 * ptMesh->getBody(i);
+            for (int j = 0; j < 6; j++)
+                force(row + j) += iunit * (omega * pDensity) * phi(i)
+                        * (ptMesh->getGenNormal(i, j) * ptMesh->getArea(i));
+        }
+    }
+
+    logStd.Write("Frequency " + itoa(freqIn + 1) + " of " + itoa(plistFreq.size()) + " solved.  Storage "
+                 + ftoa(100.0 * matVel.getRatio()) + "% of dense, largest rank " + itoa(matVel.getMaxRank())
+                 + ", " + itoa(iterations) + " GMRES iterations.", 3);
+}
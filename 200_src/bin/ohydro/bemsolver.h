@@ -0,0 +1,230 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef BEMSOLVER_H
+#define BEMSOLVER_H
+#include <atomic>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "panelmesh.h"
+#include "blocktree.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The BemSolver class solves the linear radiation and diffraction problems with a constant source panel method.
+ *
+ * The velocity potential is written as a source distribution over the wetted panels, with the deep water free
+ * surface Green function.  For each frequency, the boundary condition on the panels gives the system
+ *
+ * (-2 pi I + D) sigma = dphi/dn
+ *
+ * where D holds the normal derivatives of the Green function integrated over each panel.  The potential on the
+ * panels is then phi = S sigma.  Both D and S are stored as hierarchical matrices (HMatrix), and the system is
+ * solved with GMRES.  Each frequency needs 6 solves per body for radiation, and one solve per wave direction for
+ * diffraction.  All of them share the same matrices.
+ *
+ * Frequencies are independent, and are spread over a pool of threads.  Each thread builds and solves one frequency
+ * at a time, so the memory use grows with the number of threads, not the number of frequencies.
+ *
+ * Results use the exp(i w t) time convention and the unit normal pointing into the fluid.  The added mass and
+ * damping come from the radiation potentials.  The excitation force comes from the incident and diffraction
+ * potentials, for a wave of unit amplitude.
+ */
+class BemSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    BemSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the panel mesh.
+     * @param meshIn Pointer to the PanelMesh.  Variable passed by reference.
+     */
+    void setMesh(PanelMesh *meshIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the wave frequencies.
+     * @param freqIn Vector of doubles.  Wave frequencies, in rad/s.  Variable passed by value.
+     */
+    void setFrequencies(std::vector<double> freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the wave directions.
+     * @param dirIn Vector of doubles.  Wave directions, in radians.  Zero travels along the positive x axis.
+     */
+    void setDirections(std::vector<double> dirIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the density of the water.
+     * @param densityIn Double.  Variable passed by value.
+     */
+    void setDensity(double densityIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the magnitude of gravity.
+     * @param gravIn Double.  Variable passed by value.
+     */
+    void setGravity(double gravIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of threads.  Zero uses the number of hardware threads.
+     * @param threadsIn Integer.  Variable passed by value.
+     */
+    void setThreads(int threadsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the relative tolerance of the low rank blocks.
+     * @param tolIn Double.  Variable passed by value.
+     */
+    void setAcaTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the relative tolerance of the GMRES solver.
+     * @param tolIn Double.  Variable passed by value.
+     */
+    void setSolverTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves all frequencies.
+     */
+    void run();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the added mass for one frequency.
+     * @param freqIn Integer.  The index of the frequency.  Variable passed by value.
+     * @return Returns matrix of doubles.  Six rows and columns per body.  Variable passed by reference.
+     */
+    arma::mat &getAddedMass(int freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the radiation damping for one frequency.
+     * @param freqIn Integer.  The index of the frequency.  Variable passed by value.
+     * @return Returns matrix of doubles.  Six rows and columns per body.  Variable passed by reference.
+     */
+    arma::mat &getDamping(int freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the wave excitation force for one frequency and direction, for a wave of unit amplitude.
+     * @param freqIn Integer.  The index of the frequency.  Variable passed by value.
+     * @param dirIn Integer.  The index of the wave direction.  Variable passed by value.
+     * @return Returns complex vector.  Six entries per body.  Variable passed by reference.
+     */
+    arma::cx_vec &getExcite(int freqIn, int dirIn);
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Takes frequencies from the shared counter and solves them, until none are left.
+     */
+    void runWorker();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the radiation and diffraction problems for one frequency.
+     * @param freqIn Integer.  The index of the frequency.  Variable passed by value.
+     */
+    void solveFreq(int freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    PanelMesh *ptMesh; /**< Pointer to the panel mesh. */
+    BlockTree pTree; /**< Block structure of the influence matrices.  Shared by all frequencies. */
+    std::vector<double> plistFreq; /**< The wave frequencies. */
+    std::vector<double> plistDir; /**< The wave directions. */
+    std::vector<arma::mat> plistMass; /**< Added mass for each frequency. */
+    std::vector<arma::mat> plistDamp; /**< Radiation damping for each frequency. */
+    std::vector<std::vector<arma::cx_vec> > plistExcite; /**< Excitation force for each frequency and direction. */
+    double pDensity; /**< Density of the water. */
+    double pGrav; /**< Magnitude of gravity. */
+    int pThreads; /**< Number of threads. */
+    double pAcaTol; /**< Tolerance of the low rank blocks. */
+    double pSolveTol; /**< Tolerance of the GMRES solver. */
+    std::atomic<int> pNext; /**< Index of the next frequency to solve. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // BEMSOLVER_H
@@ -0,0 +1,203 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "blocktree.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BlockTree::LEAFSIZE = 32;   /**< Largest number of panels in a leaf cluster. */
+double BlockTree::ETA = 1.5;    /**< Admissibility ratio. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+BlockTree::BlockTree()
+{
+    ptMesh = NULL;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BlockTree::build(PanelMesh *meshIn)
+{
+    ptMesh = meshIn;
+    plistPerm.clear();
+    plistClust.clear();
+    plistBox.clear();
+    plistBlock.clear();
+
+    for (int i = 0; i < ptMesh->getPanelCount(); i++)
+        plistPerm.push_back(i);
+
+    if (plistPerm.empty())
+        return;
+
+    int root = addCluster(0, plistPerm.size());
+    addBlocks(root, root);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BlockTree::getSize()
+{
+    return plistPerm.size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BlockTree::getPanel(int posIn)
+{
+    return plistPerm[posIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BlockTree::getBlockCount()
+{
+    return plistBlock.size() / 5;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool BlockTree::getBlock(int blockIn, int &rowBegin, int &rowEnd, int &colBegin, int &colEnd)
+{
+    const int *blk = &plistBlock[5 * blockIn];
+    rowBegin = blk[0];
+    rowEnd = blk[1];
+    colBegin = blk[2];
+    colEnd = blk[3];
+    return (blk[4] != 0);
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int BlockTree::addCluster(int beginIn, int endIn)
+{
+    int index = plistClust.size() / 4;
+    plistClust.push_back(beginIn);
+    plistClust.push_back(endIn);
+    plistClust.push_back(-1);
+    plistClust.push_back(-1);
+
+    //Bounding box of the centroids.
+    double box[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL, -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+    for (int i = beginIn; i < endIn; i++)
+    {
+        const double *cent = ptMesh->getCentroid(plistPerm[i]);
+        for (int c = 0; c < 3; c++)
+        {
+            box[c] = min(box[c], cent[c]);
+            box[c + 3] = max(box[c + 3], cent[c]);
+        }
+    }
+    plistBox.insert(plistBox.end(), box, box + 6);
+
+    if (endIn - beginIn <= LEAFSIZE)
+        return index;
+
+    //Split at the median along the longest side.
+    int axis = 0;
+    for (int c = 1; c < 3; c++)
+    {
+        if (box[c + 3] - box[c] > box[axis + 3] - box[axis])
+            axis = c;
+    }
+
+    int middle = (beginIn + endIn) / 2;
+    PanelMesh *mesh = ptMesh;
+    nth_element(plistPerm.begin() + beginIn, plistPerm.begin() + middle, plistPerm.begin() + endIn,
+                [mesh, axis](int a, int b) { return mesh->getCentroid(a)[axis] < mesh->getCentroid(b)[axis]; });
+
+    int first = addCluster(beginIn, middle);
+    int second = addCluster(middle, endIn);
+    plistClust[4 * index + 2] = first;
+    plistClust[4 * index + 3] = second;
+
+    return index;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void BlockTree::addBlocks(int rowIn, int colIn)
+{
+    const double *rowBox = &plistBox[6 * rowIn];
+    const double *colBox = &plistBox[6 * colIn];
+
+    //Distance between the bounding boxes.
+    double dist = 0.0;
+    for (int c = 0; c < 3; c++)
+    {
+        double gap = max(rowBox[c] - colBox[c + 3], colBox[c] - rowBox[c + 3]);
+        if (gap > 0.0)
+            dist += gap * gap;
+    }
+    dist = sqrt(dist);
+
+    bool far = (min(getDiameter(rowIn), getDiameter(colIn)) < ETA * dist);
+    bool rowLeaf = (plistClust[4 * rowIn + 2] < 0);
+    bool colLeaf = (plistClust[4 * colIn + 2] < 0);
+
+    if (far || rowLeaf || colLeaf)
+    {
+        plistBlock.push_back(plistClust[4 * rowIn]);
+        plistBlock.push_back(plistClust[4 * rowIn + 1]);
+        plistBlock.push_back(plistClust[4 * colIn]);
+        plistBlock.push_back(plistClust[4 * colIn + 1]);
+        plistBlock.push_back(far ? 1 : 0);
+        return;
+    }
+
+    for (int i = 2; i < 4; i++)
+    {
+        for (int j = 2; j < 4; j++)
+            addBlocks(plistClust[4 * rowIn + i], plistClust[4 * colIn + j]);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double BlockTree::getDiameter(int clustIn)
+{
+    const double *box = &plistBox[6 * clustIn];
+    double output = 0.0;
+    for (int c = 0; c < 3; c++)
+        output += (box[c + 3] - box[c]) * (box[c + 3] - box[c]);
+    return sqrt(output);
+}
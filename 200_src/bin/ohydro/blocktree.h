@@ -0,0 +1,182 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef BLOCKTREE_H
+#define BLOCKTREE_H
+#include <vector>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "panelmesh.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The BlockTree class splits the panel influence matrix into blocks, for the hierarchical matrix.
+ *
+ * The panels are first sorted into a cluster tree.  Each cluster is split in two along the longest side of its
+ * bounding box, until it holds no more than LEAFSIZE panels.  The matrix is then split by pairs of clusters.  A pair
+ * is far, and is approximated with a low rank block, when the smaller of the two bounding boxes is small compared to
+ * the distance between them.  Near pairs are split further, until one of the clusters is a leaf.  Near pairs of
+ * leaves are stored as dense blocks.
+ *
+ * The tree only depends on the panel geometry.  It is built once and shared by all frequencies.  Blocks are given in
+ * the sorted panel order.  Use getPanel() to convert back to the mesh order.
+ */
+class BlockTree : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    BlockTree();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Builds the cluster tree and the list of blocks from the panel centroids.
+     * @param meshIn Pointer to the PanelMesh.  Variable passed by reference.
+     */
+    void build(PanelMesh *meshIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of panels in the tree.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getSize();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the mesh index of the panel at one position in the sorted order.
+     * @param posIn Integer.  The position in the sorted order.  Variable passed by value.
+     * @return Returns integer.  The index of the panel in the PanelMesh.  Variable passed by value.
+     */
+    int getPanel(int posIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of blocks.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getBlockCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the extent of one block, in the sorted order.  The end positions are one past the last entry.
+     * @param blockIn Integer.  The index of the block.  Variable passed by value.
+     * @param rowBegin Integer.  First row.  Variable passed by reference.
+     * @param rowEnd Integer.  One past the last row.  Variable passed by reference.
+     * @param colBegin Integer.  First column.  Variable passed by reference.
+     * @param colEnd Integer.  One past the last column.  Variable passed by reference.
+     * @return Returns boolean.  True if the block is far, and may be approximated with a low rank block.
+     */
+    bool getBlock(int blockIn, int &rowBegin, int &rowEnd, int &colBegin, int &colEnd);
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Creates a cluster for a range of sorted panels, and splits it recursively.
+     * @param beginIn Integer.  First position of the cluster.  Variable passed by value.
+     * @param endIn Integer.  One past the last position of the cluster.  Variable passed by value.
+     * @return Returns integer.  The index of the new cluster.  Variable passed by value.
+     */
+    int addCluster(int beginIn, int endIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds the blocks for one pair of clusters, splitting near pairs recursively.
+     * @param rowIn Integer.  The index of the row cluster.  Variable passed by value.
+     * @param colIn Integer.  The index of the column cluster.  Variable passed by value.
+     */
+    void addBlocks(int rowIn, int colIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the diagonal of the bounding box of a cluster.
+     * @param clustIn Integer.  The index of the cluster.  Variable passed by value.
+     * @return Returns double.  Variable passed by value.
+     */
+    double getDiameter(int clustIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    PanelMesh *ptMesh; /**< Pointer to the panel mesh. */
+    std::vector<int> plistPerm; /**< Mesh index of the panel at each position in the sorted order. */
+    std::vector<int> plistClust; /**< Begin, end, first child, and second child of each cluster.  -1 for leaves. */
+    std::vector<double> plistBox; /**< Lower and upper corners of the bounding box of each cluster. */
+    std::vector<int> plistBlock; /**< Row begin, row end, column begin, column end, and far flag of each block. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static int LEAFSIZE;    /**< Largest number of panels in a leaf cluster. */
+    static double ETA;      /**< Admissibility ratio.  Far if the smaller diameter is below ETA times the distance. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // BLOCKTREE_H
@@ -0,0 +1,194 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "gmressolver.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int GmresSolver::RESTART = 40;  /**< Number of iterations between restarts. */
+int GmresSolver::MAXITER = 400; /**< Largest number of iterations. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+GmresSolver::GmresSolver()
+{
+    ptMatrix = NULL;
+    pTol = 1e-6;
+    pIter = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GmresSolver::setTolerance(double tolIn)
+{
+    pTol = tolIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GmresSolver::setMatrix(HMatrix *matIn)
+{
+    ptMatrix = matIn;
+    pInvDiag = ptMatrix->getDiag();
+
+    for (unsigned int i = 0; i < pInvDiag.n_elem; i++)
+    {
+        if (abs(pInvDiag(i)) > 0.0)
+            pInvDiag(i) = 1.0 / pInvDiag(i);
+        else
+            pInvDiag(i) = 1.0;
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_vec GmresSolver::solve(const cx_vec &rhsIn)
+{
+    int n = rhsIn.n_elem;
+    cx_vec x = zeros<cx_vec>(n);
+    pIter = 0;
+
+    double normB = norm(rhsIn, 2);
+    if (normB == 0.0)
+        return x;
+
+    vector<cx_vec> basis;
+    cx_mat H(RESTART + 1, RESTART);
+    vector<double> cs(RESTART);
+    vector<complex<double> > sn(RESTART);
+    cx_vec g(RESTART + 1);
+
+    while (pIter < MAXITER)
+    {
+        cx_vec r = rhsIn - ptMatrix->multiply(x);
+        double beta = norm(r, 2);
+        if (beta <= pTol * normB)
+            return x;
+
+        basis.clear();
+        basis.push_back(r / beta);
+        H.zeros();
+        g.zeros();
+        g(0) = beta;
+
+        int k = 0;
+        for (; k < RESTART && pIter < MAXITER; k++, pIter++)
+        {
+            //Arnoldi step with the right preconditioner.
+            cx_vec w = ptMatrix->multiply(pInvDiag % basis[k]);
+            for (int j = 0; j <= k; j++)
+            {
+                complex<double> h = 0.0;
+                for (int i = 0; i < n; i++)
+                    h += conj(basis[j](i)) * w(i);
+                H(j, k) = h;
+                w -= h * basis[j];
+            }
+            double normW = norm(w, 2);
+            H(k + 1, k) = normW;
+
+            //Apply the previous rotations to the new column.
+            for (int j = 0; j < k; j++)
+            {
+                complex<double> a = H(j, k);
+                complex<double> b = H(j + 1, k);
+                H(j, k) = cs[j] * a + sn[j] * b;
+                H(j + 1, k) = -conj(sn[j]) * a + cs[j] * b;
+            }
+
+            //New rotation to zero the subdiagonal.
+            complex<double> a = H(k, k);
+            double absA = abs(a);
+            double rad = sqrt(absA * absA + normW * normW);
+            if (absA == 0.0)
+            {
+                cs[k] = 0.0;
+                sn[k] = 1.0;
+            }
+            else
+            {
+                cs[k] = absA / rad;
+                sn[k] = (a / absA) * normW / rad;
+            }
+            H(k, k) = cs[k] * a + sn[k] * complex<double>(normW, 0.0);
+            H(k + 1, k) = 0.0;
+            g(k + 1) = -conj(sn[k]) * g(k);
+            g(k) = cs[k] * g(k);
+
+            bool done = (abs(g(k + 1)) <= pTol * normB) || (normW == 0.0);
+            if (!done)
+                basis.push_back(w / normW);
+            else
+            {
+                k++;
+                pIter++;
+                break;
+            }
+        }
+
+        //Back substitution for the update.
+        cx_vec y(k);
+        for (int i = k - 1; i >= 0; i--)
+        {
+            complex<double> sum = g(i);
+            for (int j = i + 1; j < k; j++)
+                sum -= H(i, j) * y(j);
+            y(i) = sum / H(i, i);
+        }
+
+        cx_vec update = zeros<cx_vec>(n);
+        for (int j = 0; j < k; j++)
+            update += y(j) * basis[j];
+        x += pInvDiag % update;
+    }
+
+    logStd.Write("    GMRES did not converge in " + itoa(MAXITER) + " iterations.", 3);
+    return x;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int GmresSolver::getIterations()
+{
+    return pIter;
+}
@@ -0,0 +1,140 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef GMRESSOLVER_H
+#define GMRESSOLVER_H
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "hmatrix.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The GmresSolver class solves a linear system with a hierarchical matrix, by the restarted GMRES method.
+ *
+ * The matrix is only used through matrix vector products, so the compressed form is never expanded.  The system is
+ * preconditioned on the right by the diagonal of the matrix.  For the panel method, the diagonal holds the jump term
+ * of the source distribution, and is by far the largest entry of each row.  The solver usually converges in a few
+ * tens of iterations, nearly independent of the number of panels.
+ */
+class GmresSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    GmresSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the relative tolerance on the residual.
+     * @param tolIn Double.  Variable passed by value.
+     */
+    void setTolerance(double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the matrix of the system.  Also computes the preconditioner.
+     * @param matIn Pointer to the HMatrix.  The matrix must be kept until the last solve.
+     */
+    void setMatrix(HMatrix *matIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Solves the system for one right hand side.
+     * @param rhsIn Complex vector.  The right hand side.  Variable passed by reference.
+     * @return Returns complex vector.  The solution.  Variable passed by value.
+     */
+    arma::cx_vec solve(const arma::cx_vec &rhsIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of iterations used by the last solve.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getIterations();
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    HMatrix *ptMatrix; /**< Pointer to the matrix. */
+    arma::cx_vec pInvDiag; /**< Inverse of the matrix diagonal.  The preconditioner. */
+    double pTol; /**< Relative tolerance on the residual. */
+    int pIter; /**< Iterations used by the last solve. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static int RESTART;     /**< Number of iterations between restarts. */
+    static int MAXITER;     /**< Largest number of iterations. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // GMRESSOLVER_H
@@ -0,0 +1,275 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "greenfunc.h"
+#include <cmath>
+
+using namespace std;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double GreenFunc::XMIN = 1e-8;  /**< Smallest horizontal distance used. */
+double GreenFunc::XSERIES = 16.0;   /**< Largest argument for the power series of the Struve functions. */
+double GreenFunc::YMAX = 40.0;  /**< Range below Y where the finite integrals still contribute. */
+
+//------------------------------------------Function Separator --------------------------------------------------------
+//Eight point Gauss-Legendre rule on [-1, 1].
+static const double GAUSS_X[8] = {-0.9602898564975363, -0.7966664774136267, -0.5255324099163290,
+                                  -0.1834346424956498, 0.1834346424956498, 0.5255324099163290,
+                                  0.7966664774136267, 0.9602898564975363};
+static const double GAUSS_W[8] = {0.1012285362903763, 0.2223810344533745, 0.3137066458778873,
+                                  0.3626837833783620, 0.3626837833783620, 0.3137066458778873,
+                                  0.2223810344533745, 0.1012285362903763};
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+GreenFunc::GreenFunc()
+{
+    pWaveNum = 0.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GreenFunc::setWaveNumber(double numIn)
+{
+    pWaveNum = numIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double GreenFunc::getWaveNumber()
+{
+    return pWaveNum;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GreenFunc::evalWave(const double *fieldIn, const double *sourceIn, complex<double> &valOut,
+                         complex<double> *gradOut)
+{
+    double K = pWaveNum;
+
+    if (K <= 0.0)
+    {
+        //Zero frequency.  No wave part.
+        valOut = 0.0;
+        for (int i = 0; i < 3; i++)
+            gradOut[i] = 0.0;
+        return;
+    }
+
+    double dx = fieldIn[0] - sourceIn[0];
+    double dy = fieldIn[1] - sourceIn[1];
+    double R = sqrt(dx * dx + dy * dy);
+    double V = -(fieldIn[2] + sourceIn[2]);
+    if (V < 0.0)
+        V = 0.0;
+
+    double F, FX, FY;
+    evalIntegral(K * R, K * V, F, FX, FY);
+
+    double decay = exp(-K * V);
+    double J0 = j0(K * R);
+    double J1 = j1(K * R);
+
+    valOut = complex<double>(2.0 * K * F, -2.0 * M_PI * K * decay * J0);
+
+    //Derivatives in R and z.  Y decreases as z increases.
+    complex<double> dR(2.0 * K * K * FX, 2.0 * M_PI * K * K * decay * J1);
+    complex<double> dZ(-2.0 * K * K * FY, -2.0 * M_PI * K * K * decay * J0);
+
+    if (R > XMIN / K)
+    {
+        gradOut[0] = dR * (dx / R);
+        gradOut[1] = dR * (dy / R);
+    }
+    else
+    {
+        gradOut[0] = 0.0;
+        gradOut[1] = 0.0;
+    }
+    gradOut[2] = dZ;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GreenFunc::evalIntegral(double X, double Y, double &F, double &FX, double &FY)
+{
+    if (X < XMIN)
+        X = XMIN;
+
+    double rho = sqrt(X * X + Y * Y);
+    double decay = exp(-Y);
+
+    //Values at Y = 0.
+    //PV int( J0(kX) / (k - 1) ) = -pi / 2 (H0 + Y0)
+    //PV int( J1(kX) / (k - 1) ) = 1 - 1 / X - pi / 2 (H1 + Y1)
+    double F0 = -M_PI / 2.0 * (struveH0(X) + y0(X));
+    double G0 = 1.0 - 1.0 / X - M_PI / 2.0 * (struveH1(X) + y1(X));
+
+    //Each integral f satisfies df/dY + f = -int( exp(-kY) Jn(kX) ).
+    double I0, I1;
+    finiteIntegral(X, Y, I0, I1);
+
+    F = decay * F0 - I0;
+    double G = decay * G0 - I1;
+
+    //int( exp(-kY) J1(kX) ) = (1 - Y / rho) / X, written to avoid cancellation.
+    FX = -(G + X / (rho * (rho + Y)));
+    FY = -(F + 1.0 / rho);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double GreenFunc::struveH0(double x)
+{
+    if (x <= XSERIES)
+    {
+        //Power series.  H0 = 2 / pi * sum( (-1)^k x^(2k+1) / ((2k+1)!!)^2 )
+        double term = x;
+        double sum = term;
+        for (int k = 0; k < 200; k++)
+        {
+            term *= -x * x / ((2.0 * k + 3.0) * (2.0 * k + 3.0));
+            sum += term;
+            if (fabs(term) < 1e-17 * fabs(sum))
+                break;
+        }
+        return 2.0 / M_PI * sum;
+    }
+    else
+    {
+        //Asymptotic series.  H0 - Y0 = 2 / pi * (1/x - 1/x^3 + 9/x^5 - ...), stopped at the smallest term.
+        double term = 1.0 / x;
+        double sum = term;
+        for (int k = 0; k < 50; k++)
+        {
+            double next = -term * (2.0 * k + 1.0) * (2.0 * k + 1.0) / (x * x);
+            if (fabs(next) >= fabs(term))
+                break;
+            term = next;
+            sum += term;
+        }
+        return 2.0 / M_PI * sum + y0(x);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double GreenFunc::struveH1(double x)
+{
+    if (x <= XSERIES)
+    {
+        //Power series.  H1 = 2 / pi * sum( (-1)^k x^(2k+2) / ((2k+1)!! (2k+3)!!) )
+        double term = x * x / 3.0;
+        double sum = term;
+        for (int k = 0; k < 200; k++)
+        {
+            term *= -x * x / ((2.0 * k + 3.0) * (2.0 * k + 5.0));
+            sum += term;
+            if (fabs(term) < 1e-17 * fabs(sum))
+                break;
+        }
+        return 2.0 / M_PI * sum;
+    }
+    else
+    {
+        //Asymptotic series.  H1 - Y1 = 2 / pi * (1 + 1/x^2 - 3/x^4 + 45/x^6 - ...), stopped at the smallest term.
+        double term = 1.0;
+        double sum = term;
+        for (int k = 0; k < 50; k++)
+        {
+            double next = term * (1.0 - 4.0 * k * k) / (x * x);
+            if ((k > 0) && (fabs(next) >= fabs(term)))
+                break;
+            term = next;
+            sum += term;
+        }
+        return 2.0 / M_PI * sum + y1(x);
+    }
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void GreenFunc::finiteIntegral(double X, double Y, double &I0, double &I1)
+{
+    I0 = 0.0;
+    I1 = 0.0;
+    if (Y <= 0.0)
+        return;
+
+    //Near t = 0 the integrands behave like 1 / sqrt(X^2 + t^2).  Use t = X sinh(u), which removes that behavior:
+    //dt / sqrt(X^2 + t^2) = du, and (1 - t / sqrt(X^2 + t^2)) / X dt = exp(-u) du.
+    double tSplit = (Y < 1.0) ? Y : 1.0;
+    double uEnd = asinh(tSplit / X);
+    int nPanel = 8;
+    double width = uEnd / nPanel;
+    for (int p = 0; p < nPanel; p++)
+    {
+        double mid = (p + 0.5) * width;
+        for (int i = 0; i < 8; i++)
+        {
+            double u = mid + 0.5 * width * GAUSS_X[i];
+            double w = 0.5 * width * GAUSS_W[i];
+            double val = exp(X * sinh(u) - Y);
+            I0 += w * val;
+            I1 += w * val * exp(-u);
+        }
+    }
+
+    //The rest, in t.  The factor exp(t - Y) removes everything more than YMAX below Y.
+    double tStart = (Y - YMAX > tSplit) ? Y - YMAX : tSplit;
+    if (Y > tStart)
+    {
+        nPanel = static_cast<int>(ceil((Y - tStart) / 4.0));
+        width = (Y - tStart) / nPanel;
+        for (int p = 0; p < nPanel; p++)
+        {
+            double mid = tStart + (p + 0.5) * width;
+            for (int i = 0; i < 8; i++)
+            {
+                double t = mid + 0.5 * width * GAUSS_X[i];
+                double w = 0.5 * width * GAUSS_W[i];
+                double rho = sqrt(X * X + t * t);
+                double val = exp(t - Y);
+                I0 += w * val / rho;
+                I1 += w * val * X / (rho * (rho + t));
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef GREENFUNC_H
+#define GREENFUNC_H
+#include <complex>
+#include "../ofreq/system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The GreenFunc class evaluates the wave part of the deep water free surface Green function, and its gradient.
+ *
+ * The full Green function is G = 1/r + 1/r1 + Gw, where r1 is the distance to the image point above the free
+ * surface.  The Rankine parts, 1/r and 1/r1, are integrated over each panel by the PanelMesh class.  The wave part
+ * is smooth below the free surface and is evaluated here at the panel centroid:
+ *
+ * Gw = 2 K F(X, Y) - i 2 pi K exp(-Y) J0(X)
+ *
+ * where K = w^2 / g, X = K R, and Y = -K (z + zeta).  F is the principal value integral of
+ * exp(-kY) J0(kX) / (k - 1) over k from zero to infinity.  The sign of the imaginary part follows the exp(i w t) time
+ * convention used by ofreq.
+ *
+ * F is evaluated from the Struve and Bessel functions at Y = 0, plus a finite integral over Y.  The derivative in X
+ * uses the same approach with J1.  Struve functions use the power series for small arguments and the asymptotic
+ * series for large arguments.
+ */
+class GreenFunc : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    GreenFunc();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the deep water wave number.
+     * @param numIn Double.  The wave number K = w^2 / g, in 1/m.  Variable passed by value.
+     */
+    void setWaveNumber(double numIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the deep water wave number.
+     * @return Returns double.  The wave number, in 1/m.  Variable passed by value.
+     */
+    double getWaveNumber();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Evaluates the wave part of the Green function and its gradient with respect to the field point.
+     * @param fieldIn Pointer to three doubles.  The field point.  z must be less than or equal to zero.
+     * @param sourceIn Pointer to three doubles.  The source point.  z must be less than or equal to zero.
+     * @param valOut Complex.  The value of the wave part.  Variable passed by reference.
+     * @param gradOut Pointer to three complex values.  The gradient with respect to the field point.
+     */
+    void evalWave(const double *fieldIn, const double *sourceIn, std::complex<double> &valOut,
+                  std::complex<double> *gradOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Evaluates the principal value integrals in non-dimensional form.
+     *
+     * F = PV int( exp(-kY) J0(kX) / (k - 1) )
+     * F_X = dF / dX
+     * F_Y = dF / dY
+     * @param X Double.  The non-dimensional horizontal distance.  Variable passed by value.
+     * @param Y Double.  The non-dimensional depth below the free surface, of the image point.  Variable passed by
+     * value.
+     * @param F Double.  The value of the integral.  Variable passed by reference.
+     * @param FX Double.  The derivative in X.  Variable passed by reference.
+     * @param FY Double.  The derivative in Y.  Variable passed by reference.
+     */
+    static void evalIntegral(double X, double Y, double &F, double &FX, double &FY);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The Struve function of order zero.
+     * @param x Double.  The argument.  Must be zero or greater.  Variable passed by value.
+     * @return Returns double.  The value of H0(x).  Variable passed by value.
+     */
+    static double struveH0(double x);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The Struve function of order one.
+     * @param x Double.  The argument.  Must be zero or greater.  Variable passed by value.
+     * @return Returns double.  The value of H1(x).  Variable passed by value.
+     */
+    static double struveH1(double x);
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Integrates the two finite integrals over Y used by evalIntegral().
+     *
+     * I0 = int( exp(t - Y) / sqrt(X^2 + t^2) ), for t from 0 to Y.
+     * I1 = int( exp(t - Y) (1 - t / sqrt(X^2 + t^2)) / X ), for t from 0 to Y.
+     * @param X Double.  Variable passed by value.
+     * @param Y Double.  Variable passed by value.
+     * @param I0 Double.  Variable passed by reference.
+     * @param I1 Double.  Variable passed by reference.
+     */
+    static void finiteIntegral(double X, double Y, double &I0, double &I1);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    double pWaveNum; /**< The deep water wave number. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static double XMIN;     /**< Smallest horizontal distance used.  Avoids the log singularity of Y0 at zero. */
+    static double XSERIES;  /**< Largest argument for the power series of the Struve functions. */
+    static double YMAX;     /**< Range below Y where the finite integrals still contribute. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // GREENFUNC_H
@@ -0,0 +1,296 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "hmatrix.h"
+#include <cmath>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HMatrix::HMatrix()
+{
+    ptTree = NULL;
+    pStorage = 0.0;
+    pMaxRank = 0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HMatrix::build(BlockTree *treeIn, std::function<complex<double>(int, int)> entryIn, double tolIn)
+{
+    ptTree = treeIn;
+    pEntry = entryIn;
+    pStorage = 0.0;
+    pMaxRank = 0;
+
+    int nBlock = ptTree->getBlockCount();
+    plistU.assign(nBlock, cx_mat());
+    plistV.assign(nBlock, cx_mat());
+
+    int rowBegin, rowEnd, colBegin, colEnd;
+    for (int i = 0; i < nBlock; i++)
+    {
+        bool far = ptTree->getBlock(i, rowBegin, rowEnd, colBegin, colEnd);
+
+        if (!far || !buildLowRank(i, tolIn))
+            buildDense(i);
+
+        pStorage += plistU[i].n_elem + plistV[i].n_elem;
+    }
+
+    //The entry function is not needed after the build.
+    pEntry = std::function<complex<double>(int, int)>();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_vec HMatrix::multiply(const cx_vec &vecIn)
+{
+    int n = ptTree->getSize();
+
+    //Convert to the sorted order.
+    cx_vec input(n);
+    for (int i = 0; i < n; i++)
+        input(i) = vecIn(ptTree->getPanel(i));
+
+    cx_vec result = zeros<cx_vec>(n);
+
+    int rowBegin, rowEnd, colBegin, colEnd;
+    for (unsigned int i = 0; i < plistU.size(); i++)
+    {
+        ptTree->getBlock(i, rowBegin, rowEnd, colBegin, colEnd);
+
+        if (plistV[i].n_elem == 0)
+            result.subvec(rowBegin, rowEnd - 1) += plistU[i] * input.subvec(colBegin, colEnd - 1);
+        else
+            result.subvec(rowBegin, rowEnd - 1) += plistU[i] * (plistV[i] * input.subvec(colBegin, colEnd - 1));
+    }
+
+    //Convert back to the mesh order.
+    cx_vec output(n);
+    for (int i = 0; i < n; i++)
+        output(ptTree->getPanel(i)) = result(i);
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+cx_vec HMatrix::getDiag()
+{
+    cx_vec output(ptTree->getSize());
+
+    //Diagonal entries are always in dense blocks, since a cluster is never far from itself.
+    int rowBegin, rowEnd, colBegin, colEnd;
+    for (unsigned int i = 0; i < plistU.size(); i++)
+    {
+        ptTree->getBlock(i, rowBegin, rowEnd, colBegin, colEnd);
+        if (rowBegin != colBegin || plistV[i].n_elem != 0)
+            continue;
+
+        for (int j = rowBegin; j < rowEnd; j++)
+            output(ptTree->getPanel(j)) = plistU[i](j - rowBegin, j - colBegin);
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double HMatrix::getStorage()
+{
+    return pStorage;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double HMatrix::getRatio()
+{
+    double n = ptTree->getSize();
+    if (n == 0)
+        return 0.0;
+    return pStorage / (n * n);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int HMatrix::getMaxRank()
+{
+    return pMaxRank;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool HMatrix::buildLowRank(int blockIn, double tolIn)
+{
+    int rowBegin, rowEnd, colBegin, colEnd;
+    ptTree->getBlock(blockIn, rowBegin, rowEnd, colBegin, colEnd);
+    int m = rowEnd - rowBegin;
+    int n = colEnd - colBegin;
+
+    vector<cx_vec> listU;
+    vector<cx_vec> listV;
+    vector<bool> used(m, false);
+    double normSq = 0.0;
+    int pivot = 0;
+    int tries = 0;
+
+    while (true)
+    {
+        //The low rank form is no longer worth it.
+        int rank = listU.size();
+        if ((rank + 1) * (m + n) >= m * n)
+            return false;
+
+        //Residual of the pivot row.
+        cx_vec row(n);
+        for (int j = 0; j < n; j++)
+            row(j) = getEntry(rowBegin + pivot, colBegin + j);
+        for (int k = 0; k < rank; k++)
+            row -= listU[k](pivot) * listV[k];
+        used[pivot] = true;
+
+        int col = 0;
+        double best = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            if (abs(row(j)) > best)
+            {
+                best = abs(row(j));
+                col = j;
+            }
+        }
+
+        if (best == 0.0)
+        {
+            //Row is already exact.  Try another row.
+            pivot = -1;
+            for (int i = 0; i < m; i++)
+            {
+                if (!used[i])
+                {
+                    pivot = i;
+                    break;
+                }
+            }
+            if (pivot < 0 || ++tries > 3)
+                break;
+            continue;
+        }
+
+        cx_vec v = row / row(col);
+
+        //Residual of the pivot column.
+        cx_vec u(m);
+        for (int i = 0; i < m; i++)
+            u(i) = getEntry(rowBegin + i, colBegin + col);
+        for (int k = 0; k < rank; k++)
+            u -= listV[k](col) * listU[k];
+
+        //Update the estimate of the Frobenius norm.
+        double normU = norm(u, 2);
+        double normV = norm(v, 2);
+        for (int k = 0; k < rank; k++)
+        {
+            complex<double> uu = 0.0, vv = 0.0;
+            for (int i = 0; i < m; i++)
+                uu += conj(listU[k](i)) * u(i);
+            for (int j = 0; j < n; j++)
+                vv += conj(listV[k](j)) * v(j);
+            normSq += 2.0 * real(uu * vv);
+        }
+        normSq += normU * normU * normV * normV;
+
+        listU.push_back(u);
+        listV.push_back(v);
+
+        if (normU * normV <= tolIn * sqrt(fabs(normSq)))
+            break;
+
+        //Next pivot row is the largest entry of the new column.
+        pivot = -1;
+        best = -1.0;
+        for (int i = 0; i < m; i++)
+        {
+            if (!used[i] && abs(u(i)) > best)
+            {
+                best = abs(u(i));
+                pivot = i;
+            }
+        }
+        if (pivot < 0)
+            break;
+    }
+
+    int rank = listU.size();
+    plistU[blockIn].set_size(m, rank);
+    plistV[blockIn].set_size(rank, n);
+    for (int k = 0; k < rank; k++)
+    {
+        plistU[blockIn].col(k) = listU[k];
+        plistV[blockIn].row(k) = strans(listV[k]);
+    }
+
+    if (rank > pMaxRank)
+        pMaxRank = rank;
+
+    return true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HMatrix::buildDense(int blockIn)
+{
+    int rowBegin, rowEnd, colBegin, colEnd;
+    ptTree->getBlock(blockIn, rowBegin, rowEnd, colBegin, colEnd);
+
+    cx_mat &block = plistU[blockIn];
+    block.set_size(rowEnd - rowBegin, colEnd - colBegin);
+    plistV[blockIn].reset();
+
+    for (int j = colBegin; j < colEnd; j++)
+    {
+        for (int i = rowBegin; i < rowEnd; i++)
+            block(i - rowBegin, j - colBegin) = getEntry(i, j);
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+complex<double> HMatrix::getEntry(int rowIn, int colIn)
+{
+    return pEntry(ptTree->getPanel(rowIn), ptTree->getPanel(colIn));
+}
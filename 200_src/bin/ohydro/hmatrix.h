@@ -0,0 +1,183 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef HMATRIX_H
+#define HMATRIX_H
+#include <complex>
+#include <functional>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "blocktree.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The HMatrix class stores a panel influence matrix in compressed form, as a hierarchical matrix.
+ *
+ * The blocks come from a BlockTree.  Near blocks are stored as dense matrices.  Far blocks are approximated as the
+ * product U V of two thin matrices, found by adaptive cross approximation (ACA) with partial pivoting.  ACA only
+ * evaluates the rows and columns of the block that it picks as pivots, so neither the storage nor the setup ever
+ * needs the full N x N matrix.  A far block is stored dense if its low rank form would not be smaller.
+ *
+ * Entries are supplied by a function of the row and column panel, in the mesh order.
+ */
+class HMatrix : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    HMatrix();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Fills all blocks of the matrix.
+     * @param treeIn Pointer to the BlockTree.  The tree must be kept until the matrix is no longer used.
+     * @param entryIn Function.  Returns the matrix entry for a row and column panel, in the mesh order.
+     * @param tolIn Double.  Relative tolerance of the low rank blocks.  Variable passed by value.
+     */
+    void build(BlockTree *treeIn, std::function<std::complex<double>(int, int)> entryIn, double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param vecIn Complex vector.  In the mesh order.  Variable passed by reference.
+     * @return Returns complex vector.  In the mesh order.  Variable passed by value.
+     */
+    arma::cx_vec multiply(const arma::cx_vec &vecIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the diagonal of the matrix.
+     * @return Returns complex vector.  In the mesh order.  Variable passed by value.
+     */
+    arma::cx_vec getDiag();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of complex values stored, for all blocks.
+     * @return Returns double.  Variable passed by value.
+     */
+    double getStorage();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the fraction of the dense matrix that is stored.
+     * @return Returns double.  Variable passed by value.
+     */
+    double getRatio();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the largest rank of the low rank blocks.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getMaxRank();
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Approximates one far block with adaptive cross approximation.
+     * @param blockIn Integer.  The index of the block.  Variable passed by value.
+     * @param tolIn Double.  Relative tolerance.  Variable passed by value.
+     * @return Returns boolean.  True if the low rank form was kept.  False if the block should be stored dense.
+     */
+    bool buildLowRank(int blockIn, double tolIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Fills one block as a dense matrix.
+     * @param blockIn Integer.  The index of the block.  Variable passed by value.
+     */
+    void buildDense(int blockIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets one entry, with the row and column given in the sorted order.
+     * @param rowIn Integer.  Variable passed by value.
+     * @param colIn Integer.  Variable passed by value.
+     * @return Returns complex.  Variable passed by value.
+     */
+    std::complex<double> getEntry(int rowIn, int colIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    BlockTree *ptTree; /**< Pointer to the block tree. */
+    std::function<std::complex<double>(int, int)> pEntry; /**< Function for the matrix entries. */
+    std::vector<arma::cx_mat> plistU; /**< Dense block, or left factor of each low rank block. */
+    std::vector<arma::cx_mat> plistV; /**< Right factor of each low rank block.  Empty for dense blocks. */
+    double pStorage; /**< Number of complex values stored. */
+    int pMaxRank; /**< Largest rank of the low rank blocks. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // HMATRIX_H
@@ -0,0 +1,311 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "hydrowriter.h"
+#include <iomanip>
+#include <sstream>
+#include <QDir>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string HydroWriter::DIR = "d";      /**< The letter prefix for the wave direction directories. */
+double HydroWriter::DEPTH = 1000.0; /**< Water depth written to the environment file. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+HydroWriter::HydroWriter()
+{
+    ptMesh = NULL;
+    ptSolver = NULL;
+    pDensity = 1025.0;
+    pGrav = 9.80665;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setPath(string pathIn)
+{
+    pPath = pathIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setMesh(PanelMesh *meshIn)
+{
+    ptMesh = meshIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setSolver(BemSolver *solverIn)
+{
+    ptSolver = solverIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setFrequencies(vector<double> freqIn)
+{
+    plistFreq = freqIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setDirections(vector<double> dirIn)
+{
+    plistDir = dirIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setDensity(double densityIn)
+{
+    pDensity = densityIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::setGravity(double gravIn)
+{
+    pGrav = gravIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeFiles()
+{
+    plistStiff.clear();
+    for (int b = 0; b < ptMesh->getBodyCount(); b++)
+        plistStiff.push_back(ptMesh->calcStiffness(b, pDensity, pGrav));
+
+    QDir().mkpath(QString::fromStdString(pPath));
+
+    writeEnvironment();
+    writeList(pPath + SLASH + "directions.out", "direction", plistDir);
+    writeList(pPath + SLASH + "frequencies.out", "frequency", plistFreq);
+
+    for (unsigned int d = 0; d < plistDir.size(); d++)
+    {
+        //Directories use the human counting system (start 1), same as HydroReader.
+        string dir = pPath + SLASH + DIR + itoa(d + 1);
+        QDir().mkpath(QString::fromStdString(dir));
+
+        writeReact(dir, "hydromass.out", "hydromass", 0, false);
+        writeReact(dir, "hydrodamp.out", "hydrodamp", 1, false);
+        writeReact(dir, "hydrostiffness.out", "hydrostiff", 2, false);
+        writeReact(dir, "crossmass.out", "crossmass", 0, true);
+        writeReact(dir, "crossdamp.out", "crossdamp", 1, true);
+        writeReact(dir, "crossstiffness.out", "crossstiff", 2, true);
+        writeExcite(dir, d);
+    }
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::openFile(string fileIn, string objectIn, ofstream &outfile)
+{
+    outfile.open(fileIn.c_str());
+    if (!outfile.is_open())
+        throw std::ios_base::failure("Could not write file:  " + fileIn);
+
+    outfile << "/*--------------------------------*- C++ -*------------------------------------*\\" << endl
+            << "| O pen         | OpenSea:  The Open Source Seakeeping Suite                    |" << endl
+            << "| S eakeeping   | Version:  1.0                                                 |" << endl
+            << "| E valuation   | Web:      www.opensea.dmsonline.us                            |" << endl
+            << "| A nalysis     |                                                               |" << endl
+            << "\\*-----------------------------------------------------------------------------*/" << endl
+            << "seafile" << endl
+            << "{" << endl
+            << "    version     1.0;" << endl
+            << "    format      ascii;" << endl
+            << "    object      " << objectIn << ";" << endl
+            << "}" << endl
+            << "// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //" << endl;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::closeFile(ofstream &outfile)
+{
+    outfile << endl << "// ************************************************************************* //" << endl;
+    outfile.close();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeList(string fileIn, string objectIn, vector<double> listIn)
+{
+    ofstream outfile;
+    openFile(fileIn, objectIn, outfile);
+
+    outfile << objectIn << " (" << endl;
+    outfile << setprecision(10);
+    for (unsigned int i = 0; i < listIn.size(); i++)
+        outfile << listIn[i] << endl;
+    outfile << ");" << endl;
+
+    closeFile(outfile);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeEnvironment()
+{
+    ofstream outfile;
+    openFile(pPath + SLASH + "environment.out", "hydroenv", outfile);
+
+    outfile << "//Physical properties used for the ohydro run." << endl
+            << "physics {" << endl
+            << "  //Depth of water. [m]  ohydro uses the deep water Green function." << endl
+            << "  depth " << DEPTH << ";" << endl << endl
+            << "  //Density of water. [kg/m^3]" << endl
+            << "  density " << pDensity << ";" << endl << endl
+            << "  //Gravity. [m/s^2]  Specified as a vector for three dimensions." << endl
+            << "  gravity (" << endl
+            << "  0.00" << endl
+            << "  0.00" << endl
+            << "  " << -pGrav << endl
+            << "  );" << endl << endl
+            << "  //Amplitude of incident waves. [m]  Excitation forces are for a unit amplitude." << endl
+            << "  waveamp 1.00;" << endl
+            << "}" << endl;
+
+    closeFile(outfile);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeReact(string dirIn, string fileIn, string objectIn, int typeIn, bool crossIn)
+{
+    ofstream outfile;
+    openFile(dirIn + SLASH + fileIn, objectIn, outfile);
+
+    int nBod = ptMesh->getBodyCount();
+    for (int b = 0; b < nBod; b++)
+    {
+        outfile << "body {" << endl;
+        outfile << "  name \"" << ptMesh->getBodyName(b) << "\";" << endl;
+
+        if (!crossIn)
+            writeBlock(outfile, typeIn, b, b, "  ");
+        else
+        {
+            for (int c = 0; c < nBod; c++)
+            {
+                if (c == b)
+                    continue;
+
+                outfile << "  linkedbody {" << endl;
+                outfile << "    name \"" << ptMesh->getBodyName(c) << "\";" << endl;
+                writeBlock(outfile, typeIn, b, c, "    ");
+                outfile << "  }" << endl;
+            }
+        }
+
+        outfile << "}" << endl;
+    }
+
+    closeFile(outfile);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeExcite(string dirIn, int indexIn)
+{
+    ofstream outfile;
+    openFile(dirIn + SLASH + "forceexcite.out", "forcexcite", outfile);
+
+    //Fixed notation.  The complex number reader does not accept exponents.
+    outfile << fixed << setprecision(8);
+
+    for (int b = 0; b < ptMesh->getBodyCount(); b++)
+    {
+        outfile << "body {" << endl;
+        outfile << "  name \"" << ptMesh->getBodyName(b) << "\";" << endl;
+
+        for (unsigned int f = 0; f < plistFreq.size(); f++)
+        {
+            cx_vec &force = ptSolver->getExcite(f, indexIn);
+
+            outfile << "  data {" << endl;
+            outfile << "    frequency " << f + 1 << ";" << endl;
+            outfile << "    value (" << endl;
+            for (int j = 0; j < 6; j++)
+            {
+                complex<double> val = force(6 * b + j);
+                outfile << "\t" << real(val) << (imag(val) < 0.0 ? "" : "+") << imag(val) << "i" << endl;
+            }
+            outfile << "    );" << endl;
+            outfile << "  }" << endl;
+        }
+
+        outfile << "}" << endl;
+    }
+
+    closeFile(outfile);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void HydroWriter::writeBlock(ofstream &outfile, int typeIn, int rowIn, int colIn, string indentIn)
+{
+    outfile << scientific << setprecision(6);
+
+    for (unsigned int f = 0; f < plistFreq.size(); f++)
+    {
+        mat block;
+        if (typeIn == 0)
+            block = ptSolver->getAddedMass(f).submat(6 * rowIn, 6 * colIn, 6 * rowIn + 5, 6 * colIn + 5);
+        else if (typeIn == 1)
+            block = ptSolver->getDamping(f).submat(6 * rowIn, 6 * colIn, 6 * rowIn + 5, 6 * colIn + 5);
+        else if (rowIn == colIn)
+            block = plistStiff.at(rowIn);
+        else
+            block = zeros<mat>(6, 6);
+
+        outfile << indentIn << "data {" << endl;
+        outfile << indentIn << "  frequency " << f + 1 << ";" << endl;
+        outfile << indentIn << "  value (" << endl;
+        for (int i = 0; i < 6; i++)
+        {
+            outfile << indentIn << "   ";
+            for (int j = 0; j < 6; j++)
+                outfile << " " << setw(13) << block(i, j);
+            outfile << endl;
+        }
+        outfile << indentIn << "  );" << endl;
+        outfile << indentIn << "}" << endl;
+    }
+
+    outfile.unsetf(ios_base::floatfield);
+}
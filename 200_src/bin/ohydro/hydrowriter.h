@@ -0,0 +1,239 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef HYDROWRITER_H
+#define HYDROWRITER_H
+#include <fstream>
+#include <string>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "panelmesh.h"
+#include "bemsolver.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The HydroWriter class writes the results of BemSolver as a set of hydrodynamic files, in the layout read by
+ * HydroReader in ofreq.
+ *
+ * The top level directory holds environment.out, directions.out, and frequencies.out.  Each wave direction has its
+ * own directory, d1, d2, and so on, with the added mass, damping, stiffness, cross body terms, and excitation force.
+ * The radiation results do not depend on the wave direction, so the same values are repeated in each directory.
+ * The excitation forces are for a wave of unit amplitude, and the environment file declares waveamp as 1.
+ *
+ * Cross body terms are the coupling between the modes of two different bodies.  For a single body, the cross files
+ * are written with only the body name.
+ */
+class HydroWriter : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    HydroWriter();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the output directory.  It is created if it does not exist.
+     * @param pathIn String.  Variable passed by value.
+     */
+    void setPath(std::string pathIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the panel mesh.  Used for the body names and the hydrostatic stiffness.
+     * @param meshIn Pointer to the PanelMesh.  Variable passed by reference.
+     */
+    void setMesh(PanelMesh *meshIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the solver that holds the results.
+     * @param solverIn Pointer to the BemSolver.  Variable passed by reference.
+     */
+    void setSolver(BemSolver *solverIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the wave frequencies.  Must match the solver.
+     * @param freqIn Vector of doubles.  Variable passed by value.
+     */
+    void setFrequencies(std::vector<double> freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the wave directions.  Must match the solver.
+     * @param dirIn Vector of doubles.  Variable passed by value.
+     */
+    void setDirections(std::vector<double> dirIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the density of the water.
+     * @param densityIn Double.  Variable passed by value.
+     */
+    void setDensity(double densityIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the magnitude of gravity.
+     * @param gravIn Double.  Variable passed by value.
+     */
+    void setGravity(double gravIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes all of the hydrodynamic files.
+     */
+    void writeFiles();
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Opens an output file and writes the file header.
+     * @param fileIn String.  Path of the file.  Variable passed by value.
+     * @param objectIn String.  The object type declared in the header.  Variable passed by value.
+     * @param outfile The output file stream.  Variable passed by reference.
+     */
+    void openFile(std::string fileIn, std::string objectIn, std::ofstream &outfile);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the footer and closes an output file.
+     * @param outfile The output file stream.  Variable passed by reference.
+     */
+    void closeFile(std::ofstream &outfile);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes a list of values as a named list object.
+     * @param fileIn String.  Path of the file.  Variable passed by value.
+     * @param objectIn String.  The object type, which is also the name of the list.  Variable passed by value.
+     * @param listIn Vector of doubles.  Variable passed by value.
+     */
+    void writeList(std::string fileIn, std::string objectIn, std::vector<double> listIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the environment file.
+     */
+    void writeEnvironment();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes one reactive force file, for one wave direction.
+     * @param dirIn String.  The wave direction directory.  Variable passed by value.
+     * @param fileIn String.  The file name.  Variable passed by value.
+     * @param objectIn String.  The object type.  Variable passed by value.
+     * @param typeIn Integer.  0 for added mass, 1 for damping, 2 for stiffness.  Variable passed by value.
+     * @param crossIn Boolean.  True for the cross body terms.  Variable passed by value.
+     */
+    void writeReact(std::string dirIn, std::string fileIn, std::string objectIn, int typeIn, bool crossIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the excitation force file for one wave direction.
+     * @param dirIn String.  The wave direction directory.  Variable passed by value.
+     * @param indexIn Integer.  The index of the wave direction.  Variable passed by value.
+     */
+    void writeExcite(std::string dirIn, int indexIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Writes the data objects of one 6x6 block, one per frequency.
+     * @param outfile The output file stream.  Variable passed by reference.
+     * @param typeIn Integer.  0 for added mass, 1 for damping, 2 for stiffness.  Variable passed by value.
+     * @param rowIn Integer.  The body the forces act on.  Variable passed by value.
+     * @param colIn Integer.  The body whose motion causes the forces.  Variable passed by value.
+     * @param indentIn String.  Indent for each line.  Variable passed by value.
+     */
+    void writeBlock(std::ofstream &outfile, int typeIn, int rowIn, int colIn, std::string indentIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::string pPath; /**< The output directory. */
+    PanelMesh *ptMesh; /**< Pointer to the panel mesh. */
+    BemSolver *ptSolver; /**< Pointer to the solver. */
+    std::vector<double> plistFreq; /**< The wave frequencies. */
+    std::vector<double> plistDir; /**< The wave directions. */
+    std::vector<arma::mat> plistStiff; /**< Hydrostatic stiffness of each body. */
+    double pDensity; /**< Density of the water. */
+    double pGrav; /**< Magnitude of gravity. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static std::string DIR;     /**< The letter prefix for the wave direction directories. */
+    static double DEPTH;        /**< Water depth written to the environment file.  The solver assumes deep water. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // HYDROWRITER_H
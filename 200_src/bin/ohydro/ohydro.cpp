@@ -0,0 +1,296 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Include Statements ########################################################
+#include <QCoreApplication>
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "panelmesh.h"
+#include "bemsolver.h"
+#include "hydrowriter.h"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <stdio.h>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    //----------- Windows Inclusions ------------
+    #include <direct.h>
+    #define GetCurrentDir _getcwd
+#elif defined Q_OS_LINUX
+    //----------- Linux Inclusions ------------
+    #include <unistd.h>
+    #define GetCurrentDir getcwd
+#endif
+
+//########################################## Global Variables #########################################################
+//Namespaces
+using namespace osea;
+using namespace osea::ofreq;
+using namespace osea::ohydro;
+using namespace std;
+using namespace arma;
+
+//########################################## Global Variables #########################################################
+
+//System object.  Only used for the run path and the log files.
+System sysohydro;
+
+//Panel mesh of all bodies.
+PanelMesh meshohydro;
+
+//Panel method solver.
+BemSolver solverohydro;
+
+//Name of the output directory.  Created in the run directory, unless set with ARG_OUT.
+const std::string OUTDIR = "hydro";
+
+//Command line options.
+const std::string ARG_MESH = "--mesh";          //Mesh file of a body, in WAMIT .gdf format.  Starts a new body.
+const std::string ARG_NAME = "--name";          //Name of the last body.  Defaults to body1, body2, ...
+const std::string ARG_REF = "--ref";            //Reference point of the last body, as x,y,z.
+const std::string ARG_FREQ = "--freq";          //Wave frequencies, in rad/s.  List a,b,c or range start:step:end.
+const std::string ARG_DIR = "--dir";            //Wave directions, in radians.  List or range.
+const std::string ARG_DENSITY = "--rho";        //Density of the water.
+const std::string ARG_GRAV = "--grav";          //Magnitude of gravity.
+const std::string ARG_THREADS = "--threads";    //Number of threads.  Zero uses all hardware threads.
+const std::string ARG_ACATOL = "--aca-tol";     //Relative tolerance of the low rank matrix blocks.
+const std::string ARG_TOL = "--tol";            //Relative tolerance of the GMRES solver.
+const std::string ARG_OUT = "--out";            //Output directory.
+
+//######################################### Function Prototypes #######################################################
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Parses a list of values from the command line.
+ *
+ * Values are separated by commas.  Each entry may also be a range, given as start:step:end, which includes both
+ * ends.
+ * @param textIn String.  The command line argument.  Variable passed by value.
+ * @return Returns vector of doubles.  Variable passed by value.
+ */
+vector<double> parseList(string textIn);
+
+//########################################### Main Function ###########################################################
+/**
+ * @brief The main function that runs ohydro program.
+ *
+ * ohydro solves the linear radiation and diffraction problems for one or more bodies, with a panel method.  It
+ * writes the hydrodynamic files read by ofreq and otime.  The usage is:
+ * ohydro [run directory] --mesh <file.gdf> [--name <body>] [--ref x,y,z] [--mesh ...] --freq <frequencies>
+ *        --dir <directions> [--rho <density>] [--grav <gravity>] [--threads <n>] [--aca-tol <tol>] [--tol <tol>]
+ *        [--out <directory>]
+ * 1.  Read the mesh of each body.
+ * 2.  Build the block structure of the influence matrices.
+ * 3.  For each frequency, build the compressed influence matrices and solve the radiation and diffraction
+ *     problems.  Frequencies are solved in parallel.
+ * 4.  Write the added mass, damping, hydrostatic stiffness, and excitation forces in the hydro file layout.
+ */
+int main(int argc, char *argv[])
+{
+    //Main Input Section
+    //=================================================================================================================
+    string runPath = "";
+    string outPath = "";
+    vector<string> listMesh;
+    vector<string> listName;
+    vector<string> listRef;
+    string freqText = "";
+    string dirText = "0";
+    double density = 1025.0;
+    double grav = 9.80665;
+    int threads = 0;
+    double acaTol = 1e-4;
+    double solveTol = 1e-6;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg(argv[i]);
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == ARG_MESH && hasValue)
+        {
+            listMesh.push_back(argv[++i]);
+            listName.push_back("body" + std::to_string(listMesh.size()));
+            listRef.push_back("0,0,0");
+        }
+        else if (arg == ARG_NAME && hasValue && !listName.empty())
+            listName.back() = argv[++i];
+        else if (arg == ARG_REF && hasValue && !listRef.empty())
+            listRef.back() = argv[++i];
+        else if (arg == ARG_FREQ && hasValue)
+            freqText = argv[++i];
+        else if (arg == ARG_DIR && hasValue)
+            dirText = argv[++i];
+        else if (arg == ARG_DENSITY && hasValue)
+            density = atof(argv[++i]);
+        else if (arg == ARG_GRAV && hasValue)
+            grav = atof(argv[++i]);
+        else if (arg == ARG_THREADS && hasValue)
+            threads = atoi(argv[++i]);
+        else if (arg == ARG_ACATOL && hasValue)
+            acaTol = atof(argv[++i]);
+        else if (arg == ARG_TOL && hasValue)
+            solveTol = atof(argv[++i]);
+        else if (arg == ARG_OUT && hasValue)
+            outPath = argv[++i];
+        else
+            runPath = arg;
+    }
+
+    if (!runPath.empty())
+    {
+        sysohydro.setPath(runPath);
+    }
+    else
+    {
+        //Get current working directory
+        char cCurrentPath[FILENAME_MAX];
+        if (!GetCurrentDir(cCurrentPath, sizeof(cCurrentPath)))
+        {
+            //Return error
+        }
+        //Set the path to the current working directory
+        sysohydro.setPath(cCurrentPath);
+    }
+
+    #ifdef Q_OS_WIN
+        std::string SLASH = "\\";
+    #elif defined Q_OS_LINUX
+        std::string SLASH = "/";
+    #endif
+
+    if (outPath.empty())
+        outPath = sysohydro.getPath() + SLASH + OUTDIR;
+
+    //Setup the output log files
+    //---------------------------------------------------------------------------
+    sysohydro.setLogFiles(sysohydro.getPath());
+    sysohydro.logStd.cls();
+
+    try
+    {
+        vector<double> listFreq = parseList(freqText);
+        vector<double> listDir = parseList(dirText);
+
+        if (listMesh.empty())
+            throw std::invalid_argument("No mesh files given.  Use option " + ARG_MESH);
+        if (listFreq.empty())
+            throw std::invalid_argument("No wave frequencies given.  Use option " + ARG_FREQ);
+        if (listDir.empty())
+            throw std::invalid_argument("No wave directions given.  Use option " + ARG_DIR);
+
+        //Read the mesh of each body.
+        //---------------------------------------------------------------------------
+        sysohydro.logStd.Write("Reading mesh files",3);
+        for (unsigned int i = 0; i < listMesh.size(); i++)
+            meshohydro.addBody(listMesh[i], listName[i], vec(parseList(listRef[i])));
+
+        //Solve the radiation and diffraction problems.
+        //---------------------------------------------------------------------------
+        sysohydro.logStd.Write("Solving radiation and diffraction",3);
+        solverohydro.setMesh(&meshohydro);
+        solverohydro.setFrequencies(listFreq);
+        solverohydro.setDirections(listDir);
+        solverohydro.setDensity(density);
+        solverohydro.setGravity(grav);
+        solverohydro.setThreads(threads);
+        solverohydro.setAcaTolerance(acaTol);
+        solverohydro.setSolverTolerance(solveTol);
+        solverohydro.run();
+
+        //Write the hydrodynamic files.
+        //---------------------------------------------------------------------------
+        sysohydro.logStd.Write("Writing hydrodynamic files",3);
+        HydroWriter writer;
+        writer.setPath(outPath);
+        writer.setMesh(&meshohydro);
+        writer.setSolver(&solverohydro);
+        writer.setFrequencies(listFreq);
+        writer.setDirections(listDir);
+        writer.setDensity(density);
+        writer.setGravity(grav);
+        writer.writeFiles();
+
+        sysohydro.logStd.Write("ohydro complete",3);
+    }
+    catch(const std::exception &err)
+    {
+        sysohydro.logStd.Notify();
+        sysohydro.logErr.Write(ID + std::string(err.what()));
+        return 1;
+    }
+
+    return 0;
+}
+
+//######################################## parseList Function ########################################################
+vector<double> parseList(string textIn)
+{
+    vector<double> output;
+    stringstream input(textIn);
+    string entry;
+
+    while (getline(input, entry, ','))
+    {
+        size_t first = entry.find(':');
+        if (first == string::npos)
+        {
+            if (!entry.empty())
+                output.push_back(atof(entry.c_str()));
+            continue;
+        }
+
+        //Range.  start:step:end
+        size_t second = entry.find(':', first + 1);
+        if (second == string::npos)
+            throw std::invalid_argument("Range must be given as start:step:end.  Found:  " + entry);
+
+        double start = atof(entry.substr(0, first).c_str());
+        double step = atof(entry.substr(first + 1, second - first - 1).c_str());
+        double end = atof(entry.substr(second + 1).c_str());
+        if (step <= 0.0)
+            throw std::invalid_argument("Range step must be positive.  Found:  " + entry);
+
+        //Small allowance so the end point is included despite round off.
+        int count = static_cast<int>((end - start) / step + 1e-9);
+        for (int i = 0; i <= count; i++)
+            output.push_back(start + i * step);
+    }
+
+    return output;
+}
@@ -0,0 +1,494 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#include "panelmesh.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::ohydro;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double PanelMesh::FARFIELD = 4.0;   /**< Distance, in panel diameters, beyond which the centroid rule is used. */
+double PanelMesh::NEARFIELD = 1.0;  /**< Distance, in panel diameters, below which the panel is subdivided. */
+int PanelMesh::SUBPANEL = 4;        /**< Number of sub-panels along each side, for near field points. */
+
+//------------------------------------------Function Separator --------------------------------------------------------
+//Three point Gauss-Legendre rule on [-1, 1].
+static const double GAUSS_X[3] = {-0.7745966692414834, 0.0, 0.7745966692414834};
+static const double GAUSS_W[3] = {0.5555555555555556, 0.8888888888888889, 0.5555555555555556};
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+PanelMesh::PanelMesh()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void PanelMesh::addBody(string fileIn, string nameIn, vec refIn)
+{
+    ifstream infile(fileIn.c_str());
+    if (!infile.is_open())
+        throw std::ios_base::failure("Could not open mesh file:  " + fileIn);
+
+    if (refIn.n_elem != 3)
+        throw std::invalid_argument("Reference point must have three coordinates.  Body:  " + nameIn);
+
+    //Header lines.  Title, then ULEN GRAV, then ISX ISY.  The coordinates are dimensional, so ULEN and GRAV are
+    //not used.
+    string line;
+    int symX = 0, symY = 0;
+    getline(infile, line);
+    getline(infile, line);
+    getline(infile, line);
+    istringstream(line) >> symX >> symY;
+
+    int nPan = 0;
+    infile >> nPan;
+    if (!infile || nPan <= 0)
+        throw std::runtime_error("No panels found in mesh file:  " + fileIn);
+
+    //Reflections to apply for the symmetry planes.  The first is the panel as given.
+    vector<double> signX(1, 1.0), signY(1, 1.0);
+    if (symX != 0)
+    {
+        signX.push_back(-1.0);
+        signY.push_back(1.0);
+    }
+    if (symY != 0)
+    {
+        unsigned int count = signX.size();
+        for (unsigned int k = 0; k < count; k++)
+        {
+            signX.push_back(signX[k]);
+            signY.push_back(-1.0);
+        }
+    }
+
+    int bod = plistName.size();
+    plistName.push_back(nameIn);
+    plistRef.push_back(refIn);
+
+    int first = plistArea.size();
+    double vert[12];
+    double mirror[12];
+
+    for (int i = 0; i < nPan; i++)
+    {
+        for (int j = 0; j < 12; j++)
+            infile >> vert[j];
+        if (!infile)
+            throw std::runtime_error("Mesh file ended before all panels were read:  " + fileIn);
+
+        for (unsigned int k = 0; k < signX.size(); k++)
+        {
+            //A single reflection reverses the vertex order.
+            bool reverse = (signX[k] * signY[k] < 0.0);
+            for (int v = 0; v < 4; v++)
+            {
+                int src = reverse ? (3 - v) : v;
+                mirror[3 * v] = signX[k] * vert[3 * src];
+                mirror[3 * v + 1] = signY[k] * vert[3 * src + 1];
+                mirror[3 * v + 2] = vert[3 * src + 2];
+            }
+            addPanel(mirror, bod);
+        }
+    }
+
+    logStd.Write("    Body " + nameIn + ":  " + itoa(plistArea.size() - first) + " panels below the free surface.", 3);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int PanelMesh::getBodyCount()
+{
+    return plistName.size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+string PanelMesh::getBodyName(int bodIn)
+{
+    return plistName.at(bodIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int PanelMesh::getPanelCount()
+{
+    return plistArea.size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int PanelMesh::getBody(int panIn)
+{
+    return plistBody[panIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+const double *PanelMesh::getCentroid(int panIn)
+{
+    return &plistCent[3 * panIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+const double *PanelMesh::getNormal(int panIn)
+{
+    return &plistNorm[3 * panIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double PanelMesh::getArea(int panIn)
+{
+    return plistArea[panIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double PanelMesh::getGenNormal(int panIn, int modeIn)
+{
+    return plistGenNorm[6 * panIn + modeIn];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void PanelMesh::evalRankine(const double *fieldIn, int panIn, bool selfIn, double &potOut, double *gradOut)
+{
+    //Image part.  1/r1 from the source below the surface equals 1/r from the field point reflected above it.
+    double image[3] = {fieldIn[0], fieldIn[1], -fieldIn[2]};
+    double potImage;
+    double gradImage[3];
+    integratePanel(image, panIn, potImage, gradImage);
+
+    if (selfIn)
+    {
+        potOut = integrateSelf(panIn);
+        gradOut[0] = 0.0;
+        gradOut[1] = 0.0;
+        gradOut[2] = 0.0;
+    }
+    else
+        integratePanel(fieldIn, panIn, potOut, gradOut);
+
+    potOut += potImage;
+    gradOut[0] += gradImage[0];
+    gradOut[1] += gradImage[1];
+    gradOut[2] -= gradImage[2];
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat PanelMesh::calcStiffness(int bodIn, double densityIn, double gravIn)
+{
+    const vec &ref = plistRef.at(bodIn);
+
+    //Waterplane properties and volume moments, from the wetted surface with the divergence theorem.
+    double Aw = 0.0, Sx = 0.0, Sy = 0.0, Sxx = 0.0, Syy = 0.0, Sxy = 0.0;
+    double vol = 0.0, volX = 0.0, volY = 0.0, volZ = 0.0;
+
+    for (unsigned int i = 0; i < plistArea.size(); i++)
+    {
+        if (plistBody[i] != bodIn)
+            continue;
+
+        double x = plistCent[3 * i] - ref(0);
+        double y = plistCent[3 * i + 1] - ref(1);
+        double z = plistCent[3 * i + 2];
+        double nzA = plistNorm[3 * i + 2] * plistArea[i];
+
+        Aw -= nzA;
+        Sx -= x * nzA;
+        Sy -= y * nzA;
+        Sxx -= x * x * nzA;
+        Syy -= y * y * nzA;
+        Sxy -= x * y * nzA;
+        vol += z * nzA;
+        volX += x * z * nzA;
+        volY += y * z * nzA;
+        volZ += 0.5 * z * z * nzA;
+    }
+
+    //Vertical center of buoyancy, relative to the reference point.
+    double zB = 0.0;
+    if (vol > 0.0)
+        zB = volZ / vol - ref(2);
+
+    double rg = densityIn * gravIn;
+    mat output = zeros<mat>(6, 6);
+
+    output(2, 2) = rg * Aw;
+    output(2, 3) = rg * Sy;
+    output(2, 4) = -rg * Sx;
+    output(3, 3) = rg * (Syy + vol * zB);
+    output(3, 4) = -rg * Sxy;
+    output(3, 5) = -rg * volX;
+    output(4, 4) = rg * (Sxx + vol * zB);
+    output(4, 5) = -rg * volY;
+
+    //Fill the lower triangle.
+    for (int i = 0; i < 6; i++)
+    {
+        for (int j = 0; j < i; j++)
+            output(i, j) = output(j, i);
+    }
+
+    return output;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double PanelMesh::calcVolume(int bodIn)
+{
+    double vol = 0.0;
+    for (unsigned int i = 0; i < plistArea.size(); i++)
+    {
+        if (plistBody[i] == bodIn)
+            vol += plistCent[3 * i + 2] * plistNorm[3 * i + 2] * plistArea[i];
+    }
+    return vol;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void PanelMesh::addPanel(const double *vertIn, int bodIn)
+{
+    const double *v0 = vertIn, *v1 = vertIn + 3, *v2 = vertIn + 6, *v3 = vertIn + 9;
+    double e1[3], e2[3], e3[3], a1[3], a2[3], norm[3];
+
+    //Split into two triangles, (v0, v1, v2) and (v0, v2, v3).
+    for (int c = 0; c < 3; c++)
+    {
+        e1[c] = v1[c] - v0[c];
+        e2[c] = v2[c] - v0[c];
+        e3[c] = v3[c] - v0[c];
+    }
+    a1[0] = 0.5 * (e1[1] * e2[2] - e1[2] * e2[1]);
+    a1[1] = 0.5 * (e1[2] * e2[0] - e1[0] * e2[2]);
+    a1[2] = 0.5 * (e1[0] * e2[1] - e1[1] * e2[0]);
+    a2[0] = 0.5 * (e2[1] * e3[2] - e2[2] * e3[1]);
+    a2[1] = 0.5 * (e2[2] * e3[0] - e2[0] * e3[2]);
+    a2[2] = 0.5 * (e2[0] * e3[1] - e2[1] * e3[0]);
+
+    double area1 = sqrt(a1[0] * a1[0] + a1[1] * a1[1] + a1[2] * a1[2]);
+    double area2 = sqrt(a2[0] * a2[0] + a2[1] * a2[1] + a2[2] * a2[2]);
+    double area = area1 + area2;
+    if (area <= 0.0)
+        return;
+
+    double cent[3];
+    for (int c = 0; c < 3; c++)
+    {
+        cent[c] = (area1 * (v0[c] + v1[c] + v2[c]) + area2 * (v0[c] + v2[c] + v3[c])) / (3.0 * area);
+        norm[c] = a1[c] + a2[c];
+    }
+
+    //Panels above the free surface are not wetted.
+    if (cent[2] >= 0.0)
+        return;
+
+    double len = sqrt(norm[0] * norm[0] + norm[1] * norm[1] + norm[2] * norm[2]);
+    for (int c = 0; c < 3; c++)
+        norm[c] /= len;
+
+    double d1 = 0.0, d2 = 0.0;
+    for (int c = 0; c < 3; c++)
+    {
+        d1 += (v2[c] - v0[c]) * (v2[c] - v0[c]);
+        d2 += (v3[c] - v1[c]) * (v3[c] - v1[c]);
+    }
+
+    const vec &ref = plistRef.at(bodIn);
+    double r[3] = {cent[0] - ref(0), cent[1] - ref(1), cent[2] - ref(2)};
+
+    plistVert.insert(plistVert.end(), vertIn, vertIn + 12);
+    plistCent.insert(plistCent.end(), cent, cent + 3);
+    plistNorm.insert(plistNorm.end(), norm, norm + 3);
+    plistGenNorm.push_back(norm[0]);
+    plistGenNorm.push_back(norm[1]);
+    plistGenNorm.push_back(norm[2]);
+    plistGenNorm.push_back(r[1] * norm[2] - r[2] * norm[1]);
+    plistGenNorm.push_back(r[2] * norm[0] - r[0] * norm[2]);
+    plistGenNorm.push_back(r[0] * norm[1] - r[1] * norm[0]);
+    plistArea.push_back(area);
+    plistDiam.push_back(sqrt(d1 > d2 ? d1 : d2));
+    plistBody.push_back(bodIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void PanelMesh::integrateGauss(const double *pointIn, int panIn, int subIn, double &potOut, double *gradOut)
+{
+    const double *v = &plistVert[12 * panIn];
+    double step = 2.0 / subIn;
+
+    potOut = 0.0;
+    gradOut[0] = 0.0;
+    gradOut[1] = 0.0;
+    gradOut[2] = 0.0;
+
+    for (int su = 0; su < subIn; su++)
+    {
+        for (int sv = 0; sv < subIn; sv++)
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                for (int j = 0; j < 3; j++)
+                {
+                    //Local coordinates on the bilinear panel.
+                    double u = -1.0 + step * (su + 0.5 * (GAUSS_X[i] + 1.0));
+                    double w = -1.0 + step * (sv + 0.5 * (GAUSS_X[j] + 1.0));
+                    double N[4] = {0.25 * (1 - u) * (1 - w), 0.25 * (1 + u) * (1 - w),
+                                   0.25 * (1 + u) * (1 + w), 0.25 * (1 - u) * (1 + w)};
+                    double Nu[4] = {-0.25 * (1 - w), 0.25 * (1 - w), 0.25 * (1 + w), -0.25 * (1 + w)};
+                    double Nw[4] = {-0.25 * (1 - u), -0.25 * (1 + u), 0.25 * (1 + u), 0.25 * (1 - u)};
+
+                    double pos[3] = {0.0, 0.0, 0.0}, du[3] = {0.0, 0.0, 0.0}, dw[3] = {0.0, 0.0, 0.0};
+                    for (int k = 0; k < 4; k++)
+                    {
+                        for (int c = 0; c < 3; c++)
+                        {
+                            pos[c] += N[k] * v[3 * k + c];
+                            du[c] += Nu[k] * v[3 * k + c];
+                            dw[c] += Nw[k] * v[3 * k + c];
+                        }
+                    }
+                    double jx = du[1] * dw[2] - du[2] * dw[1];
+                    double jy = du[2] * dw[0] - du[0] * dw[2];
+                    double jz = du[0] * dw[1] - du[1] * dw[0];
+                    double weight = GAUSS_W[i] * GAUSS_W[j] * 0.25 * step * step
+                            * sqrt(jx * jx + jy * jy + jz * jz);
+
+                    double dx = pointIn[0] - pos[0];
+                    double dy = pointIn[1] - pos[1];
+                    double dz = pointIn[2] - pos[2];
+                    double r = sqrt(dx * dx + dy * dy + dz * dz);
+                    double r3 = r * r * r;
+
+                    potOut += weight / r;
+                    gradOut[0] -= weight * dx / r3;
+                    gradOut[1] -= weight * dy / r3;
+                    gradOut[2] -= weight * dz / r3;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void PanelMesh::integratePanel(const double *pointIn, int panIn, double &potOut, double *gradOut)
+{
+    const double *cent = &plistCent[3 * panIn];
+    double dx = pointIn[0] - cent[0];
+    double dy = pointIn[1] - cent[1];
+    double dz = pointIn[2] - cent[2];
+    double r = sqrt(dx * dx + dy * dy + dz * dz);
+    double dist = r / plistDiam[panIn];
+
+    if (dist > FARFIELD)
+    {
+        double area = plistArea[panIn];
+        double r3 = r * r * r;
+        potOut = area / r;
+        gradOut[0] = -area * dx / r3;
+        gradOut[1] = -area * dy / r3;
+        gradOut[2] = -area * dz / r3;
+    }
+    else if (dist > NEARFIELD)
+        integrateGauss(pointIn, panIn, 1, potOut, gradOut);
+    else
+        integrateGauss(pointIn, panIn, SUBPANEL, potOut, gradOut);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double PanelMesh::integrateSelf(int panIn)
+{
+    const double *v = &plistVert[12 * panIn];
+    const double *cent = &plistCent[3 * panIn];
+    const double *norm = &plistNorm[3 * panIn];
+
+    //Local axes in the plane of the panel.
+    double t1[3] = {0.0, 0.0, 0.0};
+    for (int k = 0; k < 4 && t1[0] * t1[0] + t1[1] * t1[1] + t1[2] * t1[2] == 0.0; k++)
+    {
+        for (int c = 0; c < 3; c++)
+            t1[c] = v[3 * k + c] - cent[c];
+        double dot = t1[0] * norm[0] + t1[1] * norm[1] + t1[2] * norm[2];
+        for (int c = 0; c < 3; c++)
+            t1[c] -= dot * norm[c];
+    }
+    double len = sqrt(t1[0] * t1[0] + t1[1] * t1[1] + t1[2] * t1[2]);
+    for (int c = 0; c < 3; c++)
+        t1[c] /= len;
+    double t2[3] = {norm[1] * t1[2] - norm[2] * t1[1],
+                    norm[2] * t1[0] - norm[0] * t1[2],
+                    norm[0] * t1[1] - norm[1] * t1[0]};
+
+    //Project the vertices, counter-clockwise about the normal.
+    double px[4], py[4];
+    for (int k = 0; k < 4; k++)
+    {
+        double rel[3] = {v[3 * k] - cent[0], v[3 * k + 1] - cent[1], v[3 * k + 2] - cent[2]};
+        px[k] = rel[0] * t1[0] + rel[1] * t1[1] + rel[2] * t1[2];
+        py[k] = rel[0] * t2[0] + rel[1] * t2[1] + rel[2] * t2[2];
+    }
+
+    //Sum over the edges of h (asinh(sb / h) - asinh(sa / h)), where h is the distance to the edge.
+    double output = 0.0;
+    for (int k = 0; k < 4; k++)
+    {
+        int next = (k + 1) % 4;
+        double ex = px[next] - px[k];
+        double ey = py[next] - py[k];
+        double edge = sqrt(ex * ex + ey * ey);
+        if (edge < 1e-12 * plistDiam[panIn])
+            continue;
+        ex /= edge;
+        ey /= edge;
+
+        double h = px[k] * ey - py[k] * ex;
+        if (fabs(h) < 1e-12 * plistDiam[panIn])
+            continue;
+        double sa = px[k] * ex + py[k] * ey;
+        double sb = px[next] * ex + py[next] * ey;
+
+        output += h * (asinh(sb / fabs(h)) - asinh(sa / fabs(h)));
+    }
+
+    return output;
+}
@@ -0,0 +1,274 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef PANELMESH_H
+#define PANELMESH_H
+#include <string>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with ohydro.
+ */
+namespace ohydro
+{
+
+//######################################### Class Separator ###########################################################
+/**
+ * The PanelMesh class holds the wetted surface of each body as a list of flat quadrilateral panels.
+ *
+ * Panels are read from WAMIT geometric data files (.gdf).  Triangles are given as quadrilaterals with two repeated
+ * vertices.  Any symmetry planes declared in the file are applied when the file is read, so the mesh always covers
+ * the complete body.  Panels with their centroid above the free surface are dropped.  The vertex order follows the
+ * WAMIT convention, counter-clockwise when viewed from the fluid, so the panel normals point out of the body and
+ * into the fluid.
+ *
+ * The class also integrates the Rankine part of the Green function, 1/r + 1/r1, over a panel.  The integration
+ * uses the centroid for distant panels, a Gauss rule for near panels, and a subdivided Gauss rule for very near
+ * panels.  The potential of a panel on itself is found analytically.
+ *
+ * The hydrostatic stiffness is computed from the same panels.  It only includes the buoyancy and waterplane terms.
+ * The body weight terms are left to the body definitions in ofreq.
+ */
+class PanelMesh : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    PanelMesh();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reads a WAMIT geometric data file and adds it to the mesh as a new body.
+     * @param fileIn String.  The path to the .gdf file.  Variable passed by value.
+     * @param nameIn String.  The name of the body, as it will appear in the hydrodynamic files.  Variable passed by
+     * value.
+     * @param refIn Vector of doubles.  The reference point of the body.  Rotations are about this point.  Variable
+     * passed by value.
+     */
+    void addBody(std::string fileIn, std::string nameIn, arma::vec refIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of bodies in the mesh.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getBodyCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the name of one body.
+     * @param bodIn Integer.  The index of the body.  Variable passed by value.
+     * @return Returns string.  Variable passed by value.
+     */
+    std::string getBodyName(int bodIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of panels, for all bodies.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getPanelCount();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the index of the body that owns a panel.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @return Returns integer.  Variable passed by value.
+     */
+    int getBody(int panIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the centroid of a panel.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @return Returns pointer to three doubles.  Valid until the mesh is changed.
+     */
+    const double *getCentroid(int panIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the unit normal of a panel.  The normal points into the fluid.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @return Returns pointer to three doubles.  Valid until the mesh is changed.
+     */
+    const double *getNormal(int panIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the area of a panel.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @return Returns double.  Variable passed by value.
+     */
+    double getArea(int panIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the generalized normal of a panel, for one mode of motion of its body.
+     *
+     * Modes 0 to 2 are the translations, and give the components of the normal.  Modes 3 to 5 are the rotations,
+     * and give the components of (x - ref) x n.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @param modeIn Integer.  The mode of motion, 0 to 5.  Variable passed by value.
+     * @return Returns double.  Variable passed by value.
+     */
+    double getGenNormal(int panIn, int modeIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Integrates the Rankine part of the Green function over one panel.
+     *
+     * Evaluates the integral of 1/r + 1/r1 over the source panel, and its gradient with respect to the field point.
+     * @param fieldIn Pointer to three doubles.  The field point.  Variable passed by reference.
+     * @param panIn Integer.  The index of the source panel.  Variable passed by value.
+     * @param selfIn Boolean.  True if the field point is the centroid of the source panel.  Variable passed by value.
+     * @param potOut Double.  The integrated potential.  Variable passed by reference.
+     * @param gradOut Pointer to three doubles.  The gradient of the potential.  The gradient of the panel on itself
+     * only includes the image part.  The normal component of the rest is zero, and the tangential components do not
+     * enter the solution.
+     */
+    void evalRankine(const double *fieldIn, int panIn, bool selfIn, double &potOut, double *gradOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the hydrostatic stiffness matrix of one body, about its reference point.
+     * @param bodIn Integer.  The index of the body.  Variable passed by value.
+     * @param densityIn Double.  The density of the water.  Variable passed by value.
+     * @param gravIn Double.  The magnitude of gravity.  Variable passed by value.
+     * @return Returns a 6x6 matrix of doubles.  Variable passed by value.
+     */
+    arma::mat calcStiffness(int bodIn, double densityIn, double gravIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the displaced volume of one body.
+     * @param bodIn Integer.  The index of the body.  Variable passed by value.
+     * @return Returns double.  Variable passed by value.
+     */
+    double calcVolume(int bodIn);
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds one panel to the mesh and computes its geometry.  Panels above the free surface are ignored.
+     * @param vertIn Pointer to twelve doubles.  The four vertices of the panel.
+     * @param bodIn Integer.  The index of the body.  Variable passed by value.
+     */
+    void addPanel(const double *vertIn, int bodIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Integrates 1/r over a panel with an n x n Gauss rule on each of m x m sub-panels.
+     * @param pointIn Pointer to three doubles.  The field point.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @param subIn Integer.  The number of sub-panels along each side.  Variable passed by value.
+     * @param potOut Double.  Variable passed by reference.
+     * @param gradOut Pointer to three doubles.  The gradient with respect to the field point.
+     */
+    void integrateGauss(const double *pointIn, int panIn, int subIn, double &potOut, double *gradOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Integrates 1/r over a panel, choosing the rule from the distance to the panel.
+     * @param pointIn Pointer to three doubles.  The field point.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @param potOut Double.  Variable passed by reference.
+     * @param gradOut Pointer to three doubles.  The gradient with respect to the field point.
+     */
+    void integratePanel(const double *pointIn, int panIn, double &potOut, double *gradOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Integrates 1/r over a panel, for a field point at its own centroid.  Uses the exact result for a flat
+     * polygon.
+     * @param panIn Integer.  The index of the panel.  Variable passed by value.
+     * @return Returns double.  Variable passed by value.
+     */
+    double integrateSelf(int panIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<double> plistVert; /**< The four vertices of each panel.  Twelve entries per panel. */
+    std::vector<double> plistCent; /**< The centroid of each panel.  Three entries per panel. */
+    std::vector<double> plistNorm; /**< The unit normal of each panel.  Three entries per panel. */
+    std::vector<double> plistGenNorm; /**< The generalized normal of each panel.  Six entries per panel. */
+    std::vector<double> plistArea; /**< The area of each panel. */
+    std::vector<double> plistDiam; /**< The largest diagonal of each panel. */
+    std::vector<int> plistBody; /**< The body index of each panel. */
+    std::vector<std::string> plistName; /**< The name of each body. */
+    std::vector<arma::vec> plistRef; /**< The reference point of each body. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    //Static constants
+    static double FARFIELD;     /**< Distance, in panel diameters, beyond which the centroid rule is used. */
+    static double NEARFIELD;    /**< Distance, in panel diameters, below which the panel is subdivided. */
+    static int SUBPANEL;        /**< Number of sub-panels along each side, for near field points. */
+};
+
+}   //Namespace ohydro
+
+}   //Namespace osea
+
+#endif // PANELMESH_H
@@ -0,0 +1,595 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Include Statements ########################################################
+#include <QCoreApplication>
+#include "../ofreq/motion_solver/matbody.h"
+#include "../ofreq/motion_solver/matbodybuilder.h"
+#include "../ofreq/system_objects/system.h"
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "../ofreq/file_reader/dictcontrol.h"
+#include "../ofreq/file_reader/dictforces.h"
+#include "../ofreq/file_reader/dictbodies.h"
+#include "../ofreq/file_reader/filereader.h"
+#include "../ofreq/file_reader/dictseaenv.h"
+#include "../ofreq/file_reader/dictdata.h"
+#include "../ofreq/file_reader/dictoutputs.h"
+#include "../ofreq/hydro_reader/hydroreader.h"
+#include "../ofreq/hydro_data/hydromanager.h"
+#include "../ofreq/hydro_data/hydrodata.h"
+#include "radiationfit.h"
+#include "timesolver.h"
+#include "waveexcite.h"
+#include <string>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdio.h>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+    //----------- Windows Inclusions ------------
+    #include <direct.h>
+    #define GetCurrentDir _getcwd
+#elif defined Q_OS_LINUX
+    //----------- Linux Inclusions ------------
+    #include <unistd.h>
+    #define GetCurrentDir getcwd
+#endif
+
+//Motion Models
+//---------------------------------------
+#include "../ofreq/motion_model/model6dof.h"
+
+//########################################## Global Variables #########################################################
+//Namespaces
+using namespace osea;
+using namespace osea::ofreq;
+using namespace osea::otime;
+using namespace std;
+using namespace arma;
+
+//########################################## Global Variables #########################################################
+
+//System object.  Holds the same input objects as ofreq.
+System sysotime;
+
+//Time domain solver.
+TimeSolver solverotime;
+
+//Wave excitation.
+WaveExcite exciteotime;
+
+//Name of the output file.  Written in the run directory.
+const std::string OUTFILE = "otime.out";
+
+//Command line options.
+const std::string ARG_TIMESTEP = "--dt";        //Time step, in seconds.
+const std::string ARG_DURATION = "--duration";  //Duration of the simulation, in seconds.
+const std::string ARG_FREQ = "--freq";          //Wave frequency of a regular wave, in rad/s.
+const std::string ARG_AMP = "--amp";            //Wave amplitude of a regular wave.
+const std::string ARG_ORDER = "--order";        //Number of states in each radiation fit.
+const std::string ARG_RAMP = "--ramp";          //Ramp time of the excitation, in seconds.
+const std::string ARG_OUTSTEP = "--out-step";   //Number of time steps between each output.
+
+//Entries of the retardation kernel smaller than this, relative to the largest entry, are not fit.
+const double KERNTOL = 1.0e-6;
+
+//Fits with a relative error larger than this produce a warning.
+const double FITWARN = 0.05;
+
+//######################################### Function Prototypes #######################################################
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Reads the input files for otime.  otime uses the same input files as ofreq.
+ * @param runPath String.  The directory of the input files.  Variable passed by value.
+ */
+void ReadFiles(std::string runPath);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Builds the time domain model from the input objects and the hydrodynamic data.
+ *
+ * The mass matrix and the user forces come from the motion model of each body, evaluated at a wave frequency of
+ * 1.0 rad/s.  Each derivative is then divided by i^order to recover the time domain coefficient.  The frequency
+ * dependent added mass, damping, and excitation come directly from the hydroData of each body, for the first wave
+ * direction.  The added mass at the largest wave frequency is used as the added mass at infinite frequency.
+ * @param freqIn Double.  The wave frequency of the regular wave, in rad/s.  Variable passed by value.
+ * @param ampIn Double.  The wave amplitude of the regular wave.  Variable passed by value.
+ * @param ordIn Integer.  Number of states in each radiation fit.  Variable passed by value.
+ */
+void buildModel(double freqIn, double ampIn, int ordIn);
+
+//------------------------------------------Function Separator --------------------------------------------------------
+/**
+ * @brief Fits each entry of one block of the retardation kernel and adds the fits to the time solver.
+ * @param dataIn The hydrodynamic data for the body.  Variable passed by reference.
+ * @param crossIn Integer.  Index of the cross-body data to use.  Use -1 for the body itself.  Variable passed by
+ * value.
+ * @param rowIn Integer.  The first degree of freedom of the body the forces act on.  Variable passed by value.
+ * @param colIn Integer.  The first degree of freedom of the body whose motion causes the forces.  Variable passed by
+ * value.
+ * @param ordIn Integer.  Number of states in each radiation fit.  Variable passed by value.
+ */
+void fitBlock(hydroData &dataIn, int crossIn, int rowIn, int colIn, int ordIn);
+
+//########################################### Main Function ###########################################################
+/**
+ * @brief The main function that runs otime program.
+ *
+ * otime solves the equations of motion in the time domain, with the Cummins equation.  It uses the same input files
+ * and hydrodynamic data as ofreq.  The usage is:
+ * otime [run directory] --dt <time step> --duration <time> --freq <wave frequency> [--amp <wave amplitude>]
+ *       [--order <states>] [--ramp <time>] [--out-step <steps>]
+ * 1.  Read in input files.
+ * 2.  Build the mass, damping, and stiffness matrices, and the wave excitation.
+ * 3.  Fit a state-space model to each entry of the radiation retardation kernel.
+ * 4.  Integrate the equations of motion with a fixed time step.
+ * 5.  Write the positions of each body to otime.out, as the solution proceeds.
+ */
+int main(int argc, char *argv[])
+{
+    //Main Input Section
+    //=================================================================================================================
+    string runPath = "";
+    double timeStep = 0.0;
+    double duration = 0.0;
+    double waveFreq = 0.0;
+    double waveAmp = 1.0;
+    double rampTime = 0.0;
+    int fitOrder = 4;
+    int outStep = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg(argv[i]);
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == ARG_TIMESTEP && hasValue)
+            timeStep = atof(argv[++i]);
+        else if (arg == ARG_DURATION && hasValue)
+            duration = atof(argv[++i]);
+        else if (arg == ARG_FREQ && hasValue)
+            waveFreq = atof(argv[++i]);
+        else if (arg == ARG_AMP && hasValue)
+            waveAmp = atof(argv[++i]);
+        else if (arg == ARG_ORDER && hasValue)
+            fitOrder = atoi(argv[++i]);
+        else if (arg == ARG_RAMP && hasValue)
+            rampTime = atof(argv[++i]);
+        else if (arg == ARG_OUTSTEP && hasValue)
+            outStep = atoi(argv[++i]);
+        else
+            runPath = arg;
+    }
+
+    if (!runPath.empty())
+    {
+        sysotime.setPath(runPath);
+    }
+    else
+    {
+        //Get current working directory
+        char cCurrentPath[FILENAME_MAX];
+        if (!GetCurrentDir(cCurrentPath, sizeof(cCurrentPath)))
+        {
+            //Return error
+        }
+        //Set the path to the current working directory
+        sysotime.setPath(cCurrentPath);
+    }
+
+    //Setup the output log files
+    //---------------------------------------------------------------------------
+    sysotime.setLogFiles(sysotime.getPath());
+    sysotime.logStd.cls();
+
+    try
+    {
+        //Read input files and interpret data.
+        //---------------------------------------------------------------------------
+        sysotime.logStd.Write("Reading input files",3);
+        ReadFiles(sysotime.getPath());
+        sysotime.setActiveSeaModel();
+        sysotime.resolveIndex();
+
+        //Build the time domain model.
+        //---------------------------------------------------------------------------
+        sysotime.logStd.Write("Fitting radiation kernels",3);
+        buildModel(waveFreq, waveAmp, fitOrder);
+
+        //Integrate the equations of motion.
+        //---------------------------------------------------------------------------
+        sysotime.logStd.Write("Solving equations of motion",3);
+        solverotime.setExcite(&exciteotime);
+        solverotime.setTimeStep(timeStep);
+        solverotime.setDuration(duration);
+        solverotime.setRampTime(rampTime);
+        solverotime.setOutputStep(outStep);
+
+        #ifdef Q_OS_WIN
+            std::string SLASH = "\\";
+        #elif defined Q_OS_LINUX
+            std::string SLASH = "/";
+        #endif
+
+        solverotime.run(sysotime.getPath() + SLASH + OUTFILE);
+
+        sysotime.logStd.Write("otime complete",3);
+    }
+    catch(const std::exception &err)
+    {
+        sysotime.logStd.Notify();
+        sysotime.logErr.Write(ID + std::string(err.what()));
+        return 1;
+    }
+
+    return 0;
+}
+
+//######################################## ReadFiles Function #########################################################
+void ReadFiles(string runPath)
+{
+    FileReader fileIn;                  //Create file reading objects
+    dictBodies dictBod;                 //Create dictionary object for bodies.in
+    dictForces dictForce;               //Create dictionary object for forces.in
+    dictControl dictCont;               //Create dictionary object for control.in
+    dictSeaEnv dictSea;                 //Create dictionary object for seaenv.in
+    dictData dictDat(&fileIn);          //Create dictionary object for data.in
+    dictOutputs dictOut;                //Create dictionary object for outputs.in
+
+    fileIn.setSystem(&sysotime);
+    dictBod.setSystem(&sysotime);
+    dictForce.setSystem(&sysotime);
+    dictCont.setSystem(&sysotime);
+    dictSea.setSystem(&sysotime);
+    dictDat.setSystem(&sysotime);
+    dictOut.setSystem(&sysotime);
+
+    fileIn.setPath(runPath);
+
+    //Sequence of file reading is important.  Same as ofreq.
+    fileIn.setDictionary(dictCont);
+    fileIn.readControl();
+    fileIn.setDictionary(dictSea);
+    fileIn.readSeaEnv();
+    fileIn.setDictionary(dictForce);
+    fileIn.readForces();
+    fileIn.setDictionary(dictBod);
+    fileIn.readBodies();
+    fileIn.setDictionary(dictDat);
+    fileIn.readData();
+    fileIn.setDictionary(dictOut);
+    fileIn.readOutputs();
+
+    sysotime.SearchActiveSeaModel();
+
+    //Read the hydrodynamic data.
+    HydroReader hydroIn;
+    hydroIn.setSystem(&sysotime);
+
+    for (unsigned int i = 0; i < fileIn.listDataFiles().size(); i++)
+    {
+        hydroIn.setPath(fileIn.listDataFiles(i));
+        hydroIn.readHydroSys();
+    }
+}
+
+//######################################## buildModel Function ########################################################
+void buildModel(double freqIn, double ampIn, int ordIn)
+{
+    int nBod = sysotime.listBody().size();
+    if (nBod == 0)
+        throw std::runtime_error("No bodies defined.");
+    if (sysotime.listWaveDirections().size() == 0)
+        throw std::runtime_error("No wave directions defined.");
+    if (freqIn <= 0.0)
+        throw std::invalid_argument("Wave frequency must be positive.  Use option " + ARG_FREQ);
+
+    //Matrix bodies at 1.0 rad/s.  Each derivative of order u is then k * i^u.
+    vector<matBody> listMatBody(nBod);
+    MatBodyBuilder builder;
+    builder.setSystem(&sysotime);
+    builder.setFreq(1.0);
+    for (int b = 0; b < nBod; b++)
+        builder.buildMatBody(listMatBody, b, true);
+
+    //Offset of each body in the global degrees of freedom.
+    vector<int> listOffset(nBod + 1, 0);
+    for (int b = 0; b < nBod; b++)
+        listOffset.at(b + 1) = listOffset.at(b) + listMatBody.at(b).refMass().n_rows;
+
+    int N = listOffset.at(nBod);
+    solverotime.setSize(N);
+    cx_vec excite = zeros<cx_vec>(N);
+
+    complex<double> imagI(0.0, 1.0);
+
+    for (int b = 0; b < nBod; b++)
+    {
+        int off = listOffset.at(b);
+        int n = listMatBody.at(b).refMass().n_rows;
+        matBody &matBod = listMatBody.at(b);
+
+        for (int i = 0; i < n; i++)
+            solverotime.listLabel().at(off + i) = sysotime.listBody(b).getBodyName() + "_" + solverotime.itoa(i + 1);
+
+        //Body mass.  Second derivative.
+        solverotime.refMass().submat(off, off, off + n - 1, off + n - 1) += real(matBod.refMass() / pow(imagI, 2));
+
+        //User reactive forces.
+        for (unsigned int f = 0; f < matBod.listForceReact_user().size(); f++)
+        {
+            matForceReact &force = matBod.listForceReact_user(f);
+            for (unsigned int u = 0; u < force.listDerivative().size(); u++)
+            {
+                mat coeff = real(force.listDerivative(u) / pow(imagI, static_cast<int>(u)));
+                if (u == 0)
+                    solverotime.refStiff().submat(off, off, off + n - 1, off + n - 1) += coeff;
+                else if (u == 1)
+                    solverotime.refDamp().submat(off, off, off + n - 1, off + n - 1) += coeff;
+                else if (u == 2)
+                    solverotime.refMass().submat(off, off, off + n - 1, off + n - 1) += coeff;
+                else if ((coeff.n_elem > 0) && (max(max(abs(coeff))) > 0.0))
+                    throw std::invalid_argument("otime only supports reactive forces up to second order.  Body:  "
+                                                + sysotime.listBody(b).getBodyName());
+            }
+        }
+
+        //User cross-body forces.
+        for (unsigned int f = 0; f < matBod.listForceCross_user().size(); f++)
+        {
+            matForceCross &force = matBod.listForceCross_user(f);
+            int link = force.getLinkedId();
+            int offL = listOffset.at(link);
+            int nL = listOffset.at(link + 1) - offL;
+
+            for (unsigned int u = 0; u < force.listDerivative().size(); u++)
+            {
+                mat coeff = real(force.listDerivative(u) / pow(imagI, static_cast<int>(u)));
+                if (u == 0)
+                    solverotime.refStiff().submat(off, offL, off + n - 1, offL + nL - 1) += coeff;
+                else if (u == 1)
+                    solverotime.refDamp().submat(off, offL, off + n - 1, offL + nL - 1) += coeff;
+                else if (u == 2)
+                    solverotime.refMass().submat(off, offL, off + n - 1, offL + nL - 1) += coeff;
+                else if ((coeff.n_elem > 0) && (max(max(abs(coeff))) > 0.0))
+                    throw std::invalid_argument("otime only supports cross-body forces up to second order.  Body:  "
+                                                + sysotime.listBody(b).getBodyName());
+            }
+        }
+
+        //User active forces.  Applied at the frequency of the regular wave, scaled by the wave amplitude.
+        for (unsigned int f = 0; f < matBod.listForceActive_user().size(); f++)
+            excite.subvec(off, off + n - 1) += matBod.listForceActive_user(f).listCoefficient().col(0) * ampIn;
+
+        //Hydrodynamic data.  First amplitude, wave direction closest to the first wave direction.
+        //---------------------------------------------------------------------------
+        HydroManager &hydroMan = sysotime.listHydroManager(sysotime.listBody(b).getHydroBodName());
+        if (hydroMan.listHydroData().size() == 0 || hydroMan.listHydroData().at(0).size() == 0)
+            throw std::runtime_error("No hydrodynamic data for body:  " + sysotime.listBody(b).getBodyName());
+
+        double dir = sysotime.listWaveDirections(0);
+        int dirInd = 0;
+        for (unsigned int d = 1; d < hydroMan.listHydroData().at(0).size(); d++)
+        {
+            if (fabs(hydroMan.listHydroData(0, d).getWaveDir() - dir) <
+                    fabs(hydroMan.listHydroData(0, dirInd).getWaveDir() - dir))
+                dirInd = d;
+        }
+        hydroData &data = hydroMan.listHydroData(0, dirInd);
+        int nFreq = data.listWaveFreq().size();
+        if (nFreq == 0)
+            throw std::runtime_error("No hydrodynamic wave frequencies for body:  "
+                                     + sysotime.listBody(b).getBodyName());
+
+        //Hydrostatic stiffness and added mass at infinite frequency.
+        mat stiff = data.getReactReal(0, 0);
+        if (stiff.n_rows > 0)
+            solverotime.refStiff().submat(off, off, off + n - 1, off + n - 1) += stiff;
+
+        int kMax = 0;
+        for (int k = 1; k < nFreq; k++)
+        {
+            if (data.listWaveFreq(k) > data.listWaveFreq(kMax))
+                kMax = k;
+        }
+        mat massInf = data.getReactReal(kMax, 2);
+        if (massInf.n_rows > 0)
+            solverotime.refMass().submat(off, off, off + n - 1, off + n - 1) += massInf;
+
+        //Radiation kernel of the body itself.
+        fitBlock(data, -1, off, off, ordIn);
+
+        //Radiation kernel from the motion of other bodies.
+        if (data.getCrossCount(0) > 0)
+        {
+            for (int c = 0; c < data.getCrossCount(0); c++)
+            {
+                string linkName = data.getCrossName(0, c);
+                int link = -1;
+                for (int b2 = 0; b2 < nBod; b2++)
+                {
+                    if (sysotime.listBody(b2).getHydroBodName() == linkName)
+                        link = b2;
+                }
+                if (link < 0)
+                    continue;
+
+                //Added mass at infinite frequency.
+                mat crossInf = data.getCrossReal(kMax, c, 2);
+                if (crossInf.n_rows > 0)
+                    solverotime.refMass().submat(off, listOffset.at(link),
+                                                 off + n - 1, listOffset.at(link + 1) - 1) += crossInf;
+
+                fitBlock(data, c, off, listOffset.at(link), ordIn);
+            }
+        }
+
+        //Wave excitation.  Linear interpolation between wave frequencies, per unit wave amplitude.
+        //---------------------------------------------------------------------------
+        int lo = -1;
+        int hi = -1;
+        for (int k = 0; k < nFreq; k++)
+        {
+            double w = data.listWaveFreq(k);
+            if (w <= freqIn && (lo < 0 || w > data.listWaveFreq(lo)))
+                lo = k;
+            if (w >= freqIn && (hi < 0 || w < data.listWaveFreq(hi)))
+                hi = k;
+        }
+        if (lo < 0)
+            lo = hi;
+        if (hi < 0)
+            hi = lo;
+
+        cx_mat actLo = data.listDataActive(lo).listCoefficient();
+        cx_mat actHi = data.listDataActive(hi).listCoefficient();
+        double frac = 0.0;
+        if (hi != lo)
+            frac = (freqIn - data.listWaveFreq(lo)) / (data.listWaveFreq(hi) - data.listWaveFreq(lo));
+
+        if (actLo.n_rows > 0 && actHi.n_rows > 0 && data.getWaveAmp() > 0.0)
+            excite.subvec(off, off + n - 1) += ((1.0 - frac) * actLo.col(0) + frac * actHi.col(0))
+                                                * (ampIn / data.getWaveAmp());
+    }
+
+    exciteotime.clear();
+    exciteotime.addComponent(freqIn, excite);
+
+    sysotime.logStd.Write("Degrees of freedom:  " + sysotime.itoa(N), 3);
+}
+
+//######################################## fitBlock Function ##########################################################
+void fitBlock(hydroData &dataIn, int crossIn, int rowIn, int colIn, int ordIn)
+{
+    int nFreq = dataIn.listWaveFreq().size();
+
+    //Added mass and damping at each wave frequency.
+    vector<mat> listMass(nFreq);
+    vector<mat> listDamp(nFreq);
+    int kMax = 0;
+    for (int k = 0; k < nFreq; k++)
+    {
+        if (crossIn < 0)
+        {
+            listMass.at(k) = dataIn.getReactReal(k, 2);
+            listDamp.at(k) = dataIn.getReactReal(k, 1);
+        }
+        else
+        {
+            listMass.at(k) = dataIn.getCrossReal(k, crossIn, 2);
+            listDamp.at(k) = dataIn.getCrossReal(k, crossIn, 1);
+        }
+
+        if (dataIn.listWaveFreq(k) > dataIn.listWaveFreq(kMax))
+            kMax = k;
+    }
+
+    int nRow = 0;
+    int nCol = 0;
+    for (int k = 0; k < nFreq; k++)
+    {
+        if (listMass.at(k).n_rows > 0)
+        {
+            nRow = listMass.at(k).n_rows;
+            nCol = listMass.at(k).n_cols;
+        }
+        else if (listDamp.at(k).n_rows > 0)
+        {
+            nRow = listDamp.at(k).n_rows;
+            nCol = listDamp.at(k).n_cols;
+        }
+    }
+    if (nRow == 0)
+        return;
+
+    for (int k = 0; k < nFreq; k++)
+    {
+        if (listMass.at(k).n_rows == 0)
+            listMass.at(k).zeros(nRow, nCol);
+        if (listDamp.at(k).n_rows == 0)
+            listDamp.at(k).zeros(nRow, nCol);
+    }
+
+    //Retardation kernel K(iw) = B(w) + iw * (A(w) - Ainf).
+    vector<double> listFreq(dataIn.listWaveFreq());
+    vector< vector< vector< complex<double> > > > listKern(nRow,
+        vector< vector< complex<double> > >(nCol, vector< complex<double> >(nFreq)));
+    double kernMax = 0.0;
+
+    for (int i = 0; i < nRow; i++)
+    {
+        for (int j = 0; j < nCol; j++)
+        {
+            for (int k = 0; k < nFreq; k++)
+            {
+                complex<double> K(listDamp.at(k)(i, j),
+                                  listFreq.at(k) * (listMass.at(k)(i, j) - listMass.at(kMax)(i, j)));
+                listKern.at(i).at(j).at(k) = K;
+                if (abs(K) > kernMax)
+                    kernMax = abs(K);
+            }
+        }
+    }
+
+    //Fit each entry that is not negligible.
+    for (int i = 0; i < nRow; i++)
+    {
+        for (int j = 0; j < nCol; j++)
+        {
+            double entryMax = 0.0;
+            for (int k = 0; k < nFreq; k++)
+            {
+                if (abs(listKern.at(i).at(j).at(k)) > entryMax)
+                    entryMax = abs(listKern.at(i).at(j).at(k));
+            }
+            if (entryMax <= KERNTOL * kernMax)
+                continue;
+
+            RadiationFit fit;
+            fit.setOrder(ordIn);
+            fit.fit(listFreq, listKern.at(i).at(j));
+            solverotime.addRadiation(rowIn + i, colIn + j, fit);
+
+            if (fit.getError() > FITWARN)
+                sysotime.logStd.Write("Radiation fit error of " + sysotime.ftoa(fit.getError())
+                                      + " for degrees of freedom " + sysotime.itoa(rowIn + i + 1) + ", "
+                                      + sysotime.itoa(colIn + j + 1) + ".  Consider option " + ARG_ORDER, 2);
+        }
+    }
+}
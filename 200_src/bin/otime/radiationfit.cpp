@@ -0,0 +1,311 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "radiationfit.h"
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::otime;
+
+//==========================================Section Separator =========================================================
+//Static Initialization
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int RadiationFit::ITERMAX = 20; /**< Maximum number of Sanathanan-Koerner iterations. */
+double RadiationFit::TOL = 1.0e-8; /**< Convergence tolerance on the denominator coefficients. */
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+RadiationFit::RadiationFit()
+{
+    pOrder = 4;
+    pScale = 1.0;
+    pError = 0.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+RadiationFit::~RadiationFit()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void RadiationFit::setOrder(int ordIn)
+{
+    pOrder = ordIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int RadiationFit::getOrder()
+{
+    return pOrder;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void RadiationFit::fit(const vector<double> &freqIn, const vector< complex<double> > &kernIn)
+{
+    int n = pOrder;
+    int m = freqIn.size();
+
+    if (n < 2)
+        throw std::invalid_argument("Radiation fit needs at least 2 states.");
+    if (static_cast<int>(kernIn.size()) != m)
+        throw std::invalid_argument("Radiation fit needs one kernel value for each wave frequency.");
+    if (2 * m < 2 * n - 1)
+        throw std::invalid_argument("Not enough wave frequencies for a radiation fit with " + itoa(n) + " states.");
+
+    //Scale frequencies to improve the conditioning of the fit.
+    pScale = 0.0;
+    for (int k = 0; k < m; k++)
+    {
+        if (freqIn.at(k) > pScale)
+            pScale = freqIn.at(k);
+    }
+    if (pScale <= 0.0)
+        throw std::invalid_argument("Radiation fit needs positive wave frequencies.");
+
+    vector< complex<double> > s(m);
+    for (int k = 0; k < m; k++)
+        s.at(k) = complex<double>(0.0, freqIn.at(k) / pScale);
+
+    //Sanathanan-Koerner iterations.  Unknowns are p(1) to p(n-1), then q(0) to q(n-1).
+    plistQ.assign(n, 0.0);
+    plistP.assign(n, 0.0);
+    vec weight = ones<vec>(m);
+    mat A(2 * m, 2 * n - 1);
+    vec b(2 * m);
+
+    for (int iter = 0; iter < ITERMAX; iter++)
+    {
+        for (int k = 0; k < m; k++)
+        {
+            complex<double> sPow(1.0, 0.0);
+            complex<double> K = kernIn.at(k);
+
+            for (int j = 0; j < n; j++)
+            {
+                if (j > 0)
+                {
+                    A(2 * k, j - 1) = weight(k) * sPow.real();
+                    A(2 * k + 1, j - 1) = weight(k) * sPow.imag();
+                }
+                complex<double> term = -K * sPow;
+                A(2 * k, n - 1 + j) = weight(k) * term.real();
+                A(2 * k + 1, n - 1 + j) = weight(k) * term.imag();
+
+                sPow *= s.at(k);
+            }
+
+            complex<double> rhs = K * sPow;
+            b(2 * k) = weight(k) * rhs.real();
+            b(2 * k + 1) = weight(k) * rhs.imag();
+        }
+
+        vec x;
+        if (!solve(x, A, b))
+            throw std::runtime_error("Least squares solution failed in radiation fit.");
+
+        //Check convergence of the denominator.
+        double change = 0.0;
+        double size = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            change += pow(x(n - 1 + j) - plistQ.at(j), 2);
+            size += pow(x(n - 1 + j), 2);
+            plistQ.at(j) = x(n - 1 + j);
+        }
+
+        //Update weights with the new denominator.
+        for (int k = 0; k < m; k++)
+            weight(k) = 1.0 / abs(evalPoly(plistQ, s.at(k), true));
+
+        if (sqrt(change) < TOL * (1.0 + sqrt(size)))
+            break;
+    }
+
+    //Make the fit stable, then fit the numerator to the final denominator.
+    stabilize();
+    fitNumerator(s, kernIn);
+
+    //Convert to real time.  Q(s) = s^n + sum(q(j) * scale^(n-j) * s^j).  Same scale for P(s).
+    plistQReal.resize(n);
+    plistPReal.resize(n);
+    for (int j = 0; j < n; j++)
+    {
+        double factor = pow(pScale, n - j);
+        plistQReal.at(j) = plistQ.at(j) * factor;
+        plistPReal.at(j) = plistP.at(j) * factor;
+    }
+
+    //Relative error of the fit.
+    double errNorm = 0.0;
+    double kernNorm = 0.0;
+    for (int k = 0; k < m; k++)
+    {
+        errNorm += norm(kernIn.at(k) - evaluate(freqIn.at(k)));
+        kernNorm += norm(kernIn.at(k));
+    }
+    pError = (kernNorm > 0.0) ? sqrt(errNorm / kernNorm) : 0.0;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+complex<double> RadiationFit::evaluate(double freqIn)
+{
+    complex<double> s(0.0, freqIn);
+    return evalPoly(plistPReal, s, false) / evalPoly(plistQReal, s, true);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+double RadiationFit::getError()
+{
+    return pError;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &RadiationFit::listDenominator()
+{
+    return plistQReal;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<double> &RadiationFit::listNumerator()
+{
+    return plistPReal;
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void RadiationFit::fitNumerator(const vector< complex<double> > &sIn, const vector< complex<double> > &kernIn)
+{
+    int n = pOrder;
+    int m = sIn.size();
+
+    mat A(2 * m, n - 1);
+    vec b(2 * m);
+
+    for (int k = 0; k < m; k++)
+    {
+        complex<double> Q = evalPoly(plistQ, sIn.at(k), true);
+        complex<double> sPow = sIn.at(k);
+
+        for (int j = 1; j < n; j++)
+        {
+            complex<double> term = sPow / Q;
+            A(2 * k, j - 1) = term.real();
+            A(2 * k + 1, j - 1) = term.imag();
+            sPow *= sIn.at(k);
+        }
+
+        b(2 * k) = kernIn.at(k).real();
+        b(2 * k + 1) = kernIn.at(k).imag();
+    }
+
+    vec x;
+    if (!solve(x, A, b))
+        throw std::runtime_error("Least squares solution failed in radiation fit.");
+
+    plistP.assign(n, 0.0);
+    for (int j = 1; j < n; j++)
+        plistP.at(j) = x(j - 1);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+bool RadiationFit::stabilize()
+{
+    int n = pOrder;
+
+    //Roots of the denominator are the eigenvalues of the companion matrix.
+    mat comp = zeros<mat>(n, n);
+    for (int j = 0; j < n - 1; j++)
+        comp(j, j + 1) = 1.0;
+    for (int j = 0; j < n; j++)
+        comp(n - 1, j) = -plistQ.at(j);
+
+    cx_vec roots;
+    cx_mat vecs;
+    if (!eig_gen(roots, vecs, comp))
+        throw std::runtime_error("Eigenvalue solution failed in radiation fit.");
+
+    bool reflect = false;
+    for (unsigned int j = 0; j < roots.n_elem; j++)
+    {
+        if (roots(j).real() >= 0.0)
+        {
+            //Reflect into left half plane.  Poles on the imaginary axis are moved slightly into the left half plane.
+            double re = (roots(j).real() > 0.0) ? -roots(j).real() : -1.0e-3 * (1.0 + abs(roots(j)));
+            roots(j) = complex<double>(re, roots(j).imag());
+            reflect = true;
+        }
+    }
+
+    if (!reflect)
+        return false;
+
+    //Rebuild the denominator from the roots.  Product of (s - root).
+    vector< complex<double> > poly(1, complex<double>(1.0, 0.0));
+    for (unsigned int j = 0; j < roots.n_elem; j++)
+    {
+        vector< complex<double> > next(poly.size() + 1, complex<double>(0.0, 0.0));
+        for (unsigned int k = 0; k < poly.size(); k++)
+        {
+            next.at(k + 1) += poly.at(k);
+            next.at(k) -= roots(j) * poly.at(k);
+        }
+        poly = next;
+    }
+
+    for (int j = 0; j < n; j++)
+        plistQ.at(j) = poly.at(j).real();
+
+    return true;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+complex<double> RadiationFit::evalPoly(const vector<double> &coeffIn, complex<double> sIn, bool monicIn)
+{
+    //Horner's method.
+    complex<double> out = monicIn ? complex<double>(1.0, 0.0) : complex<double>(0.0, 0.0);
+
+    for (int j = coeffIn.size() - 1; j >= 0; j--)
+        out = out * sIn + coeffIn.at(j);
+
+    return out;
+}
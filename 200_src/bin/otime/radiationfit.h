@@ -0,0 +1,215 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef RADIATIONFIT_H
+#define RADIATIONFIT_H
+#include <complex>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with otime.
+ */
+namespace otime
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The RadiationFit approximates one entry of the radiation retardation kernel with a state-space model.
+ *
+ * In the time domain, the radiation force is a convolution of the retardation kernel with the body velocity.  The
+ * kernel is the inverse transform of K(iw) = B(w) + iw * (A(w) - Ainf), where A is added mass, B is damping, and Ainf
+ * is the added mass at infinite frequency.  Evaluating the convolution directly costs one pass over the entire time
+ * history at every time step.
+ *
+ * Instead, K(iw) is fit once with a rational function P(s)/Q(s), from the same frequency dependent hydrodynamic data
+ * ofreq uses.  The fit is a linear least squares problem, iterated with Sanathanan-Koerner weights.  P has a zero at
+ * s=0, since the kernel has no static component.  Any unstable poles are reflected into the left half plane and the
+ * numerator is fit again.  The rational function is then realized in controllable canonical form.  Each time step only
+ * costs one update of the states.
+ *
+ * The states use the companion form of Q directly:
+ * dx(k)/dt = x(k+1), for k < n-1
+ * dx(n-1)/dt = -q(0) * x(0) - ... - q(n-1) * x(n-1) + u
+ * y = p(0) * x(0) + ... + p(n-1) * x(n-1)
+ * The input u is the velocity and the output y is the radiation force.
+ */
+class RadiationFit : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    RadiationFit();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~RadiationFit();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of states in the fit.  This is the order of the denominator Q(s).
+     * @param ordIn Integer.  The number of states.  Must be at least 2.  Variable passed by value.
+     */
+    void setOrder(int ordIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of states in the fit.
+     * @return Integer.  The number of states.  Returned variable passed by value.
+     */
+    int getOrder();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Fits the retardation kernel.  Throws an error if the fit fails.
+     * @param freqIn The list of wave frequencies, in rad/s.  Variable passed by reference.
+     * @param kernIn The retardation kernel K(iw) at each wave frequency.  Variable passed by reference.
+     */
+    void fit(const std::vector<double> &freqIn, const std::vector< std::complex<double> > &kernIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Evaluates the fitted kernel at a wave frequency.
+     * @param freqIn Double.  The wave frequency, in rad/s.  Variable passed by value.
+     * @return Complex double.  The fitted kernel at the wave frequency.  Returned variable passed by value.
+     */
+    std::complex<double> evaluate(double freqIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the relative error of the fit, over all wave frequencies used in the fit.
+     * @return Double.  Norm of the fit error, divided by the norm of the kernel.  Returned variable passed by value.
+     */
+    double getError();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The denominator coefficients q(0) to q(n-1), in real time.  The leading coefficient is one.
+     * @return Vector of doubles.  Returned variable passed by reference.
+     */
+    std::vector<double> &listDenominator();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The numerator coefficients p(0) to p(n-1), in real time.
+     * @return Vector of doubles.  Returned variable passed by reference.
+     */
+    std::vector<double> &listNumerator();
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Fits the numerator, with the denominator held fixed.  Uses the scaled frequencies.
+     * @param sIn Scaled Laplace variable at each wave frequency.  Variable passed by reference.
+     * @param kernIn The retardation kernel at each wave frequency.  Variable passed by reference.
+     */
+    void fitNumerator(const std::vector< std::complex<double> > &sIn,
+                      const std::vector< std::complex<double> > &kernIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Reflects any poles of the denominator in the right half plane.  Uses the scaled frequencies.
+     * @return Boolean.  True if any poles were reflected.  Returned variable passed by value.
+     */
+    bool stabilize();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Evaluates a polynomial.  The leading coefficient is one if monicIn is true.
+     * @param coeffIn The coefficients, from lowest order to highest order.  Variable passed by reference.
+     * @param sIn Complex double.  The point to evaluate at.  Variable passed by value.
+     * @param monicIn Boolean.  True to add a leading coefficient of one.  Variable passed by value.
+     * @return Complex double.  The value of the polynomial.  Returned variable passed by value.
+     */
+    std::complex<double> evalPoly(const std::vector<double> &coeffIn, std::complex<double> sIn, bool monicIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pOrder; /**< Number of states. */
+    double pScale; /**< Frequency scale used in the fit.  The largest wave frequency. */
+    double pError; /**< Relative error of the fit. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<double> plistQ; /**< Denominator coefficients in scaled frequency. */
+    std::vector<double> plistP; /**< Numerator coefficients in scaled frequency. */
+    std::vector<double> plistQReal; /**< Denominator coefficients in real time. */
+    std::vector<double> plistPReal; /**< Numerator coefficients in real time. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    // Static constants
+    static int ITERMAX; /**< Maximum number of Sanathanan-Koerner iterations. */
+    static double TOL; /**< Convergence tolerance on the denominator coefficients. */
+};
+
+}   //Namespace otime
+}   //Namespace osea
+
+#endif // RADIATIONFIT_H
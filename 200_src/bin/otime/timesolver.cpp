@@ -0,0 +1,310 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "timesolver.h"
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace arma;
+using namespace osea::otime;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSolver::TimeSolver()
+{
+    pSize = 0;
+    pStates = 0;
+    ptExcite = NULL;
+    pTimeStep = 0.0;
+    pDuration = 0.0;
+    pRampTime = 0.0;
+    pOutStep = 1;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+TimeSolver::~TimeSolver()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setSize(int sizeIn)
+{
+    pSize = sizeIn;
+    pMass.zeros(sizeIn, sizeIn);
+    pDamp.zeros(sizeIn, sizeIn);
+    pStiff.zeros(sizeIn, sizeIn);
+
+    plistRow.clear();
+    plistCol.clear();
+    plistStart.clear();
+    plistQ.clear();
+    plistP.clear();
+    pStates = 0;
+
+    plistLabel.resize(sizeIn);
+    for (int i = 0; i < sizeIn; i++)
+        plistLabel.at(i) = "q" + itoa(i + 1);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int TimeSolver::getSize()
+{
+    return pSize;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat &TimeSolver::refMass()
+{
+    return pMass;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat &TimeSolver::refDamp()
+{
+    return pDamp;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+mat &TimeSolver::refStiff()
+{
+    return pStiff;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::addRadiation(int rowIn, int colIn, RadiationFit &fitIn)
+{
+    plistRow.push_back(rowIn);
+    plistCol.push_back(colIn);
+    plistStart.push_back(pStates);
+    plistQ.push_back(fitIn.listDenominator());
+    plistP.push_back(fitIn.listNumerator());
+
+    pStates += fitIn.listDenominator().size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int TimeSolver::getNumStates()
+{
+    return pStates;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setExcite(WaveExcite *ptIn)
+{
+    ptExcite = ptIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setTimeStep(double stepIn)
+{
+    pTimeStep = stepIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setDuration(double durIn)
+{
+    pDuration = durIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setRampTime(double rampIn)
+{
+    pRampTime = rampIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::setOutputStep(int stepIn)
+{
+    pOutStep = (stepIn < 1) ? 1 : stepIn;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+vector<string> &TimeSolver::listLabel()
+{
+    return plistLabel;
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::run(string fileIn)
+{
+    if (pSize < 1)
+        throw std::invalid_argument("Time solver has no degrees of freedom.");
+    if (pTimeStep <= 0.0)
+        throw std::invalid_argument("Time step must be positive.");
+    if (pDuration <= 0.0)
+        throw std::invalid_argument("Duration must be positive.");
+
+    //Factor the mass matrix once.
+    if (!inv(pMassInv, pMass))
+        throw std::runtime_error("Total mass matrix is singular.");
+
+    //Allocate all buffers before the first step.
+    int nState = 2 * pSize + pStates;
+    vec state = zeros<vec>(nState);
+    vec temp(nState);
+    vec k1(nState);
+    vec k2(nState);
+    vec k3(nState);
+    vec k4(nState);
+    pForce.set_size(pSize);
+    pRadForce.set_size(pSize);
+
+    int nStep = static_cast<int>(floor(pDuration / pTimeStep + 0.5));
+    double h = pTimeStep;
+
+    ofstream fileOut(fileIn.c_str(), std::ios::out | std::ios::trunc);
+    if (!fileOut)
+        throw std::ios_base::failure("Could not open output file:  " + fileIn);
+
+    fileOut.precision(8);
+    fileOut << scientific;
+    fileOut << "# time";
+    for (int i = 0; i < pSize; i++)
+        fileOut << "  " << plistLabel.at(i);
+    fileOut << "\n";
+
+    logStd.Write("Time steps:  " + itoa(nStep) + "    Radiation states:  " + itoa(pStates), 3);
+
+    int nReport = (nStep >= 10) ? nStep / 10 : 1;
+
+    for (int step = 0; step <= nStep; step++)
+    {
+        double t = step * h;
+
+        //Write output.
+        if (step % pOutStep == 0)
+        {
+            fileOut << t;
+            for (int i = 0; i < pSize; i++)
+                fileOut << "  " << state(i);
+            fileOut << "\n";
+        }
+
+        if (step == nStep)
+            break;
+
+        //Fourth order Runge-Kutta step.
+        calcDeriv(t, state, k1);
+
+        for (int i = 0; i < nState; i++)
+            temp(i) = state(i) + 0.5 * h * k1(i);
+        calcDeriv(t + 0.5 * h, temp, k2);
+
+        for (int i = 0; i < nState; i++)
+            temp(i) = state(i) + 0.5 * h * k2(i);
+        calcDeriv(t + 0.5 * h, temp, k3);
+
+        for (int i = 0; i < nState; i++)
+            temp(i) = state(i) + h * k3(i);
+        calcDeriv(t + h, temp, k4);
+
+        for (int i = 0; i < nState; i++)
+            state(i) += h / 6.0 * (k1(i) + 2.0 * k2(i) + 2.0 * k3(i) + k4(i));
+
+        if ((step + 1) % nReport == 0)
+            logMon.Write(itoa(step + 1) + "       \t" + ftoa(t + h) + "        \t"
+                         + ftoa(double(step + 1) / double(nStep)), 3);
+    }
+
+    fileOut.close();
+}
+
+//==========================================Section Separator =========================================================
+//Private Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void TimeSolver::calcDeriv(double timeIn, const vec &stateIn, vec &derivOut)
+{
+    const int nPos = 0;
+    const int nVel = pSize;
+    const int nRad = 2 * pSize;
+
+    //Excitation, with ramp.
+    if (ptExcite != NULL)
+        ptExcite->calcForce(timeIn, pForce);
+    else
+        pForce.zeros();
+
+    if ((pRampTime > 0.0) && (timeIn < pRampTime))
+        pForce *= 0.5 * (1.0 - cos(datum::pi * timeIn / pRampTime));
+
+    //Radiation states.
+    pRadForce.zeros();
+    for (unsigned int r = 0; r < plistRow.size(); r++)
+    {
+        const vector<double> &Q = plistQ.at(r);
+        const vector<double> &P = plistP.at(r);
+        int start = nRad + plistStart.at(r);
+        int n = Q.size();
+
+        double out = 0.0;
+        double last = stateIn(nVel + plistCol.at(r));
+        for (int k = 0; k < n; k++)
+        {
+            double x = stateIn(start + k);
+            out += P.at(k) * x;
+            last -= Q.at(k) * x;
+            if (k < n - 1)
+                derivOut(start + k) = stateIn(start + k + 1);
+        }
+        derivOut(start + n - 1) = last;
+
+        pRadForce(plistRow.at(r)) += out;
+    }
+
+    //Equation of motion.
+    for (int i = 0; i < pSize; i++)
+    {
+        double sum = pForce(i) - pRadForce(i);
+        for (int j = 0; j < pSize; j++)
+            sum -= pDamp(i, j) * stateIn(nVel + j) + pStiff(i, j) * stateIn(nPos + j);
+        pForce(i) = sum;
+    }
+
+    for (int i = 0; i < pSize; i++)
+    {
+        double accel = 0.0;
+        for (int j = 0; j < pSize; j++)
+            accel += pMassInv(i, j) * pForce(j);
+
+        derivOut(nPos + i) = stateIn(nVel + i);
+        derivOut(nVel + i) = accel;
+    }
+}
@@ -0,0 +1,257 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef TIMESOLVER_H
+#define TIMESOLVER_H
+#include <string>
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+#include "radiationfit.h"
+#include "waveexcite.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with otime.
+ */
+namespace otime
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The TimeSolver integrates the Cummins equation in the time domain.
+ *
+ * (M + Ainf) * q'' + D * q' + C * q + integral(K(t - tau) * q'(tau)) = F(t)
+ *
+ * M is the body mass, plus any second order user forces.  Ainf is the added mass at infinite frequency.  D is the
+ * damping from first order user forces.  C is the hydrostatic stiffness, plus any zero order user forces.  K is the
+ * radiation retardation kernel.  F is the wave excitation, plus any user active forces.
+ *
+ * The convolution is replaced by the state-space fits of each entry of the retardation kernel, from RadiationFit.
+ * The position, velocity, and radiation states are integrated together with a fixed step, fourth order Runge-Kutta
+ * method.  All buffers are allocated once before the first step.  So each step costs a fixed amount of work,
+ * proportional to the number of states.  The positions are written to the output file as the solution proceeds.
+ */
+class TimeSolver : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    TimeSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~TimeSolver();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the number of degrees of freedom.  Clears the matrices and the radiation fits.
+     * @param sizeIn Integer.  The number of degrees of freedom, over all bodies.  Variable passed by value.
+     */
+    void setSize(int sizeIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of degrees of freedom.
+     * @return Integer.  The number of degrees of freedom.  Returned variable passed by value.
+     */
+    int getSize();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The total mass matrix, including the added mass at infinite frequency.
+     * @return Matrix of doubles.  Returned variable passed by reference.
+     */
+    arma::mat &refMass();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The linear damping matrix.  Does not include radiation damping.
+     * @return Matrix of doubles.  Returned variable passed by reference.
+     */
+    arma::mat &refDamp();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The stiffness matrix.
+     * @return Matrix of doubles.  Returned variable passed by reference.
+     */
+    arma::mat &refStiff();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a state-space fit for one entry of the retardation kernel.
+     * @param rowIn Integer.  The degree of freedom the radiation force acts on.  Variable passed by value.
+     * @param colIn Integer.  The degree of freedom whose velocity causes the radiation force.  Variable passed by
+     * value.
+     * @param fitIn The fit of the retardation kernel.  Variable passed by reference.
+     */
+    void addRadiation(int rowIn, int colIn, RadiationFit &fitIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of radiation states, over all entries of the retardation kernel.
+     * @return Integer.  The number of radiation states.  Returned variable passed by value.
+     */
+    int getNumStates();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the wave excitation.
+     * @param ptIn Pointer to the wave excitation.  Variable passed by value.
+     */
+    void setExcite(WaveExcite *ptIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the time step.
+     * @param stepIn Double.  The time step, in seconds.  Variable passed by value.
+     */
+    void setTimeStep(double stepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the duration of the simulation.
+     * @param durIn Double.  The duration, in seconds.  Variable passed by value.
+     */
+    void setDuration(double durIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets the ramp time.  The excitation is ramped up from zero over this time, to reduce start up
+     * transients.
+     * @param rampIn Double.  The ramp time, in seconds.  Zero for no ramp.  Variable passed by value.
+     */
+    void setRampTime(double rampIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Sets how often the positions are written to the output file.
+     * @param stepIn Integer.  Write every stepIn time steps.  Variable passed by value.
+     */
+    void setOutputStep(int stepIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief The label of each degree of freedom, written in the header of the output file.
+     * @return Vector of strings.  Returned variable passed by reference.
+     */
+    std::vector<std::string> &listLabel();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Runs the simulation from rest.  Throws an error if the inputs are not valid.
+     * @param fileIn String.  The path of the output file.  Variable passed by value.
+     */
+    void run(std::string fileIn);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the time derivative of the state vector.  Uses only preallocated buffers.
+     * @param timeIn Double.  The time, in seconds.  Variable passed by value.
+     * @param stateIn The state vector.  Positions, then velocities, then radiation states.  Variable passed by
+     * reference.
+     * @param derivOut The time derivative of the state vector.  Variable passed by reference.
+     */
+    void calcDeriv(double timeIn, const arma::vec &stateIn, arma::vec &derivOut);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    int pSize; /**< Number of degrees of freedom. */
+    arma::mat pMass; /**< Total mass matrix. */
+    arma::mat pDamp; /**< Linear damping matrix. */
+    arma::mat pStiff; /**< Stiffness matrix. */
+    arma::mat pMassInv; /**< Inverse of the total mass matrix.  Calculated once before the first step. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<int> plistRow; /**< Degree of freedom each radiation fit acts on. */
+    std::vector<int> plistCol; /**< Degree of freedom whose velocity drives each radiation fit. */
+    std::vector<int> plistStart; /**< Index of the first state of each radiation fit, within the radiation states. */
+    std::vector< std::vector<double> > plistQ; /**< Denominator coefficients of each radiation fit. */
+    std::vector< std::vector<double> > plistP; /**< Numerator coefficients of each radiation fit. */
+    int pStates; /**< Number of radiation states. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    WaveExcite *ptExcite; /**< Pointer to the wave excitation. */
+    double pTimeStep; /**< Time step, in seconds. */
+    double pDuration; /**< Duration of the simulation, in seconds. */
+    double pRampTime; /**< Ramp time of the excitation, in seconds. */
+    int pOutStep; /**< Number of time steps between each output. */
+    std::vector<std::string> plistLabel; /**< Label of each degree of freedom. */
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    arma::vec pForce; /**< Buffer for the force on each degree of freedom. */
+    arma::vec pRadForce; /**< Buffer for the radiation force on each degree of freedom. */
+};
+
+}   //Namespace otime
+}   //Namespace osea
+
+#endif // TIMESOLVER_H
@@ -0,0 +1,93 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//######################################### Class Separator ###########################################################
+#include "waveexcite.h"
+#include <cmath>
+
+using namespace std;
+using namespace arma;
+using namespace osea::otime;
+
+//==========================================Section Separator =========================================================
+//Public Functions
+
+//------------------------------------------Function Separator --------------------------------------------------------
+WaveExcite::WaveExcite()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+WaveExcite::~WaveExcite()
+{
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WaveExcite::addComponent(double freqIn, cx_vec forceIn)
+{
+    plistFreq.push_back(freqIn);
+    plistForce.push_back(forceIn);
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WaveExcite::clear()
+{
+    plistFreq.clear();
+    plistForce.clear();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+int WaveExcite::getNumComponent()
+{
+    return plistFreq.size();
+}
+
+//------------------------------------------Function Separator --------------------------------------------------------
+void WaveExcite::calcForce(double timeIn, vec &forceOut)
+{
+    forceOut.zeros();
+
+    for (unsigned int c = 0; c < plistFreq.size(); c++)
+    {
+        double phase = plistFreq.at(c) * timeIn;
+        double cosP = cos(phase);
+        double sinP = sin(phase);
+        cx_vec &force = plistForce.at(c);
+
+        //Real part of F * exp(i * w * t).
+        for (unsigned int i = 0; i < forceOut.n_elem; i++)
+            forceOut(i) += force(i).real() * cosP - force(i).imag() * sinP;
+    }
+}
@@ -0,0 +1,141 @@
+/*----------------------------------------*- C++ -*------------------------------------------------------------------*\
+| O pen         | OpenSea: The Open Source Seakeeping Suite                                                           |
+| S eakeeping	| Web:     www.opensea.dmsonline.us                                                                   |
+| E valuation   |                                                                                                     |
+| A nalysis     |                                                                                                     |
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Revision History
+ *---------------------------------------------------------------------------------------------------------------------
+ *Date          Author                  Description
+ *---------------------------------------------------------------------------------------------------------------------
+ *Oct 19, 2026                          Initially created.
+ *
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+//License
+/*-------------------------------------------------------------------------------------------------------------------*\
+ *Copyright Datawave Marine Solutions, 2013.
+ *This file is part of OpenSEA.
+
+ *OpenSEA is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *OpenSEA is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with OpenSEA.  If not, see <http://www.gnu.org/licenses/>.
+\*-------------------------------------------------------------------------------------------------------------------*/
+
+
+//######################################### Class Separator ###########################################################
+#ifndef WAVEEXCITE_H
+#define WAVEEXCITE_H
+#include <vector>
+#include <armadillo>
+#include "../ofreq/system_objects/ofreqcore.h"
+
+//######################################### Class Separator ###########################################################
+//Namespace declarations
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace for all code created under the OpenSEA project.  There are also several sub-namespaces, one
+ * associated with each primary program under osea.
+ * 1.)  ohydro:  Code associated with the program ohydro.
+ * 2.)  ofreq:   Code associated with the program ofreq.
+ * 3.)  otime:   Code associated with the program otime.
+ * 4.)  ofourier:  Code associated with the program ofourier.
+ * 5.)  obatch:    Code associated with the program obatch.
+ * 6.)  guisea:    Code assocaited with the GUI that interacts with all OpenSEA programs.
+ * Any code that may have common utility amongst all programs, such as file reading objects, goes under the generic
+ * osea namespace.  Any code that is only useful within the specific program it serves, goes under the specific
+ * namespace.  When in doubt, default to just the osea namespace.
+ *
+ * The namespaces are not intended to create an organizational structure.  They are only intended to prevent
+ * name conflicts.
+ */
+namespace osea
+{
+
+//==========================================Section Separator =========================================================
+/**
+ * The namespace of all code specifically associated with otime.
+ */
+namespace otime
+{
+
+
+//######################################### Class Separator ###########################################################
+/**
+ * The WaveExcite calculates the wave excitation force in the time domain.  The excitation is a sum of harmonic
+ * components.  Each component has a wave frequency and a complex force amplitude for every degree of freedom.  The
+ * force amplitude already includes the wave amplitude and phase.  The force at any time is the real part of the sum
+ * of F * exp(i * w * t).
+ */
+class WaveExcite : public osea::ofreq::oFreqCore
+{
+//==========================================Section Separator =========================================================
+public:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    WaveExcite();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Default destructor.
+     */
+    ~WaveExcite();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Adds a harmonic component to the excitation.
+     * @param freqIn Double.  The wave frequency, in rad/s.  Variable passed by value.
+     * @param forceIn Complex vector.  The force amplitude for each degree of freedom.  Variable passed by value.
+     */
+    void addComponent(double freqIn, arma::cx_vec forceIn);
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Removes all harmonic components.
+     */
+    void clear();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Gets the number of harmonic components.
+     * @return Integer.  The number of harmonic components.  Returned variable passed by value.
+     */
+    int getNumComponent();
+
+    //------------------------------------------Function Separator ----------------------------------------------------
+    /**
+     * @brief Calculates the excitation force at a time.
+     * @param timeIn Double.  The time, in seconds.  Variable passed by value.
+     * @param forceOut Vector of doubles.  The force for each degree of freedom.  Must already be sized.  Variable
+     * passed by reference.
+     */
+    void calcForce(double timeIn, arma::vec &forceOut);
+
+//==========================================Section Separator =========================================================
+protected:
+
+//==========================================Section Separator =========================================================
+private:
+    //------------------------------------------Function Separator ----------------------------------------------------
+    std::vector<double> plistFreq; /**< Wave frequency of each component. */
+    std::vector<arma::cx_vec> plistForce; /**< Force amplitude of each component. */
+};
+
+}   //Namespace otime
+}   //Namespace osea
+
+#endif // WAVEEXCITE_H
@@ -0,0 +1,361 @@
+//Scaling benchmark for large body counts.
+//Generates an oFreq run and a matching hydrodynamic database for each body count, then times the ofreq executable
+//on it.  Bodies are linked in pairs through a user cross-body force, so the load time index resolution and the
+//cross-body assembly both scale with the body count.
+//
+//Each case runs twice, in ofreq1 with NFREQ_1 wave frequencies and in ofreq2 with NFREQ_2 wave frequencies.  The
+//difference gives the time per frequency, and the remainder is the setup time (reading inputs, hydro data, and index
+//resolution).  Any checkpoint file from an earlier run is removed first, so every frequency is solved again.
+//
+//Usage:  testBodyScaling <path to ofreq executable> [<work directory>] [<largest body count>]
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+const int NFREQ_1 = 2;      //Wave frequencies in the first run.  The sea model needs at least two.
+const int NFREQ_2 = 11;     //Wave frequencies in the second run.
+const int NHYDRO = 3;       //Frequencies in the hydrodynamic database.
+const int NDOF = 6;         //Equations of motion for each body.
+
+//Creates a directory.  Existing directories are left as they are.
+void makeDir(string pathIn)
+{
+#ifdef _WIN32
+    _mkdir(pathIn.c_str());
+#else
+    mkdir(pathIn.c_str(), 0755);
+#endif
+}
+
+//Returns the absolute form of a path.  oFreq expects an absolute path to the run directory.
+string absPath(string pathIn)
+{
+#ifdef _WIN32
+    if ((pathIn.size() > 1) && (pathIn.at(1) == ':'))
+        return pathIn;
+    char buffer[4096];
+    if (_getcwd(buffer, sizeof(buffer)) == NULL)
+        return pathIn;
+    return string(buffer) + "\\" + pathIn;
+#else
+    if ((pathIn.size() > 0) && (pathIn.at(0) == '/'))
+        return pathIn;
+    char buffer[4096];
+    if (getcwd(buffer, sizeof(buffer)) == NULL)
+        return pathIn;
+    return string(buffer) + "/" + pathIn;
+#endif
+}
+
+//Writes the standard file header.
+void writeHeader(ofstream &fileOut, string objectIn)
+{
+    fileOut << "/*--------------------------------*- C++ -*------------------------------------*\\" << endl
+            << "| O pen         | OpenSea:  The Open Source Seakeeping Suite                    |" << endl
+            << "| S eakeeping   | Version:  1.0                                                 |" << endl
+            << "| E valuation   | Web:      www.opensea.dmsonline.us                            |" << endl
+            << "| A nalysis     |                                                               |" << endl
+            << "\\*-----------------------------------------------------------------------------*/" << endl
+            << "seafile" << endl
+            << "{" << endl
+            << "    version     1.0;" << endl
+            << "    format      ascii;" << endl
+            << "    object      " << objectIn << ";" << endl
+            << "}" << endl << endl;
+}
+
+string bodyName(int indexIn)
+{
+    return "body" + to_string(indexIn + 1);
+}
+
+//Writes one hydrodynamic matrix file, with the given value on the diagonal for every body and frequency.
+void writeHydroMatrix(string pathIn, string objectIn, int nBodyIn, double diagIn)
+{
+    ofstream fileOut(pathIn.c_str());
+    writeHeader(fileOut, objectIn);
+
+    for (int b = 0; b < nBodyIn; b++)
+    {
+        fileOut << "body {" << endl << "  name \"" << bodyName(b) << "\";" << endl;
+        for (int f = 0; f < NHYDRO; f++)
+        {
+            fileOut << "  data {" << endl << "    frequency " << f + 1 << ";" << endl << "    value (" << endl;
+            for (int i = 0; i < NDOF; i++)
+            {
+                for (int j = 0; j < NDOF; j++)
+                    fileOut << "\t" << ((i == j) ? diagIn : 0.0);
+                fileOut << endl;
+            }
+            fileOut << "    );" << endl << "  }" << endl;
+        }
+        fileOut << "}" << endl;
+    }
+}
+
+//Writes one crossbody matrix file.  The reader needs crossbody data, so each body gets a zero block linked to itself.
+//Sizes then stay linear in the body count, and the only cross-body coupling is the user force.
+void writeCrossMatrix(string pathIn, string objectIn, int nBodyIn)
+{
+    ofstream fileOut(pathIn.c_str());
+    writeHeader(fileOut, objectIn);
+
+    for (int b = 0; b < nBodyIn; b++)
+    {
+        fileOut << "body {" << endl << "  name \"" << bodyName(b) << "\";" << endl
+                << "  linkedbody {" << endl << "    name \"" << bodyName(b) << "\";" << endl;
+        for (int f = 0; f < NHYDRO; f++)
+        {
+            fileOut << "    data {" << endl << "      frequency " << f + 1 << ";" << endl << "      value (" << endl;
+            for (int i = 0; i < NDOF; i++)
+            {
+                for (int j = 0; j < NDOF; j++)
+                    fileOut << "\t" << 0.0;
+                fileOut << endl;
+            }
+            fileOut << "      );" << endl << "    }" << endl;
+        }
+        fileOut << "  }" << endl << "}" << endl;
+    }
+}
+
+//Writes the hydrodynamic database for nBodyIn bodies.
+void writeHydro(string pathIn, int nBodyIn)
+{
+    makeDir(pathIn);
+    makeDir(pathIn + "/d1");
+
+    ofstream dirOut((pathIn + "/directions.out").c_str());
+    writeHeader(dirOut, "direction");
+    dirOut << "direction (" << endl << "0.0000" << endl << ");" << endl;
+
+    ofstream freqOut((pathIn + "/frequencies.out").c_str());
+    writeHeader(freqOut, "frequency");
+    freqOut << "frequency (" << endl;
+    for (int f = 0; f < NHYDRO; f++)
+        freqOut << f + 1.0 << endl;
+    freqOut << ");" << endl;
+
+    ofstream envOut((pathIn + "/environment.out").c_str());
+    writeHeader(envOut, "hydroenv");
+    envOut << "physics {" << endl
+           << "  depth 1000.00;" << endl
+           << "  density 1025;" << endl
+           << "  gravity (" << endl << "  0.00" << endl << "  0.00" << endl << "  -9.8065" << endl << "  );" << endl
+           << "  waveamp 1.00;" << endl
+           << "}" << endl;
+
+    writeHydroMatrix(pathIn + "/d1/hydromass.out", "hydromass", nBodyIn, 0.5);
+    writeHydroMatrix(pathIn + "/d1/hydrodamp.out", "hydrodamp", nBodyIn, 0.1);
+    writeHydroMatrix(pathIn + "/d1/hydrostiffness.out", "hydrostiff", nBodyIn, 2.0);
+    writeCrossMatrix(pathIn + "/d1/crossmass.out", "crossmass", nBodyIn);
+    writeCrossMatrix(pathIn + "/d1/crossdamp.out", "crossdamp", nBodyIn);
+    writeCrossMatrix(pathIn + "/d1/crossstiffness.out", "crossstiff", nBodyIn);
+
+    ofstream exciteOut((pathIn + "/d1/forceexcite.out").c_str());
+    writeHeader(exciteOut, "forceexcite");
+    for (int b = 0; b < nBodyIn; b++)
+    {
+        exciteOut << "body {" << endl << "  name \"" << bodyName(b) << "\";" << endl;
+        for (int f = 0; f < NHYDRO; f++)
+        {
+            exciteOut << "  data {" << endl << "    frequency " << f + 1 << ";" << endl << "    value (" << endl;
+            for (int i = 0; i < NDOF; i++)
+                exciteOut << "\t1.0+0.0i" << endl;
+            exciteOut << "    );" << endl << "  }" << endl;
+        }
+        exciteOut << "}" << endl;
+    }
+}
+
+//Writes the oFreq run for nBodyIn bodies and nFreqIn wave frequencies.
+void writeRun(string pathIn, int nBodyIn, int nFreqIn)
+{
+    makeDir(pathIn);
+    makeDir(pathIn + "/constant");
+    makeDir(pathIn + "/system");
+
+    //Bodies.  Bodies are linked in pairs, so each force has a matching force on the linked body.
+    ofstream bodOut((pathIn + "/constant/bodies.in").c_str());
+    writeHeader(bodOut, "dictionary");
+    for (int b = 0; b < nBodyIn; b++)
+    {
+        bodOut << "body {" << endl
+               << "  name \"" << bodyName(b) << "\";" << endl
+               << "  hydrobody \"" << bodyName(b) << "\";" << endl
+               << "  massprop {" << endl
+               << "    mass 1.0;" << endl << "    ixx 1.0;" << endl << "    iyy 1.0;" << endl << "    izz 1.0;" << endl
+               << "  }" << endl
+               << "  centroid {" << endl
+               << "    cogx " << 10.0 * b << ";" << endl << "    cogy 0.00;" << endl << "    cogz 0.00;" << endl
+               << "  }" << endl
+               << "  motion \"6DOF\";" << endl;
+        if ((b ^ 1) < nBodyIn)
+        {
+            bodOut << "  force_crossbody {" << endl
+                   << "    model \"link\";" << endl
+                   << "    linkedbody \"" << bodyName(b ^ 1) << "\";" << endl
+                   << "  }" << endl;
+        }
+        bodOut << "}" << endl;
+    }
+
+    //Forces.  A weak spring on every variable of the linked body.
+    ofstream forceOut((pathIn + "/constant/forces.in").c_str());
+    writeHeader(forceOut, "dictionary");
+    forceOut << "force_crossbody {" << endl
+             << "  name \"link\";" << endl
+             << "  derivative {" << endl
+             << "    order 0;" << endl;
+    for (int i = 0; i < NDOF; i++)
+    {
+        forceOut << "    equation {" << endl
+                 << "      number " << i + 1 << ";" << endl
+                 << "      force (" << endl
+                 << "      " << i + 1 << ":-0.01" << endl
+                 << "      );" << endl
+                 << "    }" << endl;
+    }
+    forceOut << "  }" << endl << "}" << endl;
+
+    ofstream dataOut((pathIn + "/constant/data.in").c_str());
+    writeHeader(dataOut, "dictionary");
+    dataOut << "hydrofiles {" << endl << "  filelocation (" << endl << "  \"../ohydro1/\"" << endl
+            << "  );" << endl << "}" << endl;
+
+    ofstream seaOut((pathIn + "/constant/seaenv.in").c_str());
+    writeHeader(seaOut, "dictionary");
+    seaOut << "wave_spec {" << endl
+           << "  class \"custom\";" << endl
+           << "  name \"SpecCustom1\";" << endl
+           << "  frequency (" << endl;
+    for (int f = 0; f < NHYDRO; f++)
+        seaOut << "  " << f + 1.0 << endl;
+    seaOut << "  );" << endl << "  wave_energy (" << endl;
+    for (int f = 0; f < NHYDRO; f++)
+        seaOut << "  1.00" << endl;
+    seaOut << "  );" << endl << "}" << endl
+           << "sea_model {" << endl
+           << "  class \"custom\";" << endl
+           << "  name \"Custom Model 1\";" << endl
+           << "  wave_def {" << endl
+           << "    direction 0.000;" << endl
+           << "    spectrum \"SpecCustom1\";" << endl
+           << "    scale 1.00;" << endl
+           << "  }" << endl
+           << "}" << endl;
+
+    //Control.  Frequencies spread evenly across the hydrodynamic database.
+    ofstream contOut((pathIn + "/system/control.in").c_str());
+    writeHeader(contOut, "dictionary");
+    contOut << "system {" << endl << "  analysis \"response\";" << endl << "  frequency (" << endl;
+    for (int f = 0; f < nFreqIn; f++)
+    {
+        double freq = 1.0 + (NHYDRO - 1.0) * f / (nFreqIn - 1.0);
+        contOut << "  " << fixed << setprecision(4) << freq << endl;
+    }
+    contOut << "  );" << endl
+            << "  direction (" << endl << "  0.0000" << endl << "  );" << endl
+            << "  seamodel \"Custom Model 1\";" << endl
+            << "}" << endl;
+
+    //Outputs.  Only one report, so writing results does not hide the solver time.
+    ofstream outOut((pathIn + "/system/outputs.in").c_str());
+    writeHeader(outOut, "dictionary");
+    outOut << "repBodyMotion {" << endl
+           << "  name \"Motion 1\";" << endl
+           << "  body \"" << bodyName(0) << "\";" << endl
+           << "}" << endl;
+}
+
+//Runs ofreq on the run directory and returns the wall clock time in seconds, or a negative value on failure.
+double timeRun(string execIn, string pathIn)
+{
+    //Stored solutions would skip the solver.
+    remove((pathIn + "/ofreq.ckpt").c_str());
+
+#ifdef _WIN32
+    string command = "\"\"" + execIn + "\" \"" + pathIn + "\" > NUL\"";
+#else
+    string command = "\"" + execIn + "\" \"" + pathIn + "\" > /dev/null";
+#endif
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int status = system(command.c_str());
+    chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+
+    if (status != 0)
+        return -1.0;
+
+    return chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        cout << "Usage:  testBodyScaling <path to ofreq executable> [<work directory>] [<largest body count>]"
+             << endl;
+        return 1;
+    }
+
+    string exec = argv[1];
+    string work = absPath((argc > 2) ? argv[2] : "bodyscaling");
+    int nMax = (argc > 3) ? atoi(argv[3]) : 1000;
+    int sizes[] = {10, 20, 50, 100, 200, 500, 1000};
+    int nFail = 0;
+
+    makeDir(work);
+
+    cout << setw(8) << "bodies" << setw(14) << "setup [s]" << setw(16) << "per freq [s]"
+         << setw(18) << "setup / body" << setw(18) << "freq / body" << endl;
+
+    for (unsigned int s = 0; s < sizeof(sizes) / sizeof(int); s++)
+    {
+        int n = sizes[s];
+        if (n > nMax)
+            break;
+
+        string casePath = work + "/bodies" + to_string(n);
+        makeDir(casePath);
+        writeHydro(casePath + "/ohydro1", n);
+
+        writeRun(casePath + "/ofreq1", n, NFREQ_1);
+        double time1 = timeRun(exec, casePath + "/ofreq1");
+
+        writeRun(casePath + "/ofreq2", n, NFREQ_2);
+        double time2 = timeRun(exec, casePath + "/ofreq2");
+
+        if ((time1 < 0) || (time2 < 0))
+        {
+            nFail += 1;
+            cout << setw(8) << n << "  ofreq failed.  See " << casePath << ((time1 < 0) ? "/ofreq1" : "/ofreq2")
+                 << "/error.log" << endl;
+            continue;
+        }
+
+        double perFreq = (time2 - time1) / (NFREQ_2 - NFREQ_1);
+        double setup = time1 - NFREQ_1 * perFreq;
+
+        cout << setw(8) << n << scientific << setprecision(3)
+             << setw(14) << setup << setw(16) << perFreq
+             << setw(18) << setup / n << setw(18) << perFreq / n << endl;
+        cout.unsetf(ios::floatfield);
+    }
+
+    return nFail;
+}
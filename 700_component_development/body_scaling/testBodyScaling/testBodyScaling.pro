@@ -0,0 +1,18 @@
+#-------------------------------------------------
+#
+# Scaling benchmark for large body counts.  Generates oFreq runs with
+# 10 to 1000 bodies and times the ofreq executable on each.
+#
+#-------------------------------------------------
+
+QT       -= core gui
+
+TARGET = testBodyScaling
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+QMAKE_CXXFLAGS += -std=c++11
+
+SOURCES += main.cpp
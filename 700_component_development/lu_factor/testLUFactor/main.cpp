@@ -0,0 +1,157 @@
+//Test of the LUFactor object.
+//Factors random complex symmetric matrices and checks solve() and solveTrans() against a direct solve with
+//arma::solve().  The matrices have a zero diagonal, so the symmetric indefinite factorization must use 2x2 pivots.
+//Each test also solves for several right hand sides at once.  Returns the number of failed tests.
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "motion_solver/lufactor.h"
+
+using namespace osea::ofreq;
+using namespace arma;
+using namespace std;
+
+//Packed symmetric factorization.  Same declaration as lufactor.cpp.
+#if defined(ARMA_BLAS_CAPITALS)
+    #define osea_zsptrf ZSPTRF
+#else
+    #define osea_zsptrf zsptrf
+#endif
+
+extern "C"
+{
+    void arma_fortran_noprefix(osea_zsptrf)(char* uplo, blas_int* n, void* ap, blas_int* ipiv, blas_int* info);
+}
+
+int nFail = 0;      //Number of failed tests.
+
+//Relative difference between two solutions.
+double relErr(const cx_mat &valIn, const cx_mat &refIn)
+{
+    return norm(valIn - refIn, "fro") / norm(refIn, "fro");
+}
+
+//Counts the 2x2 pivot blocks zsptrf picks for the matrix.  Same call and storage as LUFactor::factorSym().
+int count2x2(const cx_mat &matIn)
+{
+    blas_int n = matIn.n_rows;
+    blas_int info = 0;
+    char uplo = 'L';
+    vector<blas_int> listPivot(n, 0);
+
+    //Lower triangle, one column after the other.
+    cx_vec packed(n * (n + 1) / 2);
+    int ind = 0;
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = j; i < n; i++)
+            packed(ind++) = matIn(i,j);
+    }
+
+    arma_fortran_noprefix(osea_zsptrf)(&uplo, &n, packed.memptr(), &listPivot[0], &info);
+
+    //A 2x2 block has two negative entries.
+    int out = 0;
+    for (int k = 0; k < n; k++)
+    {
+        if (listPivot.at(k) < 0)
+            out += 1;
+    }
+    return out / 2;
+}
+
+//Checks one value and prints the result.
+void check(string nameIn, double errIn, double tolIn)
+{
+    bool pass = (errIn <= tolIn);
+    if (!pass)
+        nFail += 1;
+
+    cout << (pass ? "PASS  " : "FAIL  ") << nameIn << "  error = " << errIn << endl;
+}
+
+int main()
+{
+    const double TOL = 1.0e-9;  //Allowed relative difference against arma::solve().
+    int sizes[] = {2, 3, 4, 7, 12, 31, 64, 150};
+    int rhs[] = {1, 3, 6};
+
+    srand(1234);
+
+    //Complex symmetric matrices.
+    //---------------------------------------------------------------------------
+    for (unsigned int s = 0; s < sizeof(sizes) / sizeof(int); s++)
+    {
+        for (int trial = 0; trial < 4; trial++)
+        {
+            int n = sizes[s];
+            int nRhs = rhs[(s + trial) % 3];
+
+            cx_mat A = randn<cx_mat>(n, n);
+            A = A + strans(A);
+
+            //A zero diagonal forces 2x2 pivots.  Every other trial only zeroes part of it, to mix 1x1 and 2x2 blocks.
+            for (int i = 0; i < n; i += ((trial % 2 == 0) ? 1 : 2))
+                A(i,i) = 0;
+
+            //Skip matrices too close to singular for a fair comparison.
+            vec sv = svd(A);
+            if (sv.min() < 1.0e-8 * sv.max())
+                continue;
+
+            cx_mat B = randn<cx_mat>(n, nRhs);
+            string name = "n = " + to_string(n) + ", rhs = " + to_string(nRhs) + ", trial " + to_string(trial);
+
+            LUFactor factor;
+            factor.factor(A);
+
+            if (!factor.isSymmetric())
+            {
+                nFail += 1;
+                cout << "FAIL  " << name << "  symmetric factorization not used" << endl;
+                continue;
+            }
+
+            if ((trial % 2 == 0) && (count2x2(A) == 0))
+            {
+                nFail += 1;
+                cout << "FAIL  " << name << "  no 2x2 pivots" << endl;
+                continue;
+            }
+
+            check(name + "  solve", relErr(factor.solve(B), arma::solve(A, B)), TOL);
+            check(name + "  solveTrans", relErr(factor.solveTrans(B), arma::solve(strans(A), B)), TOL);
+
+            //The factors must be reusable for a second right hand side.
+            cx_mat B2 = randn<cx_mat>(n, 1);
+            check(name + "  reuse", relErr(factor.solve(B2), arma::solve(A, B2)), TOL);
+        }
+    }
+
+    //Nonsymmetric matrices use the LU factors.
+    //---------------------------------------------------------------------------
+    for (unsigned int s = 0; s < sizeof(sizes) / sizeof(int); s++)
+    {
+        int n = sizes[s];
+        cx_mat A = randn<cx_mat>(n, n);
+        cx_mat B = randn<cx_mat>(n, 3);
+        string name = "nonsymmetric n = " + to_string(n);
+
+        LUFactor factor;
+        factor.factor(A);
+
+        if (factor.isSymmetric())
+        {
+            nFail += 1;
+            cout << "FAIL  " << name << "  symmetric factorization used" << endl;
+            continue;
+        }
+
+        check(name + "  solve", relErr(factor.solve(B), arma::solve(A, B)), TOL);
+        check(name + "  solveTrans", relErr(factor.solveTrans(B), arma::solve(strans(A), B)), TOL);
+    }
+
+    cout << endl << nFail << " tests failed." << endl;
+
+    return nFail;
+}
@@ -0,0 +1,45 @@
+#-------------------------------------------------
+#
+# Test of the LUFactor object.  Compares the stored factors against a direct
+# solve of the same system.
+#
+#-------------------------------------------------
+
+QT       += core
+
+QT       -= gui
+
+TARGET = testLUFactor
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+QMAKE_CXXFLAGS += -std=c++11
+
+SOURCES += main.cpp \
+    $$PWD/../../../200_src/bin/ofreq/motion_solver/lufactor.cpp \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/ofreqcore.cpp \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/log.cpp
+
+HEADERS += \
+    $$PWD/../../../200_src/bin/ofreq/motion_solver/lufactor.h \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/ofreqcore.h \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/log.h
+
+INCLUDEPATH += $$PWD/../../../200_src/bin/ofreq
+
+# Platform Specific files go in these scope brackets
+# ========================================================
+win32 {
+    # Any files specific to windows go in these brackets.
+    LIBS += \
+        $$PWD/../../../200_src/lib/armadillo.h \        #Add armadillo and associated support
+        $$PWD/../../../200_src/lib/blas_win32_MT.lib \
+        $$PWD/../../../200_src/lib/lapack_win32_MT.lib
+}
+
+unix {
+    # Any files specific to linux go in these brackets.
+    LIBS += -larmadillo -llapack -lblas #Add armadillo and associated support
+}
@@ -0,0 +1,175 @@
+//Test of the ReportWriter object.
+//Writes integers, doubles, and complex numbers with the ReportWriter and compares each against the text the report
+//manager created before, with QTextStream in scientific notation.  The old functions are copied below from
+//ReportManager::Val2String() and ReportManager::TAB().  Returns the number of failed tests.
+#include <QString>
+#include <QTextStream>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <cstdio>
+#include "reports/reportwriter.h"
+
+using namespace osea::ofreq;
+using namespace std;
+
+//######################################### Class Separator ###########################################################
+//The formatting used by ReportManager before the ReportWriter.
+class OldFormat : public ioword
+{
+public:
+    QString Val2String(int valIn)
+    {
+        //Convert to QString
+        return a2Qstr(itoa(valIn));
+    }
+
+    QString Val2String(double valIn)
+    {
+        QString output;
+        QTextStream convert;
+        convert.setString(&output);
+        convert.setRealNumberNotation(QTextStream::ScientificNotation);
+        convert << valIn;
+
+        //Write output.
+        return output;
+    }
+
+    QString Val2String(std::complex<double> valIn)
+    {
+        QString output;
+        QTextStream convert;
+        convert.setString(&output);
+        convert.setRealNumberNotation(QTextStream::ScientificNotation);
+
+        //Create opening brackets
+        convert << a2Qstr(LIST_BEGIN);
+
+        //Enter real number
+        convert << valIn.real();
+
+        //Enter separation mark
+        convert << a2Qstr(COMPLEX_COORD);
+
+        //Enter imaginary part
+        convert << valIn.imag();
+
+        //Enter closing brackets
+        convert << a2Qstr(LIST_END);
+
+        //Write output
+        return output;
+    }
+
+    QString TAB(int num = 1)
+    {
+        string output;  //Output string
+        for (int i = 0; i < num; i++)
+            output.append(TAB_REF);
+
+        //Write output
+        return a2Qstr(output);
+    }
+
+    QString a2Qstr(std::string valIn)
+    {
+        return QString::fromStdString(valIn);
+    }
+};
+
+//######################################### Class Separator ###########################################################
+int nFail = 0;      //Number of failed tests.
+string FILENAME = "testReportWriter.out";
+
+//Reads back the file written by the ReportWriter.
+string readBack()
+{
+    ifstream fileIn(FILENAME.c_str(), ios::binary);
+    stringstream out;
+    out << fileIn.rdbuf();
+    return out.str();
+}
+
+//Compares one value and prints the result.
+void check(string nameIn, string valIn, string refIn)
+{
+    bool pass = (valIn == refIn);
+    if (!pass)
+        nFail += 1;
+
+    cout << (pass ? "PASS  " : "FAIL  ") << nameIn << "  \"" << valIn << "\"";
+    if (!pass)
+        cout << "  expected \"" << refIn << "\"";
+    cout << endl;
+}
+
+//Writes one value with the ReportWriter and returns the text.
+template <class T>
+string writeOne(T valIn)
+{
+    //The ReportWriter appends, so start from an empty file.
+    remove(FILENAME.c_str());
+    ReportWriter writer;
+    writer.open(FILENAME);
+    writer.writeValue(valIn);
+    writer.close();
+    return readBack();
+}
+
+int main()
+{
+    OldFormat old;
+    double inf = numeric_limits<double>::infinity();
+    double nan = numeric_limits<double>::quiet_NaN();
+    double denorm = numeric_limits<double>::denorm_min();
+
+    //Integers.
+    //---------------------------------------------------------------------------
+    int listInt[] = {0, 1, -1, 7, 42, -12345, numeric_limits<int>::max(), numeric_limits<int>::min()};
+    for (unsigned int i = 0; i < sizeof(listInt) / sizeof(int); i++)
+        check("int " + to_string(listInt[i]), writeOne(listInt[i]), old.Val2String(listInt[i]).toStdString());
+
+    //Doubles.
+    //---------------------------------------------------------------------------
+    double listDouble[] = {0.0, -0.0, 1.0, -1.0, 0.5, 1.0 / 3.0, -2.5e10, 9.9999995e5, 9.9999995e-5, 1.23456789e-300,
+                           numeric_limits<double>::min(), denorm, -denorm, 4.5e-310,
+                           numeric_limits<double>::max(), -numeric_limits<double>::max(), nan, -nan, inf, -inf};
+    for (unsigned int i = 0; i < sizeof(listDouble) / sizeof(double); i++)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "double %.17g", listDouble[i]);
+        check(name, writeOne(listDouble[i]), old.Val2String(listDouble[i]).toStdString());
+    }
+
+    //Complex numbers.
+    //---------------------------------------------------------------------------
+    complex<double> listComplex[] = {complex<double>(0.0, 0.0), complex<double>(-1.0, 0.0),
+                                     complex<double>(0.0, -0.0), complex<double>(1.5e-3, -2.25e4),
+                                     complex<double>(denorm, -denorm), complex<double>(nan, inf),
+                                     complex<double>(-inf, nan)};
+    for (unsigned int i = 0; i < sizeof(listComplex) / sizeof(complex<double>); i++)
+    {
+        char name[96];
+        snprintf(name, sizeof(name), "complex (%.17g, %.17g)", listComplex[i].real(), listComplex[i].imag());
+        check(name, writeOne(listComplex[i]), old.Val2String(listComplex[i]).toStdString());
+    }
+
+    //Tabs.
+    //---------------------------------------------------------------------------
+    for (int n = 0; n < 5; n++)
+    {
+        remove(FILENAME.c_str());
+        ReportWriter writer;
+        writer.open(FILENAME);
+        writer.writeTab(n);
+        writer.close();
+        check("tab " + to_string(n), readBack(), old.TAB(n).toStdString());
+    }
+
+    remove(FILENAME.c_str());
+    cout << endl << nFail << " tests failed." << endl;
+
+    return nFail;
+}
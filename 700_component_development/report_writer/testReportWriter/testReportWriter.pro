@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Test of the ReportWriter object.  Compares its output against the QTextStream
+# formatting the report manager used before.
+#
+#-------------------------------------------------
+
+QT       += core
+
+QT       -= gui
+
+TARGET = testReportWriter
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+QMAKE_CXXFLAGS += -std=c++11
+
+SOURCES += main.cpp \
+    $$PWD/../../../200_src/bin/ofreq/reports/reportwriter.cpp \
+    $$PWD/../../../200_src/bin/ofreq/global_objects/ioword.cpp \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/ofreqcore.cpp \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/log.cpp
+
+HEADERS += \
+    $$PWD/../../../200_src/bin/ofreq/reports/reportwriter.h \
+    $$PWD/../../../200_src/bin/ofreq/global_objects/ioword.h \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/ofreqcore.h \
+    $$PWD/../../../200_src/bin/ofreq/system_objects/log.h
+
+INCLUDEPATH += $$PWD/../../../200_src/bin/ofreq
+